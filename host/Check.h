@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdio.h>
+
+namespace host {
+
+/**
+ * Tally for the thn_check_* programs. Failures go to stderr, the first ten
+ * of them only, so one broken invariant does not bury the rest; finish()
+ * prints the summary line and gives the exit code.
+ */
+class Checker {
+ public:
+  unsigned long checks() const { return checks_; }
+  unsigned long failures() const { return failures_; }
+
+  void expect(bool ok, const char *what, long detail = 0) {
+    ++checks_;
+    if (!ok && failures_++ < kMaxReported) {
+      fprintf(stderr, "%s (%ld)\n", what, detail);
+    }
+  }
+
+  /** Prints "<name> N checks, M failures"; returns the exit code for main(). */
+  int finish(const char *name) const {
+    printf("%-20s%lu checks, %lu failures\n", name, checks_, failures_);
+    return failures_ == 0 ? 0 : 1;
+  }
+
+ private:
+  static constexpr unsigned long kMaxReported = 10;
+
+  unsigned long checks_ = 0;
+  unsigned long failures_ = 0;
+};
+
+}  // namespace host
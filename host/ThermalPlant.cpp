@@ -0,0 +1,87 @@
+#include "ThermalPlant.h"
+
+namespace host {
+
+namespace {
+
+constexpr float kSecondsPerDay = 24.0f * 60.0f * 60.0f;
+constexpr unsigned long kMaxIntegrationStepMs = 1000;
+
+// Share of the high-speed coil conductance at each fan speed; with the fan
+// off only natural convection moves heat between the coil and the room.
+float fanTransferFraction(controller::FanSpeed speed) {
+  switch (speed) {
+    case controller::FanSpeed::kLow:
+      return 0.55f;
+    case controller::FanSpeed::kMedium:
+      return 0.75f;
+    case controller::FanSpeed::kHigh:
+      return 1.0f;
+    case controller::FanSpeed::kOff:
+      break;
+  }
+  return 0.1f;
+}
+
+}  // namespace
+
+ThermalPlant *ThermalPlant::connected_ = nullptr;
+
+ThermalPlant::ThermalPlant(const Config &config)
+    : config_(config), roomC_(config.initialRoomC), coilC_(config.initialRoomC) {}
+
+void ThermalPlant::connect(controller::SensorManager &sensors) {
+  connected_ = this;
+  sensors.setAmbientReader(readAmbient);
+  sensors.setCoilReader(readCoil);
+}
+
+float ThermalPlant::outdoorTemperature() const {
+  float secondOfDay = static_cast<float>(VirtualClock::epoch() % static_cast<time_t>(kSecondsPerDay));
+  float phase = (secondOfDay / 3600.0f - config_.outdoorPeakHour) / 24.0f;
+  return config_.outdoorMeanC + config_.outdoorSwingC * cosf(phase * 2.0f * static_cast<float>(M_PI));
+}
+
+void ThermalPlant::step(unsigned long elapsedMs,
+                        bool compressorRunning,
+                        controller::FanSpeed fanSpeed,
+                        controller::SystemMode mode) {
+  float outdoor = outdoorTemperature();
+  float transfer = config_.coilTransferWPerK * fanTransferFraction(fanSpeed);
+  float coilHeatCapacity = config_.coilTransferWPerK * config_.coilTimeConstantS;
+  float pumped = 0.0f;
+  if (compressorRunning) {
+    pumped = mode == controller::SystemMode::kHeating ? config_.compressorCapacityW
+                                                      : -config_.compressorCapacityW;
+  }
+
+  while (elapsedMs > 0) {
+    unsigned long stepMs = elapsedMs < kMaxIntegrationStepMs ? elapsedMs : kMaxIntegrationStepMs;
+    elapsedMs -= stepMs;
+    float seconds = static_cast<float>(stepMs) / 1000.0f;
+
+    float coilExchange = transfer * (roomC_ - coilC_);
+    float roomGain = config_.envelopeWPerK * (outdoor - roomC_) + config_.heatLoadW - coilExchange;
+    roomC_ += roomGain * seconds / config_.roomHeatCapacityJPerK;
+    coilC_ += (coilExchange + pumped) * seconds / coilHeatCapacity;
+  }
+}
+
+float ThermalPlant::quantize(float value) const {
+  if (config_.sensorResolutionC <= 0.0f) {
+    return value;
+  }
+  return roundf(value / config_.sensorResolutionC) * config_.sensorResolutionC;
+}
+
+units::CentiCelsius ThermalPlant::readAmbient() {
+  return connected_ != nullptr ? units::fromCelsius(connected_->quantize(connected_->roomC_))
+                               : units::kNoTemperature;
+}
+
+units::CentiCelsius ThermalPlant::readCoil() {
+  return connected_ != nullptr ? units::fromCelsius(connected_->quantize(connected_->coilC_))
+                               : units::kNoTemperature;
+}
+
+}  // namespace host
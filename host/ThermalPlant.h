@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "FanController.h"
+#include "HVACController.h"
+#include "SensorManager.h"
+
+namespace host {
+
+/**
+ * Lumped two-node thermal model of a room and the unit's indoor coil.
+ *
+ * The room exchanges heat with the outdoors through the envelope and gains a
+ * constant internal load; the coil exchanges heat with the room at a rate
+ * set by the fan speed and is pumped by the compressor (heat removed while
+ * cooling, added while heating). Both probes are quantized like a 12-bit
+ * DS18B20 and reach SensorManager through its TemperatureReader hooks.
+ */
+class ThermalPlant {
+ public:
+  struct Config {
+    float outdoorMeanC = 30.0f;
+    float outdoorSwingC = 5.0f;       // Half the peak-to-trough daily swing.
+    float outdoorPeakHour = 15.0f;    // UTC hour of the daily peak.
+    float envelopeWPerK = 60.0f;
+    float heatLoadW = 300.0f;         // People, equipment, sun through windows.
+    float roomHeatCapacityJPerK = 600000.0f;
+    float compressorCapacityW = 2600.0f;
+    float coilTimeConstantS = 20.0f;  // At high fan speed.
+    float coilTransferWPerK = 300.0f; // Room-to-coil conductance at high fan speed.
+    float initialRoomC = 27.0f;
+    float sensorResolutionC = 0.0625f;
+  };
+
+  explicit ThermalPlant(const Config &config);
+
+  /** Routes the sensor manager's ambient and coil readers to this plant. */
+  void connect(controller::SensorManager &sensors);
+
+  /** Integrates the model over `elapsedMs` with the given relay state. */
+  void step(unsigned long elapsedMs,
+            bool compressorRunning,
+            controller::FanSpeed fanSpeed,
+            controller::SystemMode mode);
+
+  float roomTemperature() const { return roomC_; }
+  float coilTemperature() const { return coilC_; }
+  float outdoorTemperature() const;
+  const Config &config() const { return config_; }
+
+ private:
+  static units::CentiCelsius readAmbient();
+  static units::CentiCelsius readCoil();
+  float quantize(float value) const;
+
+  static ThermalPlant *connected_;
+
+  Config config_;
+  float roomC_;
+  float coilC_;
+};
+
+}  // namespace host
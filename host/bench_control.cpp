@@ -0,0 +1,163 @@
+// Times HVACController::update() on the host: the control tick (sensor read,
+// hysteresis and fan decisions, temperature/power logging) and the pass
+// between ticks. Sensor readings replay a precomputed trace that swings
+// through the hysteresis band, so the compressor and fan keep switching.
+//
+//   thn_bench [--ticks N] [--rounds N]
+//
+// Host timings only compare builds against each other; the ESP8266 has no
+// FPU, so anything float costs it far more than it does here.
+
+#include <Arduino.h>
+
+#include <math.h>
+
+#include <algorithm>
+#include <chrono>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "HVACController.h"
+#include "PowerLog.h"
+#include "ScheduleManager.h"
+#include "SensorManager.h"
+#include "TemperatureLog.h"
+
+using controller::Compressor;
+using controller::FanController;
+using controller::FanMode;
+using controller::HVACController;
+using controller::SensorManager;
+using controller::SystemMode;
+
+namespace {
+
+// Whatever the sensor readers hand to SensorManager.
+using Reading = decltype(std::declval<controller::TemperatureReader>()());
+
+constexpr size_t kTraceLength = 4096;
+constexpr unsigned long kControlIntervalMs = 1000;
+constexpr unsigned long kIdleStepMs = 10;
+
+std::vector<Reading> ambientTrace;
+std::vector<Reading> coilTrace;
+size_t traceIndex = 0;
+
+Reading toReading(float celsius) {
+  if constexpr (std::is_floating_point<Reading>::value) {
+    return celsius;
+  } else {
+    return static_cast<Reading>(lroundf(celsius * 100.0f));
+  }
+}
+
+void buildTrace() {
+  ambientTrace.clear();
+  coilTrace.clear();
+  for (size_t i = 0; i < kTraceLength; ++i) {
+    float phase = 2.0f * static_cast<float>(M_PI) * static_cast<float>(i) / 600.0f;
+    // 23 C target with a 1 C band: the room wanders 1.5 C either side of it.
+    float ambient = 23.0f + 1.5f * sinf(phase) + 0.0625f * static_cast<float>(i % 3);
+    float coil = ambient - 6.0f - 4.0f * cosf(phase);
+    ambientTrace.push_back(toReading(ambient));
+    coilTrace.push_back(toReading(coil));
+  }
+}
+
+Reading readAmbient() { return ambientTrace[traceIndex % kTraceLength]; }
+Reading readCoil() { return coilTrace[traceIndex++ % kTraceLength]; }
+
+struct Options {
+  unsigned long ticks = 200000;
+  unsigned rounds = 5;
+};
+
+bool parseOptions(int argc, char **argv, Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    String arg(argv[i]);
+    if (i + 1 >= argc) {
+      printf("missing value for %s\n", argv[i]);
+      return false;
+    }
+    long value = atol(argv[++i]);
+    if (value <= 0) {
+      printf("invalid value for %s\n", arg.c_str());
+      return false;
+    }
+    if (arg == "--ticks") {
+      options.ticks = static_cast<unsigned long>(value);
+    } else if (arg == "--rounds") {
+      options.rounds = static_cast<unsigned>(value);
+    } else {
+      printf("unknown option %s\n", arg.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+// Best of `rounds`, in nanoseconds per update() call.
+template <typename Step>
+double timeUpdates(HVACController &hvac, const Options &options, Step step) {
+  double best = 0.0;
+  for (unsigned round = 0; round < options.rounds; ++round) {
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < options.ticks; ++i) {
+      step();
+      hvac.update();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double ns = std::chrono::duration<double, std::nano>(elapsed).count() /
+                static_cast<double>(options.ticks);
+    best = round == 0 ? ns : std::min(best, ns);
+  }
+  return best;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    return 2;
+  }
+
+  host::VirtualClock::reset();
+  buildTrace();
+
+  static Compressor compressor(16);
+  static FanController fan({5, 14, 12});
+  static SensorManager sensors;
+  static scheduler::ScheduleManager scheduleManager;
+  static logging::TemperatureLog temperatureLog;
+  static logging::PowerLog powerLog;
+  static HVACController hvac(compressor, fan, sensors, scheduleManager, temperatureLog, powerLog);
+
+  sensors.setAmbientReader(readAmbient);
+  sensors.setCoilReader(readCoil);
+  hvac.setSystemMode(SystemMode::kCooling);
+  hvac.setFanMode(FanMode::kAuto);
+  hvac.begin();
+
+  unsigned long starts = 0;
+  bool wasRunning = hvac.compressorRunning();
+  double controlNs = timeUpdates(hvac, options, [&]() {
+    host::VirtualClock::advance(kControlIntervalMs);
+    bool running = hvac.compressorRunning();
+    if (running && !wasRunning) {
+      ++starts;
+    }
+    wasRunning = running;
+  });
+  double idleNs = timeUpdates(hvac, options, []() { host::VirtualClock::advance(kIdleStepMs); });
+
+  printf("reading type      %s, %zu bytes\n",
+         std::is_floating_point<Reading>::value ? "float" : "fixed-point", sizeof(Reading));
+  printf("temperature log   %zu bytes for %zu minute rows\n", sizeof(logging::TemperatureLog),
+         logging::TemperatureLog::kMaxEntries);
+  printf("control tick      %.1f ns/update (%lu ticks x %u rounds, %lu compressor starts)\n",
+         controlNs, options.ticks, options.rounds, starts);
+  printf("between ticks     %.1f ns/update\n", idleNs);
+  return 0;
+}
@@ -0,0 +1,226 @@
+// Measures what serving one response costs the firmware: heap calls made
+// while it is built and sent, the heap it holds at most, and how it reaches
+// the socket. Each endpoint is fetched once by a peer that drains everything
+// after every handleClient() pass and once by one that reads only
+// --slow-read-bytes per pass, after --history-hours of simulated history.
+//
+//   thn_bench_responses [--history-hours N] [--slow-read-bytes N]
+//
+// Heap counts come from wrapping the host C library's allocator (glibc only)
+// and leave out the socket and file shims. The shim String is a std::string
+// with a small-string buffer, so short Strings allocate less often than the
+// device's. Response bytes are copied from the writer's buffer into a
+// HttpServer block and from there into the socket, so "to socket" matches
+// the body plus headers; a larger figure means something was sent twice.
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "HVACController.h"
+#include "PowerLog.h"
+#include "ScheduleManager.h"
+#include "SensorManager.h"
+#include "TemperatureLog.h"
+#include "ThermalPlant.h"
+#include "WebInterface.h"
+
+using controller::Compressor;
+using controller::FanController;
+using controller::FanMode;
+using controller::FanSpeed;
+using controller::HVACController;
+using controller::SensorManager;
+using controller::SystemMode;
+using logging::PowerLog;
+using logging::TemperatureLog;
+using scheduler::ScheduleManager;
+
+namespace {
+
+// Monday 2024-01-01 00:00 UTC, as in thn_sim.
+constexpr time_t kEpochAtBoot = 1704067200;
+constexpr uint16_t kPort = 80;
+constexpr unsigned long kStepMs = 1000;
+constexpr unsigned long kMaxPasses = 100000;
+
+constexpr uint8_t kCompressorRelayPin = 16;
+constexpr FanController::Pins kFanPins = {5, 14, 12};
+
+const PowerLog::ConsumptionRate kConsumptionTable[] = {
+    {FanSpeed::kOff, false, 5.0f},   {FanSpeed::kLow, false, 110.0f},
+    {FanSpeed::kMedium, false, 125.0f}, {FanSpeed::kHigh, false, 140.0f},
+    {FanSpeed::kLow, true, 600.0f}, {FanSpeed::kMedium, true, 650.0f},
+    {FanSpeed::kHigh, true, 700.0f},
+};
+
+struct Options {
+  unsigned long historyHours = 24;
+  size_t slowReadBytes = 256;
+};
+
+struct Fetch {
+  int code = 0;
+  std::string body;
+  size_t received = 0;     // Headers and body.
+  size_t writes = 0;       // WiFiClient::write() calls.
+  unsigned long passes = 0;
+  double micros = 0.0;     // Host time in handleClient().
+  host::HeapStats heap;
+};
+
+bool parseOptions(int argc, char **argv, Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    if (i + 1 >= argc) {
+      return false;
+    }
+    unsigned long value = strtoul(argv[i + 1], nullptr, 10);
+    if (strcmp(argv[i], "--history-hours") == 0) {
+      options.historyHours = value;
+    } else if (strcmp(argv[i], "--slow-read-bytes") == 0) {
+      options.slowReadBytes = value;
+    } else {
+      return false;
+    }
+    ++i;
+  }
+  return options.slowReadBytes > 0;
+}
+
+/** Value of a top-level integer field in a JSON body, e.g. "seq"; 0 when absent. */
+unsigned long jsonNumber(const std::string &body, const char *name) {
+  std::string key = std::string("\"") + name + "\":";
+  size_t position = body.find(key);
+  if (position == std::string::npos) {
+    return 0;
+  }
+  return strtoul(body.c_str() + position + key.size(), nullptr, 10);
+}
+
+/** Fetches `path`, reading at most `readBytes` per pass (0 reads everything). */
+Fetch fetch(interface::WebInterface &web, const std::string &path, size_t readBytes) {
+  Fetch result;
+  std::shared_ptr<host::TcpSocket> socket = host::connect(kPort);
+  std::string request = "GET " + path + " HTTP/1.1\r\nHost: thn\r\n\r\n";
+  socket->toServer.insert(socket->toServer.end(), request.begin(), request.end());
+
+  std::string response;
+  host::startHeapCount();
+  while (!(socket->serverClosed && socket->toPeer.empty()) && result.passes < kMaxPasses) {
+    host::VirtualClock::advance(1);
+    auto start = std::chrono::steady_clock::now();
+    web.handleClient();
+    result.micros +=
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+            .count();
+    ++result.passes;
+    host::ShimHeapScope peer;
+    std::deque<uint8_t> &incoming = socket->toPeer;
+    size_t count = readBytes == 0 ? incoming.size() : std::min(readBytes, incoming.size());
+    response.append(incoming.begin(), incoming.begin() + static_cast<long>(count));
+    incoming.erase(incoming.begin(), incoming.begin() + static_cast<long>(count));
+  }
+  result.heap = host::stopHeapCount();
+  socket->peerClosed = true;
+
+  result.writes = socket->writes;
+  result.received = response.size();
+  if (response.compare(0, 9, "HTTP/1.1 ") == 0) {
+    result.code = atoi(response.c_str() + 9);
+  }
+  size_t body = response.find("\r\n\r\n");
+  if (body != std::string::npos) {
+    result.body = response.substr(body + 4);
+  }
+  return result;
+}
+
+void report(const char *name, const char *reader, const Fetch &fetch) {
+  printf("%-28s %-5s %3d %7zu %7zu %6zu %6lu %6lu %8zu %7zu %8.0f\n", name, reader, fetch.code,
+         fetch.body.size(), fetch.received, fetch.writes, fetch.passes, fetch.heap.allocations,
+         fetch.heap.allocatedBytes, fetch.heap.peakBytes, fetch.micros);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    fprintf(stderr, "usage: %s [--history-hours N] [--slow-read-bytes N]\n", argv[0]);
+    return 2;
+  }
+
+  host::VirtualClock::reset();
+  host::VirtualClock::setEpochAtBoot(kEpochAtBoot);
+  host::formatFileSystem();
+
+  static Compressor compressor(kCompressorRelayPin);
+  static FanController fan(kFanPins);
+  static SensorManager sensors;
+  static ScheduleManager scheduleManager;
+  static TemperatureLog temperatureLog;
+  static PowerLog powerLog;
+  static HVACController hvac(compressor, fan, sensors, scheduleManager, temperatureLog, powerLog);
+  static interface::WebInterface webInterface(hvac, scheduleManager, temperatureLog, powerLog,
+                                              nullptr, kPort);
+
+  static host::ThermalPlant plant(host::ThermalPlant::Config{});
+  plant.connect(sensors);
+  powerLog.setConsumptionTable(kConsumptionTable,
+                               sizeof(kConsumptionTable) / sizeof(kConsumptionTable[0]));
+  hvac.setSystemMode(SystemMode::kCooling);
+  hvac.setFanMode(FanMode::kAuto);
+  hvac.begin();
+  auto runFor = [&](unsigned long ms) {
+    for (unsigned long elapsed = 0; elapsed < ms; elapsed += kStepMs) {
+      host::VirtualClock::advance(kStepMs);
+      plant.step(kStepMs, hvac.compressorRunning(), fan.currentSpeed(), hvac.systemMode());
+      hvac.update();
+    }
+  };
+  runFor(options.historyHours * 3600000UL);
+  webInterface.begin();
+
+  if (!host::heapCountAvailable()) {
+    printf("heap counts are not available with this C library\n");
+  }
+  printf("%-28s %-5s %3s %7s %7s %6s %6s %6s %8s %7s %8s\n", "response", "peer", "", "body",
+         "socket", "writes", "passes", "allocs", "alloc B", "peak B", "host us");
+
+  bool ok = true;
+  Fetch state;
+  const struct {
+    const char *name;
+    const char *path;
+  } kEndpoints[] = {
+      {"state", "/api/state"},
+      {"power-log", "/api/power-log"},
+      {"power-log bin", "/api/power-log?format=bin"},
+      {"power-log hourly", "/api/power-log?resolution=3600"},
+      {"temperature-history", "/api/temperature-history"},
+      {"temperature-history bin", "/api/temperature-history?format=bin"},
+  };
+  for (const auto &endpoint : kEndpoints) {
+    Fetch fast = fetch(webInterface, endpoint.path, 0);
+    Fetch slow = fetch(webInterface, endpoint.path, options.slowReadBytes);
+    report(endpoint.name, "fast", fast);
+    report(endpoint.name, "slow", slow);
+    ok = ok && fast.code == 200 && slow.code == 200 && fast.body == slow.body;
+    if (strcmp(endpoint.path, "/api/state") == 0) {
+      state = fast;
+    }
+  }
+
+  // A dashboard that polls with its cursor a minute later gets only the new rows.
+  runFor(60000UL);
+  char path[64];
+  snprintf(path, sizeof(path), "/api/state?boot=%lu&since=%lu", jsonNumber(state.body, "boot"),
+           jsonNumber(state.body, "seq"));
+  Fetch delta = fetch(webInterface, path, 0);
+  report("state delta", "fast", delta);
+  ok = ok && (delta.code == 200 || delta.code == 304);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,346 @@
+// Checks the power log journal (PowerLogStorage.h) on the in-memory
+// LittleFS: rows read back as written, replay stopping at a torn or corrupt
+// record and resuming in a new segment, a segment with a bad header being
+// skipped, segments rotating at 255 records with only the newest three kept,
+// and compaction after a clock correction surviving a cut at any point, in
+// the copy or while the segments it replaces are removed.
+//
+//   thn_check_journal
+
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#include <map>
+#include <string>
+#include <string.h>
+#include <vector>
+
+#include "Check.h"
+#include "HostHardware.h"
+#include "PowerLog.h"
+#include "PowerLogStorage.h"
+
+using controller::FanSpeed;
+using host::Checker;
+using logging::PowerLog;
+using storage::PowerLogStorage;
+
+namespace {
+
+// Monday 2024-01-01 00:00 UTC, as in thn_sim.
+constexpr unsigned long kStart = 1704067200UL;
+constexpr unsigned long kMinute = 60UL;
+constexpr size_t kRecordSize = 16;         // Also the size of a segment header.
+constexpr size_t kRecordsPerSegment = 255;
+constexpr size_t kMaxSegments = 3;
+const char kJournalDir[] = "/powerlog";
+// Segment header flags, as PowerLogStorage writes them.
+constexpr size_t kHeaderFlagsOffset = 12;
+constexpr uint8_t kCompactionFlag = 0x01;
+
+const PowerLog::ConsumptionRate kConsumptionTable[] = {
+    {FanSpeed::kOff, false, 5.0f},
+    {FanSpeed::kLow, false, 110.0f},
+    {FanSpeed::kHigh, true, 700.0f},
+};
+
+using Files = std::map<std::string, std::vector<uint8_t>>;
+
+/** A log journaled from every loop(), as in main.ino. */
+struct Unit {
+  Unit() : storage(log) {
+    log.setConsumptionTable(kConsumptionTable,
+                            sizeof(kConsumptionTable) / sizeof(kConsumptionTable[0]));
+    storage.begin();
+    restored = storage.load();
+  }
+
+  /** Logs `minutes` minutes of alternating fan and compressor states from `clock` on. */
+  void run(unsigned long minutes) {
+    for (unsigned long end = clock + minutes * kMinute; clock < end; clock += 10) {
+      unsigned long minute = clock / kMinute;
+      bool cooling = minute % 3 == 0;
+      log.logState(clock, cooling ? FanSpeed::kHigh : FanSpeed::kLow, cooling);
+      storage.update();
+    }
+  }
+
+  PowerLog log;
+  PowerLogStorage storage;
+  unsigned long clock = kStart;
+  bool restored = false;
+};
+
+Files journalFiles() {
+  Files files;
+  Dir dir = LittleFS.openDir(kJournalDir);
+  while (dir.next()) {
+    std::string path = std::string(kJournalDir) + "/" + dir.fileName().c_str();
+    File file = LittleFS.open(path.c_str(), "r");
+    std::vector<uint8_t> bytes(file.size());
+    file.read(bytes.data(), bytes.size());
+    files[path] = bytes;
+  }
+  return files;
+}
+
+// CRC-16/CCITT-FALSE, as PowerLogStorage computes it.
+uint16_t crc16(const uint8_t *data, size_t length) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < length; ++i) {
+    crc ^= static_cast<uint16_t>(data[i]) << 8;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021)
+                           : static_cast<uint16_t>(crc << 1);
+    }
+  }
+  return crc;
+}
+
+void writeFile(const std::string &path, const std::vector<uint8_t> &bytes) {
+  File file = LittleFS.open(path.c_str(), "w");
+  file.write(bytes.data(), bytes.size());
+  file.close();
+}
+
+/** Completed rows of a log, oldest first; the newest is left out while its minute is open. */
+std::vector<PowerLog::Entry> completedRows(const PowerLog &log) {
+  std::vector<PowerLog::Entry> rows;
+  log.forEach([&](const PowerLog::Entry &entry) { rows.push_back(entry); });
+  if (log.minuteOpen() && !rows.empty()) {
+    rows.pop_back();
+  }
+  return rows;
+}
+
+bool sameRows(const std::vector<PowerLog::Entry> &a, const std::vector<PowerLog::Entry> &b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].timestamp != b[i].timestamp ||
+        a[i].energyWhAccumulated != b[i].energyWhAccumulated ||
+        a[i].instantaneousWatts != b[i].instantaneousWatts || a[i].fanSpeed != b[i].fanSpeed ||
+        a[i].compressorActive != b[i].compressorActive) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void checkRoundTrip(Checker &check) {
+  host::formatFileSystem();
+  Unit unit;
+  check.expect(!unit.restored, "nothing to restore from an empty journal");
+  unit.run(90);
+  std::vector<PowerLog::Entry> written = completedRows(unit.log);
+
+  Unit reboot;
+  std::vector<PowerLog::Entry> read = completedRows(reboot.log);
+  check.expect(reboot.restored && sameRows(read, written), "journal replays every completed row",
+               static_cast<long>(read.size()));
+  check.expect(!read.empty() && reboot.log.totalEnergyWh() == read.back().energyWhAccumulated,
+               "counter continues from the last record");
+  Files files = journalFiles();
+  check.expect(files.size() == 1 && files.begin()->second.size() == kRecordSize * 90,
+               "one segment of header and records", static_cast<long>(files.size()));
+}
+
+void checkTornTail(Checker &check) {
+  host::formatFileSystem();
+  {
+    Unit unit;
+    unit.run(30);
+  }
+  Files files = journalFiles();
+  const std::string segment = files.begin()->first;
+  std::vector<uint8_t> &bytes = files.begin()->second;
+  // A power cut in the middle of the last record.
+  bytes.resize(bytes.size() - kRecordSize / 2);
+  writeFile(segment, bytes);
+
+  Unit reboot;
+  size_t restored = completedRows(reboot.log).size();
+  check.expect(restored == 28, "torn record is dropped", static_cast<long>(restored));
+  reboot.clock = kStart + 40 * kMinute;
+  reboot.run(5);  // The first call only starts the power integration.
+  Files after = journalFiles();
+  check.expect(after.size() == 2 && after[segment].size() == bytes.size(),
+               "appends go to a new segment, not behind the torn record",
+               static_cast<long>(after.size()));
+
+  Unit again;
+  std::vector<PowerLog::Entry> rows = completedRows(again.log);
+  check.expect(rows.size() == 28 + 4 && rows[28].timestamp == kStart + 40 * kMinute,
+               "replay continues past the torn segment", static_cast<long>(rows.size()));
+}
+
+void checkCorruptRecord(Checker &check) {
+  host::formatFileSystem();
+  std::vector<PowerLog::Entry> written;
+  {
+    Unit unit;
+    unit.run(30);
+    written = completedRows(unit.log);
+  }
+  Files files = journalFiles();
+  std::vector<uint8_t> &bytes = files.begin()->second;
+  // Flip a bit in the energy counter of record 20; its CRC no longer matches.
+  bytes[kRecordSize * (1 + 20) + 5] ^= 0x10;
+  writeFile(files.begin()->first, bytes);
+
+  Unit reboot;
+  std::vector<PowerLog::Entry> rows = completedRows(reboot.log);
+  written.resize(20);
+  check.expect(sameRows(rows, written), "replay stops at a corrupt record",
+               static_cast<long>(rows.size()));
+  check.expect(!rows.empty() && reboot.log.totalEnergyWh() == rows.back().energyWhAccumulated,
+               "counter comes from the last good record");
+}
+
+void checkRotation(Checker &check) {
+  host::formatFileSystem();
+  const unsigned long minutes = kRecordsPerSegment * (kMaxSegments + 1) + 40;
+  std::vector<PowerLog::Entry> written;
+  {
+    Unit unit;
+    unit.run(minutes);
+    written = completedRows(unit.log);
+  }
+  Files files = journalFiles();
+  check.expect(files.size() == kMaxSegments, "only the newest segments are kept",
+               static_cast<long>(files.size()));
+  std::vector<std::string> expected = {"/powerlog/00000002", "/powerlog/00000003",
+                                       "/powerlog/00000004"};
+  size_t index = 0;
+  bool sizes = true;
+  for (const auto &file : files) {
+    bool newest = index + 1 == files.size();
+    sizes = sizes && index < expected.size() && file.first == expected[index] &&
+            file.second.size() ==
+                kRecordSize * (1 + (newest ? 39 : kRecordsPerSegment));
+    ++index;
+  }
+  // Minute `minutes` is still open, so 39 records follow the 4 full segments.
+  check.expect(sizes, "full segments hold 255 records, the newest the rest");
+
+  // The restored ring is full of completed rows, one older than the live log's.
+  Unit reboot;
+  std::vector<PowerLog::Entry> rows = completedRows(reboot.log);
+  check.expect(rows.size() == PowerLog::kMaxEntries &&
+                   sameRows(std::vector<PowerLog::Entry>(rows.begin() + 1, rows.end()), written),
+               "rows across segments replay in order", static_cast<long>(rows.size()));
+
+  // A segment with a damaged header is skipped, the ones after it still replay.
+  files["/powerlog/00000003"][0] ^= 0xFF;
+  writeFile("/powerlog/00000003", files["/powerlog/00000003"]);
+  Unit damaged;
+  rows = completedRows(damaged.log);
+  check.expect(rows.size() == kRecordsPerSegment + 39 &&
+                   rows[kRecordsPerSegment - 1].timestamp ==
+                       kStart + (3 * kRecordsPerSegment - 1) * kMinute &&
+                   rows[kRecordsPerSegment].timestamp == kStart + 4 * kRecordsPerSegment * kMinute,
+               "bad header skips its segment", static_cast<long>(rows.size()));
+}
+
+void checkCompaction(Checker &check) {
+  host::formatFileSystem();
+  Files before;
+  Files after;
+  std::vector<PowerLog::Entry> corrected;
+  {
+    Unit unit;
+    unit.run(300);
+    before = journalFiles();
+    // The clock turned out to be an hour behind; update() rewrites the journal.
+    unit.log.rebase(0, 3600);
+    unit.storage.update();
+    after = journalFiles();
+    corrected = completedRows(unit.log);
+  }
+  // 299 rows take two segments, so the copy does too.
+  check.expect(after.size() == 2 && after.begin()->first > before.rbegin()->first,
+               "compaction writes new segments and removes the old ones",
+               static_cast<long>(after.size()));
+
+  Unit compacted;
+  check.expect(sameRows(completedRows(compacted.log), corrected),
+               "compacted journal holds the corrected times");
+
+  // Cut the copy after every record while the old segments are still in
+  // place; until save() commits it, the copy's header carries only
+  // kCompactionFlag.
+  Files uncommitted = after;
+  std::vector<uint8_t> &header = uncommitted.begin()->second;
+  header[kHeaderFlagsOffset] = kCompactionFlag;
+  uint16_t crc = crc16(header.data(), kRecordSize - sizeof(crc));
+  memcpy(header.data() + kRecordSize - sizeof(crc), &crc, sizeof(crc));
+  bool recovered = true;
+  bool dropped = true;
+  size_t total = 0;
+  for (const auto &file : uncommitted) {
+    total += file.second.size();
+  }
+  for (size_t length = 0; length <= total; length += kRecordSize) {
+    host::formatFileSystem();
+    for (const auto &file : before) {
+      writeFile(file.first, file.second);
+    }
+    size_t left = length;
+    for (const auto &file : uncommitted) {
+      if (left == 0) {
+        break;
+      }
+      size_t part = left < file.second.size() ? left : file.second.size();
+      writeFile(file.first, std::vector<uint8_t>(file.second.begin(),
+                                                 file.second.begin() + static_cast<long>(part)));
+      left -= part;
+    }
+    Unit reboot;
+    std::vector<PowerLog::Entry> rows = completedRows(reboot.log);
+    recovered = recovered && rows.size() == 299 && rows.front().timestamp == kStart;
+    // Without a whole header the copy cannot be told from a torn segment; it
+    // replays as empty and is pruned like one.
+    if (length >= kRecordSize) {
+      Files files = journalFiles();
+      dropped = dropped && files.size() == before.size() && files.begin()->first ==
+                before.begin()->first;
+    }
+  }
+  check.expect(recovered, "an uncommitted copy leaves the old rows in place");
+  check.expect(dropped, "and is removed once its header is readable");
+
+  // Cut after each removal of an old segment once the copy is committed.
+  bool kept = true;
+  bool finished = true;
+  for (size_t removed = 0; removed <= before.size(); ++removed) {
+    host::formatFileSystem();
+    size_t index = 0;
+    for (const auto &file : before) {
+      if (index++ >= removed) {
+        writeFile(file.first, file.second);
+      }
+    }
+    for (const auto &file : after) {
+      writeFile(file.first, file.second);
+    }
+    Unit reboot;
+    kept = kept && sameRows(completedRows(reboot.log), corrected);
+    finished = finished && journalFiles() == after;
+  }
+  check.expect(kept, "a committed copy wins over old segments left behind");
+  check.expect(finished, "and load() removes the ones save() did not get to");
+}
+
+}  // namespace
+
+int main() {
+  host::VirtualClock::reset();
+  Checker check;
+  checkRoundTrip(check);
+  checkTornTail(check);
+  checkCorruptRecord(check);
+  checkRotation(check);
+  checkCompaction(check);
+  return check.finish("power log journal");
+}
@@ -0,0 +1,161 @@
+// Checks the DS18B20 readout (TemperatureProbes.h) against a fake bus on the
+// virtual clock: when conversions start and are collected, the kIdle and
+// kConverting states in between, readings handed out once each, missing
+// and disconnected probes, and the 1/128 degree to centi-degree rounding
+// over the sensor's whole range.
+//
+//   thn_check_probes
+
+#include <Arduino.h>
+
+#include <math.h>
+
+#include "Check.h"
+#include "HostHardware.h"
+#include "TemperatureProbes.h"
+
+using controller::TemperatureProbes;
+using host::Checker;
+using Probe = controller::TemperatureProbes::Probe;
+using State = controller::TemperatureProbes::State;
+
+namespace {
+
+constexpr unsigned long kConversionMs = 750;  // 12-bit resolution.
+constexpr int32_t kLowestRaw = -55 * 128;     // DS18B20 range, -55 to +125 degrees.
+constexpr int32_t kHighestRaw = 125 * 128;
+
+class FakeBus : public TemperatureProbes::Bus {
+ public:
+  bool present(Probe probe) const override {
+    return probe == Probe::kAmbient ? hasAmbient : hasCoil;
+  }
+  void requestConversion() override { ++conversions; }
+  unsigned long conversionTimeMs() const override { return kConversionMs; }
+  int32_t readRaw(Probe probe) override {
+    ++reads;
+    return probe == Probe::kAmbient ? ambientRaw : coilRaw;
+  }
+
+  bool hasAmbient = true;
+  bool hasCoil = true;
+  int32_t ambientRaw = 0;
+  int32_t coilRaw = 0;
+  unsigned long conversions = 0;
+  unsigned long reads = 0;
+};
+
+void checkConversionCycle(Checker &check) {
+  host::VirtualClock::reset(5000);
+  FakeBus bus;
+  bus.ambientRaw = 2570;  // 20.078 degrees.
+  bus.coilRaw = -300;     // -2.344 degrees.
+  TemperatureProbes probes(bus);
+  check.expect(probes.state() == State::kIdle, "starts idle");
+
+  probes.poll();
+  check.expect(probes.state() == State::kConverting, "first poll starts a conversion");
+  check.expect(bus.conversions == 1, "one conversion requested",
+               static_cast<long>(bus.conversions));
+
+  host::VirtualClock::advance(kConversionMs - 1);
+  probes.poll();
+  check.expect(probes.state() == State::kConverting, "still converting before the conversion time");
+  check.expect(bus.reads == 0, "no scratchpad read before the conversion time");
+  check.expect(probes.takeAmbient() == units::kNoTemperature, "no reading while converting");
+
+  host::VirtualClock::advance(1);
+  probes.poll();
+  check.expect(probes.state() == State::kIdle, "collected at the conversion time");
+  check.expect(bus.reads == 2, "both probes read", static_cast<long>(bus.reads));
+  check.expect(probes.ambient() == 2008, "ambient reading", probes.ambient());
+  check.expect(probes.coil() == -234, "coil reading", probes.coil());
+  check.expect(probes.takeAmbient() == 2008, "ambient handed out");
+  check.expect(probes.takeAmbient() == units::kNoTemperature, "ambient handed out only once");
+  check.expect(probes.takeCoil() == -234, "coil handed out");
+  check.expect(probes.takeCoil() == units::kNoTemperature, "coil handed out only once");
+
+  // The next conversion starts kPollIntervalMs after the previous one did.
+  host::VirtualClock::advance(TemperatureProbes::kPollIntervalMs - kConversionMs - 1);
+  probes.poll();
+  check.expect(probes.state() == State::kIdle && bus.conversions == 1,
+               "waits out the poll interval");
+  host::VirtualClock::advance(1);
+  probes.poll();
+  check.expect(probes.state() == State::kConverting && bus.conversions == 2,
+               "next conversion on the poll interval");
+
+  // A loop() that stalls past both deadlines collects once, then starts over.
+  bus.ambientRaw = 2688;
+  host::VirtualClock::advance(3000);
+  probes.poll();
+  check.expect(probes.state() == State::kIdle && probes.ambient() == 2100,
+               "late poll collects the pending conversion");
+  probes.poll();
+  check.expect(probes.state() == State::kConverting && bus.conversions == 3,
+               "and starts the next one on the following poll");
+}
+
+void checkMissingProbes(Checker &check) {
+  host::VirtualClock::reset(0);
+  FakeBus bus;
+  bus.hasAmbient = false;
+  bus.coilRaw = TemperatureProbes::Bus::kDisconnected;
+  TemperatureProbes probes(bus);
+  probes.poll();
+  host::VirtualClock::advance(kConversionMs);
+  probes.poll();
+  check.expect(bus.reads == 1, "absent probe is not read", static_cast<long>(bus.reads));
+  check.expect(probes.takeAmbient() == units::kNoTemperature, "absent probe has no reading");
+  check.expect(probes.takeCoil() == units::kNoTemperature, "disconnected probe has no reading");
+
+  FakeBus empty;
+  empty.hasAmbient = false;
+  empty.hasCoil = false;
+  TemperatureProbes none(empty);
+  none.poll();
+  none.readNow();
+  check.expect(empty.conversions == 0 && none.state() == State::kIdle,
+               "no conversions without probes", static_cast<long>(empty.conversions));
+}
+
+void checkReadNow(Checker &check) {
+  host::VirtualClock::reset(0);
+  FakeBus bus;
+  bus.ambientRaw = 3200;
+  TemperatureProbes probes(bus);
+  probes.readNow();
+  check.expect(millis() == kConversionMs, "readNow waits out one conversion",
+               static_cast<long>(millis()));
+  check.expect(probes.state() == State::kIdle && probes.ambient() == 2500,
+               "readNow collects", probes.ambient());
+  check.expect(probes.takeAmbient() == 2500, "readNow reading is handed out");
+}
+
+void checkRawConversion(Checker &check) {
+  check.expect(TemperatureProbes::fromRaw(TemperatureProbes::Bus::kDisconnected) ==
+                   units::kNoTemperature,
+               "disconnected raw value");
+  // Every step the sensor can report, against rounding half away from zero.
+  for (int32_t raw = kLowestRaw + 1; raw <= kHighestRaw; ++raw) {
+    double exact = static_cast<double>(raw) * 100.0 / 128.0;
+    long expected = lround(exact);
+    units::CentiCelsius converted = TemperatureProbes::fromRaw(raw);
+    if (converted != expected) {
+      check.expect(false, "raw conversion", raw);
+      return;
+    }
+  }
+  check.expect(true, "raw conversion");
+}
+
+}  // namespace
+
+int main() {
+  Checker check;
+  checkConversionCycle(check);
+  checkMissingProbes(check);
+  checkReadNow(check);
+  checkRawConversion(check);
+  return check.finish("temperature probes");
+}
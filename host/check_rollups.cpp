@@ -0,0 +1,405 @@
+// Checks the rollup tiers of TemperatureLog and PowerLog: which bucket a
+// minute lands in at the edges of each period, the min, max and rounded
+// average or the energy counter readings kept per bucket, each ring dropping
+// its oldest bucket once full, range and limit handling in forEachRollup(),
+// the tier selectResolution() falls back to when a finer one no longer
+// reaches back, range totals from PowerLog::energyRange(), and where rebase()
+// puts buckets logged on provisional time.
+//
+//   thn_check_rollups
+
+#include <Arduino.h>
+
+#include <limits.h>
+#include <math.h>
+#include <vector>
+
+#include "Check.h"
+#include "LogClock.h"
+#include "PowerLog.h"
+#include "TemperatureLog.h"
+
+using controller::FanSpeed;
+using host::Checker;
+using logging::LogClock;
+using logging::PowerLog;
+using logging::TemperatureLog;
+using Resolution = logging::TemperatureLog::Resolution;
+using PowerResolution = logging::PowerLog::Resolution;
+
+namespace {
+
+// Monday 2024-01-01 00:00 UTC, as in thn_sim; midnight, so on every period boundary.
+constexpr unsigned long kStart = 1704067200UL;
+constexpr unsigned long kMinute = 60UL;
+constexpr unsigned long kQuarterHour = 15UL * kMinute;
+constexpr unsigned long kHour = 60UL * kMinute;
+constexpr unsigned long kDay = 24UL * kHour;
+constexpr unsigned long kMonth = 30UL * kDay;  // PowerLog's month buckets.
+
+// 60 W uses 1 Wh a minute, so counter readings count logged minutes.
+const PowerLog::ConsumptionRate kConsumptionTable[] = {{FanSpeed::kOff, false, 60.0f}};
+
+std::vector<TemperatureLog::Rollup> temperatureBuckets(const TemperatureLog &log,
+                                                       Resolution resolution,
+                                                       unsigned long start = 0,
+                                                       unsigned long end = ULONG_MAX) {
+  std::vector<TemperatureLog::Rollup> buckets;
+  log.forEachRollup(resolution, start, end,
+                    [&](const TemperatureLog::Rollup &bucket) { buckets.push_back(bucket); });
+  return buckets;
+}
+
+std::vector<PowerLog::Rollup> powerBuckets(const PowerLog &log,
+                                           PowerResolution resolution,
+                                           unsigned long start = 0,
+                                           unsigned long end = ULONG_MAX) {
+  std::vector<PowerLog::Rollup> buckets;
+  log.forEachRollup(resolution, start, end,
+                    [&](const PowerLog::Rollup &bucket) { buckets.push_back(bucket); });
+  return buckets;
+}
+
+bool near(float actual, float expected) { return fabsf(actual - expected) < 0.01f; }
+
+/** Logs the fan off every `step` seconds over [from, to]. */
+void fillPower(PowerLog &log, unsigned long from, unsigned long to, unsigned long step = kMinute) {
+  for (unsigned long t = from; t <= to; t += step) {
+    log.logState(t, FanSpeed::kOff, false);
+  }
+}
+
+/** One reading per minute over [from, to), `ambient(minute)` and a fixed coil. */
+template <typename Ambient>
+void fillTemperature(TemperatureLog &log, unsigned long from, unsigned long to, Ambient ambient) {
+  for (unsigned long t = from; t < to; t += kMinute) {
+    log.addReading(t, ambient(t), 500);
+  }
+}
+
+void checkTemperatureBoundaries(Checker &check) {
+  static TemperatureLog log;
+  // 23:44 to 00:16 across midnight, each minute two readings apart.
+  unsigned long from = kStart + kDay - 16 * kMinute;
+  for (unsigned long t = from; t <= kStart + kDay + 16 * kMinute; t += kMinute) {
+    units::CentiCelsius value = static_cast<units::CentiCelsius>((t - from) / kMinute);
+    log.addReading(t, value, -value);
+    log.addReading(t + 30, value + 1, -value - 1);
+  }
+
+  // The minute in progress is not rolled up until the next one starts.
+  std::vector<TemperatureLog::Rollup> quarters = temperatureBuckets(log, Resolution::kQuarterHour);
+  check.expect(quarters.size() == 4, "quarter-hour buckets across midnight",
+               static_cast<long>(quarters.size()));
+  if (quarters.size() == 4) {
+    check.expect(quarters[0].timestamp == kStart + kDay - 30 * kMinute &&
+                     quarters[1].timestamp == kStart + kDay - kQuarterHour &&
+                     quarters[2].timestamp == kStart + kDay &&
+                     quarters[3].timestamp == kStart + kDay + kQuarterHour,
+                 "quarter-hour buckets start on the quarter");
+    // 23:44 alone, then 23:45-23:59 (values 1-15), 00:00-00:14, and 00:15.
+    // Buckets fold minute averages: value v and v + 1 average to v + 1.
+    check.expect(quarters[0].ambientMin == 1 && quarters[0].ambientMax == 1,
+                 "bucket before the quarter keeps only its own minute", quarters[0].ambientMax);
+    check.expect(quarters[1].ambientMin == 2 && quarters[1].ambientMax == 16 &&
+                     quarters[1].ambientAverage == 9,
+                 "23:45-23:59 min, max and average", quarters[1].ambientAverage);
+    check.expect(quarters[1].coilMin == -16 && quarters[1].coilMax == -2 &&
+                     quarters[1].coilAverage == -9,
+                 "negative min, max and average", quarters[1].coilAverage);
+    check.expect(quarters[2].ambientMin == 17 && quarters[2].ambientMax == 31,
+                 "midnight opens a new quarter", quarters[2].ambientMin);
+  }
+
+  std::vector<TemperatureLog::Rollup> hours = temperatureBuckets(log, Resolution::kHour);
+  check.expect(hours.size() == 2 && hours[0].timestamp == kStart + kDay - kHour &&
+                   hours[1].timestamp == kStart + kDay,
+               "hour buckets split at midnight", static_cast<long>(hours.size()));
+  std::vector<TemperatureLog::Rollup> days = temperatureBuckets(log, Resolution::kDay);
+  check.expect(days.size() == 2 && days[0].timestamp == kStart &&
+                   days[1].timestamp == kStart + kDay,
+               "day buckets split at midnight", static_cast<long>(days.size()));
+  if (days.size() == 2) {
+    check.expect(days[0].ambientMax == 16 && days[1].ambientMin == 17,
+                 "23:59 stays in the old day");
+  }
+
+  // A bucket overlaps a range that starts inside it or ends on its first second.
+  check.expect(temperatureBuckets(log, Resolution::kQuarterHour, kStart + kDay - 1,
+                                  kStart + kDay).size() == 2,
+               "range edges include the buckets they touch");
+  size_t visited = 0;
+  bool more = log.forEachRollup(Resolution::kQuarterHour, 0, ULONG_MAX,
+                                [&](const TemperatureLog::Rollup &) { ++visited; }, 3);
+  check.expect(more && visited == 3, "limit stops early and says so", static_cast<long>(visited));
+  more = log.forEachRollup(Resolution::kQuarterHour, 0, ULONG_MAX,
+                           [&](const TemperatureLog::Rollup &) {}, 4);
+  check.expect(!more, "limit equal to the buckets left is not early");
+}
+
+void checkTemperatureMissingReadings(Checker &check) {
+  static TemperatureLog log;
+  log.addReading(kStart, 2000, TemperatureLog::kNoReading);
+  log.addReading(kStart + kMinute, TemperatureLog::kNoReading, TemperatureLog::kNoReading);
+  log.addReading(kStart + 2 * kMinute, 2101, -1);
+  log.addReading(kStart + 3 * kMinute, 2101, -2);
+  log.addReading(kStart + 4 * kMinute, 0, 0);
+  std::vector<TemperatureLog::Rollup> quarters = temperatureBuckets(log, Resolution::kQuarterHour);
+  check.expect(quarters.size() == 1, "one quarter for the first minutes");
+  if (quarters.size() == 1) {
+    check.expect(quarters[0].ambientMin == 2000 && quarters[0].ambientMax == 2101 &&
+                     quarters[0].ambientAverage == 2067,
+                 "minutes without a reading are left out", quarters[0].ambientAverage);
+    check.expect(quarters[0].coilMin == -2 && quarters[0].coilMax == -1 &&
+                     quarters[0].coilAverage == -2,
+                 "negative half average rounds away from zero", quarters[0].coilAverage);
+  }
+
+  static TemperatureLog empty;
+  empty.addReading(kStart, 2000, TemperatureLog::kNoReading);
+  empty.addReading(kStart + kMinute, 2000, TemperatureLog::kNoReading);
+  quarters = temperatureBuckets(empty, Resolution::kQuarterHour);
+  if (quarters.size() == 1) {
+    check.expect(quarters[0].coilMin == TemperatureLog::kNoReading &&
+                     quarters[0].coilMax == TemperatureLog::kNoReading &&
+                     quarters[0].coilAverage == TemperatureLog::kNoReading,
+                 "a probe with no readings stays empty");
+  } else {
+    check.expect(false, "one quarter with a missing probe", static_cast<long>(quarters.size()));
+  }
+}
+
+void checkTemperatureRollOver(Checker &check) {
+  static TemperatureLog log;
+  const unsigned long quarters = TemperatureLog::kQuarterHourBuckets + 3;
+  // The extra minute opens quarter `quarters`, which rolls up the one before.
+  fillTemperature(log, kStart, kStart + quarters * kQuarterHour + kMinute, [](unsigned long t) {
+    return static_cast<units::CentiCelsius>(t / kQuarterHour % 1000);
+  });
+
+  std::vector<TemperatureLog::Rollup> buckets = temperatureBuckets(log, Resolution::kQuarterHour);
+  check.expect(buckets.size() == TemperatureLog::kQuarterHourBuckets,
+               "full quarter-hour ring keeps its capacity", static_cast<long>(buckets.size()));
+  unsigned long oldest = 0;
+  check.expect(log.oldestTimestamp(Resolution::kQuarterHour, oldest) &&
+                   oldest == kStart + 3 * kQuarterHour,
+               "oldest quarters are dropped first", static_cast<long>(oldest - kStart));
+  bool consecutive = true;
+  for (size_t i = 1; i < buckets.size(); ++i) {
+    consecutive = consecutive && buckets[i].timestamp == buckets[i - 1].timestamp + kQuarterHour &&
+                  buckets[i].ambientAverage ==
+                      static_cast<int16_t>(buckets[i].timestamp / kQuarterHour % 1000);
+  }
+  check.expect(consecutive, "kept quarters stay in order with their own values");
+  check.expect(log.oldestTimestamp(Resolution::kHour, oldest) && oldest == kStart,
+               "hour tier still reaches the start");
+
+  // The minute ring (6 hours) and quarter ring (16 hours) no longer reach
+  // the first hour, so a minute request for it falls back to hours.
+  check.expect(log.selectResolution(kStart, kMinute) == Resolution::kHour,
+               "falls back to the finest tier reaching the start");
+  check.expect(log.selectResolution(kStart + 10 * kHour, kMinute) == Resolution::kQuarterHour,
+               "quarters when they reach the start");
+  check.expect(log.selectResolution(kStart + 16 * kHour, kMinute) == Resolution::kMinute,
+               "minutes when they reach the start");
+  check.expect(log.selectResolution(kStart + 16 * kHour, kDay) == Resolution::kDay,
+               "never finer than asked for");
+}
+
+void checkTemperatureLongRollOver(Checker &check) {
+  static TemperatureLog log;
+  const unsigned long days = TemperatureLog::kDayBuckets + 2;
+  fillTemperature(log, kStart, kStart + days * kDay + kMinute,
+                  [](unsigned long t) { return static_cast<units::CentiCelsius>(t / kDay % 100); });
+  unsigned long oldest = 0;
+  check.expect(temperatureBuckets(log, Resolution::kHour).size() == TemperatureLog::kHourBuckets,
+               "full hour ring keeps its capacity");
+  check.expect(log.oldestTimestamp(Resolution::kHour, oldest) &&
+                   oldest == kStart + days * kDay - TemperatureLog::kHourBuckets * kHour,
+               "hour ring keeps the newest week", static_cast<long>(oldest - kStart));
+  std::vector<TemperatureLog::Rollup> buckets = temperatureBuckets(log, Resolution::kDay);
+  check.expect(buckets.size() == TemperatureLog::kDayBuckets,
+               "full day ring keeps its capacity", static_cast<long>(buckets.size()));
+  check.expect(!buckets.empty() && buckets.front().timestamp == kStart + 2 * kDay &&
+                   buckets.back().timestamp == kStart + (days - 1) * kDay,
+               "day ring drops the oldest days");
+  check.expect(log.selectResolution(kStart, kMinute) == Resolution::kDay,
+               "days when nothing else reaches back");
+}
+
+void checkPowerBoundaries(Checker &check) {
+  static PowerLog log;
+  log.setConsumptionTable(kConsumptionTable, 1);
+  // 23:58 to 00:02: two minutes before midnight and two after.
+  fillPower(log, kStart + kDay - 2 * kMinute, kStart + kDay + 2 * kMinute);
+
+  std::vector<PowerLog::Rollup> hours = powerBuckets(log, PowerResolution::kHour);
+  check.expect(hours.size() == 2, "hour buckets across midnight", static_cast<long>(hours.size()));
+  if (hours.size() == 2) {
+    check.expect(hours[0].timestamp == kStart + kDay - kHour && hours[1].timestamp == kStart + kDay,
+                 "hour buckets start on the hour");
+    check.expect(near(hours[0].energyWhStart, 0.0f) && near(hours[0].energyWhEnd, 2.0f),
+                 "23:00 bucket holds 23:58 and 23:59");
+    check.expect(hours[1].energyWhStart == hours[0].energyWhEnd && near(hours[1].energyWhEnd, 4.0f),
+                 "midnight bucket starts where the last one ended");
+  }
+  std::vector<PowerLog::Rollup> days = powerBuckets(log, PowerResolution::kDay);
+  check.expect(days.size() == 2 && days[0].timestamp == kStart &&
+                   days[1].timestamp == kStart + kDay,
+               "day buckets split at midnight", static_cast<long>(days.size()));
+
+  float startWh = 0.0f;
+  float endWh = 0.0f;
+  check.expect(log.energyRange(kStart + kDay - kMinute, kStart + kDay, startWh, endWh) &&
+                   near(startWh, 1.0f) && near(endWh, 3.0f),
+               "range over minute buckets includes both end minutes");
+  check.expect(log.energyRange(0, ULONG_MAX, startWh, endWh) && near(startWh, 0.0f) &&
+                   endWh == log.totalEnergyWh(),
+               "range past both ends uses the oldest and live counters");
+
+  static PowerLog month;
+  month.setConsumptionTable(kConsumptionTable, 1);
+  // Month buckets are 30-day periods of epoch time, not calendar months.
+  unsigned long boundary = (kStart / kMonth + 1) * kMonth;
+  fillPower(month, boundary - kMinute, boundary + kMinute);
+  std::vector<PowerLog::Rollup> months = powerBuckets(month, PowerResolution::kMonth);
+  check.expect(months.size() == 2 && months[0].timestamp == boundary - kMonth &&
+                   months[1].timestamp == boundary,
+               "month buckets split on 30-day epoch periods", static_cast<long>(months.size()));
+}
+
+void checkPowerRollOver(Checker &check) {
+  static PowerLog log;
+  log.setConsumptionTable(kConsumptionTable, 1);
+  const unsigned long hours = PowerLog::kHourBuckets + 2;
+  // Five-minute steps, the longest logState() still integrates.
+  fillPower(log, kStart, kStart + hours * kHour, 5 * kMinute);
+
+  std::vector<PowerLog::Rollup> buckets = powerBuckets(log, PowerResolution::kHour);
+  check.expect(log.size(PowerResolution::kHour) == PowerLog::kHourBuckets &&
+                   buckets.size() == PowerLog::kHourBuckets,
+               "full hour ring keeps its capacity", static_cast<long>(buckets.size()));
+  // The step logged at the start of hour `hours` closes the hour before it.
+  check.expect(!buckets.empty() && buckets.front().timestamp == kStart + 2 * kHour &&
+                   buckets.back().timestamp == kStart + (hours - 1) * kHour,
+               "oldest hours are dropped first");
+  bool contiguous = true;
+  for (size_t i = 1; i < buckets.size(); ++i) {
+    contiguous = contiguous && buckets[i].timestamp == buckets[i - 1].timestamp + kHour &&
+                 buckets[i].energyWhStart == buckets[i - 1].energyWhEnd;
+  }
+  check.expect(contiguous, "kept hours chain their counter readings");
+
+  // Hour 1 has rolled out of the hour ring but is still in the first day bucket.
+  float startWh = 0.0f;
+  float endWh = 0.0f;
+  check.expect(log.energyRange(kStart + kHour, kStart + 5 * kHour - 1, startWh, endWh) &&
+                   near(startWh, 0.0f) && near(endWh, 300.0f),
+               "range falls back to the day bucket, then the hour", static_cast<long>(endWh));
+  check.expect(log.energyRange(kStart + 10 * kHour, kStart + 20 * kHour - 1, startWh, endWh) &&
+                   near(startWh, 600.0f) && near(endWh, 1200.0f),
+               "range over hour buckets", static_cast<long>(startWh));
+
+  check.expect(log.selectResolution(kStart + 3 * kHour, kMinute) == PowerResolution::kHour,
+               "falls back to hours when the minute ring does not reach back");
+  check.expect(log.selectResolution(kStart, kMinute) == PowerResolution::kDay,
+               "and to days when the hour ring does not either");
+  check.expect(log.selectResolution(kStart + hours * kHour, kMinute) == PowerResolution::kMinute,
+               "minutes when they reach the start");
+}
+
+void checkPowerMonthRollOver(Checker &check) {
+  static PowerLog log;
+  log.setConsumptionTable(kConsumptionTable, 1);
+  // One logged minute a month; the gaps are too long to integrate.
+  const unsigned long months = PowerLog::kMonthBuckets + 2;
+  unsigned long first = (kStart / kMonth + 1) * kMonth;
+  for (unsigned long month = 0; month < months; ++month) {
+    fillPower(log, first + month * kMonth, first + month * kMonth + kMinute);
+  }
+
+  std::vector<PowerLog::Rollup> buckets = powerBuckets(log, PowerResolution::kMonth);
+  check.expect(buckets.size() == PowerLog::kMonthBuckets, "full month ring keeps its capacity",
+               static_cast<long>(buckets.size()));
+  check.expect(!buckets.empty() && buckets.front().timestamp == first + 2 * kMonth &&
+                   buckets.back().timestamp == first + (months - 1) * kMonth,
+               "oldest months are dropped first");
+  check.expect(!buckets.empty() && near(buckets.front().energyWhStart, 2.0f) &&
+                   near(buckets.back().energyWhEnd, static_cast<float>(months)),
+               "gaps add no energy");
+  check.expect(powerBuckets(log, PowerResolution::kDay).size() == months &&
+                   powerBuckets(log, PowerResolution::kHour).size() == months,
+               "one day and hour bucket per logged minute");
+
+  // Gaps leave the rings uneven, so energyRange() has to scan for the bucket.
+  float startWh = 0.0f;
+  float endWh = 0.0f;
+  check.expect(log.energyRange(first + 5 * kMonth, first + 10 * kMonth + kHour, startWh, endWh) &&
+                   near(startWh, 5.0f) && near(endWh, 11.0f),
+               "range over a ring with gaps", static_cast<long>(endWh));
+}
+
+void checkRebase(Checker &check) {
+  static TemperatureLog temperatureLog;
+  static PowerLog powerLog;
+  powerLog.setConsumptionTable(kConsumptionTable, 1);
+  // 20 minutes on provisional time, then the clock syncs at 13:50: the rows
+  // move to 13:30, a shift that is not a whole number of hours or quarters.
+  const unsigned long provisional = LogClock::kMinSyncedEpoch;
+  const unsigned long synced = kStart + 13 * kHour + 50 * kMinute;
+  fillTemperature(temperatureLog, provisional, provisional + 20 * kMinute,
+                  [](unsigned long) { return 100; });
+  fillPower(powerLog, provisional, provisional + 20 * kMinute);
+  long delta = static_cast<long>(synced - (provisional + 20 * kMinute));
+  temperatureLog.rebase(provisional, delta);
+  powerLog.rebase(provisional, delta);
+  fillTemperature(temperatureLog, synced, synced + 30 * kMinute, [](unsigned long) { return 300; });
+  fillPower(powerLog, synced, synced + 30 * kMinute);
+
+  std::vector<TemperatureLog::Rollup> hours = temperatureBuckets(temperatureLog, Resolution::kHour);
+  check.expect(hours.size() == 2 && hours[0].timestamp == kStart + 13 * kHour &&
+                   hours[1].timestamp == kStart + 14 * kHour,
+               "moved rows and later ones share the hour they fall in",
+               static_cast<long>(hours.size()));
+  if (hours.size() == 2) {
+    check.expect(hours[0].ambientMin == 100 && hours[0].ambientMax == 300,
+                 "13:00 holds the moved rows and 13:50 onwards", hours[0].ambientMin);
+  }
+  std::vector<TemperatureLog::Rollup> quarters =
+      temperatureBuckets(temperatureLog, Resolution::kQuarterHour);
+  bool ascending = true;
+  for (size_t i = 1; i < quarters.size(); ++i) {
+    ascending = ascending && quarters[i].timestamp > quarters[i - 1].timestamp;
+  }
+  check.expect(ascending && !quarters.empty() &&
+                   quarters.front().timestamp == kStart + 13 * kHour + 30 * kMinute,
+               "moved quarters start at 13:30 and stay in order",
+               static_cast<long>(quarters.size()));
+
+  std::vector<PowerLog::Rollup> powerHours = powerBuckets(powerLog, PowerResolution::kHour);
+  check.expect(powerHours.size() == 2 && powerHours[0].timestamp == kStart + 13 * kHour &&
+                   powerHours[1].timestamp == kStart + 14 * kHour,
+               "moved power rows share the hour they fall in",
+               static_cast<long>(powerHours.size()));
+  // 20 provisional minutes and 30 after the sync, at 1 Wh a minute.
+  float startWh = 0.0f;
+  float endWh = 0.0f;
+  check.expect(powerLog.energyRange(synced - kHour, synced + 30 * kMinute, startWh, endWh) &&
+                   near(endWh - startWh, 50.0f),
+               "range over moved and later rows", static_cast<long>((endWh - startWh) * 10.0f));
+}
+
+}  // namespace
+
+int main() {
+  Checker check;
+  checkTemperatureBoundaries(check);
+  checkTemperatureMissingReadings(check);
+  checkTemperatureRollOver(check);
+  checkTemperatureLongRollOver(check);
+  checkPowerBoundaries(check);
+  checkPowerRollOver(check);
+  checkPowerMonthRollOver(check);
+  checkRebase(check);
+  return check.finish("rollups");
+}
@@ -0,0 +1,351 @@
+// Checks the settings record (SettingsStorage.h) on the in-memory LittleFS:
+// settings read back as saved, a damaged or short record rejected without
+// touching the controller, a temporary file left by an interrupted save
+// either finished or dropped, and the version 1 record and the old text
+// file migrated to the current record.
+//
+//   thn_check_settings
+
+#include <Arduino.h>
+#include <LittleFS.h>
+
+#include <stddef.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "Check.h"
+#include "HVACController.h"
+#include "HostHardware.h"
+#include "PowerLog.h"
+#include "ScheduleManager.h"
+#include "SensorManager.h"
+#include "SettingsStorage.h"
+#include "TemperatureLog.h"
+
+using controller::FanMode;
+using controller::SystemMode;
+using host::Checker;
+using scheduler::ScheduledMode;
+using scheduler::ScheduleEntry;
+using scheduler::ScheduleManager;
+using storage::SettingsStorage;
+
+namespace {
+
+const char kPath[] = "/settings.bin";
+const char kTempPath[] = "/settings.bin.tmp";
+const char kLegacyPath[] = "/settings.cfg";
+
+constexpr uint32_t kMagic = 0x534E4854;  // 'THNS'
+constexpr size_t kVersionOffset = 4;     // After the magic.
+
+/** The objects whose settings are stored, wired as in main.ino. */
+struct Unit {
+  Unit() : hvac(compressor, fan, sensors, schedule, temperatureLog, powerLog) {
+    storage.begin();
+  }
+
+  /** Settings that differ from the defaults in every stored field. */
+  void edit() {
+    hvac.setTargetTemperature(2150);
+    hvac.setHysteresis(75);
+    hvac.setCompressorTemperatureLimit(5500);
+    hvac.setCompressorMinimumAmbient(1200);
+    hvac.setCompressorCooldownTemperature(900);
+    hvac.setCompressorCooldownDurationMinutes(7.5f);
+    hvac.setFanMode(FanMode::kMedium);
+    hvac.setSystemMode(SystemMode::kHeating);
+    hvac.enableScheduling(true);
+    schedule.setTimezoneOffsetMinutes(-150);
+    const ScheduleEntry weekday[] = {{6, 30, 2100, ScheduledMode::kHeating},
+                                     {22, 0, 1800, ScheduledMode::kUnspecified}};
+    schedule.setWeekdaySchedule(weekday, 2);
+    const ScheduleEntry holiday[] = {{9, 15, 2200, ScheduledMode::kFanOnly}};
+    schedule.setDaySchedule(ScheduleManager::kHolidayProfile, holiday, 1);
+    schedule.setDayOverride(19800, ScheduleManager::kHolidayProfile);
+  }
+
+  controller::Compressor compressor{16};
+  controller::FanController fan{controller::FanController::Pins{5, 14, 12}};
+  controller::SensorManager sensors;
+  ScheduleManager schedule;
+  logging::TemperatureLog temperatureLog;
+  logging::PowerLog powerLog;
+  controller::HVACController hvac;
+  SettingsStorage storage;
+};
+
+bool sameSchedules(const ScheduleManager &a, const ScheduleManager &b) {
+  for (uint8_t profile = 0; profile < ScheduleManager::kProfileCount; ++profile) {
+    size_t countA = 0;
+    size_t countB = 0;
+    const scheduler::PackedScheduleEntry *entriesA = a.packedDaySchedule(profile, countA);
+    const scheduler::PackedScheduleEntry *entriesB = b.packedDaySchedule(profile, countB);
+    if (countA != countB ||
+        memcmp(entriesA, entriesB, countA * sizeof(scheduler::PackedScheduleEntry)) != 0) {
+      return false;
+    }
+  }
+  size_t countA = 0;
+  size_t countB = 0;
+  const scheduler::DayOverride *overridesA = a.dayOverrides(countA);
+  const scheduler::DayOverride *overridesB = b.dayOverrides(countB);
+  return countA == countB &&
+         memcmp(overridesA, overridesB, countA * sizeof(scheduler::DayOverride)) == 0 &&
+         a.timezoneOffsetMinutes() == b.timezoneOffsetMinutes();
+}
+
+bool sameSettings(const Unit &a, const Unit &b) {
+  const controller::HVACController &x = a.hvac;
+  const controller::HVACController &y = b.hvac;
+  return x.targetTemperature() == y.targetTemperature() && x.hysteresis() == y.hysteresis() &&
+         x.compressorTemperatureLimit() == y.compressorTemperatureLimit() &&
+         x.compressorMinimumAmbient() == y.compressorMinimumAmbient() &&
+         x.compressorCooldownTemperature() == y.compressorCooldownTemperature() &&
+         x.compressorCooldownDurationMinutes() == y.compressorCooldownDurationMinutes() &&
+         x.fanMode() == y.fanMode() && x.systemMode() == y.systemMode() &&
+         x.schedulingEnabled() == y.schedulingEnabled() && sameSchedules(a.schedule, b.schedule);
+}
+
+std::vector<uint8_t> readFile(const char *path) {
+  File file = LittleFS.open(path, "r");
+  std::vector<uint8_t> bytes(file.size());
+  file.read(bytes.data(), bytes.size());
+  return bytes;
+}
+
+void writeFile(const char *path, const std::vector<uint8_t> &bytes) {
+  File file = LittleFS.open(path, "w");
+  file.write(bytes.data(), bytes.size());
+  file.close();
+}
+
+uint16_t storedVersion(const std::vector<uint8_t> &bytes) {
+  uint16_t version = 0;
+  if (bytes.size() >= kVersionOffset + sizeof(version)) {
+    memcpy(&version, bytes.data() + kVersionOffset, sizeof(version));
+  }
+  return version;
+}
+
+// CRC-32 (IEEE), as SettingsStorage computes it.
+uint32_t crc32(const uint8_t *data, size_t length) {
+  uint32_t crc = 0xFFFFFFFFUL;
+  for (size_t i = 0; i < length; ++i) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1UL)));
+    }
+  }
+  return ~crc;
+}
+
+// The version 1 record, weekday and weekend tables only.
+struct V1ScheduleEntry {
+  uint8_t hour;
+  uint8_t minute;
+  uint8_t mode;
+  uint8_t reserved;
+  float temperature;
+};
+
+struct BlobV1 {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t payloadSize;
+  struct {
+    float targetTemperature;
+    float hysteresis;
+    float compressorTemperatureLimit;
+    float compressorMinimumAmbient;
+    float compressorCooldownTemperature;
+    float compressorCooldownMinutes;
+    int16_t timezoneOffsetMinutes;
+    uint8_t fanMode;
+    uint8_t systemMode;
+    uint8_t schedulingEnabled;
+    uint8_t weekdayCount;
+    uint8_t weekendCount;
+    uint8_t reserved;
+    V1ScheduleEntry weekday[12];
+    V1ScheduleEntry weekend[12];
+  } payload;
+  uint32_t crc;
+};
+
+void checkRoundTrip(Checker &check) {
+  host::formatFileSystem();
+  Unit unit;
+  unit.edit();
+  check.expect(unit.storage.save(unit.hvac, unit.schedule), "save succeeds");
+  check.expect(!LittleFS.exists(kTempPath), "save leaves no temporary file");
+
+  Unit reboot;
+  check.expect(reboot.storage.load(reboot.hvac, reboot.schedule), "load succeeds");
+  check.expect(sameSettings(reboot, unit), "every setting reads back");
+  check.expect(storedVersion(readFile(kPath)) == 2, "record is version 2");
+}
+
+void checkRejected(Checker &check) {
+  host::formatFileSystem();
+  {
+    Unit unit;
+    unit.edit();
+    unit.storage.save(unit.hvac, unit.schedule);
+  }
+  const std::vector<uint8_t> good = readFile(kPath);
+  Unit defaults;
+
+  // One flipped bit anywhere, including the CRC itself.
+  bool rejected = true;
+  for (size_t offset = 0; offset < good.size(); offset += 7) {
+    std::vector<uint8_t> bad = good;
+    bad[offset] ^= 0x04;
+    writeFile(kPath, bad);
+    Unit reboot;
+    rejected = rejected && !reboot.storage.load(reboot.hvac, reboot.schedule) &&
+               sameSettings(reboot, defaults);
+  }
+  check.expect(rejected, "a flipped bit rejects the record and leaves the defaults");
+
+  std::vector<uint8_t> shortened(good.begin(), good.end() - 1);
+  writeFile(kPath, shortened);
+  Unit truncated;
+  check.expect(!truncated.storage.load(truncated.hvac, truncated.schedule) &&
+                   sameSettings(truncated, defaults),
+               "a short record is rejected");
+}
+
+void checkTemporaryFile(Checker &check) {
+  host::formatFileSystem();
+  Unit first;
+  first.storage.save(first.hvac, first.schedule);
+  const std::vector<uint8_t> live = readFile(kPath);
+  Unit second;
+  second.edit();
+  second.storage.save(second.hvac, second.schedule);
+  const std::vector<uint8_t> newer = readFile(kPath);
+
+  // Cut off before the rename: the whole new record sits beside the old one.
+  writeFile(kPath, live);
+  writeFile(kTempPath, newer);
+  {
+    Unit reboot;
+    check.expect(reboot.storage.load(reboot.hvac, reboot.schedule) &&
+                     sameSettings(reboot, second),
+                 "a whole temporary record is the newer one and is used");
+    check.expect(!LittleFS.exists(kTempPath) && readFile(kPath) == newer,
+                 "and is renamed into place");
+  }
+
+  // Cut off while writing: part of the new record beside the old one.
+  writeFile(kPath, live);
+  writeFile(kTempPath, std::vector<uint8_t>(newer.begin(), newer.begin() + newer.size() / 2));
+  {
+    Unit reboot;
+    check.expect(reboot.storage.load(reboot.hvac, reboot.schedule) &&
+                     sameSettings(reboot, first),
+                 "a torn temporary record leaves the old one in use");
+    check.expect(!LittleFS.exists(kTempPath) && readFile(kPath) == live,
+                 "and is removed");
+  }
+
+  // A whole temporary record is also used when the first save never got its rename.
+  LittleFS.remove(kPath);
+  writeFile(kTempPath, newer);
+  Unit reboot;
+  check.expect(reboot.storage.load(reboot.hvac, reboot.schedule) && sameSettings(reboot, second),
+               "a temporary record without a live one is used");
+}
+
+void checkVersion1(Checker &check) {
+  host::formatFileSystem();
+  BlobV1 blob{};
+  blob.magic = kMagic;
+  blob.version = 1;
+  blob.payloadSize = sizeof(blob.payload);
+  blob.payload.targetTemperature = 21.5f;
+  blob.payload.hysteresis = 0.75f;
+  blob.payload.compressorTemperatureLimit = 55.0f;
+  blob.payload.compressorMinimumAmbient = 12.0f;
+  blob.payload.compressorCooldownTemperature = 9.0f;
+  blob.payload.compressorCooldownMinutes = 7.5f;
+  blob.payload.timezoneOffsetMinutes = -150;
+  blob.payload.fanMode = static_cast<uint8_t>(FanMode::kMedium);
+  blob.payload.systemMode = static_cast<uint8_t>(SystemMode::kHeating);
+  blob.payload.schedulingEnabled = 1;
+  blob.payload.weekdayCount = 2;
+  blob.payload.weekday[0] = {6, 30, static_cast<uint8_t>(ScheduledMode::kHeating), 0, 21.0f};
+  blob.payload.weekday[1] = {22, 0, static_cast<uint8_t>(ScheduledMode::kUnspecified), 0, 18.0f};
+  blob.payload.weekendCount = 1;
+  blob.payload.weekend[0] = {9, 15, static_cast<uint8_t>(ScheduledMode::kFanOnly), 0, 22.0f};
+  blob.crc = crc32(reinterpret_cast<const uint8_t *>(&blob), offsetof(BlobV1, crc));
+  writeFile(kPath, std::vector<uint8_t>(reinterpret_cast<const uint8_t *>(&blob),
+                                        reinterpret_cast<const uint8_t *>(&blob) + sizeof(blob)));
+
+  Unit expected;
+  expected.edit();
+  // Version 1 had no holiday profile or overrides; its weekend table covers Saturday and Sunday.
+  expected.schedule.setDaySchedule(ScheduleManager::kHolidayProfile, nullptr, 0);
+  expected.schedule.setDayOverrides(nullptr, 0);
+  const ScheduleEntry weekend[] = {{9, 15, 2200, ScheduledMode::kFanOnly}};
+  expected.schedule.setWeekendSchedule(weekend, 1);
+
+  Unit migrated;
+  check.expect(migrated.storage.load(migrated.hvac, migrated.schedule), "version 1 record loads");
+  check.expect(sameSettings(migrated, expected), "version 1 settings carry over");
+  check.expect(storedVersion(readFile(kPath)) == 2, "and are rewritten as version 2");
+  Unit reboot;
+  check.expect(reboot.storage.load(reboot.hvac, reboot.schedule) && sameSettings(reboot, expected),
+               "the rewritten record reads back the same");
+
+  // A damaged version 1 record is rejected like a current one.
+  blob.payload.weekdayCount = 3;
+  writeFile(kPath, std::vector<uint8_t>(reinterpret_cast<const uint8_t *>(&blob),
+                                        reinterpret_cast<const uint8_t *>(&blob) + sizeof(blob)));
+  Unit damaged;
+  check.expect(!damaged.storage.load(damaged.hvac, damaged.schedule) &&
+                   storedVersion(readFile(kPath)) == 1,
+               "a damaged version 1 record is rejected and left alone");
+}
+
+void checkTextFile(Checker &check) {
+  host::formatFileSystem();
+  const char kText[] =
+      "# written by the text-format firmware\n"
+      "target=21.5\n"
+      "fanMode=medium\n"
+      "systemMode=heating\n"
+      "scheduling=true\n"
+      "timezoneOffsetMinutes=-150\n"
+      "weekday=06:30=21.0|heating;22:00=18.0\n";
+  writeFile(kLegacyPath, std::vector<uint8_t>(kText, kText + sizeof(kText) - 1));
+
+  Unit migrated;
+  check.expect(migrated.storage.load(migrated.hvac, migrated.schedule), "text file loads");
+  check.expect(migrated.hvac.targetTemperature() == 2150 &&
+                   migrated.hvac.fanMode() == FanMode::kMedium &&
+                   migrated.hvac.systemMode() == SystemMode::kHeating &&
+                   migrated.schedule.timezoneOffsetMinutes() == -150,
+               "text settings carry over", migrated.hvac.targetTemperature());
+  size_t count = 0;
+  migrated.schedule.packedDaySchedule(1, count);  // Monday.
+  check.expect(count == 2, "text schedule carries over", static_cast<long>(count));
+  check.expect(!LittleFS.exists(kLegacyPath) && storedVersion(readFile(kPath)) == 2,
+               "text file is replaced by the record");
+}
+
+}  // namespace
+
+int main() {
+  host::VirtualClock::reset();
+  Checker check;
+  checkRoundTrip(check);
+  checkRejected(check);
+  checkTemporaryFile(check);
+  checkVersion1(check);
+  checkTextFile(check);
+  return check.finish("settings record");
+}
@@ -0,0 +1,369 @@
+// Fuzzes the schedule codec (ScheduleCodec.h) on the host, after spot checks
+// of its grammar, the dated overrides and the mode-name tables. Random profiles must survive
+// formatSchedule() and parseSchedule() unchanged, also when the output buffer
+// is too small; mutated and random texts must parse without reading past
+// their length and, when accepted, must read back identically after
+// formatting. Texts are passed in exactly sized heap copies with no
+// terminator, so an overread shows up under -fsanitize=address.
+//
+//   thn_fuzz_schedule [--iterations N] [--seed N]
+
+#include <Arduino.h>
+
+#include <memory>
+#include <random>
+#include <string>
+
+#include "ScheduleCodec.h"
+
+using scheduler::DayOverride;
+using scheduler::ScheduledMode;
+using scheduler::ScheduleEntry;
+using scheduler::ScheduleError;
+using scheduler::ScheduleManager;
+using scheduler::ScheduleParseResult;
+
+namespace {
+
+constexpr size_t kCapacity = ScheduleManager::kMaxEntries;
+
+struct Options {
+  unsigned long iterations = 200000;
+  unsigned long seed = 1;
+};
+
+struct Known {
+  const char *text;
+  ScheduleError error;
+  size_t count;
+  ScheduleEntry first;
+};
+
+// Spot checks of the grammar itself; the fuzzing below only checks consistency.
+const Known kKnown[] = {
+    {"", ScheduleError::kNone, 0, {}},
+    {" ; ;", ScheduleError::kNone, 0, {}},
+    {"6:30=21.5|Heating", ScheduleError::kNone, 1, {6, 30, 2150, ScheduledMode::kHeating}},
+    {" 06:30 = 21.5 | fan ;", ScheduleError::kNone, 1, {6, 30, 2150, ScheduledMode::kFanOnly}},
+    {"22:00=18|", ScheduleError::kNone, 1, {22, 0, 1800, ScheduledMode::kUnspecified}},
+    {"00:00=-0.125", ScheduleError::kNone, 1, {0, 0, -13, ScheduledMode::kUnspecified}},
+    {"23:59=327.67|idle", ScheduleError::kNone, 1, {23, 59, 32767, ScheduledMode::kIdle}},
+    {"07:00=.5", ScheduleError::kNone, 1, {7, 0, 50, ScheduledMode::kUnspecified}},
+    {"07:00", ScheduleError::kSyntax, 0, {}},
+    {"24:00=20", ScheduleError::kTime, 0, {}},
+    {"7:5=20", ScheduleError::kTime, 0, {}},
+    {"07:00=20;08:60=20", ScheduleError::kTime, 1, {7, 0, 2000, ScheduledMode::kUnspecified}},
+    {"07:00=", ScheduleError::kTemperature, 0, {}},
+    {"07:00=20C", ScheduleError::kTemperature, 0, {}},
+    {"07:00=327.68", ScheduleError::kTemperature, 0, {}},
+    {"07:00=1e2", ScheduleError::kTemperature, 0, {}},
+    {"07:00=20|auto", ScheduleError::kMode, 0, {}},
+};
+
+struct KnownOverride {
+  const char *text;
+  ScheduleError error;
+  size_t count;
+  DayOverride first;
+};
+
+const KnownOverride kKnownOverrides[] = {
+    {"", ScheduleError::kNone, 0, {}},
+    {"1970-01-01=sun", ScheduleError::kNone, 1, {0, 0, 0}},
+    {" 2024-12-25 = Holiday ;",
+     ScheduleError::kNone,
+     1,
+     {20082, ScheduleManager::kHolidayProfile, 0}},
+    {"2024-02-29=sat", ScheduleError::kNone, 1, {19782, 6, 0}},
+    {"2149-06-06=mon", ScheduleError::kNone, 1, {65535, 1, 0}},
+    {"2024-12-25", ScheduleError::kSyntax, 0, {}},
+    {"2023-02-29=sat", ScheduleError::kDate, 0, {}},
+    {"2024-13-01=sat", ScheduleError::kDate, 0, {}},
+    {"2024-1-01=sat", ScheduleError::kDate, 0, {}},
+    {"1969-12-31=sat", ScheduleError::kDate, 0, {}},
+    {"2149-06-07=sat", ScheduleError::kDate, 0, {}},
+    {"2024-12-25=xmas", ScheduleError::kProfile, 0, {}},
+    {"2024-12-24=sat;2024-12-25=", ScheduleError::kProfile, 1, {20081, 6, 0}},
+};
+
+bool parseOptions(int argc, char **argv, Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    if (i + 1 >= argc) {
+      return false;
+    }
+    unsigned long value = strtoul(argv[i + 1], nullptr, 10);
+    if (strcmp(argv[i], "--iterations") == 0) {
+      options.iterations = value;
+    } else if (strcmp(argv[i], "--seed") == 0) {
+      options.seed = value;
+    } else {
+      return false;
+    }
+    ++i;
+  }
+  return true;
+}
+
+bool sameEntry(const ScheduleEntry &a, const ScheduleEntry &b) {
+  return a.hour == b.hour && a.minute == b.minute && a.temperature == b.temperature &&
+         a.mode == b.mode;
+}
+
+bool sameEntries(const ScheduleEntry *a, const ScheduleEntry *b, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    if (!sameEntry(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/** Parses `text` from an unterminated heap copy of exactly its length. */
+ScheduleParseResult parseExact(const std::string &text, ScheduleEntry *entries, size_t capacity) {
+  std::unique_ptr<char[]> copy(new char[text.size() > 0 ? text.size() : 1]);
+  memcpy(copy.get(), text.data(), text.size());
+  return scheduler::parseSchedule(copy.get(), text.size(), entries, capacity);
+}
+
+std::string format(const ScheduleEntry *entries, size_t count) {
+  char buffer[scheduler::kMaxScheduleTextSize];
+  size_t length = scheduler::formatSchedule(entries, count, buffer, sizeof(buffer));
+  return std::string(buffer, length < sizeof(buffer) ? length : 0);
+}
+
+ScheduleEntry randomEntry(std::mt19937 &random) {
+  std::uniform_int_distribution<int> hour(0, 23);
+  std::uniform_int_distribution<int> minute(0, 59);
+  std::uniform_int_distribution<int> temperature(-32767, 32767);
+  std::uniform_int_distribution<int> mode(0, static_cast<int>(ScheduledMode::kIdle));
+  return ScheduleEntry(static_cast<uint8_t>(hour(random)), static_cast<uint8_t>(minute(random)),
+                       static_cast<units::CentiCelsius>(temperature(random)),
+                       static_cast<ScheduledMode>(mode(random)));
+}
+
+void mutate(std::string &text, std::mt19937 &random) {
+  static const char kAlphabet[] = "0123456789:=|;.- \tcoolingheatfanidleCOOLx";
+  std::uniform_int_distribution<int> operation(0, 4);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::uniform_int_distribution<size_t> symbol(0, sizeof(kAlphabet) - 2);
+  size_t position = text.empty() ? 0 : std::uniform_int_distribution<size_t>(0, text.size())(random);
+  switch (operation(random)) {
+    case 0:
+      text.insert(position, 1, kAlphabet[symbol(random)]);
+      break;
+    case 1:
+      text.insert(position, 1, static_cast<char>(byte(random)));
+      break;
+    case 2:
+      if (position < text.size()) {
+        text.erase(position, 1);
+      }
+      break;
+    case 3:
+      if (position < text.size()) {
+        text[position] = kAlphabet[symbol(random)];
+      }
+      break;
+    default:
+      if (position < text.size()) {
+        size_t length = std::uniform_int_distribution<size_t>(1, text.size() - position)(random);
+        text.insert(position, text.substr(position, length));
+      }
+      break;
+  }
+}
+
+class Fuzzer {
+ public:
+  explicit Fuzzer(unsigned long seed) : random_(seed) {}
+
+  unsigned long failures() const { return failures_; }
+
+  void checkKnown() {
+    for (const Known &known : kKnown) {
+      ScheduleEntry entries[kCapacity];
+      ScheduleParseResult result = parseExact(known.text, entries, kCapacity);
+      bool ok = result.error == known.error && result.count == known.count &&
+                (known.count == 0 || sameEntry(entries[0], known.first));
+      if (!ok) {
+        fail("known case", known.text);
+      }
+    }
+    for (const KnownOverride &known : kKnownOverrides) {
+      DayOverride overrides[ScheduleManager::kMaxDayOverrides];
+      ScheduleParseResult result = scheduler::parseDayOverrides(
+          known.text, strlen(known.text), overrides, ScheduleManager::kMaxDayOverrides);
+      bool ok = result.error == known.error && result.count == known.count &&
+                (known.count == 0 || (overrides[0].day == known.first.day &&
+                                      overrides[0].profile == known.first.profile));
+      if (!ok) {
+        fail("known override", known.text);
+      }
+    }
+    // Every storable day formats to a date that reads back to it.
+    for (uint32_t day = 0; day <= 0xFFFF; ++day) {
+      char text[24];
+      size_t length = scheduler::formatDay(static_cast<uint16_t>(day), text, sizeof(text));
+      uint8_t profile = static_cast<uint8_t>(day % ScheduleManager::kProfileCount);
+      const char *name = scheduler::scheduleProfileName(profile);
+      text[length++] = '=';
+      memcpy(text + length, name, strlen(name));
+      length += strlen(name);
+      DayOverride parsed = {};
+      ScheduleParseResult result = scheduler::parseDayOverrides(text, length, &parsed, 1);
+      if (!result.ok() || result.count != 1 || parsed.day != day || parsed.profile != profile) {
+        fail("override round trip", std::string(text, length));
+        break;
+      }
+    }
+    for (int i = 0; i <= static_cast<int>(controller::FanMode::kHigh); ++i) {
+      controller::FanMode mode = static_cast<controller::FanMode>(i);
+      const char *name = scheduler::fanModeName(mode);
+      controller::FanMode parsed = controller::FanMode::kAuto;
+      if (!scheduler::fanModeFromName(name, strlen(name), parsed) || parsed != mode) {
+        fail("fan mode name", name);
+      }
+    }
+    for (int i = 0; i <= static_cast<int>(controller::SystemMode::kIdle); ++i) {
+      controller::SystemMode mode = static_cast<controller::SystemMode>(i);
+      const char *name = scheduler::systemModeName(mode);
+      controller::SystemMode parsed = controller::SystemMode::kCooling;
+      if (!scheduler::systemModeFromName(name, strlen(name), parsed) || parsed != mode) {
+        fail("system mode name", name);
+      }
+    }
+    controller::FanMode fan = controller::FanMode::kAuto;
+    controller::SystemMode system = controller::SystemMode::kCooling;
+    if (!scheduler::fanModeFromName("HIGH", 4, fan) || fan != controller::FanMode::kHigh ||
+        scheduler::fanModeFromName("hi", 2, fan) || scheduler::systemModeFromName("", 0, system)) {
+      fail("mode name lookup", "HIGH/hi/empty");
+    }
+
+    ScheduleEntry entries[kCapacity];
+    ScheduleParseResult full = parseExact("1:00=1;2:00=2;3:00=3", entries, 2);
+    if (full.error != ScheduleError::kTooManyEntries || full.count != 2 || full.position != 14) {
+      fail("capacity", "1:00=1;2:00=2;3:00=3");
+    }
+  }
+
+  /** Random profiles read back unchanged, whole or cut to a small buffer. */
+  void roundTrip() {
+    ScheduleEntry entries[kCapacity];
+    size_t count = std::uniform_int_distribution<size_t>(0, kCapacity)(random_);
+    for (size_t i = 0; i < count; ++i) {
+      entries[i] = randomEntry(random_);
+    }
+    std::string text = format(entries, count);
+    if (count > 0 && text.empty()) {
+      fail("format did not fit kMaxScheduleTextSize", "");
+      return;
+    }
+    ScheduleEntry parsed[kCapacity];
+    ScheduleParseResult result = parseExact(text, parsed, kCapacity);
+    if (!result.ok() || result.count != count || !sameEntries(entries, parsed, count)) {
+      fail("round trip", text);
+      return;
+    }
+
+    char small[64];
+    size_t capacity = std::uniform_int_distribution<size_t>(1, sizeof(small))(random_);
+    size_t length = scheduler::formatSchedule(entries, count, small, capacity);
+    if (length != text.size() || strlen(small) >= capacity ||
+        text.compare(0, strlen(small), small) != 0) {
+      fail("truncated format", text);
+      return;
+    }
+    result = parseExact(small, parsed, kCapacity);
+    if (!result.ok() || result.count > count || !sameEntries(entries, parsed, result.count)) {
+      fail("truncated round trip", small);
+    }
+  }
+
+  /** Damaged profiles and random bytes: consistent results, canonical when accepted. */
+  void mutated() {
+    std::string text;
+    if (std::uniform_int_distribution<int>(0, 7)(random_) == 0) {
+      size_t length = std::uniform_int_distribution<size_t>(0, 48)(random_);
+      for (size_t i = 0; i < length; ++i) {
+        text += static_cast<char>(std::uniform_int_distribution<int>(0, 255)(random_));
+      }
+    } else {
+      ScheduleEntry entries[4];
+      size_t count = std::uniform_int_distribution<size_t>(1, 4)(random_);
+      for (size_t i = 0; i < count; ++i) {
+        entries[i] = randomEntry(random_);
+      }
+      text = format(entries, count);
+      int mutations = std::uniform_int_distribution<int>(1, 4)(random_);
+      for (int i = 0; i < mutations; ++i) {
+        mutate(text, random_);
+      }
+    }
+
+    ScheduleEntry parsed[kCapacity];
+    size_t capacity = std::uniform_int_distribution<size_t>(0, kCapacity)(random_);
+    ScheduleParseResult result = parseExact(text, parsed, capacity);
+    if (result.count > capacity || result.position > text.size() ||
+        (result.ok() && result.position != text.size()) ||
+        (!result.ok() && (result.position == text.size() || text[result.position] == ' ' ||
+                          text[result.position] == '\t' || text[result.position] == ';'))) {
+      fail("inconsistent result", text);
+      return;
+    }
+    for (size_t i = 0; i < result.count; ++i) {
+      const ScheduleEntry &entry = parsed[i];
+      if (entry.hour > 23 || entry.minute > 59 || !units::isValid(entry.temperature) ||
+          entry.mode > ScheduledMode::kIdle) {
+        fail("out of range entry", text);
+        return;
+      }
+    }
+    std::string canonical = format(parsed, result.count);
+    ScheduleEntry again[kCapacity];
+    ScheduleParseResult reread = parseExact(canonical, again, kCapacity);
+    if (!reread.ok() || reread.count != result.count || !sameEntries(parsed, again, result.count)) {
+      fail("accepted entries do not read back", text);
+    }
+  }
+
+ private:
+  void fail(const char *what, const std::string &text) {
+    if (failures_++ < 10) {
+      std::string printable;
+      for (char c : text) {
+        unsigned char byte = static_cast<unsigned char>(c);
+        if (byte >= 0x20 && byte < 0x7F) {
+          printable += c;
+        } else {
+          char escaped[8];
+          snprintf(escaped, sizeof(escaped), "\\x%02x", byte);
+          printable += escaped;
+        }
+      }
+      fprintf(stderr, "%s: \"%s\"\n", what, printable.c_str());
+    }
+  }
+
+  std::mt19937 random_;
+  unsigned long failures_ = 0;
+};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    fprintf(stderr, "usage: %s [--iterations N] [--seed N]\n", argv[0]);
+    return 2;
+  }
+
+  Fuzzer fuzzer(options.seed);
+  fuzzer.checkKnown();
+  for (unsigned long i = 0; i < options.iterations; ++i) {
+    fuzzer.roundTrip();
+    fuzzer.mutated();
+  }
+  printf("schedule codec      %lu round trips, %lu mutated texts, seed %lu, %lu failures\n",
+         options.iterations, options.iterations, options.seed, fuzzer.failures());
+  return fuzzer.failures() == 0 ? 0 : 1;
+}
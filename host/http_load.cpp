@@ -0,0 +1,461 @@
+// Drives WebInterface's HTTP server on the host with simulated clients over
+// the in-memory TCP stand-in, interleaved with the controller loop, and
+// reports completed requests per second and the spread of loop() iteration
+// times. Every client cycles through a mix of dashboard requests; the first
+// --slow-clients of them read their responses --slow-read-bytes at a time per
+// iteration, so send queues fill and the server has to hold back instead of
+// buffering whole responses.
+//
+// Then three clients request seven hours of the power log and read a block
+// of it a second, so their queues hold the server's whole send budget; a
+// fourth, connected once they have, reads the same response as fast as it
+// comes. Waiting on the others' queues, it must not be dropped as a client
+// that stopped reading: every copy has to arrive whole, with no timeouts.
+//
+// Afterwards the unit is switched to idle in a room held at a steady
+// temperature, with no standby draw metered, and a dashboard polls
+// /api/state with its cursor every few seconds. Only polls that see a new
+// minute row in either log may get content; control ticks that change
+// nothing a response shows must leave the others at 304.
+//
+//   thn_http_load [--clients N] [--slow-clients N] [--slow-read-bytes N]
+//                 [--requests N] [--history-hours N] [--step-ms N]
+//
+// Loop times are host wall-clock times; like thn_bench they only compare
+// builds against each other.
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include <LittleFS.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "HVACController.h"
+#include "LoopMetrics.h"
+#include "PowerLog.h"
+#include "ScheduleManager.h"
+#include "SensorManager.h"
+#include "SettingsStorage.h"
+#include "TemperatureLog.h"
+#include "ThermalPlant.h"
+#include "WebInterface.h"
+
+using controller::Compressor;
+using controller::FanController;
+using controller::FanMode;
+using controller::FanSpeed;
+using controller::HVACController;
+using controller::SensorManager;
+using controller::SystemMode;
+using logging::PowerLog;
+using logging::TemperatureLog;
+using scheduler::ScheduleManager;
+
+namespace {
+
+// Monday 2024-01-01 00:00 UTC, as in thn_sim.
+constexpr time_t kEpochAtBoot = 1704067200;
+constexpr uint16_t kPort = 80;
+constexpr unsigned long kWarmupStepMs = 1000;
+constexpr unsigned long long kMaxIterations = 20000000ULL;
+constexpr unsigned long kIdleSettleMs = 15UL * 60UL * 1000UL;  // Past every countdown.
+constexpr unsigned long kIdlePollMs = 5000;
+constexpr unsigned long kIdlePolls = 120;
+constexpr size_t kTricklingClients = 3;
+constexpr size_t kTrickleBytes = 512;
+constexpr unsigned long kTrickleMs = 1000;     // Inside the server's write timeout.
+constexpr unsigned long kTrickleFillMs = 200;  // Before the reader connects.
+constexpr unsigned long kTrickleMaxMs = 300000;
+
+constexpr uint8_t kCompressorRelayPin = 16;
+constexpr FanController::Pins kFanPins = {5, 14, 12};
+
+const PowerLog::ConsumptionRate kConsumptionTable[] = {
+    {FanSpeed::kOff, false, 5.0f},   {FanSpeed::kLow, false, 110.0f},
+    {FanSpeed::kMedium, false, 125.0f}, {FanSpeed::kHigh, false, 140.0f},
+    {FanSpeed::kLow, true, 600.0f}, {FanSpeed::kMedium, true, 650.0f},
+    {FanSpeed::kHigh, true, 700.0f},
+};
+// Any standby draw moves the energy counter a hundredth of a Wh every few seconds.
+const PowerLog::ConsumptionRate kIdleConsumptionTable[] = {{FanSpeed::kOff, false, 0.0f}};
+
+struct Options {
+  size_t clients = 8;
+  size_t slowClients = 2;
+  size_t slowReadBytes = 128;
+  unsigned long requests = 2000;
+  unsigned long historyHours = 48;
+  unsigned long stepMs = 5;
+};
+
+struct Client {
+  std::shared_ptr<host::TcpSocket> socket;
+  std::string response;
+  size_t next = 0;  // Index into the request mix.
+  bool slow = false;
+};
+
+struct Totals {
+  unsigned long completed = 0;
+  unsigned long ok = 0;           // 200 and 304.
+  unsigned long failed = 0;       // Anything else, or a reply without a status line.
+  unsigned long long bytes = 0;
+};
+
+bool parseOptions(int argc, char **argv, Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    if (i + 1 >= argc) {
+      return false;
+    }
+    unsigned long value = strtoul(argv[i + 1], nullptr, 10);
+    if (strcmp(argv[i], "--clients") == 0) {
+      options.clients = value;
+    } else if (strcmp(argv[i], "--slow-clients") == 0) {
+      options.slowClients = value;
+    } else if (strcmp(argv[i], "--slow-read-bytes") == 0) {
+      options.slowReadBytes = value;
+    } else if (strcmp(argv[i], "--requests") == 0) {
+      options.requests = value;
+    } else if (strcmp(argv[i], "--history-hours") == 0) {
+      options.historyHours = value;
+    } else if (strcmp(argv[i], "--step-ms") == 0) {
+      options.stepMs = value;
+    } else {
+      return false;
+    }
+    ++i;
+  }
+  return options.clients > 0 && options.slowClients <= options.clients &&
+         options.slowReadBytes > 0 && options.requests > 0 && options.stepMs > 0;
+}
+
+std::vector<std::string> requestMix() {
+  char powerRange[96];
+  unsigned long now = static_cast<unsigned long>(time(nullptr));
+  snprintf(powerRange, sizeof(powerRange), "/api/power-log?start=%lu&end=%lu", now - 3600UL, now);
+  std::vector<std::string> paths = {
+      "/api/state",
+      "/api/power-log?resolution=3600&format=bin",
+      powerRange,
+      "/api/temperature-history?points=120",
+      "/",
+      "/api/state",
+      "/api/metrics",
+      "/api/temperature-history?points=120&format=bin",
+  };
+  std::vector<std::string> requests;
+  for (const std::string &path : paths) {
+    requests.push_back("GET " + path + " HTTP/1.1\r\nHost: thn\r\nAccept: */*\r\n\r\n");
+  }
+  const char kConfig[] = "target=24.5&fanMode=auto";
+  char post[192];
+  snprintf(post, sizeof(post),
+           "POST /api/config HTTP/1.1\r\nHost: thn\r\n"
+           "Content-Type: application/x-www-form-urlencoded\r\nContent-Length: %zu\r\n\r\n%s",
+           sizeof(kConfig) - 1, kConfig);
+  requests.push_back(post);
+  return requests;
+}
+
+/** Plays the peer side of one client for an iteration: connect, send, read, finish. */
+void driveClient(Client &client,
+                 const std::vector<std::string> &requests,
+                 const Options &options,
+                 Totals &totals,
+                 bool connect) {
+  if (client.socket == nullptr) {
+    if (!connect) {
+      return;
+    }
+    client.socket = host::connect(kPort);
+    const std::string &request = requests[client.next];
+    client.socket->toServer.insert(client.socket->toServer.end(), request.begin(), request.end());
+    client.response.clear();
+    return;
+  }
+
+  std::deque<uint8_t> &incoming = client.socket->toPeer;
+  size_t count = client.slow ? std::min(options.slowReadBytes, incoming.size()) : incoming.size();
+  // Only the status line is kept; the rest of the body is counted and dropped.
+  for (size_t i = 0; i < count && client.response.size() < 16; ++i) {
+    client.response += static_cast<char>(incoming[i]);
+  }
+  incoming.erase(incoming.begin(), incoming.begin() + static_cast<long>(count));
+  totals.bytes += count;
+  if (!client.socket->serverClosed || !incoming.empty()) {
+    return;
+  }
+
+  ++totals.completed;
+  int code = 0;
+  if (client.response.compare(0, 9, "HTTP/1.1 ") == 0) {
+    code = atoi(client.response.c_str() + 9);
+  }
+  if (code == 200 || code == 304) {
+    ++totals.ok;
+  } else {
+    ++totals.failed;
+    fprintf(stderr, "request %zu answered %d\n", client.next, code);
+  }
+  client.socket->peerClosed = true;
+  client.socket.reset();
+  client.next = (client.next + 1) % requests.size();
+}
+
+/** Value of a top-level integer field in a JSON body, e.g. "seq"; 0 when absent. */
+unsigned long jsonNumber(const std::string &body, const char *name) {
+  std::string key = std::string("\"") + name + "\":";
+  size_t position = body.find(key);
+  if (position == std::string::npos) {
+    return 0;
+  }
+  return strtoul(body.c_str() + position + key.size(), nullptr, 10);
+}
+
+double percentile(std::vector<double> &sorted, double quantile) {
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  size_t index = static_cast<size_t>(quantile * static_cast<double>(sorted.size() - 1) + 0.5);
+  return sorted[index];
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    fprintf(stderr,
+            "usage: %s [--clients N] [--slow-clients N] [--slow-read-bytes N]\n"
+            "          [--requests N] [--history-hours N] [--step-ms N]\n",
+            argv[0]);
+    return 2;
+  }
+
+  host::VirtualClock::reset();
+  host::VirtualClock::setEpochAtBoot(kEpochAtBoot);
+  host::formatFileSystem();
+
+  static Compressor compressor(kCompressorRelayPin);
+  static FanController fan(kFanPins);
+  static SensorManager sensors;
+  static ScheduleManager scheduleManager;
+  static TemperatureLog temperatureLog;
+  static PowerLog powerLog;
+  static storage::SettingsStorage settingsStorage;
+  static HVACController hvac(compressor, fan, sensors, scheduleManager, temperatureLog, powerLog);
+  static diagnostics::LoopMetrics loopMetrics;
+  static interface::WebInterface webInterface(hvac, scheduleManager, temperatureLog, powerLog,
+                                              &settingsStorage, kPort);
+
+  static host::ThermalPlant plant(host::ThermalPlant::Config{});
+  plant.connect(sensors);
+  powerLog.setConsumptionTable(kConsumptionTable,
+                               sizeof(kConsumptionTable) / sizeof(kConsumptionTable[0]));
+  hvac.setSystemMode(SystemMode::kCooling);
+  hvac.setFanMode(FanMode::kAuto);
+  hvac.begin();
+
+  // Fill the logs first so history responses have their usual size.
+  const unsigned long warmupMs = options.historyHours * 3600000UL;
+  while (millis() < warmupMs) {
+    host::VirtualClock::advance(kWarmupStepMs);
+    plant.step(kWarmupStepMs, hvac.compressorRunning(), fan.currentSpeed(), hvac.systemMode());
+    hvac.update();
+  }
+
+  settingsStorage.begin();
+  webInterface.setLoopMetrics(&loopMetrics);
+  webInterface.begin();
+
+  std::vector<std::string> requests = requestMix();
+  std::vector<Client> clients(options.clients);
+  for (size_t i = 0; i < clients.size(); ++i) {
+    clients[i].slow = i < options.slowClients;
+    clients[i].next = i % requests.size();
+  }
+
+  Totals totals;
+  std::vector<double> loopUs;
+  double busySeconds = 0.0;
+  unsigned long long iterations = 0;
+  auto wallStart = std::chrono::steady_clock::now();
+  while (totals.completed < options.requests && iterations < kMaxIterations) {
+    for (Client &client : clients) {
+      driveClient(client, requests, options, totals, true);
+    }
+
+    auto loopStart = std::chrono::steady_clock::now();
+    uint32_t mark = diagnostics::LoopMetrics::mark();
+    host::VirtualClock::advance(options.stepMs);
+    plant.step(options.stepMs, hvac.compressorRunning(), fan.currentSpeed(), hvac.systemMode());
+    scheduleManager.update(hvac);
+    hvac.update();
+    webInterface.handleClient();
+    loopMetrics.finishLoop(mark);
+    double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - loopStart).count();
+    busySeconds += seconds;
+    loopUs.push_back(seconds * 1e6);
+    ++iterations;
+  }
+  double wallSeconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+  // The plant is no longer stepped, so the probes read the same values throughout.
+  auto runFor = [&](unsigned long ms) {
+    for (unsigned long elapsed = 0; elapsed < ms; elapsed += kWarmupStepMs) {
+      host::VirtualClock::advance(kWarmupStepMs);
+      scheduleManager.update(hvac);
+      hvac.update();
+      webInterface.handleClient();
+    }
+  };
+  auto get = [&](const std::string &path, int &code) {
+    std::shared_ptr<host::TcpSocket> socket = host::connect(kPort);
+    std::string request = "GET " + path + " HTTP/1.1\r\nHost: thn\r\n\r\n";
+    socket->toServer.insert(socket->toServer.end(), request.begin(), request.end());
+    std::string response;
+    for (int i = 0; i < 1000 && !(socket->serverClosed && socket->toPeer.empty()); ++i) {
+      host::VirtualClock::advance(1);
+      webInterface.handleClient();
+      response.append(socket->toPeer.begin(), socket->toPeer.end());
+      socket->toPeer.clear();
+    }
+    socket->peerClosed = true;
+    code = response.compare(0, 9, "HTTP/1.1 ") == 0 ? atoi(response.c_str() + 9) : 0;
+    size_t body = response.find("\r\n\r\n");
+    return body == std::string::npos ? std::string() : response.substr(body + 4);
+  };
+
+  // Let the load clients finish before the server stats are read.
+  for (bool pending = true; pending;) {
+    pending = false;
+    for (Client &client : clients) {
+      driveClient(client, requests, options, totals, false);
+      pending = pending || client.socket != nullptr;
+    }
+    host::VirtualClock::advance(options.stepMs);
+    webInterface.handleClient();
+  }
+  const interface::HttpServer::Stats &http = webInterface.httpStats();
+  const uint32_t loadTimeouts = http.timeouts;
+
+  // The range ends in the past, so the reference copy and the streamed ones match.
+  unsigned long now = static_cast<unsigned long>(time(nullptr));
+  char trickledPath[96];
+  snprintf(trickledPath, sizeof(trickledPath), "/api/power-log?start=%lu&end=%lu",
+           now - 8UL * 3600UL, now - 3600UL);
+  int trickledCode = 0;
+  std::string expected = get(trickledPath, trickledCode);
+  std::string trickledRequest =
+      std::string("GET ") + trickledPath + " HTTP/1.1\r\nHost: thn\r\n\r\n";
+  auto request = [&]() {
+    std::shared_ptr<host::TcpSocket> socket = host::connect(kPort);
+    socket->toServer.insert(socket->toServer.end(), trickledRequest.begin(),
+                            trickledRequest.end());
+    return socket;
+  };
+  auto finished = [](const std::shared_ptr<host::TcpSocket> &socket) {
+    return socket->serverClosed && socket->toPeer.empty();
+  };
+  // The trickling clients fill the send budget before the reader asks, and are serviced first.
+  std::vector<std::shared_ptr<host::TcpSocket>> trickling;
+  for (size_t i = 0; i < kTricklingClients; ++i) {
+    trickling.push_back(request());
+  }
+  for (unsigned long elapsed = 0; elapsed < kTrickleFillMs; elapsed += options.stepMs) {
+    host::VirtualClock::advance(options.stepMs);
+    webInterface.handleClient();
+  }
+  std::shared_ptr<host::TcpSocket> reader = request();
+  std::string streamed;
+  unsigned long nextTrickle = millis();
+  for (unsigned long elapsed = 0; elapsed < kTrickleMaxMs; elapsed += options.stepMs) {
+    bool pending = !finished(reader);
+    for (const std::shared_ptr<host::TcpSocket> &socket : trickling) {
+      pending = pending || !finished(socket);
+    }
+    if (!pending) {
+      break;
+    }
+    host::VirtualClock::advance(options.stepMs);
+    webInterface.handleClient();
+    streamed.append(reader->toPeer.begin(), reader->toPeer.end());
+    reader->toPeer.clear();
+    if (millis() >= nextTrickle) {
+      nextTrickle += kTrickleMs;
+      for (std::shared_ptr<host::TcpSocket> &socket : trickling) {
+        size_t count = std::min(kTrickleBytes, socket->toPeer.size());
+        socket->toPeer.erase(socket->toPeer.begin(),
+                             socket->toPeer.begin() + static_cast<long>(count));
+      }
+    }
+  }
+  unsigned long trickledDone = 0;
+  for (std::shared_ptr<host::TcpSocket> &socket : trickling) {
+    trickledDone += finished(socket) ? 1 : 0;
+    socket->peerClosed = true;
+  }
+  reader->peerClosed = true;
+  size_t streamedBody = streamed.find("\r\n\r\n");
+  bool streamedWhole = trickledCode == 200 && streamedBody != std::string::npos &&
+                       streamed.compare(streamedBody + 4, std::string::npos, expected) == 0;
+  const uint32_t trickleTimeouts = http.timeouts - loadTimeouts;
+
+  hvac.setSystemMode(SystemMode::kIdle);
+  powerLog.setConsumptionTable(kIdleConsumptionTable,
+                               sizeof(kIdleConsumptionTable) / sizeof(kIdleConsumptionTable[0]));
+  runFor(kIdleSettleMs);
+  int code = 0;
+  std::string body = get("/api/state", code);
+  unsigned long boot = jsonNumber(body, "boot");
+  unsigned long seq = jsonNumber(body, "seq");
+  unsigned long notModified = 0;
+  for (unsigned long poll = 0; poll < kIdlePolls; ++poll) {
+    runFor(kIdlePollMs);
+    char path[64];
+    snprintf(path, sizeof(path), "/api/state?boot=%lu&since=%lu", boot, seq);
+    body = get(path, code);
+    if (code == 304) {
+      ++notModified;
+    } else if (code == 200) {
+      seq = jsonNumber(body, "seq");
+    }
+  }
+
+  std::sort(loopUs.begin(), loopUs.end());
+  printf("clients             %zu (%zu reading %zu bytes per iteration)\n", options.clients,
+         options.slowClients, options.slowReadBytes);
+  printf("requests            %lu completed, %lu ok, %lu failed, %.1f KiB received\n",
+         totals.completed, totals.ok, totals.failed, totals.bytes / 1024.0);
+  printf("throughput          %.0f requests/s over %.3f s (%.0f requests/s of loop time)\n",
+         totals.completed / (wallSeconds > 0 ? wallSeconds : 1), wallSeconds,
+         totals.completed / (busySeconds > 0 ? busySeconds : 1));
+  printf("loop iteration      p50 %.1f us, p99 %.1f us, max %.1f us over %llu iterations\n",
+         percentile(loopUs, 0.5), percentile(loopUs, 0.99), loopUs.empty() ? 0.0 : loopUs.back(),
+         iterations);
+  printf("server              %lu dispatched, %lu rejected, %lu timeouts, %lu throttled, "
+         "peak queue %zu bytes\n",
+         static_cast<unsigned long>(http.requests), static_cast<unsigned long>(http.rejected),
+         static_cast<unsigned long>(loadTimeouts), static_cast<unsigned long>(http.throttled),
+         http.peakQueuedBytes);
+  printf("trickling clients   %lu of %zu done, %lu timeouts, %lu held back, %zu of %zu bytes "
+         "streamed %s\n",
+         trickledDone, kTricklingClients, static_cast<unsigned long>(trickleTimeouts),
+         static_cast<unsigned long>(http.heldBack),
+         streamedBody == std::string::npos ? 0 : streamed.size() - streamedBody - 4,
+         expected.size(), streamedWhole ? "intact" : "cut short");
+  // Each log opens a row a minute, not necessarily on the same tick.
+  const unsigned long newRows = 2 * (kIdlePolls * kIdlePollMs / 60000UL + 1);
+  printf("idle polls          %lu of %lu answered 304 (every %lu s)\n", notModified, kIdlePolls,
+         kIdlePollMs / 1000);
+  bool ok = totals.completed >= options.requests && totals.failed == 0 && loadTimeouts == 0 &&
+            streamedWhole && trickleTimeouts == 0 && trickledDone == kTricklingClients &&
+            notModified + newRows >= kIdlePolls;
+  return ok ? 0 : 1;
+}
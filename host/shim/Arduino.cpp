@@ -0,0 +1,111 @@
+#include "Arduino.h"
+
+#include <ctype.h>
+
+#include <map>
+
+namespace host {
+
+uint64_t VirtualClock::nowMs_ = 0;
+time_t VirtualClock::epochAtBoot_ = 0;
+
+namespace {
+std::map<uint8_t, uint8_t> &pinLevels() {
+  static std::map<uint8_t, uint8_t> levels;
+  return levels;
+}
+
+bool serialEcho = false;
+}  // namespace
+
+uint8_t pinLevel(uint8_t pin) {
+  auto found = pinLevels().find(pin);
+  return found == pinLevels().end() ? HIGH : found->second;
+}
+
+void setSerialEcho(bool enabled) { serialEcho = enabled; }
+
+}  // namespace host
+
+HardwareSerial Serial;
+EspClass ESP;
+
+unsigned long millis() { return host::VirtualClock::now(); }
+
+unsigned long micros() { return host::VirtualClock::now() * 1000UL; }
+
+void delay(unsigned long ms) { host::VirtualClock::advance(ms); }
+
+void yield() {}
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t value) { host::pinLevels()[pin] = value; }
+
+int digitalRead(uint8_t pin) { return host::pinLevel(pin); }
+
+// Overrides the C library so ScheduleManager sees simulated wall-clock time.
+extern "C" time_t time(time_t *out) {
+  time_t now = host::VirtualClock::epoch();
+  if (out != nullptr) {
+    *out = now;
+  }
+  return now;
+}
+
+void String::trim() {
+  size_t first = value_.find_first_not_of(" \t\r\n");
+  if (first == std::string::npos) {
+    value_.clear();
+    return;
+  }
+  size_t last = value_.find_last_not_of(" \t\r\n");
+  value_ = value_.substr(first, last - first + 1);
+}
+
+void String::toLowerCase() {
+  for (char &c : value_) {
+    c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+  }
+}
+
+void String::assignNumber(double number, unsigned char decimals) {
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimals, number);
+  value_ = buffer;
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t written = 0;
+  while (written < size && write(buffer[written]) == 1) {
+    ++written;
+  }
+  return written;
+}
+
+size_t Print::print(const char *text) {
+  return write(reinterpret_cast<const uint8_t *>(text), strlen(text));
+}
+
+size_t Print::println(const char *text) { return print(text) + print("\r\n"); }
+
+size_t Print::printf(const char *format, ...) {
+  char buffer[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (length < 0) {
+    return 0;
+  }
+  size_t size = static_cast<size_t>(length) < sizeof(buffer) ? static_cast<size_t>(length)
+                                                             : sizeof(buffer) - 1;
+  return write(reinterpret_cast<const uint8_t *>(buffer), size);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (host::serialEcho) {
+    fputc(c, stdout);
+  }
+  return 1;
+}
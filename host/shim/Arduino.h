@@ -0,0 +1,172 @@
+#pragma once
+
+// Minimal stand-in for the ESP8266 Arduino core so the controller, logging
+// and storage classes build on a Linux host. Only what main/ uses is here.
+
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include <string>
+#include <type_traits>
+
+#define PROGMEM
+#define PGM_P const char *
+#define F(text) (text)
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t *>(address))
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x0
+#define OUTPUT 0x1
+
+using std::isinf;
+using std::isnan;
+
+typedef uint8_t byte;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+template <typename A, typename B>
+typename std::common_type<A, B>::type min(A a, B b) {
+  return a < b ? a : b;
+}
+
+template <typename A, typename B>
+typename std::common_type<A, B>::type max(A a, B b) {
+  return a > b ? a : b;
+}
+
+/** std::string-backed subset of the Arduino String API. */
+class String {
+ public:
+  String() = default;
+  String(const char *text) : value_(text != nullptr ? text : "") {}
+  String(const std::string &text) : value_(text) {}
+  explicit String(char c) : value_(1, c) {}
+  explicit String(int number) : value_(std::to_string(number)) {}
+  explicit String(unsigned int number) : value_(std::to_string(number)) {}
+  explicit String(long number) : value_(std::to_string(number)) {}
+  explicit String(unsigned long number) : value_(std::to_string(number)) {}
+  String(float number, unsigned char decimals) { assignNumber(number, decimals); }
+  String(double number, unsigned char decimals) { assignNumber(number, decimals); }
+
+  unsigned int length() const { return static_cast<unsigned int>(value_.size()); }
+  const char *c_str() const { return value_.c_str(); }
+  bool isEmpty() const { return value_.empty(); }
+  bool reserve(unsigned int size) {
+    value_.reserve(size);
+    return true;
+  }
+
+  char operator[](unsigned int index) const { return value_[index]; }
+  char charAt(unsigned int index) const { return value_[index]; }
+
+  String &operator+=(const String &other) {
+    value_ += other.value_;
+    return *this;
+  }
+  String &operator+=(const char *other) {
+    value_ += other;
+    return *this;
+  }
+  String &operator+=(char other) {
+    value_ += other;
+    return *this;
+  }
+  friend String operator+(const String &a, const String &b) { return String(a.value_ + b.value_); }
+
+  bool operator==(const String &other) const { return value_ == other.value_; }
+  bool operator==(const char *other) const { return value_ == other; }
+  bool operator!=(const String &other) const { return value_ != other.value_; }
+  bool operator!=(const char *other) const { return value_ != other; }
+
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t position = value_.find(c, from);
+    return position == std::string::npos ? -1 : static_cast<int>(position);
+  }
+  String substring(unsigned int from) const {
+    return from >= value_.size() ? String() : String(value_.substr(from));
+  }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) {
+      unsigned int swap = from;
+      from = to;
+      to = swap;
+    }
+    return from >= value_.size() ? String() : String(value_.substr(from, to - from));
+  }
+  bool startsWith(const char *prefix) const { return value_.rfind(prefix, 0) == 0; }
+  bool equalsIgnoreCase(const String &other) const {
+    return strcasecmp(value_.c_str(), other.c_str()) == 0;
+  }
+  void trim();
+  void toLowerCase();
+  float toFloat() const { return strtof(value_.c_str(), nullptr); }
+  long toInt() const { return strtol(value_.c_str(), nullptr, 10); }
+
+ private:
+  void assignNumber(double number, unsigned char decimals);
+
+  std::string value_;
+};
+
+class Print {
+ public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size);
+
+  size_t print(const char *text);
+  size_t print(const String &text) { return print(text.c_str()); }
+  size_t println(const char *text = "");
+  size_t println(const String &text) { return println(text.c_str()); }
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+};
+
+/** Serial output goes to stdout only when host::setSerialEcho(true) was called. */
+class HardwareSerial : public Stream {
+ public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) override;
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+};
+
+extern HardwareSerial Serial;
+
+/** The ESP8266 core queries main/ makes; the cycle counter follows micros(). */
+class EspClass {
+ public:
+  uint8_t getCpuFreqMHz() const { return 80; }
+  uint32_t getCycleCount() const { return static_cast<uint32_t>(micros() * getCpuFreqMHz()); }
+  uint32_t getFreeHeap() const { return 40000; }
+  uint32_t getMaxFreeBlockSize() const { return 32000; }
+  uint8_t getHeapFragmentation() const { return 0; }
+  uint32_t random() const { return static_cast<uint32_t>(::random()); }
+};
+
+extern EspClass ESP;
+
+#include "HostHardware.h"
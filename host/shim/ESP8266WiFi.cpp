@@ -0,0 +1,112 @@
+#include "ESP8266WiFi.h"
+
+#include <algorithm>
+#include <map>
+
+#include "HostHardware.h"
+
+namespace host {
+
+namespace {
+struct Listener {
+  bool listening = false;
+  std::deque<std::shared_ptr<TcpSocket>> backlog;
+};
+
+std::map<uint16_t, Listener> &listeners() {
+  static std::map<uint16_t, Listener> ports;
+  return ports;
+}
+}  // namespace
+
+std::shared_ptr<TcpSocket> connect(uint16_t port) {
+  ShimHeapScope shim;
+  Listener &listener = listeners()[port];
+  if (!listener.listening) {
+    return nullptr;
+  }
+  auto socket = std::make_shared<TcpSocket>();
+  listener.backlog.push_back(socket);
+  return socket;
+}
+
+size_t backlog(uint16_t port) { return listeners()[port].backlog.size(); }
+
+}  // namespace host
+
+WiFiClass WiFi;
+
+uint8_t WiFiClient::connected() const {
+  if (socket_ == nullptr || socket_->serverClosed) {
+    return 0;
+  }
+  // Like lwIP, data that arrived before the peer closed can still be read.
+  return !socket_->peerClosed || !socket_->toServer.empty();
+}
+
+int WiFiClient::available() {
+  return socket_ != nullptr && !socket_->serverClosed ? static_cast<int>(socket_->toServer.size())
+                                                      : 0;
+}
+
+int WiFiClient::read() {
+  uint8_t c = 0;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size) {
+  if (available() == 0) {
+    return 0;
+  }
+  host::ShimHeapScope shim;
+  std::deque<uint8_t> &pending = socket_->toServer;
+  size_t count = size < pending.size() ? size : pending.size();
+  std::copy(pending.begin(), pending.begin() + static_cast<long>(count), buffer);
+  pending.erase(pending.begin(), pending.begin() + static_cast<long>(count));
+  return static_cast<int>(count);
+}
+
+size_t WiFiClient::write(uint8_t c) { return write(&c, 1); }
+
+size_t WiFiClient::write(const uint8_t *buffer, size_t size) {
+  size_t writable = availableForWrite();
+  if (writable == 0) {
+    return 0;
+  }
+  size_t count = size < writable ? size : writable;
+  host::ShimHeapScope shim;
+  ++socket_->writes;
+  socket_->toPeer.insert(socket_->toPeer.end(), buffer, buffer + count);
+  return count;
+}
+
+size_t WiFiClient::availableForWrite() const {
+  if (connected() == 0 || socket_->peerClosed) {
+    return 0;
+  }
+  size_t queued = socket_->toPeer.size();
+  return queued < host::TcpSocket::kSendWindow ? host::TcpSocket::kSendWindow - queued : 0;
+}
+
+void WiFiClient::stop() {
+  host::ShimHeapScope shim;
+  if (socket_ != nullptr) {
+    socket_->serverClosed = true;
+  }
+  socket_.reset();
+}
+
+void WiFiServer::begin() { host::listeners()[port_].listening = true; }
+
+WiFiClient WiFiServer::accept() {
+  host::ShimHeapScope shim;
+  auto &backlog = host::listeners()[port_].backlog;
+  while (!backlog.empty()) {
+    std::shared_ptr<host::TcpSocket> socket = backlog.front();
+    backlog.pop_front();
+    if (!socket->peerClosed) {
+      return WiFiClient(socket);
+    }
+  }
+  return WiFiClient();
+}
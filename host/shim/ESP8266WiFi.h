@@ -0,0 +1,91 @@
+#pragma once
+
+// In-memory stand-in for the ESP8266 TCP stack. A WiFiServer accepts the
+// sockets a host driver opens with host::connect(); the driver then plays
+// the remote peer, writing request bytes and reading the response at
+// whatever rate it likes. availableForWrite() reports what is left of a
+// per-socket send window, so a peer that reads slowly pushes back on the
+// server the way a full lwIP send buffer does on the device.
+
+#include "Arduino.h"
+
+#include <deque>
+#include <memory>
+
+namespace host {
+
+struct TcpSocket {
+  // Two full-size segments, like lwIP's default TCP_SND_BUF on the ESP8266.
+  static constexpr size_t kSendWindow = 2 * 1460;
+
+  std::deque<uint8_t> toServer;  // Sent by the peer, not yet read by the server.
+  std::deque<uint8_t> toPeer;    // Written by the server, not yet read by the peer.
+  bool peerClosed = false;
+  bool serverClosed = false;
+  size_t writes = 0;  // WiFiClient::write() calls that queued data.
+};
+
+/** Opens a connection to a listening WiFiServer; it waits in the backlog until accepted. */
+std::shared_ptr<TcpSocket> connect(uint16_t port);
+
+/** Connections on `port` that no WiFiServer has accepted yet. */
+size_t backlog(uint16_t port);
+
+}  // namespace host
+
+class IPAddress {
+ public:
+  IPAddress() = default;
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : octets_{a, b, c, d} {}
+  uint8_t operator[](int index) const { return octets_[index]; }
+
+ private:
+  uint8_t octets_[4] = {0, 0, 0, 0};
+};
+
+/** Copies share one socket, as on the device; stop() closes it for every copy. */
+class WiFiClient : public Stream {
+ public:
+  WiFiClient() = default;
+  explicit WiFiClient(std::shared_ptr<host::TcpSocket> socket) : socket_(std::move(socket)) {}
+
+  explicit operator bool() const { return socket_ != nullptr; }
+  uint8_t connected() const;
+  int available() override;
+  int read() override;
+  int read(uint8_t *buffer, size_t size);
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  size_t write_P(PGM_P buffer, size_t size) {
+    return write(reinterpret_cast<const uint8_t *>(buffer), size);
+  }
+  size_t availableForWrite() const;
+  void setNoDelay(bool) {}
+  void flush() {}
+  void stop();
+
+ private:
+  std::shared_ptr<host::TcpSocket> socket_;
+};
+
+class WiFiServer {
+ public:
+  explicit WiFiServer(uint16_t port) : port_(port) {}
+
+  void begin();
+  void setNoDelay(bool) {}
+  /** The oldest connection in the backlog, or an empty client. */
+  WiFiClient accept();
+
+ private:
+  uint16_t port_;
+};
+
+class WiFiClass {
+ public:
+  String SSID() const { return String("host"); }
+  IPAddress localIP() const { return IPAddress(127, 0, 0, 1); }
+  int32_t RSSI() const { return -50; }
+};
+
+extern WiFiClass WiFi;
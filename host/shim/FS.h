@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// In-memory file system with the slice of the ESP8266 fs::FS API used by the
+// storage classes. Files live until host::formatFileSystem() is called.
+
+namespace fs {
+
+using FileData = std::shared_ptr<std::vector<uint8_t>>;
+
+class File : public Stream {
+ public:
+  File() = default;
+  File(FileData data, bool writable, size_t position)
+      : data_(std::move(data)), writable_(writable), position_(position) {}
+
+  explicit operator bool() const { return data_ != nullptr; }
+
+  size_t read(uint8_t *buffer, size_t size);
+  int read() override;
+  int available() override;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override;
+  String readStringUntil(char terminator);
+  bool seek(uint32_t position);
+  size_t position() const { return position_; }
+  size_t size() const { return data_ ? data_->size() : 0; }
+  void flush() {}
+  void close() { data_.reset(); }
+
+ private:
+  FileData data_;
+  bool writable_ = false;
+  size_t position_ = 0;
+};
+
+class Dir {
+ public:
+  Dir() = default;
+  explicit Dir(std::vector<std::string> names) : names_(std::move(names)) {}
+
+  bool next();
+  String fileName() const { return String(current_); }
+
+ private:
+  std::vector<std::string> names_;
+  size_t index_ = 0;
+  std::string current_;
+};
+
+class FS {
+ public:
+  bool begin() { return true; }
+  File open(const char *path, const char *mode);
+  File open(const String &path, const char *mode) { return open(path.c_str(), mode); }
+  bool exists(const char *path) const;
+  bool remove(const char *path);
+  bool rename(const char *from, const char *to);
+  bool mkdir(const char *) { return true; }
+  Dir openDir(const char *path) const;
+
+  void format() { files_.clear(); }
+
+ private:
+  std::map<std::string, FileData> files_;
+};
+
+}  // namespace fs
+
+using fs::Dir;
+using fs::File;
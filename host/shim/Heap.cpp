@@ -0,0 +1,102 @@
+#include "HostHardware.h"
+
+#include <stddef.h>
+
+// Counts the heap calls of the code under test by standing in for the C
+// library's malloc family, which operator new goes through as well. Only
+// glibc exposes the underlying allocator to forward to; elsewhere the
+// counters stay at zero.
+
+namespace host {
+
+namespace {
+bool counting = false;
+int shimDepth = 0;
+HeapStats stats;
+long long inUse = 0;
+
+bool counted() { return counting && shimDepth == 0; }
+}  // namespace
+
+#if defined(__GLIBC__)
+bool heapCountAvailable() { return true; }
+#else
+bool heapCountAvailable() { return false; }
+#endif
+
+void startHeapCount() {
+  stats = HeapStats{};
+  inUse = 0;
+  counting = true;
+}
+
+HeapStats stopHeapCount() {
+  counting = false;
+  return stats;
+}
+
+ShimHeapScope::ShimHeapScope() { ++shimDepth; }
+ShimHeapScope::~ShimHeapScope() { --shimDepth; }
+
+}  // namespace host
+
+#if defined(__GLIBC__)
+
+#include <malloc.h>
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *pointer, size_t size);
+void __libc_free(void *pointer);
+}
+
+namespace {
+void countAllocation(void *pointer, size_t size) {
+  if (pointer == nullptr || !host::counted()) {
+    return;
+  }
+  ++host::stats.allocations;
+  host::stats.allocatedBytes += size;
+  host::inUse += static_cast<long long>(malloc_usable_size(pointer));
+  if (host::inUse > static_cast<long long>(host::stats.peakBytes)) {
+    host::stats.peakBytes = static_cast<size_t>(host::inUse);
+  }
+}
+
+void countFree(void *pointer) {
+  if (pointer != nullptr && host::counted()) {
+    host::inUse -= static_cast<long long>(malloc_usable_size(pointer));
+  }
+}
+}  // namespace
+
+extern "C" {
+
+void *malloc(size_t size) {
+  void *pointer = __libc_malloc(size);
+  countAllocation(pointer, size);
+  return pointer;
+}
+
+void *calloc(size_t count, size_t size) {
+  void *pointer = __libc_calloc(count, size);
+  countAllocation(pointer, count * size);
+  return pointer;
+}
+
+void *realloc(void *pointer, size_t size) {
+  countFree(pointer);
+  void *moved = __libc_realloc(pointer, size);
+  countAllocation(moved, size);
+  return moved;
+}
+
+void free(void *pointer) {
+  countFree(pointer);
+  __libc_free(pointer);
+}
+
+}  // extern "C"
+
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * Controls for the simulated board behind the Arduino shims.
+ *
+ * millis(), micros() and time() all read one virtual clock that only moves
+ * when a driver advances it (delay() advances it too), so a simulation can
+ * cover weeks of controller time in a few seconds of wall-clock time.
+ */
+namespace host {
+
+class VirtualClock {
+ public:
+  /** Milliseconds since the simulated boot. */
+  static unsigned long now() { return static_cast<unsigned long>(nowMs_); }
+  static void advance(unsigned long ms) { nowMs_ += ms; }
+  static void reset(uint64_t ms = 0) { nowMs_ = ms; }
+
+  /** Wall-clock seconds reported by time() at the simulated boot. */
+  static void setEpochAtBoot(time_t epoch) { epochAtBoot_ = epoch; }
+  static time_t epoch() { return epochAtBoot_ + static_cast<time_t>(nowMs_ / 1000ULL); }
+
+ private:
+  static uint64_t nowMs_;
+  static time_t epochAtBoot_;
+};
+
+/** Last level written to a pin with digitalWrite(); pins start HIGH (relays off). */
+uint8_t pinLevel(uint8_t pin);
+
+/** Echo Serial output to stdout; off by default to keep simulations quiet. */
+void setSerialEcho(bool enabled);
+
+/** Drops every file from the in-memory LittleFS. */
+void formatFileSystem();
+
+/** Heap use of the code under test between startHeapCount() and stopHeapCount(). */
+struct HeapStats {
+  unsigned long allocations = 0;  // malloc(), calloc(), realloc() and operator new.
+  size_t allocatedBytes = 0;      // Bytes asked for by those calls.
+  size_t peakBytes = 0;           // Most held at once beyond what was held at the start.
+};
+
+/** False where the C library's allocator cannot be wrapped; the counts then stay zero. */
+bool heapCountAvailable();
+void startHeapCount();
+HeapStats stopHeapCount();
+
+/**
+ * Leaves the shims' own bookkeeping (socket buffers, file contents) out of
+ * the heap counts while in scope; the device keeps those outside its heap.
+ */
+class ShimHeapScope {
+ public:
+  ShimHeapScope();
+  ~ShimHeapScope();
+  ShimHeapScope(const ShimHeapScope &) = delete;
+  ShimHeapScope &operator=(const ShimHeapScope &) = delete;
+};
+
+}  // namespace host
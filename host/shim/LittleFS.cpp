@@ -0,0 +1,137 @@
+#include "LittleFS.h"
+
+fs::FS LittleFS;
+
+namespace host {
+
+void formatFileSystem() { LittleFS.format(); }
+
+}  // namespace host
+
+namespace fs {
+
+size_t File::read(uint8_t *buffer, size_t size) {
+  if (!data_) {
+    return 0;
+  }
+  size_t available = position_ < data_->size() ? data_->size() - position_ : 0;
+  size_t count = size < available ? size : available;
+  memcpy(buffer, data_->data() + position_, count);
+  position_ += count;
+  return count;
+}
+
+int File::read() {
+  uint8_t c = 0;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::available() {
+  if (!data_ || position_ >= data_->size()) {
+    return 0;
+  }
+  return static_cast<int>(data_->size() - position_);
+}
+
+size_t File::write(const uint8_t *buffer, size_t size) {
+  if (!data_ || !writable_) {
+    return 0;
+  }
+  if (position_ > data_->size()) {
+    position_ = data_->size();
+  }
+  size_t overlap = data_->size() - position_;
+  if (overlap > size) {
+    overlap = size;
+  }
+  memcpy(data_->data() + position_, buffer, overlap);
+  data_->insert(data_->end(), buffer + overlap, buffer + size);
+  position_ += size;
+  return size;
+}
+
+String File::readStringUntil(char terminator) {
+  std::string line;
+  int c = read();
+  while (c >= 0 && c != terminator) {
+    line += static_cast<char>(c);
+    c = read();
+  }
+  return String(line);
+}
+
+bool File::seek(uint32_t position) {
+  if (!data_ || position > data_->size()) {
+    return false;
+  }
+  position_ = position;
+  return true;
+}
+
+bool Dir::next() {
+  if (index_ >= names_.size()) {
+    return false;
+  }
+  current_ = names_[index_++];
+  return true;
+}
+
+File FS::open(const char *path, const char *mode) {
+  auto found = files_.find(path);
+  switch (mode[0]) {
+    case 'r': {
+      if (found == files_.end()) {
+        return File();
+      }
+      bool writable = mode[1] == '+';
+      return File(found->second, writable, 0);
+    }
+    case 'w': {
+      FileData data = std::make_shared<std::vector<uint8_t>>();
+      files_[path] = data;
+      return File(data, true, 0);
+    }
+    case 'a': {
+      if (found == files_.end()) {
+        found = files_.emplace(path, std::make_shared<std::vector<uint8_t>>()).first;
+      }
+      return File(found->second, true, found->second->size());
+    }
+    default:
+      return File();
+  }
+}
+
+bool FS::exists(const char *path) const { return files_.count(path) != 0; }
+
+bool FS::remove(const char *path) { return files_.erase(path) != 0; }
+
+bool FS::rename(const char *from, const char *to) {
+  auto found = files_.find(from);
+  if (found == files_.end()) {
+    return false;
+  }
+  FileData data = found->second;
+  files_.erase(found);
+  files_[to] = data;
+  return true;
+}
+
+Dir FS::openDir(const char *path) const {
+  // Like LittleFS, list the direct children of `path` by name only.
+  std::string prefix(path);
+  if (prefix.empty() || prefix.back() != '/') {
+    prefix += '/';
+  }
+  std::vector<std::string> names;
+  for (const auto &file : files_) {
+    const std::string &name = file.first;
+    if (name.compare(0, prefix.size(), prefix) == 0 &&
+        name.find('/', prefix.size()) == std::string::npos) {
+      names.push_back(name.substr(prefix.size()));
+    }
+  }
+  return Dir(names);
+}
+
+}  // namespace fs
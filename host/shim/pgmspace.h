@@ -0,0 +1,5 @@
+#pragma once
+
+// PROGMEM and its accessors are defined by the host Arduino.h; flash is plain memory here.
+
+#include "Arduino.h"
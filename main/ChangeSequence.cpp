@@ -0,0 +1,53 @@
+#include "ChangeSequence.h"
+
+namespace tracking {
+
+uint32_t ChangeSequence::value_ = 0;
+
+uint32_t ChangeSequence::next() { return ++value_; }
+
+uint32_t ChangeSequence::current() { return value_; }
+
+void RowRevisions::rowCreated() {
+  revision_ = ChangeSequence::next();
+  created_[createdCount_ % kHistory] = revision_;
+  ++createdCount_;
+}
+
+void RowRevisions::rowModified() { revision_ = ChangeSequence::next(); }
+
+void RowRevisions::reset() {
+  revision_ = ChangeSequence::next();
+  resetRevision_ = revision_;
+  createdCount_ = 0;
+}
+
+size_t RowRevisions::rowsChangedSince(uint32_t since,
+                                      size_t available,
+                                      bool &replaceAll) const {
+  replaceAll = false;
+  if (revision_ <= since) {
+    return 0;
+  }
+  if (resetRevision_ > since) {
+    replaceAll = true;
+    return available;
+  }
+
+  size_t rows = 0;
+  while (rows < available && rows < kHistory && rows < createdCount_) {
+    uint32_t created = created_[(createdCount_ - 1 - rows) % kHistory];
+    ++rows;
+    if (created <= since) {
+      // This row was the tail when the cursor was issued; older rows are final.
+      return rows;
+    }
+  }
+  if (rows == available) {
+    return rows;
+  }
+  replaceAll = true;
+  return available;
+}
+
+}  // namespace tracking
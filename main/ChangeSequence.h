@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace tracking {
+
+/**
+ * Process-wide, monotonically increasing change counter.
+ *
+ * Components stamp their state with the value returned by next() whenever it
+ * changes, which lets clients ask for "everything newer than N" with a single
+ * cursor that spans all of them.
+ */
+class ChangeSequence {
+ public:
+  static uint32_t next();
+  static uint32_t current();
+
+ private:
+  static uint32_t value_;
+};
+
+/**
+ * Tracks which rows of an append-only ring changed after a given sequence.
+ *
+ * Only the newest row of a log is ever modified, so the rows changed since a
+ * cursor are always a suffix. The creation sequence of the last few rows is
+ * enough to size that suffix without storing a sequence per row.
+ */
+class RowRevisions {
+ public:
+  /** Records that a new tail row was appended. */
+  void rowCreated();
+  /** Records that the tail row changed in a way its readers can see. */
+  void rowModified();
+  /** Records that the log was cleared or replaced wholesale. */
+  void reset();
+
+  uint32_t revision() const { return revision_; }
+
+  /**
+   * Returns how many of the newest `available` rows changed after `since`.
+   * Sets `replaceAll` when the caller must discard what it has and take the
+   * returned rows as the complete log.
+   */
+  size_t rowsChangedSince(uint32_t since, size_t available, bool &replaceAll) const;
+
+ private:
+  static constexpr size_t kHistory = 8;
+
+  uint32_t created_[kHistory] = {};
+  uint32_t createdCount_ = 0;
+  uint32_t revision_ = 0;
+  uint32_t resetRevision_ = 0;
+};
+
+}  // namespace tracking
@@ -0,0 +1,95 @@
+#include "ConnectivityManager.h"
+
+#include <ESP8266WiFi.h>
+#include <time.h>
+
+#include "LogClock.h"
+
+namespace network {
+
+ConnectivityManager::ConnectivityManager(const char *ssid, const char *password)
+    : ssid_(ssid), password_(password) {}
+
+void ConnectivityManager::begin() {
+  // Reconnection is driven from update(); the SDK's own retries would fight the backoff.
+  WiFi.persistent(false);
+  WiFi.mode(WIFI_STA);
+  WiFi.setAutoReconnect(false);
+  startAttempt(millis());
+}
+
+void ConnectivityManager::update() {
+  unsigned long now = millis();
+  bool associated = WiFi.status() == WL_CONNECTED;
+  switch (state_) {
+    case State::kIdle:
+      break;
+    case State::kConnecting:
+      if (associated) {
+        onConnected(now);
+      } else if (now - stateSince_ >= kConnectTimeoutMs) {
+        enterBackoff(now);
+      }
+      break;
+    case State::kConnected:
+      if (!associated) {
+        Serial.println(F("Wi-Fi connection lost; reconnecting."));
+        startAttempt(now);
+      }
+      break;
+    case State::kBackoff:
+      if (now - stateSince_ >= backoffMs_) {
+        backoffMs_ = backoffMs_ >= kMaxBackoffMs / 2 ? kMaxBackoffMs : backoffMs_ * 2;
+        startAttempt(now);
+      }
+      break;
+  }
+}
+
+bool ConnectivityManager::timeValid() {
+  return time(nullptr) >= static_cast<time_t>(logging::LogClock::kMinSyncedEpoch);
+}
+
+const char *ConnectivityManager::stateName(State state) {
+  switch (state) {
+    case State::kIdle:
+      return "idle";
+    case State::kConnecting:
+      return "connecting";
+    case State::kConnected:
+      return "connected";
+    case State::kBackoff:
+      return "backoff";
+  }
+  return "idle";
+}
+
+void ConnectivityManager::startAttempt(unsigned long now) {
+  WiFi.begin(ssid_, password_);
+  state_ = State::kConnecting;
+  stateSince_ = now;
+}
+
+void ConnectivityManager::enterBackoff(unsigned long now) {
+  WiFi.disconnect();
+  Serial.print(F("Wi-Fi unavailable; retrying in "));
+  Serial.print(backoffMs_ / 1000UL);
+  Serial.println(F(" s."));
+  state_ = State::kBackoff;
+  stateSince_ = now;
+}
+
+void ConnectivityManager::onConnected(unsigned long now) {
+  state_ = State::kConnected;
+  stateSince_ = now;
+  backoffMs_ = kInitialBackoffMs;
+  ++connections_;
+  Serial.print(F("Wi-Fi connected: "));
+  Serial.println(WiFi.localIP());
+  if (!timeConfigured_) {
+    configTime(0, 0, "pool.ntp.org", "time.nist.gov", "time.google.com");
+    timeConfigured_ = true;
+  }
+}
+
+}  // namespace network
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace network {
+
+/**
+ * Brings Wi-Fi and NTP up from loop() without ever waiting on them.
+ *
+ * begin() only starts the first association. update() then polls the
+ * station status: an attempt that does not associate within
+ * kConnectTimeoutMs is dropped and retried after a backoff that doubles from
+ * kInitialBackoffMs up to kMaxBackoffMs, and a lost link is retried straight
+ * away. SNTP is configured on the first association and keeps the clock in
+ * step on its own from then on.
+ *
+ * The controller runs from boot whatever the network does; callers check
+ * connected() before starting network services and timeValid() before
+ * acting on the wall clock.
+ */
+class ConnectivityManager {
+ public:
+  enum class State : uint8_t { kIdle, kConnecting, kConnected, kBackoff };
+
+  static constexpr unsigned long kConnectTimeoutMs = 20000;
+  static constexpr unsigned long kInitialBackoffMs = 5000;
+  static constexpr unsigned long kMaxBackoffMs = 300000;
+
+  ConnectivityManager(const char *ssid, const char *password);
+
+  void begin();
+  void update();
+
+  State state() const { return state_; }
+  bool connected() const { return state_ == State::kConnected; }
+  /** True once time() reports an NTP-set date. */
+  static bool timeValid();
+  /** Associations since boot, including the first. */
+  uint32_t connections() const { return connections_; }
+
+  static const char *stateName(State state);
+
+ private:
+  void startAttempt(unsigned long now);
+  void enterBackoff(unsigned long now);
+  void onConnected(unsigned long now);
+
+  const char *ssid_;
+  const char *password_;
+  State state_ = State::kIdle;
+  unsigned long stateSince_ = 0;
+  unsigned long backoffMs_ = kInitialBackoffMs;
+  uint32_t connections_ = 0;
+  bool timeConfigured_ = false;
+};
+
+}  // namespace network
@@ -0,0 +1,130 @@
+#include "EventStream.h"
+
+#include <string.h>
+
+namespace interface {
+
+namespace {
+const char kStreamHeaders[] PROGMEM =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/event-stream\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "\r\n"
+    "retry: 3000\n\n";
+const char kKeepAlive[] = ": keepalive\n\n";
+}  // namespace
+
+bool EventStream::subscribe(WiFiClient &client) {
+  for (Subscriber &subscriber : subscribers_) {
+    if (subscriber.active) {
+      continue;
+    }
+    subscriber.client = client;
+    subscriber.client.setNoDelay(true);
+    subscriber.active = true;
+    subscriber.head = 0;
+    subscriber.size = 0;
+    char headers[sizeof(kStreamHeaders)];
+    memcpy_P(headers, kStreamHeaders, sizeof(kStreamHeaders));
+    enqueue(subscriber, headers, sizeof(kStreamHeaders) - 1);
+    drain(subscriber);
+    return true;
+  }
+  return false;
+}
+
+void EventStream::publish(const char *name, const char *payload) {
+  size_t nameLength = strlen(name);
+  size_t payloadLength = strlen(payload);
+  for (Subscriber &subscriber : subscribers_) {
+    if (!subscriber.active) {
+      continue;
+    }
+    size_t needed = 7 + nameLength + 7 + payloadLength + 2;
+    if (kRingSize - subscriber.size < needed) {
+      disconnect(subscriber);
+      continue;
+    }
+    enqueue(subscriber, "event: ", 7);
+    enqueue(subscriber, name, nameLength);
+    enqueue(subscriber, "\ndata: ", 7);
+    enqueue(subscriber, payload, payloadLength);
+    enqueue(subscriber, "\n\n", 2);
+  }
+}
+
+void EventStream::poll() {
+  unsigned long now = millis();
+  bool keepAlive = now - lastKeepAlive_ >= kKeepAliveIntervalMs;
+  if (keepAlive) {
+    lastKeepAlive_ = now;
+  }
+  for (Subscriber &subscriber : subscribers_) {
+    if (!subscriber.active) {
+      continue;
+    }
+    if (!subscriber.client.connected()) {
+      disconnect(subscriber);
+      continue;
+    }
+    if (keepAlive && subscriber.size == 0) {
+      enqueue(subscriber, kKeepAlive, sizeof(kKeepAlive) - 1);
+    }
+    drain(subscriber);
+  }
+}
+
+size_t EventStream::subscriberCount() const {
+  size_t count = 0;
+  for (const Subscriber &subscriber : subscribers_) {
+    if (subscriber.active) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+bool EventStream::enqueue(Subscriber &subscriber, const char *data, size_t length) {
+  if (kRingSize - subscriber.size < length) {
+    return false;
+  }
+  size_t tail = (subscriber.head + subscriber.size) % kRingSize;
+  size_t first = kRingSize - tail < length ? kRingSize - tail : length;
+  memcpy(subscriber.ring + tail, data, first);
+  memcpy(subscriber.ring, data + first, length - first);
+  subscriber.size += length;
+  return true;
+}
+
+void EventStream::drain(Subscriber &subscriber) {
+  while (subscriber.size > 0) {
+    size_t writable = subscriber.client.availableForWrite();
+    if (writable == 0) {
+      return;
+    }
+    size_t contiguous = kRingSize - subscriber.head;
+    size_t chunk = subscriber.size < contiguous ? subscriber.size : contiguous;
+    if (chunk > writable) {
+      chunk = writable;
+    }
+    size_t written =
+        subscriber.client.write(reinterpret_cast<const uint8_t *>(subscriber.ring + subscriber.head),
+                                chunk);
+    if (written == 0) {
+      return;
+    }
+    subscriber.head = (subscriber.head + written) % kRingSize;
+    subscriber.size -= written;
+  }
+}
+
+void EventStream::disconnect(Subscriber &subscriber) {
+  subscriber.client.stop();
+  subscriber.client = WiFiClient();
+  subscriber.active = false;
+  subscriber.head = 0;
+  subscriber.size = 0;
+}
+
+}  // namespace interface
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <ESP8266WiFi.h>
+
+namespace interface {
+
+/**
+ * Server-Sent Events fan-out for a handful of long-lived HTTP clients.
+ *
+ * Every subscriber owns a fixed-size ring of pending bytes that is drained
+ * without blocking from poll(). A subscriber whose ring overflows is
+ * disconnected; EventSource reconnects on its own and the dashboard resyncs
+ * from /api/state, so a slow client can never hold more than one ring of RAM.
+ */
+class EventStream {
+ public:
+  static constexpr size_t kMaxSubscribers = 3;
+  static constexpr size_t kRingSize = 512;
+  static constexpr unsigned long kKeepAliveIntervalMs = 15UL * 1000UL;
+
+  /** Takes over an accepted connection and sends the event-stream headers. */
+  bool subscribe(WiFiClient &client);
+
+  /** Queues `event: name` / `data: payload` for every subscriber. */
+  void publish(const char *name, const char *payload);
+
+  /** Writes whatever each socket accepts right now and drops closed clients. */
+  void poll();
+
+  size_t subscriberCount() const;
+
+ private:
+  struct Subscriber {
+    WiFiClient client;
+    bool active = false;
+    char ring[kRingSize];
+    size_t head = 0;
+    size_t size = 0;
+  };
+
+  static bool enqueue(Subscriber &subscriber, const char *data, size_t length);
+  static void drain(Subscriber &subscriber);
+  static void disconnect(Subscriber &subscriber);
+
+  Subscriber subscribers_[kMaxSubscribers];
+  unsigned long lastKeepAlive_ = 0;
+};
+
+}  // namespace interface
@@ -0,0 +1,252 @@
+#include "FieldReader.h"
+
+namespace interface {
+
+namespace {
+bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+int hexValue(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+}  // namespace
+
+FieldReader::FieldReader(char *text, size_t length, Syntax syntax)
+    : position_(text), end_(text != nullptr ? text + length : nullptr), syntax_(syntax) {
+  if (syntax_ == Syntax::kAuto) {
+    const char *first = position_;
+    while (first < end_ && isSpace(*first)) {
+      ++first;
+    }
+    syntax_ = first < end_ && *first == '{' ? Syntax::kJson : Syntax::kForm;
+  }
+}
+
+bool FieldReader::next(const char *&key, const char *&value) {
+  if (malformed_ || position_ == nullptr) {
+    return false;
+  }
+  return syntax_ == Syntax::kJson ? nextJson(key, value) : nextForm(key, value);
+}
+
+bool FieldReader::nextForm(const char *&key, const char *&value) {
+  while (position_ < end_) {
+    char *name = position_;
+    char *nameEnd = decodeFormUntil('=');
+    char delimiter = position_ < end_ ? *position_ : '\0';
+    if (position_ < end_) {
+      ++position_;
+    }
+    *nameEnd = '\0';
+    // A key without '=' reads as an empty value: its own terminator.
+    char *text = nameEnd;
+    if (delimiter == '=') {
+      text = position_;
+      char *textEnd = decodeFormUntil('&');
+      if (position_ < end_) {
+        ++position_;
+      }
+      *textEnd = '\0';
+    }
+    if (name != nameEnd) {
+      key = name;
+      value = text;
+      return true;
+    }
+  }
+  return false;
+}
+
+char *FieldReader::decodeFormUntil(char delimiter) {
+  // Decoding only ever shrinks the text, so the output trails the input.
+  char *out = position_;
+  while (position_ < end_ && *position_ != '&' && *position_ != delimiter) {
+    char c = *position_++;
+    if (c == '+') {
+      c = ' ';
+    } else if (c == '%' && end_ - position_ >= 2) {
+      int high = hexValue(position_[0]);
+      int low = hexValue(position_[1]);
+      if (high >= 0 && low >= 0) {
+        c = static_cast<char>((high << 4) | low);
+        position_ += 2;
+      }
+    }
+    *out++ = c;
+  }
+  return out;
+}
+
+bool FieldReader::nextJson(const char *&key, const char *&value) {
+  if (!started_) {
+    started_ = true;
+    skipSpace();
+    if (position_ == end_ || *position_ != '{') {
+      return fail();
+    }
+    ++position_;
+    skipSpace();
+    if (position_ < end_ && *position_ == '}') {
+      pending_ = *position_++;
+    } else {
+      pending_ = ',';
+    }
+  }
+
+  char separator = pending_;
+  pending_ = '\0';
+  if (separator == '\0') {
+    skipSpace();
+    if (position_ == end_) {
+      return fail();
+    }
+    separator = *position_++;
+  }
+  if (separator == '}') {
+    skipSpace();
+    if (position_ != end_) {
+      return fail();
+    }
+    position_ = nullptr;
+    return false;
+  }
+  if (separator != ',') {
+    return fail();
+  }
+
+  skipSpace();
+  if (position_ == end_ || *position_ != '"') {
+    return fail();
+  }
+  ++position_;
+  char *name = nullptr;
+  if (!decodeJsonString(name)) {
+    return false;
+  }
+  skipSpace();
+  if (position_ == end_ || *position_ != ':') {
+    return fail();
+  }
+  ++position_;
+  skipSpace();
+  if (position_ == end_) {
+    return fail();
+  }
+  char *text = nullptr;
+  if (*position_ == '"') {
+    ++position_;
+    if (!decodeJsonString(text)) {
+      return false;
+    }
+  } else if (!readJsonScalar(text)) {
+    return false;
+  }
+  key = name;
+  value = text;
+  return true;
+}
+
+bool FieldReader::decodeJsonString(char *&decoded) {
+  decoded = position_;
+  char *out = position_;
+  while (position_ < end_) {
+    char c = *position_++;
+    if (c == '"') {
+      *out = '\0';
+      return true;
+    }
+    if (static_cast<unsigned char>(c) < 0x20) {
+      return fail();
+    }
+    if (c == '\\') {
+      if (position_ == end_) {
+        return fail();
+      }
+      char escape = *position_++;
+      switch (escape) {
+        case '"':
+        case '\\':
+        case '/':
+          c = escape;
+          break;
+        case 'b':
+          c = '\b';
+          break;
+        case 'f':
+          c = '\f';
+          break;
+        case 'n':
+          c = '\n';
+          break;
+        case 'r':
+          c = '\r';
+          break;
+        case 't':
+          c = '\t';
+          break;
+        case 'u': {
+          if (end_ - position_ < 4) {
+            return fail();
+          }
+          unsigned code = 0;
+          for (int i = 0; i < 4; ++i) {
+            int digit = hexValue(*position_++);
+            if (digit < 0) {
+              return fail();
+            }
+            code = (code << 4) | static_cast<unsigned>(digit);
+          }
+          // Settings are ASCII; anything wider is kept as a placeholder.
+          c = code < 0x80 ? static_cast<char>(code) : '?';
+          break;
+        }
+        default:
+          return fail();
+      }
+    }
+    *out++ = c;
+  }
+  return fail();
+}
+
+bool FieldReader::readJsonScalar(char *&scalar) {
+  // Numbers, true, false and null; nested objects and arrays are not read.
+  scalar = position_;
+  while (position_ < end_ && *position_ != ',' && *position_ != '}' && !isSpace(*position_)) {
+    char c = *position_;
+    if (c == '{' || c == '[' || c == '"' || c == ':') {
+      return fail();
+    }
+    ++position_;
+  }
+  if (position_ == scalar || position_ == end_) {
+    return fail();
+  }
+  char delimiter = *position_;
+  *position_++ = '\0';
+  if (delimiter == ',' || delimiter == '}') {
+    pending_ = delimiter;
+  }
+  return true;
+}
+
+void FieldReader::skipSpace() {
+  while (position_ < end_ && isSpace(*position_)) {
+    ++position_;
+  }
+}
+
+bool FieldReader::fail() {
+  malformed_ = true;
+  return false;
+}
+
+}  // namespace interface
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace interface {
+
+/**
+ * Single-pass reader for flat key/value request data: form-urlencoded text
+ * (`a=1&b=x+y`) or a JSON object whose members are strings, numbers,
+ * booleans or null (`{"a":1,"b":"x y"}`).
+ *
+ * Keys and values are decoded in place and handed out as NUL-terminated
+ * strings inside the caller's buffer, so reading never copies or allocates
+ * and costs one pass over the text. The buffer must stay alive while the
+ * fields are used, and must have a writable byte at text[length] (the
+ * server's request buffers carry a terminator there).
+ */
+class FieldReader {
+ public:
+  enum class Syntax : uint8_t {
+    kAuto,  // JSON when the text starts with '{', form otherwise.
+    kForm,
+    kJson,
+  };
+
+  FieldReader(char *text, size_t length, Syntax syntax = Syntax::kAuto);
+
+  /** Reads the next field; false at the end of the text or once it is malformed. */
+  bool next(const char *&key, const char *&value);
+
+  /** True if reading stopped on text that is not valid for its syntax. */
+  bool malformed() const { return malformed_; }
+
+ private:
+  bool nextForm(const char *&key, const char *&value);
+  bool nextJson(const char *&key, const char *&value);
+  char *decodeFormUntil(char delimiter);
+  bool decodeJsonString(char *&decoded);
+  bool readJsonScalar(char *&scalar);
+  void skipSpace();
+  bool fail();
+
+  char *position_;
+  char *end_;
+  Syntax syntax_;
+  bool started_ = false;
+  bool malformed_ = false;
+  char pending_ = '\0';  // A JSON ',' or '}' that was overwritten to end a scalar.
+};
+
+}  // namespace interface
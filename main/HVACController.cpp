@@ -3,6 +3,7 @@
 #include <cmath>
 #include <limits>
 
+#include "ChangeSequence.h"
 #include "PowerLog.h"
 #include "TemperatureLog.h"
 #include "ScheduleManager.h"
@@ -12,8 +13,12 @@ namespace controller {
 namespace {
 constexpr unsigned long kControlUpdateIntervalMs = 1000;
 constexpr unsigned long kCooldownMinimumRuntimeMs = 5UL * 60UL * 1000UL;
-constexpr float kCooldownCoilTemperatureThresholdC = 20.0f;
-constexpr float kCooldownTemperatureDeltaThresholdC = 2.0f;
+constexpr units::CentiCelsius kCooldownCoilTemperatureThreshold = 2000;
+constexpr units::CentiCelsius kCooldownTemperatureDeltaThreshold = 200;
+constexpr units::CentiCelsius kMinimumHysteresis = 10;
+// Coil-over-ambient deltas at which heating auto fan steps up to medium and high.
+constexpr units::CentiCelsius kHeatingMediumFanDelta = 500;
+constexpr units::CentiCelsius kHeatingHighFanDelta = 800;
 }
 
 HVACController::HVACController(Compressor &compressor,
@@ -32,40 +37,68 @@ HVACController::HVACController(Compressor &compressor,
 void HVACController::begin() {
   compressor_.begin();
   fan_.begin();
+  // Until NTP answers, rows continue from the history restored from flash.
+  logging::PowerLog::Entry newest;
+  if (powerLog_.latestEntry(newest)) {
+    logClock_.resumeAfter(newest.timestamp + logging::PowerLog::kMinuteSeconds);
+  }
 }
 
-void HVACController::setTargetTemperature(float target) { targetTemperature_ = target; }
+void HVACController::setTargetTemperature(units::CentiCelsius target) {
+  if (!units::isValid(target) || target == targetTemperature_) {
+    return;
+  }
+  targetTemperature_ = target;
+  markConfigChanged();
+}
 
-void HVACController::setHysteresis(float hysteresis) {
-  hysteresis_ = max(0.1f, hysteresis);
+void HVACController::setHysteresis(units::CentiCelsius hysteresis) {
+  if (!units::isValid(hysteresis)) {
+    return;
+  }
+  units::CentiCelsius clamped = max(kMinimumHysteresis, hysteresis);
+  if (clamped == hysteresis_) {
+    return;
+  }
+  hysteresis_ = clamped;
+  markConfigChanged();
 }
 
-void HVACController::setCompressorTemperatureLimit(float limit) {
-  if (isnan(limit) || limit < 0.0f) {
+void HVACController::setCompressorTemperatureLimit(units::CentiCelsius limit) {
+  if (!units::isValid(limit) || limit < 0 || limit == compressorTemperatureLimit_) {
     return;
   }
   compressorTemperatureLimit_ = limit;
+  markConfigChanged();
 }
 
-void HVACController::setCompressorMinimumAmbient(float minimumAmbient) {
-  if (isnan(minimumAmbient)) {
+void HVACController::setCompressorMinimumAmbient(units::CentiCelsius minimumAmbient) {
+  if (!units::isValid(minimumAmbient)) {
+    return;
+  }
+  units::CentiCelsius clamped = max(static_cast<units::CentiCelsius>(0), minimumAmbient);
+  if (clamped == compressorMinAmbientC_) {
     return;
   }
-  compressorMinAmbientC_ = max(0.0f, minimumAmbient);
+  compressorMinAmbientC_ = clamped;
+  markConfigChanged();
 }
 
-void HVACController::setCompressorCooldownTemperature(float temperature) {
-  if (isnan(temperature) || temperature < 0.0f) {
+void HVACController::setCompressorCooldownTemperature(units::CentiCelsius temperature) {
+  if (!units::isValid(temperature) || temperature < 0 ||
+      temperature == compressorCooldownTemperature_) {
     return;
   }
   compressorCooldownTemperature_ = temperature;
+  markConfigChanged();
 }
 
 void HVACController::setCompressorCooldownDurationMinutes(float minutes) {
-  if (isnan(minutes) || minutes < 0.0f) {
+  if (isnan(minutes) || minutes < 0.0f || minutes == compressorCooldownDurationMinutes_) {
     return;
   }
   compressorCooldownDurationMinutes_ = minutes;
+  markConfigChanged();
   double durationMs = static_cast<double>(minutes) * 60.0 * 1000.0;
   if (durationMs < 0.0) {
     durationMs = 0.0;
@@ -88,13 +121,18 @@ unsigned long HVACController::compressorCooldownRemainingMs() const {
 }
 
 void HVACController::enableScheduling(bool enabled) {
+  if (enabled == schedulingEnabled_ && (enabled || scheduleIgnoreUntilMs_ == 0)) {
+    return;
+  }
   schedulingEnabled_ = enabled;
   if (!schedulingEnabled_) {
     scheduleIgnoreUntilMs_ = 0;
   }
+  markConfigChanged();
 }
 
 void HVACController::ignoreScheduleForMinutes(uint16_t minutes) {
+  markConfigChanged();
   if (minutes == 0) {
     scheduleIgnoreUntilMs_ = 0;
     return;
@@ -135,21 +173,42 @@ bool HVACController::scheduleUpdatesAllowed() const {
   return schedulingEnabled_ && !scheduleIgnoreActive();
 }
 
-void HVACController::setFanMode(FanMode mode) { fanMode_ = mode; }
+void HVACController::setFanMode(FanMode mode) {
+  if (mode == fanMode_) {
+    return;
+  }
+  fanMode_ = mode;
+  markConfigChanged();
+}
 
 void HVACController::setSystemMode(SystemMode mode) {
+  if (mode != systemMode_) {
+    markConfigChanged();
+  }
   systemMode_ = mode;
   if (systemMode_ == SystemMode::kIdle || systemMode_ == SystemMode::kFanOnly) {
     compressor_.forceOff();
   }
 }
 
+void HVACController::applyScheduledTarget(units::CentiCelsius target,
+                                          bool setMode,
+                                          SystemMode mode) {
+  uint32_t settingsRevision = settingsRevision_;
+  setTargetTemperature(target);
+  if (setMode) {
+    setSystemMode(mode);
+  }
+  settingsRevision_ = settingsRevision;
+}
+
 void HVACController::update() {
   unsigned long now = millis();
   updateCooldownState();
   if ((now - lastControlUpdate_) < kControlUpdateIntervalMs) {
     compressor_.update();
     updateFanState();
+    updateStatusRevision(false);
     return;
   }
   lastControlUpdate_ = now;
@@ -159,6 +218,58 @@ void HVACController::update() {
   compressor_.update();
   updateFanState();
   logState();
+  updateStatusRevision(true);
+}
+
+void HVACController::markConfigChanged() {
+  configRevision_ = tracking::ChangeSequence::next();
+  settingsRevision_ = configRevision_;
+  notify(ControllerEvent::kConfigChanged);
+}
+
+void HVACController::notify(ControllerEvent event) {
+  if (eventListener_ != nullptr) {
+    eventListener_(event);
+  }
+}
+
+void HVACController::updateStatusRevision(bool controlTick) {
+  bool changed = false;
+  bool compressorRunning = compressor_.isRunning();
+  FanSpeed fanSpeed = fan_.currentSpeed();
+  bool cooldown = cooldownActive();
+  bool scheduleIgnore = scheduleIgnoreActive();
+  bool transition = compressorRunning != reportedCompressorRunning_ ||
+                    fanSpeed != reportedFanSpeed_ || cooldown != reportedCooldownActive_;
+  if (transition || scheduleIgnore != reportedScheduleIgnoreActive_) {
+    reportedCompressorRunning_ = compressorRunning;
+    reportedFanSpeed_ = fanSpeed;
+    reportedCooldownActive_ = cooldown;
+    reportedScheduleIgnoreActive_ = scheduleIgnore;
+    changed = true;
+  }
+
+  if (controlTick) {
+    units::CentiCelsius ambient = sensors_.ambient().value;
+    units::CentiCelsius coil = sensors_.coil().value;
+    if (ambient != reportedAmbient_ || coil != reportedCoil_) {
+      reportedAmbient_ = ambient;
+      reportedCoil_ = coil;
+      changed = true;
+    }
+    // Countdowns shown by the dashboard move every tick while they run.
+    if (compressor_.restartDelayRemaining() > 0 || compressor_.minimumRuntimeRemaining() > 0 ||
+        cooldown || scheduleIgnore) {
+      changed = true;
+    }
+  }
+
+  if (changed) {
+    statusRevision_ = tracking::ChangeSequence::next();
+  }
+  if (transition) {
+    notify(ControllerEvent::kStatusChanged);
+  }
 }
 
 void HVACController::applyControlLogic() {
@@ -173,8 +284,7 @@ void HVACController::applyControlLogic() {
   }
 
   if (sensors_.hasCoil()) {
-    float coilTemperature = sensors_.coil().value;
-    if (!isnan(coilTemperature) && coilTemperature >= compressorTemperatureLimit_) {
+    if (sensors_.coil().value >= compressorTemperatureLimit_) {
       compressor_.forceOff();
       return;
     }
@@ -185,20 +295,16 @@ void HVACController::applyControlLogic() {
     return;
   }
 
-  float ambient = sensors_.ambient().value;
-  if (isnan(ambient)) {
-    compressor_.requestOff();
-    return;
-  }
+  units::CentiCelsius ambient = sensors_.ambient().value;
   if (ambient < compressorMinAmbientC_) {
     compressor_.requestOff();
     return;
   }
 
   if (systemMode_ == SystemMode::kHeating && compressor_.isRunning() && sensors_.hasCoil()) {
-    float coilTemperature = sensors_.coil().value;
-    if (!isnan(coilTemperature) && coilTemperature < kCooldownCoilTemperatureThresholdC &&
-        coilTemperature - ambient < kCooldownTemperatureDeltaThresholdC &&
+    units::CentiCelsius coilTemperature = sensors_.coil().value;
+    if (coilTemperature < kCooldownCoilTemperatureThreshold &&
+        coilTemperature - ambient < kCooldownTemperatureDeltaThreshold &&
         compressor_.minimumRuntimeRemaining() == 0 &&
         compressor_.timeSinceLastOn() >= kCooldownMinimumRuntimeMs) {
       compressorCooldownUntil_ = millis() + compressorCooldownDurationMs_;
@@ -207,18 +313,20 @@ void HVACController::applyControlLogic() {
     }
   }
 
-  float upper = targetTemperature_ + (hysteresis_ / 2.0f);
-  float lower = targetTemperature_ - (hysteresis_ / 2.0f);
+  // Compared in half-hundredths so an odd hysteresis splits evenly around the target.
+  int32_t ambientHalves = 2 * static_cast<int32_t>(ambient);
+  int32_t upper = 2 * static_cast<int32_t>(targetTemperature_) + hysteresis_;
+  int32_t lower = 2 * static_cast<int32_t>(targetTemperature_) - hysteresis_;
 
   if (systemMode_ == SystemMode::kCooling) {
     if (compressor_.isRunning()) {
-      if (ambient <= lower) {
+      if (ambientHalves <= lower) {
         compressor_.requestOff();
       } else {
         compressor_.requestOn();
       }
     } else {
-      if (ambient >= upper) {
+      if (ambientHalves >= upper) {
         compressor_.requestOn();
       } else {
         compressor_.requestOff();
@@ -226,13 +334,13 @@ void HVACController::applyControlLogic() {
     }
   } else {  // Heating
     if (compressor_.isRunning()) {
-      if (ambient >= upper) {
+      if (ambientHalves >= upper) {
         compressor_.requestOff();
       } else {
         compressor_.requestOn();
       }
     } else {
-      if (ambient <= lower) {
+      if (ambientHalves <= lower) {
         compressor_.requestOn();
       } else {
         compressor_.requestOff();
@@ -284,24 +392,18 @@ void HVACController::updateFanState() {
         bool compressorRunning = compressor_.isRunning();
         bool forceLowFan = false;
         if (systemMode_ == SystemMode::kHeating && sensors_.hasCoil()) {
-          float coilTemperature = sensors_.coil().value;
-          forceLowFan =
-              !isnan(coilTemperature) && coilTemperature < compressorCooldownTemperature_;
+          forceLowFan = sensors_.coil().value < compressorCooldownTemperature_;
         }
         FanSpeed autoSpeed = compressorRunning ? FanSpeed::kMedium : FanSpeed::kLow;
         if (compressorRunning && systemMode_ == SystemMode::kHeating &&
             sensors_.hasAmbient() && sensors_.hasCoil()) {
-          float ambientTemperature = sensors_.ambient().value;
-          float coilTemperature = sensors_.coil().value;
-          if (!isnan(ambientTemperature) && !isnan(coilTemperature)) {
-            float temperatureDifference = coilTemperature - ambientTemperature;
-            if (temperatureDifference < 5.0f) {
-              autoSpeed = FanSpeed::kLow;
-            } else if (temperatureDifference < 8.0f) {
-              autoSpeed = FanSpeed::kMedium;
-            } else {
-              autoSpeed = FanSpeed::kHigh;
-            }
+          int temperatureDifference = sensors_.coil().value - sensors_.ambient().value;
+          if (temperatureDifference < kHeatingMediumFanDelta) {
+            autoSpeed = FanSpeed::kLow;
+          } else if (temperatureDifference < kHeatingHighFanDelta) {
+            autoSpeed = FanSpeed::kMedium;
+          } else {
+            autoSpeed = FanSpeed::kHigh;
           }
         }
         if (systemMode_ == SystemMode::kHeating) {
@@ -387,13 +489,27 @@ FanSpeed HVACController::resolveHeatingFanSpeed(FanSpeed targetSpeed,
 }
 
 void HVACController::logState() {
-  unsigned long timestamp = millis();
+  unsigned long timestamp = logClock_.now();
+  uint32_t since = 0;
+  long deltaSeconds = 0;
+  if (logClock_.takeCorrection(since, deltaSeconds)) {
+    // Rows logged before the clock was set move onto the real clock.
+    temperatureLog_.rebase(since, deltaSeconds);
+    powerLog_.rebase(since, deltaSeconds);
+    lastLoggedMinute_ += deltaSeconds / 60L;
+  }
+  unsigned long minute = timestamp / 60UL;
+  bool rowCompleted = hasLoggedMinute_ && minute != lastLoggedMinute_;
+  lastLoggedMinute_ = minute;
+  hasLoggedMinute_ = true;
   if (sensors_.hasAmbient() || sensors_.hasCoil()) {
-    float ambient = sensors_.hasAmbient() ? sensors_.ambient().value : NAN;
-    float coil = sensors_.hasCoil() ? sensors_.coil().value : NAN;
-    temperatureLog_.addReading(timestamp, ambient, coil);
+    temperatureLog_.addReading(timestamp, sensors_.ambient().value, sensors_.coil().value);
   }
   powerLog_.logState(timestamp, fan_.currentSpeed(), compressor_.isRunning());
+  if (rowCompleted) {
+    // The finished rows now sit just behind the rows opened for this minute.
+    notify(ControllerEvent::kLogRowCompleted);
+  }
 }
 
 void HVACController::updateCooldownState() {
@@ -4,7 +4,9 @@
 
 #include "Compressor.h"
 #include "FanController.h"
+#include "LogClock.h"
 #include "SensorManager.h"
+#include "Temperature.h"
 
 namespace scheduler {
 class ScheduleManager;
@@ -21,6 +23,14 @@ enum class FanMode : uint8_t { kAuto, kOff, kLow, kMedium, kHigh };
 
 enum class SystemMode : uint8_t { kCooling, kHeating, kFanOnly, kIdle };
 
+enum class ControllerEvent : uint8_t {
+  kStatusChanged,     // Compressor, fan speed or cooldown state switched.
+  kConfigChanged,     // A setting was edited.
+  kLogRowCompleted,   // A per-minute temperature/power row was finalized.
+};
+
+using EventListener = void (*)(ControllerEvent event);
+
 class HVACController {
  public:
   HVACController(Compressor &compressor,
@@ -32,11 +42,15 @@ class HVACController {
 
   void begin();
 
-  void setTargetTemperature(float target);
-  float targetTemperature() const { return targetTemperature_; }
+  /** Registers a callback for state transitions; pass nullptr to detach. */
+  void setEventListener(EventListener listener) { eventListener_ = listener; }
 
-  void setHysteresis(float hysteresis);
-  float hysteresis() const { return hysteresis_; }
+  void setTargetTemperature(units::CentiCelsius target);
+  units::CentiCelsius targetTemperature() const { return targetTemperature_; }
+
+  /** Width of the band around the target; at least 0.10 C. */
+  void setHysteresis(units::CentiCelsius hysteresis);
+  units::CentiCelsius hysteresis() const { return hysteresis_; }
 
   void enableScheduling(bool enabled);
   bool schedulingEnabled() const { return schedulingEnabled_; }
@@ -51,14 +65,23 @@ class HVACController {
   void setSystemMode(SystemMode mode);
   SystemMode systemMode() const { return systemMode_; }
 
-  void setCompressorTemperatureLimit(float limit);
-  float compressorTemperatureLimit() const { return compressorTemperatureLimit_; }
+  /**
+   * Sets the target and, if `setMode`, the system mode on behalf of the
+   * schedule. Unlike the setters this leaves settingsRevision() alone: the
+   * schedule derives these again after a restart, so they need no saving.
+   */
+  void applyScheduledTarget(units::CentiCelsius target, bool setMode, SystemMode mode);
+
+  void setCompressorTemperatureLimit(units::CentiCelsius limit);
+  units::CentiCelsius compressorTemperatureLimit() const { return compressorTemperatureLimit_; }
 
-  void setCompressorMinimumAmbient(float minimumAmbient);
-  float compressorMinimumAmbient() const { return compressorMinAmbientC_; }
+  void setCompressorMinimumAmbient(units::CentiCelsius minimumAmbient);
+  units::CentiCelsius compressorMinimumAmbient() const { return compressorMinAmbientC_; }
 
-  void setCompressorCooldownTemperature(float temperature);
-  float compressorCooldownTemperature() const { return compressorCooldownTemperature_; }
+  void setCompressorCooldownTemperature(units::CentiCelsius temperature);
+  units::CentiCelsius compressorCooldownTemperature() const {
+    return compressorCooldownTemperature_;
+  }
 
   void setCompressorCooldownDurationMinutes(float minutes);
   float compressorCooldownDurationMinutes() const {
@@ -81,7 +104,21 @@ class HVACController {
 
   bool compressorRunning() const { return compressor_.isRunning(); }
 
+  /** Clock the temperature and power logs are stamped with. */
+  logging::LogClock &logClock() { return logClock_; }
+  const logging::LogClock &logClock() const { return logClock_; }
+
+  /** Change sequence of the last setting edit (targets, limits, modes). */
+  uint32_t configRevision() const { return configRevision_; }
+  /** Like configRevision(), but only for edits worth persisting; see applyScheduledTarget(). */
+  uint32_t settingsRevision() const { return settingsRevision_; }
+  /** Change sequence of the last observable runtime change (relays, sensors, timers). */
+  uint32_t statusRevision() const { return statusRevision_; }
+
  private:
+  void markConfigChanged();
+  void notify(ControllerEvent event);
+  void updateStatusRevision(bool controlTick);
   void applyControlLogic();
   void updateFanState();
   void logState();
@@ -97,12 +134,14 @@ class HVACController {
   scheduler::ScheduleManager &schedule_;
   logging::TemperatureLog &temperatureLog_;
   logging::PowerLog &powerLog_;
-
-  float targetTemperature_ = 23.0f;  // Celsius default
-  float hysteresis_ = 1.0f;
-  float compressorTemperatureLimit_ = 60.0f;
-  float compressorMinAmbientC_ = 4.0f;
-  float compressorCooldownTemperature_ = 30.0f;
+  EventListener eventListener_ = nullptr;
+  logging::LogClock logClock_;
+
+  units::CentiCelsius targetTemperature_ = 2300;  // Hundredths of a degree Celsius.
+  units::CentiCelsius hysteresis_ = 100;
+  units::CentiCelsius compressorTemperatureLimit_ = 6000;
+  units::CentiCelsius compressorMinAmbientC_ = 400;
+  units::CentiCelsius compressorCooldownTemperature_ = 3000;
   float compressorCooldownDurationMinutes_ = 30.0f;
   unsigned long compressorCooldownDurationMs_ = 30UL * 60UL * 1000UL;
   unsigned long compressorCooldownUntil_ = 0;
@@ -118,6 +157,18 @@ class HVACController {
   bool heatingFanSpeedChangeScheduled_ = false;
   FanSpeed scheduledHeatingAutoFanSpeed_ = FanSpeed::kLow;
   unsigned long heatingFanSpeedChangeEffectiveAt_ = 0;
+
+  uint32_t configRevision_ = 0;
+  uint32_t settingsRevision_ = 0;
+  uint32_t statusRevision_ = 0;
+  bool reportedCompressorRunning_ = false;
+  FanSpeed reportedFanSpeed_ = FanSpeed::kOff;
+  bool reportedCooldownActive_ = false;
+  bool reportedScheduleIgnoreActive_ = false;
+  units::CentiCelsius reportedAmbient_ = units::kNoTemperature;
+  units::CentiCelsius reportedCoil_ = units::kNoTemperature;
+  unsigned long lastLoggedMinute_ = 0;
+  bool hasLoggedMinute_ = false;
 };
 
 }  // namespace controller
@@ -0,0 +1,674 @@
+#include "HttpServer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include <utility>
+
+#include "FieldReader.h"
+
+namespace interface {
+
+namespace {
+const char *statusText(int code) {
+  switch (code) {
+    case 200:
+      return "OK";
+    case 204:
+      return "No Content";
+    case 304:
+      return "Not Modified";
+    case 400:
+      return "Bad Request";
+    case 404:
+      return "Not Found";
+    case 405:
+      return "Method Not Allowed";
+    case 408:
+      return "Request Timeout";
+    case 413:
+      return "Payload Too Large";
+    case 414:
+      return "URI Too Long";
+    case 500:
+      return "Internal Server Error";
+    case 503:
+      return "Service Unavailable";
+  }
+  return "";
+}
+
+bool parseMethod(const char *text, HttpMethod &method) {
+  static const struct {
+    const char *name;
+    HttpMethod method;
+  } kMethods[] = {
+      {"GET", HttpMethod::kGet},       {"POST", HttpMethod::kPost},
+      {"PUT", HttpMethod::kPut},       {"DELETE", HttpMethod::kDelete},
+      {"OPTIONS", HttpMethod::kOptions},
+  };
+  for (const auto &candidate : kMethods) {
+    if (strcmp(text, candidate.name) == 0) {
+      method = candidate.method;
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+HttpServer::HttpServer(uint16_t port) : listener_(port) {}
+
+void HttpServer::begin() {
+  listener_.begin();
+  listener_.setNoDelay(true);
+}
+
+void HttpServer::on(const char *path, HttpMethod method, Handler handler) {
+  if (routeCount_ == kMaxRoutes) {
+    return;
+  }
+  routes_[routeCount_++] = Route{path, method, handler};
+}
+
+void HttpServer::onNotFound(Handler handler) { notFound_ = handler; }
+
+void HttpServer::collectHeaders(const char *const names[], size_t count) {
+  collected_ = names;
+  collectedCount_ = count < kMaxCollectedHeaders ? count : kMaxCollectedHeaders;
+}
+
+void HttpServer::poll() {
+  accept();
+  unsigned long now = millis();
+  for (Connection &connection : connections_) {
+    service(connection, now);
+  }
+  dispatchNext();
+}
+
+size_t HttpServer::openConnections() const {
+  size_t open = 0;
+  for (const Connection &connection : connections_) {
+    if (connection.state != State::kIdle) {
+      ++open;
+    }
+  }
+  return open;
+}
+
+void HttpServer::accept() {
+  // Clients beyond the pool wait in the TCP backlog until a slot frees up.
+  for (Connection &connection : connections_) {
+    if (connection.state != State::kIdle) {
+      continue;
+    }
+    WiFiClient client = listener_.accept();
+    if (!client) {
+      return;
+    }
+    client.setNoDelay(true);
+    connection.client = client;
+    connection.state = State::kRequestLine;
+    connection.since = millis();
+    connection.lineLength = 0;
+    connection.lineOverflow = false;
+    connection.target[0] = '\0';
+    for (size_t i = 0; i < kMaxCollectedHeaders; ++i) {
+      connection.headers[i][0] = '\0';
+    }
+    connection.bodyLength = 0;
+    connection.bodyExpected = 0;
+    connection.complete = false;
+  }
+}
+
+void HttpServer::service(Connection &connection, unsigned long now) {
+  switch (connection.state) {
+    case State::kIdle:
+    case State::kReady:
+      return;
+    case State::kRequestLine:
+    case State::kHeaders:
+    case State::kBody:
+      read(connection, now);
+      if (connection.state == State::kIdle || connection.state == State::kReady ||
+          connection.state == State::kSending) {
+        return;
+      }
+      if (!connection.client.connected()) {
+        release(connection);
+      } else if (now - connection.since >= kRequestTimeoutMs) {
+        ++stats_.timeouts;
+        reject(connection, 408);
+      }
+      return;
+    case State::kSending:
+      drain(connection, now);
+      resume(connection);
+      if (connection.state == State::kSending && heldBack(connection) &&
+          connection.client.connected()) {
+        // Nothing of its own to write: the client is keeping up, so no deadline.
+        connection.since = now;
+        if (!connection.heldBack) {
+          connection.heldBack = true;
+          ++stats_.heldBack;
+        }
+      } else if (connection.state == State::kSending &&
+                 now - connection.since >= kWriteTimeoutMs) {
+        ++stats_.timeouts;
+        close(connection);
+      }
+      return;
+  }
+}
+
+void HttpServer::read(Connection &connection, unsigned long now) {
+  size_t budget = kReadBudget;
+  uint8_t chunk[64];
+  while (budget > 0 && connection.client.available() > 0) {
+    size_t wanted = budget < sizeof(chunk) ? budget : sizeof(chunk);
+    if (connection.state == State::kBody) {
+      size_t remaining = connection.bodyExpected - connection.bodyLength;
+      wanted = wanted < remaining ? wanted : remaining;
+    }
+    int received = connection.client.read(chunk, wanted);
+    if (received <= 0) {
+      return;
+    }
+    budget -= static_cast<size_t>(received);
+    connection.since = now;
+    for (int i = 0; i < received; ++i) {
+      char c = static_cast<char>(chunk[i]);
+      if (connection.state == State::kBody) {
+        size_t rest = static_cast<size_t>(received - i);
+        size_t remaining = connection.bodyExpected - connection.bodyLength;
+        rest = rest < remaining ? rest : remaining;
+        memcpy(connection.body + connection.bodyLength, chunk + i, rest);
+        connection.bodyLength += rest;
+        break;
+      }
+      if (c == '\n') {
+        connection.line[connection.lineLength] = '\0';
+        if (connection.lineLength > 0 && connection.line[connection.lineLength - 1] == '\r') {
+          connection.line[connection.lineLength - 1] = '\0';
+        }
+        handleLine(connection);
+        connection.lineLength = 0;
+        connection.lineOverflow = false;
+        if (connection.state != State::kRequestLine && connection.state != State::kHeaders &&
+            connection.state != State::kBody) {
+          return;
+        }
+      } else if (connection.lineLength + 1U < kLineBufferSize) {
+        connection.line[connection.lineLength++] = c;
+      } else {
+        connection.lineOverflow = true;
+      }
+    }
+    if (connection.state == State::kBody && connection.bodyLength == connection.bodyExpected) {
+      connection.body[connection.bodyLength] = '\0';
+      connection.state = State::kReady;
+      return;
+    }
+  }
+}
+
+void HttpServer::handleLine(Connection &connection) {
+  if (connection.state == State::kRequestLine) {
+    if (connection.line[0] == '\0' && !connection.lineOverflow) {
+      return;  // Stray CRLF between requests is allowed.
+    }
+    if (connection.lineOverflow) {
+      reject(connection, 414);
+    } else if (parseRequestLine(connection)) {
+      connection.state = State::kHeaders;
+    }
+    return;
+  }
+
+  if (connection.line[0] != '\0' || connection.lineOverflow) {
+    // Overlong headers are none of the ones this server looks at; skip them.
+    if (!connection.lineOverflow) {
+      parseHeader(connection);
+    }
+    return;
+  }
+
+  if (connection.bodyExpected == 0) {
+    connection.state = State::kReady;
+    return;
+  }
+  if (connection.bodyExpected > kMaxBodySize) {
+    reject(connection, 413);
+    return;
+  }
+  connection.body = static_cast<char *>(malloc(connection.bodyExpected + 1));
+  if (connection.body == nullptr) {
+    reject(connection, 503);
+    return;
+  }
+  connection.bodyLength = 0;
+  connection.state = State::kBody;
+}
+
+bool HttpServer::parseRequestLine(Connection &connection) {
+  char *method = connection.line;
+  char *target = strchr(method, ' ');
+  if (target == nullptr) {
+    reject(connection, 400);
+    return false;
+  }
+  *target++ = '\0';
+  char *version = strchr(target, ' ');
+  if (version != nullptr) {
+    *version = '\0';
+  }
+  if (!parseMethod(method, connection.method)) {
+    reject(connection, 405);
+    return false;
+  }
+  size_t length = strlen(target);
+  if (length == 0 || target[0] != '/') {
+    reject(connection, 400);
+    return false;
+  }
+  if (length >= kMaxTargetLength) {
+    reject(connection, 414);
+    return false;
+  }
+  memcpy(connection.target, target, length + 1);
+  return true;
+}
+
+void HttpServer::parseHeader(Connection &connection) {
+  char *colon = strchr(connection.line, ':');
+  if (colon == nullptr) {
+    return;
+  }
+  *colon = '\0';
+  const char *value = colon + 1;
+  while (*value == ' ' || *value == '\t') {
+    ++value;
+  }
+  if (strcasecmp(connection.line, "Content-Length") == 0) {
+    connection.bodyExpected = strtoul(value, nullptr, 10);
+    return;
+  }
+  for (size_t i = 0; i < collectedCount_; ++i) {
+    if (strcasecmp(connection.line, collected_[i]) == 0) {
+      strncpy(connection.headers[i], value, kMaxHeaderValueLength - 1);
+      connection.headers[i][kMaxHeaderValueLength - 1] = '\0';
+      return;
+    }
+  }
+}
+
+void HttpServer::dispatchNext() {
+  // One handler per poll() keeps the loop's worst case to a single response.
+  for (size_t i = 0; i < kMaxConnections; ++i) {
+    size_t index = (nextDispatch_ + i) % kMaxConnections;
+    if (connections_[index].state == State::kReady) {
+      nextDispatch_ = (index + 1) % kMaxConnections;
+      dispatch(connections_[index]);
+      return;
+    }
+  }
+}
+
+void HttpServer::dispatch(Connection &connection) {
+  ++stats_.requests;
+  current_ = &connection;
+  argCount_ = 0;
+  extraHeadersLength_ = 0;
+  contentLengthSet_ = false;
+  responseStarted_ = false;
+  takenOver_ = false;
+  failed_ = false;
+
+  char *query = strchr(connection.target, '?');
+  if (query != nullptr) {
+    *query++ = '\0';
+    parseArgs(query);
+  }
+
+  const Route *route = nullptr;
+  for (size_t i = 0; i < routeCount_; ++i) {
+    const Route &candidate = routes_[i];
+    if (strcmp(candidate.path, connection.target) == 0 &&
+        (candidate.method == HttpMethod::kAny || candidate.method == connection.method)) {
+      route = &candidate;
+      break;
+    }
+  }
+  if (route != nullptr) {
+    route->handler();
+  } else if (notFound_) {
+    notFound_();
+  }
+
+  if (!responseStarted_) {
+    if (takenOver_) {
+      release(connection);
+    } else {
+      send(500, "text/plain", "no response");
+    }
+  }
+  argCount_ = 0;
+  if (connection.state == State::kSending) {
+    free(connection.body);
+    connection.body = nullptr;
+    if (connection.next) {
+      resume(connection);
+    } else {
+      connection.complete = true;
+      drain(connection, millis());
+    }
+  }
+  current_ = nullptr;
+}
+
+void HttpServer::parseArgs(char *query) {
+  FieldReader reader(query, strlen(query), FieldReader::Syntax::kForm);
+  const char *name = nullptr;
+  const char *value = nullptr;
+  while (argCount_ < kMaxArgs && reader.next(name, value)) {
+    args_[argCount_++] = Arg{name, value};
+  }
+}
+
+void HttpServer::reject(Connection &connection, int code) {
+  ++stats_.rejected;
+  free(connection.body);
+  connection.body = nullptr;
+  char response[96];
+  int length = snprintf(response, sizeof(response),
+                        "HTTP/1.1 %d %s\r\nContent-Length: 0\r\nConnection: close\r\n\r\n", code,
+                        statusText(code));
+  // Best effort: an error reply that does not fit the socket right now is dropped.
+  if (length > 0 && connection.client.availableForWrite() >= static_cast<size_t>(length)) {
+    connection.client.write(reinterpret_cast<const uint8_t *>(response),
+                            static_cast<size_t>(length));
+  }
+  close(connection);
+}
+
+HttpMethod HttpServer::method() const {
+  return current_ != nullptr ? current_->method : HttpMethod::kAny;
+}
+
+const char *HttpServer::uri() const { return current_ != nullptr ? current_->target : ""; }
+
+bool HttpServer::hasArg(const char *name) const {
+  for (size_t i = 0; i < argCount_; ++i) {
+    if (strcmp(args_[i].name, name) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+String HttpServer::arg(const char *name) const {
+  for (size_t i = 0; i < argCount_; ++i) {
+    if (strcmp(args_[i].name, name) == 0) {
+      return String(args_[i].value);
+    }
+  }
+  return String();
+}
+
+String HttpServer::header(const char *name) const {
+  if (current_ == nullptr) {
+    return String();
+  }
+  for (size_t i = 0; i < collectedCount_; ++i) {
+    if (strcasecmp(name, collected_[i]) == 0) {
+      return String(current_->headers[i]);
+    }
+  }
+  return String();
+}
+
+WiFiClient HttpServer::client() {
+  if (current_ == nullptr) {
+    return WiFiClient();
+  }
+  takenOver_ = true;
+  return current_->client;
+}
+
+void HttpServer::sendHeader(const char *name, const char *value) {
+  int written = snprintf(extraHeaders_ + extraHeadersLength_,
+                         sizeof(extraHeaders_) - extraHeadersLength_, "%s: %s\r\n", name, value);
+  if (written > 0 && extraHeadersLength_ + static_cast<size_t>(written) < sizeof(extraHeaders_)) {
+    extraHeadersLength_ += static_cast<size_t>(written);
+  } else {
+    extraHeaders_[extraHeadersLength_] = '\0';
+  }
+}
+
+void HttpServer::setContentLength(size_t length) {
+  contentLength_ = length;
+  contentLengthSet_ = true;
+}
+
+void HttpServer::send(int code, const char *contentType, const char *content) {
+  size_t length = strlen(content);
+  writeHead(code, contentType, contentLengthSet_ ? contentLength_ : length);
+  queue(content, length);
+}
+
+void HttpServer::send_P(int code, const char *contentType, PGM_P content, size_t length) {
+  writeHead(code, contentType, length);
+  if (current_ != nullptr && !failed_) {
+    current_->progmem = content;
+    current_->progmemLength = length;
+    current_->progmemSent = 0;
+  }
+}
+
+void HttpServer::sendContent(const char *data, size_t length) {
+  if (!responseStarted_) {
+    return;
+  }
+  queue(data, length);
+}
+
+void HttpServer::continueWith(Continuation next) {
+  if (current_ != nullptr && responseStarted_ && !failed_) {
+    current_->next = next;
+  }
+}
+
+bool HttpServer::hasRoom() const {
+  return current_ != nullptr && !failed_ && roomFor(*current_);
+}
+
+bool HttpServer::roomFor(const Connection &connection) const {
+  return connection.blocks < kMaxStreamBlocks && queuedBytes_ + kBlockSize <= kMaxQueuedBytes;
+}
+
+bool HttpServer::heldBack(const Connection &connection) const {
+  // A streamed response keeps its last block to refill, so sent out means that block is empty.
+  return connection.next && connection.blocks < kMaxStreamBlocks &&
+         (connection.head == nullptr ||
+          (connection.head == connection.tail && connection.head->sent == connection.head->length));
+}
+
+void HttpServer::resume(Connection &connection) {
+  if (!connection.next || !roomFor(connection)) {
+    return;
+  }
+  connection.heldBack = false;
+  current_ = &connection;
+  responseStarted_ = true;
+  failed_ = false;
+  // Moved out while it runs, since a failed write releases the connection.
+  Continuation next = std::move(connection.next);
+  connection.next = nullptr;
+  bool done = next();
+  if (!failed_ && connection.state == State::kSending) {
+    if (done) {
+      connection.complete = true;
+      drain(connection, millis());
+    } else {
+      connection.next = std::move(next);
+      if (!connection.throttled) {
+        connection.throttled = true;
+        ++stats_.throttled;
+      }
+    }
+  }
+  current_ = nullptr;
+}
+
+void HttpServer::writeHead(int code, const char *contentType, size_t contentLength) {
+  if (current_ == nullptr || responseStarted_) {
+    return;
+  }
+  responseStarted_ = true;
+  current_->state = State::kSending;
+  current_->since = millis();
+  char head[160];
+  int length = snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\nContent-Type: %s\r\n", code,
+                        statusText(code), contentType);
+  if (length > 0) {
+    queue(head, static_cast<size_t>(length));
+  }
+  if (contentLength != kContentLengthUnknown) {
+    length = snprintf(head, sizeof(head), "Content-Length: %lu\r\n",
+                      static_cast<unsigned long>(contentLength));
+    queue(head, static_cast<size_t>(length));
+  }
+  queue(extraHeaders_, extraHeadersLength_);
+  static const char kTail[] = "Connection: close\r\n\r\n";
+  queue(kTail, sizeof(kTail) - 1);
+}
+
+void HttpServer::queue(const char *data, size_t length) {
+  Connection *connection = current_;
+  while (length > 0 && !failed_) {
+    Block *tail = connection->tail;
+    if (tail == nullptr || tail->length == kBlockSize) {
+      if (!appendBlock(*connection)) {
+        failed_ = true;
+        close(*connection);
+        return;
+      }
+      continue;
+    }
+    size_t space = kBlockSize - tail->length;
+    size_t count = length < space ? length : space;
+    memcpy(tail->data + tail->length, data, count);
+    tail->length = static_cast<uint16_t>(tail->length + count);
+    data += count;
+    length -= count;
+  }
+}
+
+bool HttpServer::appendBlock(Connection &connection) {
+  Block *block = static_cast<Block *>(malloc(sizeof(Block)));
+  if (block == nullptr) {
+    return false;
+  }
+  block->next = nullptr;
+  block->length = 0;
+  block->sent = 0;
+  queuedBytes_ += kBlockSize;
+  ++connection.blocks;
+  if (queuedBytes_ > stats_.peakQueuedBytes) {
+    stats_.peakQueuedBytes = queuedBytes_;
+  }
+  if (connection.tail != nullptr) {
+    connection.tail->next = block;
+  } else {
+    connection.head = block;
+  }
+  connection.tail = block;
+  return true;
+}
+
+void HttpServer::drain(Connection &connection, unsigned long now) {
+  while (connection.head != nullptr) {
+    Block *block = connection.head;
+    while (block->sent < block->length) {
+      size_t writable = connection.client.availableForWrite();
+      if (writable == 0) {
+        return;
+      }
+      size_t pending = block->length - block->sent;
+      size_t count = pending < writable ? pending : writable;
+      size_t written = connection.client.write(
+          reinterpret_cast<const uint8_t *>(block->data + block->sent), count);
+      if (written == 0) {
+        return;
+      }
+      connection.since = now;
+      block->sent = static_cast<uint16_t>(block->sent + written);
+    }
+    if (block == connection.tail && !connection.complete) {
+      // The handler is still filling this block; reuse it rather than free it.
+      block->length = 0;
+      block->sent = 0;
+      return;
+    }
+    connection.head = block->next;
+    if (connection.head == nullptr) {
+      connection.tail = nullptr;
+    }
+    free(block);
+    queuedBytes_ -= kBlockSize;
+    --connection.blocks;
+  }
+
+  while (connection.progmemSent < connection.progmemLength) {
+    size_t writable = connection.client.availableForWrite();
+    if (writable == 0) {
+      return;
+    }
+    size_t pending = connection.progmemLength - connection.progmemSent;
+    size_t count = pending < writable ? pending : writable;
+    size_t written = connection.client.write_P(connection.progmem + connection.progmemSent, count);
+    if (written == 0) {
+      return;
+    }
+    connection.since = now;
+    connection.progmemSent += written;
+  }
+
+  if (connection.complete) {
+    close(connection);
+  }
+}
+
+void HttpServer::close(Connection &connection) {
+  connection.client.stop();
+  release(connection);
+}
+
+void HttpServer::release(Connection &connection) {
+  while (connection.head != nullptr) {
+    Block *next = connection.head->next;
+    free(connection.head);
+    queuedBytes_ -= kBlockSize;
+    connection.head = next;
+  }
+  connection.tail = nullptr;
+  connection.blocks = 0;
+  connection.next = nullptr;
+  connection.throttled = false;
+  connection.heldBack = false;
+  free(connection.body);
+  connection.body = nullptr;
+  connection.progmem = nullptr;
+  connection.progmemLength = 0;
+  connection.progmemSent = 0;
+  connection.complete = false;
+  connection.client = WiFiClient();
+  connection.state = State::kIdle;
+}
+
+}  // namespace interface
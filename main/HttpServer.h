@@ -0,0 +1,212 @@
+#pragma once
+
+#include <ESP8266WiFi.h>
+
+#include <functional>
+
+namespace interface {
+
+enum class HttpMethod : uint8_t { kAny, kGet, kPost, kPut, kDelete, kOptions };
+
+/**
+ * Event-driven HTTP/1.1 server behind WebInterface's route table.
+ *
+ * Up to kMaxConnections clients are held at once, each with its own small
+ * state machine driven from poll(): the request line, the headers named in
+ * collectHeaders() and a body of up to kMaxBodySize bytes are read as they
+ * arrive, so a slow or idle client never holds up the loop. Complete
+ * requests are dispatched one per poll() to their handler, which answers
+ * through send() and sendContent() as it would with ESP8266WebServer.
+ * Query arguments are decoded in place in the request buffer; the body is
+ * left to the handler, typically through a FieldReader.
+ *
+ * Response bytes are queued in kBlockSize heap blocks and written from
+ * poll() as each socket accepts them; PROGMEM bodies are streamed from flash
+ * without a copy. A handler whose response can outgrow the queue hands the
+ * rest of it to continueWith(): poll() calls the continuation again whenever
+ * the connection has room (hasRoom()), so nothing ever waits for a client.
+ * Streamed responses keep the queues within kMaxQueuedBytes, give or take
+ * the last row each one wrote; responses written in one go are queued whole.
+ * The write timeout only runs while a connection's own bytes sit unsent: a
+ * stream with nothing left to write, held back because other connections
+ * fill the queues, waits without a deadline.
+ *
+ * Every response closes its connection, so bodies need no chunking and no
+ * length up front.
+ */
+class HttpServer {
+ public:
+  using Handler = std::function<void()>;
+  /** Writes the next part of a response; returns true once it is complete. */
+  using Continuation = std::function<bool()>;
+
+  static constexpr size_t kMaxConnections = 4;
+  static constexpr size_t kMaxRoutes = 16;
+  static constexpr size_t kMaxArgs = 24;
+  static constexpr size_t kMaxCollectedHeaders = 2;
+  static constexpr size_t kLineBufferSize = 256;
+  static constexpr size_t kMaxTargetLength = 256;
+  static constexpr size_t kMaxHeaderValueLength = 64;
+  static constexpr size_t kMaxBodySize = 4096;
+  static constexpr size_t kBlockSize = 512;
+  static constexpr size_t kMaxQueuedBytes = 12 * kBlockSize;
+  static constexpr size_t kMaxStreamBlocks = 4;  // Queued per streamed response before it yields.
+  static constexpr size_t kReadBudget = 1024;  // Per connection and poll().
+  static constexpr unsigned long kRequestTimeoutMs = 5000;
+  static constexpr unsigned long kWriteTimeoutMs = 5000;
+  static constexpr size_t kContentLengthUnknown = static_cast<size_t>(-1);
+
+  struct Stats {
+    uint32_t requests = 0;
+    uint32_t rejected = 0;   // Malformed, oversized or unsupported requests.
+    uint32_t timeouts = 0;   // Clients dropped for not sending or not reading.
+    uint32_t throttled = 0;  // Streamed responses that had to pause for queue space.
+    uint32_t heldBack = 0;   // Streamed responses sent out and waiting on other queues.
+    size_t peakQueuedBytes = 0;
+  };
+
+  explicit HttpServer(uint16_t port);
+
+  void begin();
+  /** Accepts, reads, dispatches at most one request, and writes; never waits on a client. */
+  void poll();
+
+  void on(const char *path, HttpMethod method, Handler handler);
+  void onNotFound(Handler handler);
+  /** Headers whose values header() should report; others are skipped while reading. */
+  void collectHeaders(const char *const names[], size_t count);
+
+  // The request being dispatched; only valid inside a handler.
+  HttpMethod method() const;
+  const char *uri() const;
+  bool hasArg(const char *name) const;
+  /** Value of a query argument, decoded; empty when absent. */
+  String arg(const char *name) const;
+  size_t args() const { return argCount_; }
+  const char *argName(size_t index) const { return args_[index].name; }
+  const char *argValue(size_t index) const { return args_[index].value; }
+  /** The request body, NUL-terminated and writable in place; nullptr when there is none. */
+  char *body() { return current_ != nullptr ? current_->body : nullptr; }
+  size_t bodyLength() const { return current_ != nullptr ? current_->bodyLength : 0; }
+  String header(const char *name) const;
+  /**
+   * The request's socket, for handlers that keep it open after returning,
+   * such as an event stream. Unless the handler also sends a response the
+   * server lets go of the connection without closing it.
+   */
+  WiFiClient client();
+
+  void sendHeader(const char *name, const char *value);
+  /** Content-Length for the next send(); kContentLengthUnknown leaves it out. */
+  void setContentLength(size_t length);
+  void send(int code, const char *contentType = "text/plain", const char *content = "");
+  /** Sends `length` bytes from flash as the whole body; they are read as the socket drains. */
+  void send_P(int code, const char *contentType, PGM_P content, size_t length);
+  void sendContent(const char *data, size_t length);
+  void sendContent(const char *text) { sendContent(text, strlen(text)); }
+  /**
+   * Finishes the current response from poll() after the handler returns.
+   * `next` writes through sendContent() while hasRoom() and is called again
+   * as the socket drains; it runs outside the request, so it must not read
+   * arguments or the body.
+   */
+  void continueWith(Continuation next);
+  /** Whether the response being written may queue another block now. */
+  bool hasRoom() const;
+
+  const Stats &stats() const { return stats_; }
+  size_t openConnections() const;
+  size_t queuedBytes() const { return queuedBytes_; }
+
+ private:
+  enum class State : uint8_t { kIdle, kRequestLine, kHeaders, kBody, kReady, kSending };
+
+  struct Block {
+    Block *next;
+    uint16_t length;
+    uint16_t sent;
+    char data[kBlockSize];
+  };
+
+  struct Connection {
+    WiFiClient client;
+    State state = State::kIdle;
+    unsigned long since = 0;  // Last progress, for timeouts.
+    HttpMethod method = HttpMethod::kGet;
+    char target[kMaxTargetLength];
+    char headers[kMaxCollectedHeaders][kMaxHeaderValueLength];
+    char line[kLineBufferSize];
+    uint16_t lineLength = 0;
+    bool lineOverflow = false;
+    char *body = nullptr;
+    size_t bodyLength = 0;
+    size_t bodyExpected = 0;
+    Block *head = nullptr;
+    Block *tail = nullptr;
+    PGM_P progmem = nullptr;
+    size_t progmemLength = 0;
+    size_t progmemSent = 0;
+    bool complete = false;  // The whole response is queued.
+    Continuation next;      // Writes the rest of a streamed response.
+    uint8_t blocks = 0;
+    bool throttled = false;
+    bool heldBack = false;  // Sent out and waiting for other connections' queues.
+  };
+
+  struct Route {
+    const char *path;
+    HttpMethod method;
+    Handler handler;
+  };
+
+  struct Arg {
+    const char *name;   // Both point into the connection's target buffer.
+    const char *value;
+  };
+
+  void accept();
+  void service(Connection &connection, unsigned long now);
+  void read(Connection &connection, unsigned long now);
+  void handleLine(Connection &connection);
+  bool parseRequestLine(Connection &connection);
+  void parseHeader(Connection &connection);
+  void dispatchNext();
+  void dispatch(Connection &connection);
+  void parseArgs(char *query);
+  void reject(Connection &connection, int code);
+
+  void writeHead(int code, const char *contentType, size_t contentLength);
+  void queue(const char *data, size_t length);
+  bool appendBlock(Connection &connection);
+  bool roomFor(const Connection &connection) const;
+  bool heldBack(const Connection &connection) const;
+  void resume(Connection &connection);
+  void drain(Connection &connection, unsigned long now);
+  void close(Connection &connection);
+  void release(Connection &connection);
+
+  WiFiServer listener_;
+  Connection connections_[kMaxConnections];
+  Route routes_[kMaxRoutes];
+  size_t routeCount_ = 0;
+  Handler notFound_;
+  const char *const *collected_ = nullptr;
+  size_t collectedCount_ = 0;
+  size_t nextDispatch_ = 0;
+  size_t queuedBytes_ = 0;
+  Stats stats_;
+
+  // State of the request being dispatched.
+  Connection *current_ = nullptr;
+  Arg args_[kMaxArgs];
+  size_t argCount_ = 0;
+  char extraHeaders_[192];
+  size_t extraHeadersLength_ = 0;
+  size_t contentLength_ = 0;
+  bool contentLengthSet_ = false;
+  bool responseStarted_ = false;
+  bool takenOver_ = false;
+  bool failed_ = false;  // The client stopped reading; the rest of the response is dropped.
+};
+
+}  // namespace interface
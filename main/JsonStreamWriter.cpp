@@ -0,0 +1,191 @@
+#include "JsonStreamWriter.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace interface {
+
+JsonStreamWriter::JsonStreamWriter(HttpServer &server) : server_(server) {}
+
+void JsonStreamWriter::begin(int code, const char *contentType) {
+  length_ = 0;
+  depth_ = 0;
+  hasMembers_ = 0;
+  afterKey_ = false;
+  server_.setContentLength(HttpServer::kContentLengthUnknown);
+  server_.send(code, contentType, "");
+}
+
+void JsonStreamWriter::end() {
+  // The server ends the body by closing the connection once it is written out.
+  flush();
+}
+
+void JsonStreamWriter::beginObject() { openContainer('{'); }
+
+void JsonStreamWriter::endObject() { closeContainer('}'); }
+
+void JsonStreamWriter::beginArray() { openContainer('['); }
+
+void JsonStreamWriter::endArray() { closeContainer(']'); }
+
+void JsonStreamWriter::key(const char *name) {
+  separator();
+  writeEscaped(name);
+  write(':');
+  afterKey_ = true;
+}
+
+void JsonStreamWriter::value(const char *text) {
+  separator();
+  if (text == nullptr) {
+    write("null", 4);
+    return;
+  }
+  writeEscaped(text);
+}
+
+void JsonStreamWriter::value(bool flag) {
+  separator();
+  if (flag) {
+    write("true", 4);
+  } else {
+    write("false", 5);
+  }
+}
+
+void JsonStreamWriter::value(long number) {
+  separator();
+  char digits[21];  // Enough for any 64-bit value and its sign.
+  int written = snprintf(digits, sizeof(digits), "%ld", number);
+  write(digits, written > 0 ? static_cast<size_t>(written) : 0);
+}
+
+void JsonStreamWriter::value(unsigned long number) {
+  separator();
+  char digits[21];  // Enough for any 64-bit value and its sign.
+  int written = snprintf(digits, sizeof(digits), "%lu", number);
+  write(digits, written > 0 ? static_cast<size_t>(written) : 0);
+}
+
+void JsonStreamWriter::value(float number, uint8_t decimals) {
+  separator();
+  if (isnan(number) || isinf(number)) {
+    write("null", 4);
+    return;
+  }
+  char digits[24];
+  int written = snprintf(digits, sizeof(digits), "%.*f", decimals, static_cast<double>(number));
+  if (written < 0) {
+    write("null", 4);
+    return;
+  }
+  size_t length = static_cast<size_t>(written);
+  write(digits, length < sizeof(digits) ? length : sizeof(digits) - 1);
+}
+
+void JsonStreamWriter::temperature(units::CentiCelsius centiDegrees, uint8_t decimals) {
+  separator();
+  char digits[12];
+  write(digits, units::formatCelsius(centiDegrees, decimals, digits, sizeof(digits)));
+}
+
+void JsonStreamWriter::null() {
+  separator();
+  write("null", 4);
+}
+
+void JsonStreamWriter::sendMessage(HttpServer &server,
+                                   int code,
+                                   const char *name,
+                                   const char *message) {
+  JsonStreamWriter json(server);
+  json.begin(code);
+  json.beginObject();
+  json.field(name, message);
+  json.endObject();
+  json.end();
+}
+
+void JsonStreamWriter::separator() {
+  if (afterKey_) {
+    afterKey_ = false;
+    return;
+  }
+  if (depth_ == 0) {
+    return;
+  }
+  uint16_t bit = static_cast<uint16_t>(1U << (depth_ - 1));
+  if (hasMembers_ & bit) {
+    write(',');
+  } else {
+    hasMembers_ |= bit;
+  }
+}
+
+void JsonStreamWriter::openContainer(char token) {
+  separator();
+  write(token);
+  if (depth_ < kMaxDepth) {
+    ++depth_;
+    hasMembers_ &= static_cast<uint16_t>(~(1U << (depth_ - 1)));
+  }
+}
+
+void JsonStreamWriter::closeContainer(char token) {
+  if (depth_ > 0) {
+    --depth_;
+  }
+  write(token);
+}
+
+void JsonStreamWriter::write(const char *data, size_t length) {
+  while (length > 0) {
+    size_t space = kBufferSize - length_;
+    if (space == 0) {
+      flush();
+      space = kBufferSize;
+    }
+    size_t chunk = length < space ? length : space;
+    memcpy(buffer_ + length_, data, chunk);
+    length_ += chunk;
+    data += chunk;
+    length -= chunk;
+  }
+}
+
+void JsonStreamWriter::write(char c) {
+  if (length_ == kBufferSize) {
+    flush();
+  }
+  buffer_[length_++] = c;
+}
+
+void JsonStreamWriter::writeEscaped(const char *text) {
+  write('"');
+  for (const char *p = text; *p != '\0'; ++p) {
+    char c = *p;
+    if (c == '"' || c == '\\') {
+      write('\\');
+      write(c);
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escaped[7];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+      write(escaped, 6);
+    } else {
+      write(c);
+    }
+  }
+  write('"');
+}
+
+void JsonStreamWriter::flush() {
+  if (length_ == 0) {
+    return;
+  }
+  server_.sendContent(buffer_, length_);
+  length_ = 0;
+}
+
+}  // namespace interface
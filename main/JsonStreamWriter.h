@@ -0,0 +1,88 @@
+#pragma once
+
+#include "HttpServer.h"
+#include "Temperature.h"
+
+namespace interface {
+
+/**
+ * Streams a JSON document to the current HTTP client without a length up
+ * front.
+ *
+ * Output is staged in a small fixed buffer that is handed to the server
+ * whenever it fills, so the heap cost of a response does not grow with its
+ * size beyond the server's bounded send queue.
+ */
+class JsonStreamWriter {
+ public:
+  static constexpr size_t kBufferSize = 256;
+  static constexpr uint8_t kMaxDepth = 16;
+
+  explicit JsonStreamWriter(HttpServer &server);
+
+  /** Sends the status line and headers; the body follows as it is written. */
+  void begin(int code, const char *contentType = "application/json");
+
+  /** Flushes pending output; the body ends when the server closes the connection. */
+  void end();
+
+  void beginObject();
+  void endObject();
+  void beginArray();
+  void endArray();
+
+  void key(const char *name);
+
+  void value(const char *text);
+  void value(bool flag);
+  void value(long number);
+  void value(unsigned long number);
+  void value(int number) { value(static_cast<long>(number)); }
+  void value(unsigned int number) { value(static_cast<unsigned long>(number)); }
+  /** Writes a fixed-point number, or null when the value is NaN. */
+  void value(float number, uint8_t decimals);
+  /** Writes a temperature in degrees with 1 or 2 decimals, or null when missing. */
+  void temperature(units::CentiCelsius centiDegrees, uint8_t decimals = 2);
+  void null();
+
+  template <typename T>
+  void field(const char *name, T fieldValue) {
+    key(name);
+    value(fieldValue);
+  }
+
+  void field(const char *name, float fieldValue, uint8_t decimals) {
+    key(name);
+    value(fieldValue, decimals);
+  }
+
+  void temperatureField(const char *name, units::CentiCelsius centiDegrees, uint8_t decimals = 2) {
+    key(name);
+    temperature(centiDegrees, decimals);
+  }
+
+  /** Writes a complete object in one call, e.g. {"status":"ok"}. */
+  static void sendMessage(HttpServer &server,
+                          int code,
+                          const char *name,
+                          const char *message);
+
+ private:
+  void separator();
+  void openContainer(char token);
+  void closeContainer(char token);
+  void write(const char *data, size_t length);
+  void write(char c);
+  void writeEscaped(const char *text);
+  void flush();
+
+  HttpServer &server_;
+  char buffer_[kBufferSize];
+  size_t length_ = 0;
+  uint8_t depth_ = 0;
+  // Bit n is set once the container at depth n has received its first member.
+  uint16_t hasMembers_ = 0;
+  bool afterKey_ = false;
+};
+
+}  // namespace interface
@@ -0,0 +1,66 @@
+#include "LogClock.h"
+
+#include <time.h>
+
+namespace logging {
+
+void LogClock::resumeAfter(uint32_t epochSeconds) {
+  if (!synced_ && !provisionalUsed_ && epochSeconds > provisionalStart_) {
+    provisionalStart_ = epochSeconds;
+  }
+}
+
+uint32_t LogClock::now() {
+  uint32_t provisional = provisionalNow();
+  time_t wall = time(nullptr);
+  if (wall < static_cast<time_t>(kMinSyncedEpoch)) {
+    if (!synced_) {
+      provisionalUsed_ = true;
+      return provisional;
+    }
+    // A synced clock never goes back to uptime; keep counting from the last sync.
+    wall = static_cast<time_t>(provisional);
+  }
+  uint32_t real = static_cast<uint32_t>(wall);
+  if (!synced_) {
+    synced_ = true;
+    if (provisionalUsed_) {
+      int32_t minutes = static_cast<int32_t>(real / 60UL - provisional / 60UL);
+      correctionSeconds_ = static_cast<long>(minutes) * 60L;
+      correctionSince_ = provisionalStart_;
+      correctionPending_ = true;
+    }
+  }
+  // Provisional time follows the real clock from here on.
+  provisionalStart_ = real - uptimeSeconds_;
+  return real;
+}
+
+bool LogClock::takeCorrection(uint32_t &since, long &deltaSeconds) {
+  if (!correctionPending_) {
+    return false;
+  }
+  correctionPending_ = false;
+  since = correctionSince_;
+  deltaSeconds = correctionSeconds_;
+  return correctionSeconds_ != 0;
+}
+
+unsigned long LogClock::movedPeriodStart(unsigned long timestamp,
+                                         long deltaSeconds,
+                                         unsigned long periodSeconds) {
+  // Wraps back for a negative delta; moved rows never end up before the epoch.
+  unsigned long moved = timestamp + static_cast<unsigned long>(deltaSeconds);
+  return moved - moved % periodSeconds;
+}
+
+uint32_t LogClock::provisionalNow() {
+  unsigned long nowMs = millis();
+  pendingMs_ += nowMs - lastMillis_;
+  lastMillis_ = nowMs;
+  uptimeSeconds_ += static_cast<uint32_t>(pendingMs_ / 1000UL);
+  pendingMs_ %= 1000UL;
+  return provisionalStart_ + uptimeSeconds_;
+}
+
+}  // namespace logging
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace logging {
+
+/**
+ * Wall-clock time for log rows, in epoch seconds.
+ *
+ * Rows are stamped with time() once it reports an NTP-set date. Until then
+ * they get provisional times that count uptime on from resumeAfter(), the
+ * end of the history restored from flash, so they still sort after it.
+ * When the real time first shows up the offset is handed out once through
+ * takeCorrection() and the logs move their provisional rows onto it.
+ *
+ * Uptime is summed from millis() differences, so the wraparound after
+ * 49.7 days does not disturb provisional times.
+ */
+class LogClock {
+ public:
+  /** time() values below this (2020-01-01) are uptime, not an NTP-set date. */
+  static constexpr uint32_t kMinSyncedEpoch = 1577836800UL;
+
+  /** Starts provisional time at `epochSeconds`; ignored once a time has been handed out. */
+  void resumeAfter(uint32_t epochSeconds);
+
+  uint32_t now();
+  bool synced() const { return synced_; }
+
+  /**
+   * Reports, once after synchronization, how far provisional rows must move:
+   * rows at or after `since` shift by `deltaSeconds`, a whole number of
+   * minutes chosen so the minute in progress lands on the real one. Returns
+   * false when no provisional time was handed out.
+   */
+  bool takeCorrection(uint32_t &since, long &deltaSeconds);
+
+  /**
+   * Start of the period `timestamp` falls in once moved by `deltaSeconds`.
+   * A rollup bucket moved this way lands in the period of its first row,
+   * however far into a period the rows' shift reaches.
+   */
+  static unsigned long movedPeriodStart(unsigned long timestamp,
+                                        long deltaSeconds,
+                                        unsigned long periodSeconds);
+
+ private:
+  uint32_t provisionalNow();
+
+  uint32_t provisionalStart_ = kMinSyncedEpoch;
+  uint32_t uptimeSeconds_ = 0;
+  unsigned long lastMillis_ = 0;
+  unsigned long pendingMs_ = 0;
+  uint32_t correctionSince_ = 0;
+  long correctionSeconds_ = 0;
+  bool synced_ = false;
+  bool provisionalUsed_ = false;
+  bool correctionPending_ = false;
+};
+
+}  // namespace logging
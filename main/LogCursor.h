@@ -0,0 +1,87 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace logging {
+
+/**
+ * Resume points for responses that write a log range in several passes,
+ * such as HttpServer continuations. Both locate rows again on every pass
+ * rather than keeping positions, so rows appended or evicted while the
+ * client reads do not shift them.
+ */
+
+/** Rows [next, end) counted from the log's first row; see rowsAppended(). */
+struct RowCursor {
+  uint32_t next;
+  uint32_t end;
+};
+
+/** Buckets of one tier overlapping [start, end] that are still to be sent. */
+struct BucketCursor {
+  unsigned long start;
+  unsigned long end;
+  bool done;
+};
+
+/** Cursor over the rows at positions [first, last) of `log`, oldest first. */
+template <typename Log>
+RowCursor rowCursor(const Log &log, size_t first, size_t last) {
+  uint32_t oldest = log.rowsAppended() - static_cast<uint32_t>(log.size());
+  return RowCursor{oldest + static_cast<uint32_t>(first), oldest + static_cast<uint32_t>(last)};
+}
+
+/**
+ * Hands up to `limit` rows to `callback` and moves the cursor past them.
+ * Rows evicted since the last pass are skipped. Returns false, without
+ * calling back, once the cursor has reached its end.
+ */
+template <typename Log, typename Callback>
+bool nextRows(const Log &log, RowCursor &cursor, size_t limit, Callback callback) {
+  uint32_t oldest = log.rowsAppended() - static_cast<uint32_t>(log.size());
+  if (static_cast<int32_t>(cursor.next - oldest) < 0) {
+    cursor.next = oldest;
+  }
+  if (cursor.next >= cursor.end) {
+    return false;
+  }
+  uint32_t stop = cursor.end - cursor.next > limit ? cursor.next + static_cast<uint32_t>(limit)
+                                                   : cursor.end;
+  log.forEachRow(cursor.next - oldest, stop - oldest, callback);
+  cursor.next = stop;
+  return true;
+}
+
+/**
+ * Hands up to `limit` buckets of `resolution` to `callback`, as
+ * Log::forEachRollup() does, and moves the cursor past the last one.
+ * Returns false once the range is exhausted.
+ */
+template <typename Log, typename Callback>
+bool nextRollups(const Log &log,
+                 typename Log::Resolution resolution,
+                 BucketCursor &cursor,
+                 size_t limit,
+                 Callback callback) {
+  if (cursor.done) {
+    return false;
+  }
+  bool visited = false;
+  unsigned long last = 0;
+  bool more = log.forEachRollup(
+      resolution, cursor.start, cursor.end,
+      [&](const typename Log::Rollup &bucket) {
+        callback(bucket);
+        visited = true;
+        last = bucket.timestamp;
+      },
+      limit);
+  // Only buckets after the last one overlap the rest of the range.
+  if (visited) {
+    cursor.start = last + Log::periodSeconds(resolution);
+  }
+  cursor.done = !more || !visited;
+  return visited;
+}
+
+}  // namespace logging
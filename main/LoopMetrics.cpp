@@ -0,0 +1,129 @@
+#include "LoopMetrics.h"
+
+#include <string.h>
+
+namespace diagnostics {
+
+namespace {
+const char *const kStageNames[] = {
+    "network", "ota", "sensors", "schedule", "controller", "powerLogStorage",
+    "settingsStorage", "web", "loop",
+};
+static_assert(sizeof(kStageNames) / sizeof(kStageNames[0]) == LoopMetrics::kStageCount,
+              "every stage needs a name");
+
+uint8_t highestBit(uint32_t value) { return static_cast<uint8_t>(31 - __builtin_clz(value)); }
+}  // namespace
+
+LoopMetrics::LoopMetrics() { reset(); }
+
+uint32_t LoopMetrics::record(Stage stage, uint32_t since) {
+  uint32_t now = ESP.getCycleCount();
+  // Unsigned subtraction stays correct across one counter wrap (~26 s at 160 MHz).
+  add(stage, (now - since) / ESP.getCpuFreqMHz());
+  return now;
+}
+
+void LoopMetrics::finishLoop(uint32_t loopStart) {
+  record(Stage::kLoop, loopStart);
+  uint32_t freeHeap = ESP.getFreeHeap();
+  if (minFreeHeap_ == 0 || freeHeap < minFreeHeap_) {
+    minFreeHeap_ = freeHeap;
+  }
+}
+
+void LoopMetrics::reset() {
+  for (StageStats &stats : stats_) {
+    stats = StageStats();
+  }
+  memset(buckets_, 0, sizeof(buckets_));
+  minFreeHeap_ = 0;
+}
+
+uint32_t LoopMetrics::percentileUs(Stage stage, float quantile) const {
+  const uint16_t *buckets = buckets_[index(stage)];
+  uint32_t total = 0;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    total += buckets[i];
+  }
+  if (total == 0) {
+    return 0;
+  }
+  // Rank of the sample at `quantile`, rounded up so p99 of 100 samples is the 99th.
+  uint32_t rank = static_cast<uint32_t>(quantile * static_cast<float>(total) + 0.999f);
+  if (rank == 0) {
+    rank = 1;
+  }
+  uint32_t seen = 0;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    seen += buckets[i];
+    if (seen >= rank) {
+      uint32_t upper = bucketUpperBound(i);
+      uint32_t maxUs = stats_[index(stage)].maxUs;
+      return upper < maxUs ? upper : maxUs;
+    }
+  }
+  return stats_[index(stage)].maxUs;
+}
+
+LoopMetrics::HeapStats LoopMetrics::heap() const {
+  HeapStats heap;
+  heap.freeBytes = ESP.getFreeHeap();
+  heap.minFreeBytes = minFreeHeap_ != 0 && minFreeHeap_ < heap.freeBytes ? minFreeHeap_
+                                                                          : heap.freeBytes;
+  heap.maxBlockBytes = ESP.getMaxFreeBlockSize();
+  heap.fragmentationPercent = ESP.getHeapFragmentation();
+  return heap;
+}
+
+const char *LoopMetrics::stageName(Stage stage) {
+  size_t i = index(stage);
+  return i < kStageCount ? kStageNames[i] : "unknown";
+}
+
+size_t LoopMetrics::bucketFor(uint32_t micros) {
+  constexpr uint32_t kSubBuckets = 1U << kSubBucketBits;
+  if (micros < kSubBuckets) {
+    return micros;
+  }
+  uint8_t exponent = highestBit(micros);
+  if (exponent > kMaxExponent) {
+    return kBucketCount - 1;
+  }
+  uint32_t sub = (micros >> (exponent - kSubBucketBits)) & (kSubBuckets - 1);
+  return (static_cast<size_t>(exponent - kSubBucketBits + 1) << kSubBucketBits) | sub;
+}
+
+uint32_t LoopMetrics::bucketUpperBound(size_t bucket) {
+  constexpr uint32_t kSubBuckets = 1U << kSubBucketBits;
+  if (bucket < kSubBuckets) {
+    return static_cast<uint32_t>(bucket);
+  }
+  uint8_t exponent = static_cast<uint8_t>((bucket >> kSubBucketBits) + kSubBucketBits - 1);
+  uint32_t sub = static_cast<uint32_t>(bucket) & (kSubBuckets - 1);
+  uint32_t width = 1U << (exponent - kSubBucketBits);
+  return ((kSubBuckets | sub) << (exponent - kSubBucketBits)) + width - 1;
+}
+
+void LoopMetrics::add(Stage stage, uint32_t micros) {
+  StageStats &stats = stats_[index(stage)];
+  if (stats.count == 0 || micros < stats.minUs) {
+    stats.minUs = micros;
+  }
+  if (micros > stats.maxUs) {
+    stats.maxUs = micros;
+  }
+  ++stats.count;
+  stats.totalUs += micros;
+
+  uint16_t *buckets = buckets_[index(stage)];
+  size_t bucket = bucketFor(micros);
+  if (buckets[bucket] == UINT16_MAX) {
+    for (size_t i = 0; i < kBucketCount; ++i) {
+      buckets[i] >>= 1;
+    }
+  }
+  ++buckets[bucket];
+}
+
+}  // namespace diagnostics
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace diagnostics {
+
+/**
+ * Per-stage timing of loop() from the CPU cycle counter, plus heap health.
+ *
+ * Each stage keeps min/max/sum and a log-linear histogram (four buckets per
+ * power of two of microseconds, about 19% wide) from which percentiles are
+ * estimated. Bucket counts are 16-bit; when one saturates every bucket of
+ * that stage is halved, so long uptimes weigh recent behavior more without
+ * costing more RAM.
+ */
+class LoopMetrics {
+ public:
+  enum class Stage : uint8_t {
+    kNetwork,
+    kOta,
+    kSensors,
+    kSchedule,
+    kController,
+    kPowerLogStorage,
+    kSettingsStorage,
+    kWeb,
+    kLoop,  // Whole loop() iteration.
+    kCount,
+  };
+
+  static constexpr size_t kStageCount = static_cast<size_t>(Stage::kCount);
+  static constexpr uint8_t kSubBucketBits = 2;
+  // Durations from 2^kMaxExponent us (~1 s) on share the top octave's buckets.
+  static constexpr uint8_t kMaxExponent = 20;
+  static constexpr size_t kBucketCount = (kMaxExponent - kSubBucketBits + 2) << kSubBucketBits;
+
+  struct StageStats {
+    uint32_t count = 0;
+    uint32_t minUs = 0;
+    uint32_t maxUs = 0;
+    uint64_t totalUs = 0;
+  };
+
+  struct HeapStats {
+    uint32_t freeBytes = 0;
+    uint32_t minFreeBytes = 0;  // Low-water mark since the last reset.
+    uint32_t maxBlockBytes = 0;
+    uint8_t fragmentationPercent = 0;
+  };
+
+  LoopMetrics();
+
+  /** Cycle count to pass to the first record() of a loop iteration. */
+  static uint32_t mark() { return ESP.getCycleCount(); }
+
+  /** Records the time since `since` against `stage` and returns the new mark. */
+  uint32_t record(Stage stage, uint32_t since);
+
+  /** Records the whole iteration started at `loopStart` and samples the heap. */
+  void finishLoop(uint32_t loopStart);
+
+  void reset();
+
+  const StageStats &stats(Stage stage) const { return stats_[index(stage)]; }
+  /** Upper bound of the bucket holding the given quantile (0..1), clamped to max. */
+  uint32_t percentileUs(Stage stage, float quantile) const;
+  HeapStats heap() const;
+  uint32_t loops() const { return stats_[index(Stage::kLoop)].count; }
+
+  static const char *stageName(Stage stage);
+
+ private:
+  static size_t index(Stage stage) { return static_cast<size_t>(stage); }
+  static size_t bucketFor(uint32_t micros);
+  static uint32_t bucketUpperBound(size_t bucket);
+  void add(Stage stage, uint32_t micros);
+
+  StageStats stats_[kStageCount];
+  uint16_t buckets_[kStageCount][kBucketCount];
+  uint32_t minFreeHeap_ = 0;
+};
+
+}  // namespace diagnostics
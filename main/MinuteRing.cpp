@@ -0,0 +1,87 @@
+#include "MinuteRing.h"
+
+namespace logging {
+
+void MinuteRing::clear() {
+  nextRow_ = 0;
+  count_ = 0;
+  runCount_ = 0;
+}
+
+unsigned long MinuteRing::minute(size_t position) const {
+  uint32_t row = oldestRow() + static_cast<uint32_t>(position);
+  const Run &run = runs_[runFor(row)];
+  return run.minute + (row - run.firstRow);
+}
+
+bool MinuteRing::ordered() const {
+  for (size_t run = 1; run < runCount_; ++run) {
+    unsigned long previousLast =
+        runs_[run - 1].minute + (runs_[run].firstRow - 1 - runs_[run - 1].firstRow);
+    if (runs_[run].minute <= previousLast) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t MinuteRing::lowerBound(unsigned long minute) const {
+  if (!ordered()) {
+    size_t position = 0;
+    size_t found = count_;
+    forEach([&](size_t, unsigned long rowMinute) {
+      if (found == count_ && rowMinute >= minute) {
+        found = position;
+      }
+      ++position;
+    });
+    return found;
+  }
+  // Rows within a run are consecutive minutes, so each run is one comparison.
+  uint32_t oldest = oldestRow();
+  for (size_t run = 0; run < runCount_; ++run) {
+    uint32_t first = runs_[run].firstRow > oldest ? runs_[run].firstRow : oldest;
+    uint32_t end = run + 1 < runCount_ ? runs_[run + 1].firstRow : nextRow_;
+    unsigned long firstMinute = runs_[run].minute + (first - runs_[run].firstRow);
+    if (minute <= firstMinute) {
+      return first - oldest;
+    }
+    if (minute - firstMinute < end - first) {
+      return first - oldest + (minute - firstMinute);
+    }
+  }
+  return count_;
+}
+
+size_t MinuteRing::upperBound(unsigned long minute) const {
+  if (!ordered() || minute + 1 == 0) {
+    return count_;
+  }
+  return lowerBound(minute + 1);
+}
+
+size_t MinuteRing::runFor(uint32_t row) const {
+  size_t run = runCount_;
+  while (run > 1 && runs_[run - 1].firstRow > row) {
+    --run;
+  }
+  return run > 0 ? run - 1 : 0;
+}
+
+void MinuteRing::dropOldest(size_t rows) {
+  count_ = rows < count_ ? count_ - rows : 0;
+  if (count_ == 0) {
+    runCount_ = 0;
+    return;
+  }
+  size_t stale = 0;
+  while (stale + 1 < runCount_ && runs_[stale + 1].firstRow <= oldestRow()) {
+    ++stale;
+  }
+  if (stale > 0) {
+    memmove(runs_, runs_ + stale, (runCount_ - stale) * sizeof(Run));
+    runCount_ -= stale;
+  }
+}
+
+}  // namespace logging
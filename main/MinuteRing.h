@@ -0,0 +1,171 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <string.h>
+
+namespace logging {
+
+/**
+ * Slot and minute bookkeeping for a ring of per-minute rows whose values
+ * live in parallel arrays owned by the log.
+ *
+ * Rows almost always cover consecutive minutes, so rather than a timestamp
+ * per row the ring keeps runs: the first row and minute of each stretch of
+ * consecutive minutes. A row's minute is its run's start plus its offset
+ * into the run. A gap or a step back in time (a stalled loop, a reboot,
+ * history restored from flash) opens a new run; when the run table is full
+ * the rows of the oldest run are dropped early to free its entry.
+ */
+class MinuteRing {
+ public:
+  static constexpr size_t kMaxRuns = 8;
+
+  explicit MinuteRing(size_t capacity) : capacity_(capacity) {}
+
+  void clear();
+
+  size_t size() const { return count_; }
+  size_t capacity() const { return capacity_; }
+  /** Rows appended so far; the newest row is number rowsAppended() - 1. */
+  uint32_t rowsAppended() const { return nextRow_; }
+
+  /**
+   * Opens a row for `minute` and returns its slot. `evict(slot)` is called
+   * for each row that has to make room, oldest first, while its values are
+   * still in place.
+   */
+  template <typename Evict>
+  size_t append(unsigned long minute, Evict evict) {
+    if (count_ == 0) {
+      runCount_ = 0;
+    }
+    if (count_ == 0 || minute != newestMinute() + 1) {
+      startRun(minute, evict);
+    }
+    if (count_ == capacity_) {
+      evict(slot(0));
+      dropOldest(1);
+    }
+    size_t newSlot = nextRow_ % capacity_;
+    ++nextRow_;
+    ++count_;
+    return newSlot;
+  }
+
+  /**
+   * Moves the rows from `position` on by `deltaMinutes`, for example when
+   * rows stamped before the clock was set are put on the real clock. A run
+   * that straddles `position` is split; `evict` is called as in append()
+   * if that needs a run entry freed.
+   */
+  template <typename Evict>
+  void shiftFrom(size_t position, long deltaMinutes, Evict evict) {
+    if (position >= count_ || deltaMinutes == 0) {
+      return;
+    }
+    uint32_t row = oldestRow() + static_cast<uint32_t>(position);
+    size_t run = runFor(row);
+    bool split = runs_[run].firstRow != row && !(run == 0 && row == oldestRow());
+    if (split && runCount_ == kMaxRuns) {
+      dropOldestRun(evict);
+      if (count_ == 0) {
+        return;
+      }
+      if (row <= oldestRow()) {
+        row = oldestRow();
+        split = false;
+      }
+      run = runFor(row);
+    }
+    if (split) {
+      memmove(runs_ + run + 2, runs_ + run + 1, (runCount_ - run - 1) * sizeof(Run));
+      runs_[run + 1] = {row, runs_[run].minute + (row - runs_[run].firstRow)};
+      ++runCount_;
+      ++run;
+    }
+    for (; run < runCount_; ++run) {
+      runs_[run].minute += deltaMinutes;
+    }
+  }
+
+  /** Slot of the `position`-th row, oldest first. */
+  size_t slot(size_t position) const { return (oldestRow() + position) % capacity_; }
+  size_t newestSlot() const { return slot(count_ - 1); }
+
+  unsigned long minute(size_t position) const;
+  unsigned long newestMinute() const { return minute(count_ - 1); }
+
+  /** True while every run starts after the previous one ends. */
+  bool ordered() const;
+
+  /**
+   * Position of the first row at or after `minute`; size() when there is
+   * none. Walks the run table while the ring is ordered, otherwise the rows.
+   */
+  size_t lowerBound(unsigned long minute) const;
+  /**
+   * Position past the last row at or before `minute`. While the ring is not
+   * ordered this is size(), so callers must check row minutes themselves.
+   */
+  size_t upperBound(unsigned long minute) const;
+
+  /** Calls `callback(slot, minute)` for every row, oldest first. */
+  template <typename Callback>
+  void forEach(Callback callback) const {
+    forEachIn(0, count_, callback);
+  }
+
+  /** Calls `callback(slot, minute)` for the rows at positions [first, last). */
+  template <typename Callback>
+  void forEachIn(size_t first, size_t last, Callback callback) const {
+    if (last > count_) {
+      last = count_;
+    }
+    uint32_t row = oldestRow() + static_cast<uint32_t>(first);
+    size_t run = runFor(row);
+    for (size_t position = first; position < last; ++position, ++row) {
+      while (run + 1 < runCount_ && runs_[run + 1].firstRow <= row) {
+        ++run;
+      }
+      callback(static_cast<size_t>(row % capacity_),
+               runs_[run].minute + (row - runs_[run].firstRow));
+    }
+  }
+
+ private:
+  struct Run {
+    uint32_t firstRow;
+    unsigned long minute;
+  };
+
+  uint32_t oldestRow() const { return nextRow_ - static_cast<uint32_t>(count_); }
+  size_t runFor(uint32_t row) const;
+  void dropOldest(size_t rows);
+
+  template <typename Evict>
+  void startRun(unsigned long minute, Evict evict) {
+    if (runCount_ == kMaxRuns) {
+      // Give up the oldest run's rows rather than mislabel them.
+      dropOldestRun(evict);
+    }
+    runs_[runCount_++] = {nextRow_, minute};
+  }
+
+  template <typename Evict>
+  void dropOldestRun(Evict evict) {
+    size_t dropped = runs_[1].firstRow - oldestRow();
+    for (size_t i = 0; i < dropped; ++i) {
+      evict(slot(i));
+    }
+    dropOldest(dropped);
+  }
+
+  const size_t capacity_;
+  uint32_t nextRow_ = 0;
+  size_t count_ = 0;
+  Run runs_[kMaxRuns];
+  size_t runCount_ = 0;
+};
+
+}  // namespace logging
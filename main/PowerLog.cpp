@@ -1,8 +1,84 @@
 #include "PowerLog.h"
 
+#include "LogClock.h"
+
 namespace logging {
 
-PowerLog::PowerLog() = default;
+namespace {
+constexpr unsigned long kHourSeconds = 60UL * PowerLog::kMinuteSeconds;
+constexpr unsigned long kDaySeconds = 24UL * kHourSeconds;
+constexpr unsigned long kMonthSeconds = 30UL * kDaySeconds;
+// logState() runs every control tick; a longer step means the clock moved.
+constexpr unsigned long kMaxStepSeconds = 5UL * 60UL;
+
+/**
+ * Finds the bucket covering `timestamp` in a ring of fixed-period buckets,
+ * where `timestampAt(i)` is the start of the i-th bucket, oldest first.
+ */
+template <typename TimestampAt>
+bool locateBucket(size_t count,
+                  unsigned long period,
+                  unsigned long timestamp,
+                  TimestampAt timestampAt,
+                  size_t &position) {
+  if (count == 0) {
+    return false;
+  }
+  unsigned long bucketStart = timestamp - (timestamp % period);
+  unsigned long newest = timestampAt(count - 1);
+  unsigned long oldest = timestampAt(0);
+  if (bucketStart <= newest) {
+    unsigned long offset = (newest - bucketStart) / period;
+    if (offset < count && timestampAt(count - 1 - offset) == bucketStart) {
+      position = count - 1 - offset;
+      return true;
+    }
+  }
+  if (newest >= oldest && newest - oldest == (count - 1) * period) {
+    // A contiguous ring would have matched above.
+    return false;
+  }
+  // Rows restored from a previous boot can leave gaps; fall back to a scan.
+  for (size_t i = 0; i < count; ++i) {
+    if (timestampAt(i) == bucketStart) {
+      position = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t toCentiWh(float energyWh) {
+  if (!(energyWh > 0.0f)) {
+    return 0;
+  }
+  float scaled = energyWh * 100.0f + 0.5f;
+  return scaled >= 4294967040.0f ? UINT32_MAX : static_cast<uint32_t>(scaled);
+}
+
+uint16_t saturate16(uint32_t value) {
+  return value > UINT16_MAX ? UINT16_MAX : static_cast<uint16_t>(value);
+}
+}  // namespace
+
+PowerLog::PowerLog()
+    : tiers_{{hours_, kHourBuckets, kHourSeconds, 0, 0},
+             {days_, kDayBuckets, kDaySeconds, 0, 0},
+             {months_, kMonthBuckets, kMonthSeconds, 0, 0}} {}
+
+unsigned long PowerLog::periodSeconds(Resolution resolution) {
+  switch (resolution) {
+    case Resolution::kMinute:
+      return kMinuteSeconds;
+    case Resolution::kHour:
+      return kHourSeconds;
+    case Resolution::kDay:
+      return kDaySeconds;
+    case Resolution::kMonth:
+      return kMonthSeconds;
+  }
+  return kMinuteSeconds;
+}
 
 void PowerLog::setConsumptionTable(const ConsumptionRate *rates, size_t count) {
   rates_ = rates;
@@ -25,18 +101,20 @@ void PowerLog::logState(unsigned long timestamp,
 
   unsigned long start = lastTimestamp_;
   unsigned long end = timestamp;
-  if (end < start) {
+  if (end < start || end - start > kMaxStepSeconds) {
+    // The wall clock was stepped; there is no elapsed time to integrate.
     start = end;
   }
 
   while (start < end) {
-    unsigned long minute = start / 60000UL;
+    unsigned long minute = start / kMinuteSeconds;
     ensureMinute(minute);
-    unsigned long minuteEnd = (minute + 1) * 60000UL;
+    unsigned long minuteEnd = (minute + 1) * kMinuteSeconds;
     unsigned long segmentEnd = end < minuteEnd ? end : minuteEnd;
     unsigned long segmentDuration = segmentEnd - start;
     if (segmentDuration > 0) {
-      accumulateSegment(segmentDuration, lastWatts_, lastFanSpeedState_, lastCompressorState_);
+      accumulateSegment(segmentDuration * 1000UL, lastWatts_, lastFanSpeedState_,
+                        lastCompressorState_);
     }
     start = segmentEnd;
   }
@@ -49,23 +127,78 @@ void PowerLog::logState(unsigned long timestamp,
 
 void PowerLog::clear() { restoreEntries(nullptr, 0, 0.0f); }
 
+void PowerLog::rebase(unsigned long since, long deltaSeconds) {
+  long deltaMinutes = deltaSeconds / static_cast<long>(kMinuteSeconds);
+  unsigned long sinceMinute = since / kMinuteSeconds;
+  ring_.shiftFrom(ring_.lowerBound(sinceMinute), deltaMinutes,
+                  [this](size_t slot) { baseCentiWh_ += energyCentiWh_[slot]; });
+  if (hasCurrentMinute_ && currentMinute_ >= sinceMinute) {
+    currentMinute_ += deltaMinutes;
+  }
+  if (initialized_ && lastTimestamp_ >= since) {
+    lastTimestamp_ += deltaSeconds;
+  }
+  // Each bucket goes where its first row went; rows move by whole minutes.
+  long rowShift = deltaMinutes * static_cast<long>(kMinuteSeconds);
+  for (Tier &tier : tiers_) {
+    for (size_t processed = 0; processed < tier.count; ++processed) {
+      Rollup &bucket = tier.buckets[tier.slot(processed)];
+      if (bucket.timestamp >= since) {
+        bucket.timestamp =
+            LogClock::movedPeriodStart(bucket.timestamp, rowShift, tier.periodSeconds);
+      }
+    }
+  }
+  ++rebaseCount_;
+  revisions_.reset();
+}
+
 size_t PowerLog::copyEntries(Entry *dest, size_t maxEntries) const {
   if (dest == nullptr || maxEntries == 0) {
     return 0;
   }
-  size_t available = count_ < maxEntries ? count_ : maxEntries;
-  for (size_t i = 0; i < available; ++i) {
-    size_t index = (head_ + kMaxEntries - count_ + i) % kMaxEntries;
-    dest[i] = entries_[index];
-  }
-  return available;
+  size_t copied = 0;
+  forEach([&](const Entry &entry) {
+    if (copied < maxEntries) {
+      dest[copied++] = entry;
+    }
+  });
+  return copied;
 }
 
 void PowerLog::restoreEntries(const Entry *entries, size_t count, float totalEnergyWh) {
-  if (entries == nullptr || count == 0) {
-    head_ = 0;
-    count_ = 0;
-    totalEnergyWh_ = totalEnergyWh;
+  beginRestore();
+  for (size_t i = 0; entries != nullptr && i < count; ++i) {
+    restoreEntry(entries[i]);
+  }
+  finishRestore(totalEnergyWh);
+}
+
+void PowerLog::beginRestore() {
+  ring_.clear();
+  baseCentiWh_ = 0;
+  endCentiWh_ = 0;
+}
+
+void PowerLog::restoreEntry(const Entry &entry) {
+  uint32_t counter = toCentiWh(entry.energyWhAccumulated);
+  if (ring_.size() == 0) {
+    // The journal keeps end-of-minute counters only, so the oldest row
+    // starts where it ends.
+    endCentiWh_ = counter;
+  }
+  size_t slot = openRow(entry.timestamp / kMinuteSeconds);
+  uint16_t delta = counter > endCentiWh_ ? saturate16(counter - endCentiWh_) : 0;
+  energyCentiWh_[slot] = delta;
+  endCentiWh_ += delta;
+  float deciWatts = entry.instantaneousWatts * 10.0f + 0.5f;
+  deciWatts_[slot] = deciWatts <= 0.0f ? 0 : saturate16(static_cast<uint32_t>(deciWatts));
+  storeState(slot, entry.fanSpeed, entry.compressorActive);
+}
+
+void PowerLog::finishRestore(float totalEnergyWh) {
+  totalEnergyWh_ = totalEnergyWh;
+  if (ring_.size() == 0) {
     initialized_ = false;
     lastTimestamp_ = 0;
     lastWatts_ = 0.0f;
@@ -73,41 +206,209 @@ void PowerLog::restoreEntries(const Entry *entries, size_t count, float totalEne
     lastCompressorState_ = false;
     currentMinute_ = 0;
   } else {
-    size_t limited = count > kMaxEntries ? kMaxEntries : count;
-    for (size_t i = 0; i < limited; ++i) {
-      entries_[i] = entries[i];
-    }
-    count_ = limited;
-    head_ = limited % kMaxEntries;
-    totalEnergyWh_ = totalEnergyWh;
+    size_t newest = ring_.newestSlot();
     initialized_ = true;
-    const Entry &latest = entries_[limited - 1];
-    lastTimestamp_ = latest.timestamp;
-    lastWatts_ = latest.instantaneousWatts;
-    lastFanSpeedState_ = latest.fanSpeed;
-    lastCompressorState_ = latest.compressorActive;
-    currentMinute_ = latest.timestamp / 60000UL;
+    currentMinute_ = ring_.newestMinute();
+    lastTimestamp_ = currentMinute_ * kMinuteSeconds;
+    lastWatts_ = static_cast<float>(deciWatts_[newest]) / 10.0f;
+    lastFanSpeedState_ = fanSpeedAt(newest);
+    lastCompressorState_ = compressorActiveAt(newest);
   }
 
+  rowsCreated_ = static_cast<uint32_t>(ring_.size());
+  resetTiers();
+  uint32_t counter = baseCentiWh_;
+  ring_.forEach([&](size_t slot, unsigned long minute) {
+    Rollup bucket = minuteRollup(slot, minute, counter);
+    counter += energyCentiWh_[slot];
+    rollUp(bucket.timestamp, bucket.energyWhStart, bucket.energyWhEnd);
+  });
+  revisions_.reset();
   hasCurrentMinute_ = false;
-  currentIndex_ = kMaxEntries;
-  wattMillisAccumulated_ = 0.0f;
-  durationMsAccumulated_ = 0;
-  compressorOnDurationMs_ = 0;
-  for (unsigned long &duration : fanDurationMs_) {
-    duration = 0;
+  currentSlot_ = 0;
+  resetMinuteAggregates();
+}
+
+size_t PowerLog::size(Resolution resolution) const {
+  if (resolution == Resolution::kMinute) {
+    return ring_.size();
+  }
+  return tiers_[tierIndex(resolution)].count;
+}
+
+bool PowerLog::timeSpan(Resolution resolution,
+                        unsigned long &oldest,
+                        unsigned long &newest) const {
+  if (resolution == Resolution::kMinute) {
+    if (ring_.size() == 0) {
+      return false;
+    }
+    oldest = ring_.minute(0) * kMinuteSeconds;
+    newest = ring_.newestMinute() * kMinuteSeconds;
+    return true;
   }
+  const Tier &tier = tiers_[tierIndex(resolution)];
+  if (tier.count == 0) {
+    return false;
+  }
+  oldest = tier.buckets[tier.slot(0)].timestamp;
+  newest = tier.buckets[tier.slot(tier.count - 1)].timestamp;
+  return true;
+}
+
+PowerLog::Resolution PowerLog::selectResolution(unsigned long start,
+                                                unsigned long resolutionSeconds) const {
+  static constexpr Resolution kOrder[] = {Resolution::kMinute, Resolution::kHour,
+                                          Resolution::kDay, Resolution::kMonth};
+  constexpr size_t kCount = sizeof(kOrder) / sizeof(kOrder[0]);
+  size_t chosen = 0;
+  for (size_t i = 0; i < kCount; ++i) {
+    if (periodSeconds(kOrder[i]) <= resolutionSeconds) {
+      chosen = i;
+    }
+  }
+  for (; chosen + 1 < kCount; ++chosen) {
+    unsigned long oldest = 0;
+    unsigned long newest = 0;
+    if (timeSpan(kOrder[chosen], oldest, newest) && oldest <= start) {
+      break;
+    }
+  }
+  return kOrder[chosen];
+}
+
+bool PowerLog::energyRange(unsigned long start,
+                           unsigned long end,
+                           float &startWh,
+                           float &endWh) const {
+  if (ring_.size() == 0) {
+    return false;
+  }
+
+  // Anything older than every retained bucket resolves to the oldest counter
+  // reading; anything past the newest minute resolves to the live counter.
+  float oldestWh = static_cast<float>(baseCentiWh_) / 100.0f;
+  for (const Tier &tier : tiers_) {
+    if (tier.count > 0) {
+      oldestWh = tier.buckets[tier.slot(0)].energyWhStart;
+    }
+  }
+  unsigned long newestEnd = ring_.newestMinute() * kMinuteSeconds + kMinuteSeconds;
+
+  Rollup bucket;
+  if (start >= newestEnd) {
+    startWh = totalEnergyWh_;
+  } else if (findBucket(start, bucket)) {
+    startWh = bucket.energyWhStart;
+  } else {
+    startWh = oldestWh;
+  }
+
+  if (end >= newestEnd) {
+    endWh = totalEnergyWh_;
+  } else if (findBucket(end, bucket)) {
+    endWh = bucket.energyWhEnd;
+  } else {
+    endWh = oldestWh;
+  }
+  if (endWh < startWh) {
+    endWh = startWh;
+  }
+  return true;
 }
 
 bool PowerLog::latestEntry(Entry &entry) const {
-  if (count_ == 0) {
+  if (ring_.size() == 0) {
     return false;
   }
-  size_t index = (head_ + kMaxEntries - 1) % kMaxEntries;
-  entry = entries_[index];
+  entry = entryAt(ring_.newestSlot(), ring_.newestMinute(), endCentiWh_);
   return true;
 }
 
+PowerLog::Entry PowerLog::entryAt(size_t slot, unsigned long minute, uint32_t counterCentiWh) const {
+  return {minute * kMinuteSeconds, static_cast<float>(counterCentiWh) / 100.0f,
+          static_cast<float>(deciWatts_[slot]) / 10.0f, fanSpeedAt(slot), compressorActiveAt(slot)};
+}
+
+PowerLog::Rollup PowerLog::minuteRollup(size_t slot,
+                                        unsigned long minute,
+                                        uint32_t startCentiWh) const {
+  // The counter does not move while nothing is logged, so the previous row's
+  // reading is where this minute started even across a gap.
+  return {minute * kMinuteSeconds, static_cast<float>(startCentiWh) / 100.0f,
+          static_cast<float>(startCentiWh + energyCentiWh_[slot]) / 100.0f};
+}
+
+uint32_t PowerLog::counterBefore(size_t position) const {
+  if (position >= ring_.size()) {
+    return endCentiWh_;
+  }
+  size_t slot = ring_.slot(position);
+  size_t offset = slot % kCheckpointStride;
+  if (offset > position) {
+    uint32_t counter = baseCentiWh_;
+    for (size_t i = 0; i < position; ++i) {
+      counter += energyCentiWh_[ring_.slot(i)];
+    }
+    return counter;
+  }
+  uint32_t counter = checkpoints_[slot / kCheckpointStride];
+  for (size_t i = slot - offset; i < slot; ++i) {
+    counter += energyCentiWh_[i];
+  }
+  return counter;
+}
+
+size_t PowerLog::lowerBound(unsigned long timestamp) const {
+  unsigned long minute = timestamp / kMinuteSeconds;
+  return ring_.lowerBound(timestamp % kMinuteSeconds == 0 ? minute : minute + 1);
+}
+
+size_t PowerLog::upperBound(unsigned long timestamp) const {
+  return ring_.upperBound(timestamp / kMinuteSeconds);
+}
+
+bool PowerLog::findBucket(unsigned long timestamp, Rollup &bucket) const {
+  size_t position = 0;
+  if (locateBucket(ring_.size(), kMinuteSeconds, timestamp,
+                   [this](size_t i) { return ring_.minute(i) * kMinuteSeconds; }, position)) {
+    bucket = minuteRollup(ring_.slot(position), ring_.minute(position), counterBefore(position));
+    return true;
+  }
+  for (const Tier &tier : tiers_) {
+    if (locateBucket(tier.count, tier.periodSeconds, timestamp,
+                     [&tier](size_t i) { return tier.buckets[tier.slot(i)].timestamp; },
+                     position)) {
+      bucket = tier.buckets[tier.slot(position)];
+      return true;
+    }
+  }
+  return false;
+}
+
+void PowerLog::rollUp(unsigned long timestamp, float energyWhStart, float energyWhEnd) {
+  for (Tier &tier : tiers_) {
+    unsigned long bucketStart = timestamp - (timestamp % tier.periodSeconds);
+    size_t newest = (tier.head + tier.capacity - 1) % tier.capacity;
+    if (tier.count > 0 && tier.buckets[newest].timestamp == bucketStart) {
+      tier.buckets[newest].energyWhEnd = energyWhEnd;
+      continue;
+    }
+    tier.buckets[tier.head] = {bucketStart, energyWhStart, energyWhEnd};
+    tier.head = (tier.head + 1) % tier.capacity;
+    if (tier.count < tier.capacity) {
+      ++tier.count;
+    }
+  }
+}
+
+void PowerLog::resetTiers() {
+  for (Tier &tier : tiers_) {
+    tier.head = 0;
+    tier.count = 0;
+  }
+}
+
 float PowerLog::lookupWatts(controller::FanSpeed fanSpeed, bool compressorActive) const {
   if (!rates_ || rateCount_ == 0) {
     // Fallback generic estimates.
@@ -145,16 +446,15 @@ void PowerLog::ensureMinute(unsigned long minute) {
 
   currentMinute_ = minute;
   hasCurrentMinute_ = true;
-  currentIndex_ = head_;
-  entries_[currentIndex_] = {minute * 60000UL,
-                             totalEnergyWh_,
-                             0.0f,
-                             lastFanSpeedState_,
-                             lastCompressorState_};
-  head_ = (head_ + 1) % kMaxEntries;
-  if (count_ < kMaxEntries) {
-    ++count_;
+  if (ring_.size() == 0) {
+    endCentiWh_ = toCentiWh(totalEnergyWh_);
   }
+  currentSlot_ = openRow(minute);
+  energyCentiWh_[currentSlot_] = 0;
+  deciWatts_[currentSlot_] = 0;
+  storeState(currentSlot_, lastFanSpeedState_, lastCompressorState_);
+  ++rowsCreated_;
+  revisions_.rowCreated();
   resetMinuteAggregates();
 }
 
@@ -182,21 +482,69 @@ void PowerLog::accumulateSegment(unsigned long durationMs,
     fanDurationMs_[fanIndex] += durationMs;
   }
 
+  // The row only gets a new revision when a field it is served with changes.
+  const uint16_t energyBefore = energyCentiWh_[currentSlot_];
+  const uint16_t deciWattsBefore = deciWatts_[currentSlot_];
+  const uint8_t stateBefore = states_[currentSlot_ / 2];
+
   float hours = static_cast<float>(durationMs) / (1000.0f * 60.0f * 60.0f);
+  float energyWhBefore = totalEnergyWh_;
   totalEnergyWh_ += watts * hours;
+  rollUp(currentMinute_ * kMinuteSeconds, energyWhBefore, totalEnergyWh_);
 
-  Entry &entry = entries_[currentIndex_];
-  entry.timestamp = currentMinute_ * 60000UL;
-  entry.energyWhAccumulated = totalEnergyWh_;
-  entry.instantaneousWatts = durationMsAccumulated_ > 0
-                                  ? wattMillisAccumulated_ / static_cast<float>(durationMsAccumulated_)
-                                  : 0.0f;
-  entry.fanSpeed = durationMsAccumulated_ > 0 ? dominantFanSpeed() : fanSpeed;
+  uint32_t counter = toCentiWh(totalEnergyWh_);
+  if (counter > endCentiWh_) {
+    // A saturated row leaves the remainder for the next one rather than
+    // letting the rebuilt counter drift from endCentiWh_.
+    uint16_t before = energyCentiWh_[currentSlot_];
+    energyCentiWh_[currentSlot_] = saturate16(before + (counter - endCentiWh_));
+    endCentiWh_ += energyCentiWh_[currentSlot_] - before;
+  }
+  float averageWatts = durationMsAccumulated_ > 0
+                           ? wattMillisAccumulated_ / static_cast<float>(durationMsAccumulated_)
+                           : 0.0f;
+  deciWatts_[currentSlot_] = saturate16(static_cast<uint32_t>(averageWatts * 10.0f + 0.5f));
   if (durationMsAccumulated_ > 0) {
-    entry.compressorActive = (compressorOnDurationMs_ * 2 >= durationMsAccumulated_);
+    storeState(currentSlot_, dominantFanSpeed(),
+               compressorOnDurationMs_ * 2 >= durationMsAccumulated_);
   } else {
-    entry.compressorActive = compressorActive;
+    storeState(currentSlot_, fanSpeed, compressorActive);
+  }
+  if (energyCentiWh_[currentSlot_] != energyBefore || deciWatts_[currentSlot_] != deciWattsBefore ||
+      states_[currentSlot_ / 2] != stateBefore) {
+    revisions_.rowModified();
+  }
+}
+
+size_t PowerLog::openRow(unsigned long minute) {
+  if (ring_.size() == 0) {
+    baseCentiWh_ = endCentiWh_;
   }
+  // An evicted row's energy moves into the counter at the start of the ring.
+  size_t slot =
+      ring_.append(minute, [this](size_t evicted) { baseCentiWh_ += energyCentiWh_[evicted]; });
+  if (slot % kCheckpointStride == 0) {
+    checkpoints_[slot / kCheckpointStride] = endCentiWh_;
+  }
+  return slot;
+}
+
+void PowerLog::storeState(size_t slot, controller::FanSpeed fanSpeed, bool compressorActive) {
+  uint8_t nibble = static_cast<uint8_t>((static_cast<uint8_t>(fanSpeed) & 0x03) |
+                                        (compressorActive ? 0x04 : 0));
+  uint8_t shift = (slot & 1) ? 4 : 0;
+  uint8_t &packed = states_[slot / 2];
+  packed = static_cast<uint8_t>((packed & ~(0x0F << shift)) | (nibble << shift));
+}
+
+controller::FanSpeed PowerLog::fanSpeedAt(size_t slot) const {
+  uint8_t nibble = states_[slot / 2] >> ((slot & 1) ? 4 : 0);
+  return static_cast<controller::FanSpeed>(nibble & 0x03);
+}
+
+bool PowerLog::compressorActiveAt(size_t slot) const {
+  uint8_t nibble = states_[slot / 2] >> ((slot & 1) ? 4 : 0);
+  return (nibble & 0x04) != 0;
 }
 
 controller::FanSpeed PowerLog::dominantFanSpeed() const {
@@ -2,10 +2,25 @@
 
 #include <Arduino.h>
 
+#include "ChangeSequence.h"
 #include "FanController.h"
+#include "MinuteRing.h"
 
 namespace logging {
 
+/**
+ * Per-minute energy log plus hourly, daily and monthly rollup rings.
+ *
+ * Every bucket records the cumulative energy counter at its first and last
+ * sample, so the energy used between any two retained instants is a
+ * difference of two counter readings rather than a sum over rows.
+ *
+ * Minute rows are stored as parallel arrays of 4.5 bytes per row: the
+ * energy used in the minute in hundredths of a Wh, the average power in
+ * tenths of a watt, and fan speed and compressor state packed into a
+ * nibble. Row times come from MinuteRing and the cumulative counter is
+ * rebuilt from the counter at the start of the oldest row.
+ */
 class PowerLog {
  public:
   struct ConsumptionRate {
@@ -14,15 +29,30 @@ class PowerLog {
     float watts;
   };
 
+  /** One minute row as handed to forEach() and the journal; not the stored layout. */
   struct Entry {
-    unsigned long timestamp;
+    unsigned long timestamp;  // Epoch seconds at the start of the minute.
     float energyWhAccumulated;
     float instantaneousWatts;
     controller::FanSpeed fanSpeed;
     bool compressorActive;
   };
 
-  static constexpr size_t kMaxEntries = 120;
+  enum class Resolution : uint8_t { kMinute, kHour, kDay, kMonth };
+
+  struct Rollup {
+    unsigned long timestamp;  // Start of the bucket.
+    float energyWhStart;      // Cumulative counter when the bucket opened.
+    float energyWhEnd;        // Cumulative counter at the latest sample.
+  };
+
+  static constexpr size_t kMaxEntries = 360;   // 6 hours
+  static constexpr unsigned long kMinuteSeconds = 60UL;
+  static constexpr size_t kHourBuckets = 168;  // 7 days
+  static constexpr size_t kDayBuckets = 92;    // 3 months
+  static constexpr size_t kMonthBuckets = 24;  // 2 years of 30-day buckets
+
+  static unsigned long periodSeconds(Resolution resolution);
 
   PowerLog();
 
@@ -34,25 +64,172 @@ class PowerLog {
 
   void clear();
 
-  size_t size() const { return count_; }
+  /**
+   * Moves rows and buckets stamped at or after `since` by `deltaSeconds`
+   * once the clock they were stamped with turns out to be off (see
+   * LogClock). Rollup buckets move by whole periods.
+   */
+  void rebase(unsigned long since, long deltaSeconds);
+  /** Counts rebase() calls, so the journal knows its stored times went stale. */
+  uint32_t rebaseCount() const { return rebaseCount_; }
+
+  size_t size() const { return ring_.size(); }
+  /** Rows opened since the log was created or cleared; see TemperatureLog::rowsAppended(). */
+  uint32_t rowsAppended() const { return ring_.rowsAppended(); }
+  size_t size(Resolution resolution) const;
+  /**
+   * Rows that will no longer change, counted since the log was last cleared
+   * or restored; the newest row keeps accumulating until its minute ends.
+   */
+  uint32_t completedRows() const { return rowsCreated_ - (hasCurrentMinute_ ? 1 : 0); }
+  /** True while the newest row is still accumulating its minute. */
+  bool minuteOpen() const { return hasCurrentMinute_; }
+  /** Start of the oldest and newest bucket of one tier; false when it is empty. */
+  bool timeSpan(Resolution resolution, unsigned long &oldest, unsigned long &newest) const;
+
+  uint32_t revision() const { return revisions_.revision(); }
+  size_t rowsChangedSince(uint32_t since, bool &replaceAll) const {
+    return revisions_.rowsChangedSince(since, ring_.size(), replaceAll);
+  }
 
   template <typename Callback>
   void forEach(Callback callback) const {
-    size_t processed = 0;
-    while (processed < count_) {
-      size_t index = (head_ + kMaxEntries - count_ + processed) % kMaxEntries;
-      callback(entries_[index]);
-      ++processed;
+    forEachRow(0, ring_.size(), callback);
+  }
+
+  /** Position of the first row starting at or after `timestamp`; size() when there is none. */
+  size_t lowerBound(unsigned long timestamp) const;
+  /**
+   * Position past the last row starting at or before `timestamp`. Both bounds
+   * walk the run table rather than the rows. While the clock has stepped back
+   * within the ring they widen towards the whole ring, so callers still check
+   * row times.
+   */
+  size_t upperBound(unsigned long timestamp) const;
+
+  /**
+   * Visits the rows at positions [first, last), oldest first. The counter at
+   * `first` comes from the nearest checkpoint, so the cost follows the rows
+   * visited rather than the size of the log.
+   */
+  template <typename Callback>
+  void forEachRow(size_t first, size_t last, Callback callback) const {
+    uint32_t counter = counterBefore(first);
+    ring_.forEachIn(first, last, [&](size_t slot, unsigned long minute) {
+      counter += energyCentiWh_[slot];
+      callback(entryAt(slot, minute, counter));
+    });
+  }
+
+  /**
+   * Picks the coarsest tier whose bucket size does not exceed `resolutionSeconds`,
+   * moving to coarser tiers when the chosen one no longer reaches back to
+   * `start`.
+   */
+  Resolution selectResolution(unsigned long start, unsigned long resolutionSeconds) const;
+
+  /**
+   * Visits the buckets of one tier that overlap [start, end], oldest first,
+   * stopping after `limit` of them. Returns true when it stopped early, so
+   * a caller writing the range in passes can go on from the last bucket.
+   */
+  template <typename Callback>
+  bool forEachRollup(Resolution resolution,
+                     unsigned long start,
+                     unsigned long end,
+                     Callback callback,
+                     size_t limit = SIZE_MAX) const {
+    unsigned long period = periodSeconds(resolution);
+    size_t visited = 0;
+    if (resolution == Resolution::kMinute) {
+      size_t position = ring_.lowerBound(start / kMinuteSeconds);
+      size_t last = ring_.upperBound(end / kMinuteSeconds);
+      uint32_t counter = counterBefore(position);
+      while (position < last && visited < limit) {
+        size_t stop = last - position > limit - visited ? position + (limit - visited) : last;
+        ring_.forEachIn(position, stop, [&](size_t slot, unsigned long minute) {
+          Rollup bucket = minuteRollup(slot, minute, counter);
+          counter += energyCentiWh_[slot];
+          if (bucket.timestamp + period > start && bucket.timestamp <= end) {
+            callback(bucket);
+            ++visited;
+          }
+        });
+        position = stop;
+      }
+      return position < last;
+    }
+    const Tier &tier = tiers_[tierIndex(resolution)];
+    for (size_t processed = 0; processed < tier.count; ++processed) {
+      const Rollup &bucket = tier.buckets[tier.slot(processed)];
+      if (bucket.timestamp + period > start && bucket.timestamp <= end) {
+        if (visited == limit) {
+          return true;
+        }
+        callback(bucket);
+        ++visited;
+      }
     }
+    return false;
   }
 
+  /**
+   * Cumulative energy at the start of the bucket holding `start` and at the
+   * end of the bucket holding `end`, taken from the finest tier that still
+   * retains each instant. Runs in constant time while the rings are
+   * contiguous. Returns false while nothing has been logged.
+   */
+  bool energyRange(unsigned long start, unsigned long end, float &startWh, float &endWh) const;
+
   size_t copyEntries(Entry *dest, size_t maxEntries) const;
   void restoreEntries(const Entry *entries, size_t count, float totalEnergyWh);
   bool latestEntry(Entry &entry) const;
 
+  /**
+   * Replaces the log with completed rows replayed one at a time, oldest
+   * first, so a caller restoring from flash needs no buffer of its own.
+   * Rows beyond kMaxEntries push out the oldest ones as they would live.
+   */
+  void beginRestore();
+  void restoreEntry(const Entry &entry);
+  /** Ends a restore; the counter continues from `totalEnergyWh`. */
+  void finishRestore(float totalEnergyWh);
+
   float totalEnergyWh() const { return totalEnergyWh_; }
 
  private:
+  struct Tier {
+    Rollup *buckets;
+    size_t capacity;
+    unsigned long periodSeconds;
+    size_t head;
+    size_t count;
+
+    /** Ring index of the `position`-th bucket, oldest first. */
+    size_t slot(size_t position) const { return (head + capacity - count + position) % capacity; }
+  };
+
+  static size_t tierIndex(Resolution resolution) {
+    return static_cast<size_t>(resolution) - 1;
+  }
+
+  Entry entryAt(size_t slot, unsigned long minute, uint32_t counterCentiWh) const;
+  /** Bucket for one row, given the counter at the start of the row. */
+  Rollup minuteRollup(size_t slot, unsigned long minute, uint32_t startCentiWh) const;
+  /**
+   * Counter at the start of the `position`-th row: the checkpoint of its
+   * group plus the rows between, or a walk from the oldest row while that
+   * checkpoint's row has been evicted.
+   */
+  uint32_t counterBefore(size_t position) const;
+  size_t openRow(unsigned long minute);
+  void storeState(size_t slot, controller::FanSpeed fanSpeed, bool compressorActive);
+  controller::FanSpeed fanSpeedAt(size_t slot) const;
+  bool compressorActiveAt(size_t slot) const;
+  bool findBucket(unsigned long timestamp, Rollup &bucket) const;
+  void rollUp(unsigned long timestamp, float energyWhStart, float energyWhEnd);
+  void resetTiers();
+
   float lookupWatts(controller::FanSpeed fanSpeed, bool compressorActive) const;
 
   void ensureMinute(unsigned long minute);
@@ -63,9 +240,18 @@ class PowerLog {
                          bool compressorActive);
   controller::FanSpeed dominantFanSpeed() const;
 
-  Entry entries_[kMaxEntries];
-  size_t head_ = 0;
-  size_t count_ = 0;
+  MinuteRing ring_{kMaxEntries};
+  uint16_t energyCentiWh_[kMaxEntries];  // Energy used within the minute.
+  uint16_t deciWatts_[kMaxEntries];      // Average power over the covered part.
+  uint8_t states_[(kMaxEntries + 1) / 2]; // Per row nibble: fan speed bits 0-1, compressor bit 2.
+  // Counter at the start of every kCheckpointStride-th slot, written when its row opens.
+  static constexpr size_t kCheckpointStride = 32;
+  uint32_t checkpoints_[(kMaxEntries + kCheckpointStride - 1) / kCheckpointStride];
+  uint32_t baseCentiWh_ = 0;             // Counter at the start of the oldest row.
+  uint32_t endCentiWh_ = 0;              // Counter at the end of the newest row.
+  uint32_t rowsCreated_ = 0;
+  uint32_t rebaseCount_ = 0;
+  tracking::RowRevisions revisions_;
 
   const ConsumptionRate *rates_ = nullptr;
   size_t rateCount_ = 0;
@@ -77,13 +263,18 @@ class PowerLog {
 
   unsigned long currentMinute_ = 0;
   bool hasCurrentMinute_ = false;
-  size_t currentIndex_ = kMaxEntries;
+  size_t currentSlot_ = 0;
   float wattMillisAccumulated_ = 0.0f;
   unsigned long durationMsAccumulated_ = 0;
   unsigned long fanDurationMs_[4] = {0, 0, 0, 0};
   unsigned long compressorOnDurationMs_ = 0;
   controller::FanSpeed lastFanSpeedState_ = controller::FanSpeed::kOff;
   bool lastCompressorState_ = false;
+
+  Rollup hours_[kHourBuckets];
+  Rollup days_[kDayBuckets];
+  Rollup months_[kMonthBuckets];
+  Tier tiers_[3];
 };
 
 }  // namespace logging
@@ -2,28 +2,50 @@
 
 #include <FS.h>
 #include <LittleFS.h>
-#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
 
 namespace storage {
 
 namespace {
-constexpr float kEnergyEpsilonWh = 0.05f;
+constexpr size_t kPathLength = 32;
+
+// CRC-16/CCITT-FALSE over everything in the record before the checksum.
+uint16_t crc16(const uint8_t *data, size_t length) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < length; ++i) {
+    crc ^= static_cast<uint16_t>(data[i]) << 8;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021)
+                           : static_cast<uint16_t>(crc << 1);
+    }
+  }
+  return crc;
+}
+
+template <typename T>
+uint16_t checksum(const T &value) {
+  return crc16(reinterpret_cast<const uint8_t *>(&value), sizeof(T) - sizeof(uint16_t));
+}
 }  // namespace
 
-PowerLogStorage::PowerLogStorage(logging::PowerLog &log, const char *path)
-    : log_(log), path_(path) {}
+PowerLogStorage::PowerLogStorage(logging::PowerLog &log,
+                                 const char *journalDir,
+                                 const char *legacyPath)
+    : log_(log), journalDir_(journalDir), legacyPath_(legacyPath) {
+  static_assert(sizeof(Record) == 16, "journal records must stay 16 bytes");
+  static_assert(sizeof(SegmentHeader) == sizeof(Record), "header occupies one record slot");
+}
 
 bool PowerLogStorage::begin() {
   available_ = LittleFS.begin();
-  dirty_ = false;
-  lastKnownCount_ = log_.size();
-  logging::PowerLog::Entry latest;
-  hasLastKnownLatest_ = log_.latestEntry(latest);
-  lastKnownLatestTimestamp_ = hasLastKnownLatest_ ? latest.timestamp : 0;
-  lastKnownTotalEnergyWh_ = log_.totalEnergyWh();
-  lastSnapshotMillis_ = LittleFS.exists(path_)
-                           ? millis()
-                           : millis() - kSnapshotIntervalMs;
+  if (available_) {
+    LittleFS.mkdir(journalDir_);
+  }
+  hasActiveSegment_ = false;
+  activeRecords_ = 0;
+  journaledRows_ = log_.completedRows();
+  journaledRebases_ = log_.rebaseCount();
   return available_;
 }
 
@@ -32,61 +54,56 @@ bool PowerLogStorage::load() {
     return false;
   }
 
-  File file = LittleFS.open(path_, "r");
-  if (!file) {
-    return false;
-  }
-
-  struct Header {
-    uint32_t magic;
-    uint16_t version;
-    uint16_t count;
-    float totalEnergyWh;
-  } header{};
-
-  if (file.read(reinterpret_cast<uint8_t *>(&header), sizeof(header)) != sizeof(header)) {
-    file.close();
-    return false;
+  uint32_t oldest = 0;
+  uint32_t newest = 0;
+  if (!findSegments(oldest, newest)) {
+    return loadLegacy();
   }
-
-  if (header.magic != kMagic || header.version != kVersion) {
-    file.close();
-    return false;
+  uint32_t copy = 0;
+  bool committed = false;
+  while (findCompaction(oldest, copy, committed)) {
+    if (!committed) {
+      // save() was cut off while writing the copy; the segments before it are whole.
+      removeSegments(copy, newest + 1);
+      newest = copy - 1;
+      break;
+    }
+    // save() was cut off while removing the segments the copy replaces.
+    removeSegments(oldest, copy);
+    oldest = copy;
   }
-
-  uint16_t count = header.count;
-  if (count > logging::PowerLog::kMaxEntries) {
-    count = logging::PowerLog::kMaxEntries;
+  if (newest - oldest >= kMaxSegments) {
+    oldest = newest - (kMaxSegments - 1);
+    removeSegments(0, oldest);
   }
 
-  logging::PowerLog::Entry buffer[logging::PowerLog::kMaxEntries];
+  // Replay oldest to newest straight into the log, which keeps the last
+  // kMaxEntries rows.
+  log_.beginRestore();
   size_t restored = 0;
-  for (; restored < count; ++restored) {
-    PersistedEntry entry{};
-    if (file.read(reinterpret_cast<uint8_t *>(&entry), sizeof(entry)) != sizeof(entry)) {
+  float totalEnergyWh = 0.0f;
+  bool newestComplete = true;
+  for (uint32_t sequence = oldest;; ++sequence) {
+    bool complete = true;
+    size_t records = readSegment(sequence, restored, totalEnergyWh, complete);
+    if (sequence == newest) {
+      activeRecords_ = records;
+      newestComplete = complete;
       break;
     }
-    buffer[restored] = {entry.timestamp,
-                        entry.energyWhAccumulated,
-                        entry.instantaneousWatts,
-                        static_cast<controller::FanSpeed>(entry.fanSpeed),
-                        entry.compressorActive != 0};
   }
-  file.close();
+  log_.finishRestore(totalEnergyWh);
 
-  if (restored == 0) {
-    return false;
+  hasActiveSegment_ = true;
+  activeSequence_ = newest;
+  if (!newestComplete) {
+    // Never append behind a torn record; the next minute opens a new segment.
+    activeRecords_ = kRecordsPerSegment;
   }
 
-  log_.restoreEntries(buffer, restored, header.totalEnergyWh);
-  lastKnownCount_ = log_.size();
-  logging::PowerLog::Entry latest;
-  hasLastKnownLatest_ = log_.latestEntry(latest);
-  lastKnownLatestTimestamp_ = hasLastKnownLatest_ ? latest.timestamp : 0;
-  lastKnownTotalEnergyWh_ = log_.totalEnergyWh();
-  dirty_ = false;
-  lastSnapshotMillis_ = millis();
-  return true;
+  journaledRows_ = log_.completedRows();
+  journaledRebases_ = log_.rebaseCount();
+  return restored > 0 || totalEnergyWh > 0.0f;
 }
 
 bool PowerLogStorage::save() {
@@ -94,92 +111,320 @@ bool PowerLogStorage::save() {
     return false;
   }
 
-  logging::PowerLog::Entry entries[logging::PowerLog::kMaxEntries];
-  size_t count = log_.copyEntries(entries, logging::PowerLog::kMaxEntries);
+  uint32_t sequence = hasActiveSegment_ ? activeSequence_ + 1 : 0;
+  uint32_t oldest = 0;
+  uint32_t newest = 0;
+  if (findSegments(oldest, newest) && newest >= sequence) {
+    sequence = newest + 1;
+  }
 
-  File file = LittleFS.open(path_, "w");
-  if (!file) {
-    return false;
+  // The copy goes after the segments it replaces, which are removed only
+  // once all of it is written and committed.
+  bool hadSegment = hasActiveSegment_;
+  uint32_t previousSequence = activeSequence_;
+  size_t previousRecords = activeRecords_;
+  File file = startSegment(sequence, kCompactionFlag);
+  bool ok = file && appendRows(file, 0, completedRetained(), false) &&
+            commitCompaction(sequence);
+  if (ok) {
+    removeSegments(0, sequence);
+  } else {
+    removeSegments(sequence, hasActiveSegment_ ? activeSequence_ + 1 : sequence + 1);
+    hasActiveSegment_ = hadSegment;
+    activeSequence_ = previousSequence;
+    activeRecords_ = previousRecords;
   }
+  journaledRows_ = log_.completedRows();
+  journaledRebases_ = log_.rebaseCount();
+  return ok;
+}
 
-  struct Header {
-    uint32_t magic;
-    uint16_t version;
-    uint16_t count;
-    float totalEnergyWh;
-  } header{kMagic, kVersion, static_cast<uint16_t>(count), log_.totalEnergyWh()};
+void PowerLogStorage::update() {
+  if (!available_) {
+    return;
+  }
 
-  if (file.write(reinterpret_cast<const uint8_t *>(&header), sizeof(header)) != sizeof(header)) {
-    file.close();
-    return false;
+  uint32_t completed = log_.completedRows();
+  if (completed < journaledRows_) {
+    // The log was cleared; drop the journal and start over in a new segment.
+    uint32_t oldest = 0;
+    uint32_t newest = 0;
+    if (findSegments(oldest, newest)) {
+      removeSegments(0, newest + 1);
+      activeSequence_ = newest + 1;
+    }
+    hasActiveSegment_ = false;
+    activeRecords_ = 0;
+    journaledRows_ = 0;
+  }
+  if (log_.rebaseCount() != journaledRebases_) {
+    // Journaled rows carry the times from before the clock was set.
+    save();
+    return;
+  }
+  if (completed == journaledRows_) {
+    return;
+  }
+
+  // Completed rows are the oldest ones in the ring; the newest may still be open.
+  size_t finished = completedRetained();
+  uint32_t pending = completed - journaledRows_;
+  size_t first = pending < finished ? finished - pending : 0;
+  File file;
+  appendRows(file, first, finished, true);
+  journaledRows_ = completed;
+  if (removeLegacy_) {
+    LittleFS.remove(legacyPath_);
+    removeLegacy_ = false;
   }
+}
+
+size_t PowerLogStorage::completedRetained() const {
+  size_t retained = log_.size();
+  if (log_.minuteOpen() && retained > 0) {
+    --retained;
+  }
+  return retained;
+}
 
-  for (size_t i = 0; i < count; ++i) {
-    PersistedEntry entry{entries[i].timestamp,
-                         entries[i].energyWhAccumulated,
-                         entries[i].instantaneousWatts,
-                         static_cast<uint8_t>(entries[i].fanSpeed),
-                         static_cast<uint8_t>(entries[i].compressorActive ? 1 : 0)};
-    if (file.write(reinterpret_cast<const uint8_t *>(&entry), sizeof(entry)) != sizeof(entry)) {
+bool PowerLogStorage::appendRows(File &file, size_t first, size_t last, bool prune) {
+  bool ok = true;
+  char path[kPathLength];
+  log_.forEachRow(first, last, [&](const logging::PowerLog::Entry &entry) {
+    if (!ok) {
+      return;
+    }
+    if (!hasActiveSegment_ || activeRecords_ >= kRecordsPerSegment) {
+      uint32_t next = hasActiveSegment_ ? activeSequence_ + 1 : activeSequence_;
       file.close();
-      return false;
+      file = startSegment(next, 0);
+      if (!file) {
+        ok = false;
+        return;
+      }
+      if (prune && next >= kMaxSegments) {
+        removeSegments(0, next - (kMaxSegments - 1));
+      }
+    } else if (!file) {
+      segmentPath(path, sizeof(path), activeSequence_);
+      file = LittleFS.open(path, "a");
+      if (!file) {
+        ok = false;
+        return;
+      }
+    }
+
+    Record record{static_cast<uint32_t>(entry.timestamp),
+                  entry.energyWhAccumulated,
+                  entry.instantaneousWatts,
+                  static_cast<uint8_t>(entry.fanSpeed),
+                  static_cast<uint8_t>(entry.compressorActive ? 1 : 0),
+                  0};
+    record.crc = checksum(record);
+    if (file.write(reinterpret_cast<const uint8_t *>(&record), sizeof(record)) !=
+        sizeof(record)) {
+      // Whatever landed is rejected by its CRC on load; continue in a new segment.
+      activeRecords_ = kRecordsPerSegment;
+      ok = false;
+      return;
     }
+    ++activeRecords_;
+  });
+  file.close();
+  return ok;
+}
+
+File PowerLogStorage::startSegment(uint32_t sequence, uint16_t flags) {
+  SegmentHeader header{kMagic, sequence, kVersion, static_cast<uint16_t>(sizeof(Record)), flags,
+                       0};
+  header.crc = checksum(header);
+
+  char path[kPathLength];
+  segmentPath(path, sizeof(path), sequence);
+  File file = LittleFS.open(path, "w");
+  if (!file) {
+    return file;
+  }
+  if (file.write(reinterpret_cast<const uint8_t *>(&header), sizeof(header)) != sizeof(header)) {
+    file.close();
+    LittleFS.remove(path);
+    return File();
   }
+  hasActiveSegment_ = true;
+  activeSequence_ = sequence;
+  activeRecords_ = 0;
+  return file;
+}
+
+bool PowerLogStorage::commitCompaction(uint32_t sequence) {
+  SegmentHeader header{kMagic, sequence, kVersion, static_cast<uint16_t>(sizeof(Record)),
+                       static_cast<uint16_t>(kCompactionFlag | kCommittedFlag), 0};
+  header.crc = checksum(header);
 
+  // LittleFS updates a file copy-on-write, so a cut leaves the old header or the new one.
+  char path[kPathLength];
+  segmentPath(path, sizeof(path), sequence);
+  File file = LittleFS.open(path, "r+");
+  bool ok = file && file.seek(0) &&
+            file.write(reinterpret_cast<const uint8_t *>(&header), sizeof(header)) ==
+                sizeof(header);
   file.close();
-  dirty_ = false;
-  lastSnapshotMillis_ = millis();
-  lastKnownCount_ = count;
-  logging::PowerLog::Entry latest;
-  hasLastKnownLatest_ = log_.latestEntry(latest);
-  lastKnownLatestTimestamp_ = hasLastKnownLatest_ ? latest.timestamp : 0;
-  lastKnownTotalEnergyWh_ = log_.totalEnergyWh();
-  return true;
+  return ok;
 }
 
-void PowerLogStorage::update() {
-  if (!available_) {
-    return;
+void PowerLogStorage::removeSegments(uint32_t first, uint32_t last) {
+  char path[kPathLength];
+  Dir dir = LittleFS.openDir(journalDir_);
+  while (dir.next()) {
+    String name = dir.fileName();
+    char *end = nullptr;
+    unsigned long value = strtoul(name.c_str(), &end, 16);
+    if (end == name.c_str() || *end != '\0' || value < first || value >= last) {
+      continue;
+    }
+    segmentPath(path, sizeof(path), static_cast<uint32_t>(value));
+    LittleFS.remove(path);
   }
+}
 
-  updateDirtyFlags();
+bool PowerLogStorage::findSegments(uint32_t &oldest, uint32_t &newest) {
+  bool found = false;
+  Dir dir = LittleFS.openDir(journalDir_);
+  while (dir.next()) {
+    String name = dir.fileName();
+    char *end = nullptr;
+    unsigned long value = strtoul(name.c_str(), &end, 16);
+    if (end == name.c_str() || *end != '\0') {
+      continue;
+    }
+    uint32_t sequence = static_cast<uint32_t>(value);
+    if (!found || sequence < oldest) {
+      oldest = sequence;
+    }
+    if (!found || sequence > newest) {
+      newest = sequence;
+    }
+    found = true;
+  }
+  return found;
+}
 
-  unsigned long now = millis();
-  unsigned long elapsed = now - lastSnapshotMillis_;
-  if (elapsed >= kSnapshotIntervalMs) {
-    save();
+bool PowerLogStorage::findCompaction(uint32_t oldest, uint32_t &sequence, bool &committed) {
+  bool found = false;
+  char path[kPathLength];
+  Dir dir = LittleFS.openDir(journalDir_);
+  while (dir.next()) {
+    String name = dir.fileName();
+    char *end = nullptr;
+    unsigned long value = strtoul(name.c_str(), &end, 16);
+    if (end == name.c_str() || *end != '\0' || value <= oldest ||
+        (found && value >= sequence)) {
+      continue;
+    }
+    segmentPath(path, sizeof(path), static_cast<uint32_t>(value));
+    File file = LittleFS.open(path, "r");
+    SegmentHeader header{};
+    bool read = file && file.read(reinterpret_cast<uint8_t *>(&header), sizeof(header)) ==
+                            sizeof(header);
+    file.close();
+    if (read && header.magic == kMagic && header.crc == checksum(header) &&
+        (header.flags & kCompactionFlag) != 0) {
+      sequence = static_cast<uint32_t>(value);
+      committed = (header.flags & kCommittedFlag) != 0;
+      found = true;
+    }
   }
+  return found;
 }
 
-void PowerLogStorage::markDirty() { dirty_ = true; }
+size_t PowerLogStorage::readSegment(uint32_t sequence,
+                                    size_t &restored,
+                                    float &totalEnergyWh,
+                                    bool &complete) {
+  complete = false;
+  char path[kPathLength];
+  segmentPath(path, sizeof(path), sequence);
+  File file = LittleFS.open(path, "r");
+  if (!file) {
+    return 0;
+  }
 
-void PowerLogStorage::updateDirtyFlags() {
-  size_t currentCount = log_.size();
-  if (currentCount != lastKnownCount_) {
-    lastKnownCount_ = currentCount;
-    dirty_ = true;
+  SegmentHeader header{};
+  if (file.read(reinterpret_cast<uint8_t *>(&header), sizeof(header)) != sizeof(header) ||
+      header.magic != kMagic ||
+      (header.version != kVersion && header.version != kUptimeVersion) ||
+      header.sequence != sequence ||
+      header.recordSize != sizeof(Record) || header.crc != checksum(header)) {
+    file.close();
+    return 0;
   }
 
-  logging::PowerLog::Entry latest;
-  bool hasLatest = log_.latestEntry(latest);
-  if (hasLatest) {
-    if (!hasLastKnownLatest_ || latest.timestamp != lastKnownLatestTimestamp_) {
-      lastKnownLatestTimestamp_ = latest.timestamp;
-      hasLastKnownLatest_ = true;
-      dirty_ = true;
+  size_t records = 0;
+  while (records < kRecordsPerSegment) {
+    Record record{};
+    size_t read = file.read(reinterpret_cast<uint8_t *>(&record), sizeof(record));
+    if (read == 0) {
+      complete = true;
+      break;
+    }
+    if (read != sizeof(record) || record.crc != checksum(record)) {
+      break;
+    }
+    if (header.version == kVersion) {
+      log_.restoreEntry({record.timestamp,
+                         record.energyWhAccumulated,
+                         record.instantaneousWatts,
+                         static_cast<controller::FanSpeed>(record.fanSpeed),
+                         record.compressorActive != 0});
+      ++restored;
     }
-  } else if (hasLastKnownLatest_) {
-    hasLastKnownLatest_ = false;
-    lastKnownLatestTimestamp_ = 0;
-    dirty_ = true;
+    totalEnergyWh = record.energyWhAccumulated;
+    ++records;
+  }
+  if (records == kRecordsPerSegment) {
+    complete = true;
+  }
+  if (header.version != kVersion) {
+    // Never append to a segment written in another format.
+    complete = false;
+  }
+  file.close();
+  return records;
+}
+
+bool PowerLogStorage::loadLegacy() {
+  // Snapshot format written before the journal existed; migrated once.
+  File file = LittleFS.open(legacyPath_, "r");
+  if (!file) {
+    return false;
   }
 
-  float totalEnergy = log_.totalEnergyWh();
-  if (fabsf(totalEnergy - lastKnownTotalEnergyWh_) > kEnergyEpsilonWh) {
-    lastKnownTotalEnergyWh_ = totalEnergy;
-    dirty_ = true;
+  struct LegacyHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    float totalEnergyWh;
+  } header{};
+  constexpr uint32_t kLegacyMagic = 0x504C4F47;  // 'PLOG'
+  constexpr uint16_t kLegacyVersion = 1;
+
+  bool valid = file.read(reinterpret_cast<uint8_t *>(&header), sizeof(header)) == sizeof(header) &&
+               header.magic == kLegacyMagic && header.version == kLegacyVersion;
+  file.close();
+  if (!valid || header.count == 0) {
+    return false;
   }
+
+  // Its rows are stamped with uptime, so only the energy counter carries
+  // over. The file goes once a journal record holds that counter.
+  log_.beginRestore();
+  log_.finishRestore(header.totalEnergyWh);
+  removeLegacy_ = true;
+  return true;
 }
 
-}  // namespace storage
+void PowerLogStorage::segmentPath(char *buffer, size_t size, uint32_t sequence) const {
+  snprintf(buffer, size, "%s/%08lx", journalDir_, static_cast<unsigned long>(sequence));
+}
 
+}  // namespace storage
@@ -1,46 +1,107 @@
 #pragma once
 
 #include <Arduino.h>
+#include <FS.h>
 
 #include "PowerLog.h"
 
 namespace storage {
 
+/**
+ * Append-only journal of completed power log minutes on LittleFS.
+ *
+ * Each finished minute is appended as one 16-byte CRC-protected record to
+ * the newest segment file under the journal directory. Segments hold 255
+ * records behind a 16-byte header (one 4 KB flash block); when one fills a
+ * new segment is started and the oldest ones are dropped. load() replays the
+ * retained segments, stops at the first torn or corrupt record and resumes
+ * in a fresh segment, so a power cut loses at most the minute in progress.
+ *
+ * Records carry epoch seconds (version 2). Version 1 segments and the older
+ * snapshot file stamped rows with uptime, which cannot be placed on the
+ * wall clock, so only their energy counter is carried over. When the log
+ * moves rows stamped before the clock was set, the journal is compacted so
+ * flash holds the corrected times. The compacted copy is written after the
+ * existing segments and marked committed in its first header once all of it
+ * is on flash; only then are the segments before it removed. load() drops
+ * a copy that was never committed and finishes removing the segments before
+ * one that was.
+ */
 class PowerLogStorage {
  public:
-  explicit PowerLogStorage(logging::PowerLog &log, const char *path = "/powerlog.bin");
+  explicit PowerLogStorage(logging::PowerLog &log,
+                           const char *journalDir = "/powerlog",
+                           const char *legacyPath = "/powerlog.bin");
 
   bool begin();
   bool load();
+  /** Compacts the journal into fresh segments holding the log's completed rows. */
   bool save();
+  /** Appends minutes completed since the last call; cheap when nothing changed. */
   void update();
-  void markDirty();
 
  private:
-  struct PersistedEntry {
-    unsigned long timestamp;
+  struct SegmentHeader {
+    uint32_t magic;
+    uint32_t sequence;
+    uint16_t version;
+    uint16_t recordSize;
+    uint16_t flags;
+    uint16_t crc;
+  };
+
+  struct Record {
+    uint32_t timestamp;
     float energyWhAccumulated;
     float instantaneousWatts;
     uint8_t fanSpeed;
     uint8_t compressorActive;
+    uint16_t crc;
   };
 
+  static constexpr uint32_t kMagic = 0x4A4C4F50;  // 'PLOJ'
+  static constexpr uint16_t kVersion = 2;
+  static constexpr uint16_t kUptimeVersion = 1;  // Timestamps were millis().
+  static constexpr size_t kRecordsPerSegment = 255;
+  static constexpr uint32_t kMaxSegments = 3;
+  // Set on the first segment of a compacted copy; the segments before it
+  // are stale once the copy is complete.
+  static constexpr uint16_t kCompactionFlag = 0x0001;
+  // Added to that header once the whole copy is written.
+  static constexpr uint16_t kCommittedFlag = 0x0002;
+
+  size_t completedRetained() const;
+  /**
+   * Appends rows [first, last) of the log through one open file, starting
+   * segments as they fill; `file` is the active segment if already open.
+   * With `prune` the segments that fall out of the last kMaxSegments are
+   * removed as it goes. Returns false at the first failure.
+   */
+  bool appendRows(File &file, size_t first, size_t last, bool prune);
+  /** Creates segment `sequence` and leaves it open for appending; falsy on failure. */
+  File startSegment(uint32_t sequence, uint16_t flags);
+  /** Rewrites the header of compacted copy `sequence` with kCommittedFlag. */
+  bool commitCompaction(uint32_t sequence);
+  /** Removes the segments numbered [first, last). */
+  void removeSegments(uint32_t first, uint32_t last);
+  bool findSegments(uint32_t &oldest, uint32_t &newest);
+  /** Finds the first compacted copy begun after segment `oldest`; see save(). */
+  bool findCompaction(uint32_t oldest, uint32_t &sequence, bool &committed);
+  /** Replays one segment into the log; returns the records it held. */
+  size_t readSegment(uint32_t sequence, size_t &restored, float &totalEnergyWh, bool &complete);
+  bool loadLegacy();
+  void segmentPath(char *buffer, size_t size, uint32_t sequence) const;
+
   logging::PowerLog &log_;
-  const char *path_;
+  const char *journalDir_;
+  const char *legacyPath_;
   bool available_ = false;
-  bool dirty_ = false;
-  unsigned long lastSnapshotMillis_ = 0;
-  size_t lastKnownCount_ = 0;
-  bool hasLastKnownLatest_ = false;
-  unsigned long lastKnownLatestTimestamp_ = 0;
-  float lastKnownTotalEnergyWh_ = 0.0f;
-
-  static constexpr uint32_t kMagic = 0x504C4F47;  // 'PLOG'
-  static constexpr uint16_t kVersion = 1;
-  static constexpr unsigned long kSnapshotIntervalMs = 1UL * 60UL * 60UL * 1000UL;
-
-  void updateDirtyFlags();
+  bool hasActiveSegment_ = false;
+  uint32_t activeSequence_ = 0;
+  size_t activeRecords_ = 0;
+  uint32_t journaledRows_ = 0;
+  uint32_t journaledRebases_ = 0;
+  bool removeLegacy_ = false;
 };
 
 }  // namespace storage
-
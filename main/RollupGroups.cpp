@@ -0,0 +1,107 @@
+#include "RollupGroups.h"
+
+namespace logging {
+
+GroupWindow::GroupWindow(unsigned long start, unsigned long end, unsigned long periodSeconds,
+                         unsigned long points)
+    : width_(periodSeconds) {
+  if (points == 0 || periodSeconds == 0 || end < start) {
+    return;
+  }
+  // Buckets overlapping `start` may open up to one period before it, and
+  // every bucket spans a period from its timestamp.
+  unsigned long span = end - start;
+  unsigned long periods = span / periodSeconds + 2;
+  unsigned long groupPeriods = (periods + points - 1) / points;
+  if (groupPeriods > 1) {
+    width_ = groupPeriods * periodSeconds;
+  }
+}
+
+bool GroupWindow::opensGroup(unsigned long timestamp) {
+  if (!open_ || timestamp < groupStart_ || timestamp - groupStart_ >= width_) {
+    // Step whole widths from the first group so groups stay aligned to it.
+    if (open_ && timestamp > groupStart_) {
+      groupStart_ += (timestamp - groupStart_) / width_ * width_;
+    } else {
+      groupStart_ = timestamp;
+    }
+    open_ = true;
+    return true;
+  }
+  return false;
+}
+
+void TemperatureGroup::Channel::reset() {
+  min = TemperatureLog::kNoReading;
+  max = TemperatureLog::kNoReading;
+  sum = 0;
+  count = 0;
+}
+
+void TemperatureGroup::Channel::add(int16_t bucketMin, int16_t bucketMax, int16_t bucketAverage) {
+  if (!units::isValid(bucketAverage)) {
+    return;
+  }
+  if (count == 0 || bucketMin < min) {
+    min = bucketMin;
+  }
+  if (count == 0 || bucketMax > max) {
+    max = bucketMax;
+  }
+  sum += bucketAverage;
+  ++count;
+}
+
+void TemperatureGroup::add(const TemperatureLog::Rollup &bucket) {
+  if (count_++ == 0) {
+    timestamp_ = bucket.timestamp;
+    ambient_.reset();
+    coil_.reset();
+  }
+  ambient_.add(bucket.ambientMin, bucket.ambientMax, bucket.ambientAverage);
+  coil_.add(bucket.coilMin, bucket.coilMax, bucket.coilAverage);
+}
+
+TemperatureLog::Rollup TemperatureGroup::result() const {
+  auto average = [](const Channel &channel) -> int16_t {
+    if (channel.count == 0) {
+      return TemperatureLog::kNoReading;
+    }
+    int32_t half = static_cast<int32_t>(channel.count / 2);
+    int32_t rounded = channel.sum >= 0 ? channel.sum + half : channel.sum - half;
+    return static_cast<int16_t>(rounded / static_cast<int32_t>(channel.count));
+  };
+  return {timestamp_, ambient_.min, ambient_.max, average(ambient_),
+          coil_.min,  coil_.max,    average(coil_)};
+}
+
+void PowerGroup::add(const PowerLog::Rollup &bucket, unsigned long coveredSeconds) {
+  float watts = 0.0f;
+  if (coveredSeconds > 0) {
+    watts = (bucket.energyWhEnd - bucket.energyWhStart) * 3600.0f /
+            static_cast<float>(coveredSeconds);
+  }
+  if (count_ == 0) {
+    start_ = bucket.timestamp;
+    energyWhStart_ = bucket.energyWhStart;
+    minWatts_ = watts;
+    maxWatts_ = watts;
+  } else {
+    minWatts_ = watts < minWatts_ ? watts : minWatts_;
+    maxWatts_ = watts > maxWatts_ ? watts : maxWatts_;
+  }
+  energyWhEnd_ = bucket.energyWhEnd;
+  coveredEnd_ = bucket.timestamp + coveredSeconds;
+  ++count_;
+}
+
+float PowerGroup::averageWatts() const {
+  if (count_ == 0 || coveredEnd_ <= start_) {
+    return 0.0f;
+  }
+  // Gaps between buckets count as time without energy, like the rollups do.
+  return (energyWhEnd_ - energyWhStart_) * 3600.0f / static_cast<float>(coveredEnd_ - start_);
+}
+
+}  // namespace logging
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "PowerLog.h"
+#include "TemperatureLog.h"
+
+namespace logging {
+
+/**
+ * Splits a time-ordered stream of log rows or rollup buckets into at most
+ * `points` consecutive groups, so a chart response stays bounded however
+ * much of the range the logs cover. Groups are whole multiples of the
+ * bucket period wide and start at the first bucket added; the width is
+ * fixed up front from the range, so the stream is grouped in one pass.
+ */
+class GroupWindow {
+ public:
+  /**
+   * `start` and `end` bound the timestamps of the buckets that will be
+   * added; `points` of zero leaves every bucket in a group of its own.
+   */
+  GroupWindow(unsigned long start, unsigned long end, unsigned long periodSeconds,
+              unsigned long points);
+
+  unsigned long widthSeconds() const { return width_; }
+
+  /**
+   * True when the bucket starting at `timestamp` opens a new group; the
+   * group before it, if any, is then complete.
+   */
+  bool opensGroup(unsigned long timestamp);
+
+ private:
+  unsigned long width_;
+  unsigned long groupStart_ = 0;
+  bool open_ = false;
+};
+
+/** Min, max and mean of the temperature buckets in one group. */
+class TemperatureGroup {
+ public:
+  void add(const TemperatureLog::Rollup &bucket);
+  void clear() { count_ = 0; }
+  bool empty() const { return count_ == 0; }
+
+  /** The group as one bucket stamped with its first bucket's time. */
+  TemperatureLog::Rollup result() const;
+
+ private:
+  struct Channel {
+    int16_t min;
+    int16_t max;
+    int32_t sum;
+    uint16_t count;
+
+    void reset();
+    void add(int16_t bucketMin, int16_t bucketMax, int16_t bucketAverage);
+  };
+
+  unsigned long timestamp_ = 0;
+  Channel ambient_{};
+  Channel coil_{};
+  size_t count_ = 0;
+};
+
+/**
+ * Energy over one group of power buckets, with the lowest and highest
+ * bucket average so short peaks survive the merge.
+ */
+class PowerGroup {
+ public:
+  /** `coveredSeconds` is how much of the bucket has elapsed; less than its period while it fills. */
+  void add(const PowerLog::Rollup &bucket, unsigned long coveredSeconds);
+  void clear() { count_ = 0; }
+  bool empty() const { return count_ == 0; }
+
+  unsigned long timestamp() const { return start_; }
+  unsigned long coveredSeconds() const { return coveredEnd_ - start_; }
+  float energyWhStart() const { return energyWhStart_; }
+  float energyWhEnd() const { return energyWhEnd_; }
+  float averageWatts() const;
+  float minWatts() const { return minWatts_; }
+  float maxWatts() const { return maxWatts_; }
+
+ private:
+  unsigned long start_ = 0;
+  unsigned long coveredEnd_ = 0;
+  float energyWhStart_ = 0.0f;
+  float energyWhEnd_ = 0.0f;
+  float minWatts_ = 0.0f;
+  float maxWatts_ = 0.0f;
+  size_t count_ = 0;
+};
+
+}  // namespace logging
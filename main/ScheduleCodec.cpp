@@ -0,0 +1,427 @@
+#include "ScheduleCodec.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace scheduler {
+
+namespace {
+// Indexed by ScheduledMode; kUnspecified has no name.
+constexpr const char *kModeNames[] = {"", "cooling", "heating", "fan", "idle"};
+constexpr size_t kModeCount = sizeof(kModeNames) / sizeof(kModeNames[0]);
+static_assert(kModeCount == static_cast<size_t>(ScheduledMode::kIdle) + 1,
+              "kModeNames must cover every ScheduledMode");
+
+// Indexed by profile number.
+constexpr const char *kProfileNames[] = {
+    "sun", "mon", "tue", "wed", "thu", "fri", "sat", "holiday"};
+static_assert(sizeof(kProfileNames) / sizeof(kProfileNames[0]) == ScheduleManager::kProfileCount,
+              "kProfileNames must cover every profile");
+
+// Indexed by controller::FanMode and controller::SystemMode.
+constexpr const char *kFanModeNames[] = {"auto", "off", "low", "medium", "high"};
+constexpr size_t kFanModeCount = sizeof(kFanModeNames) / sizeof(kFanModeNames[0]);
+static_assert(kFanModeCount == static_cast<size_t>(controller::FanMode::kHigh) + 1,
+              "kFanModeNames must cover every FanMode");
+constexpr const char *kSystemModeNames[] = {"cooling", "heating", "fan", "idle"};
+constexpr size_t kSystemModeCount = sizeof(kSystemModeNames) / sizeof(kSystemModeNames[0]);
+static_assert(kSystemModeCount == static_cast<size_t>(controller::SystemMode::kIdle) + 1,
+              "kSystemModeNames must cover every SystemMode");
+
+// Indexed by ScheduleError.
+constexpr const char *kErrorMessages[] = {
+    "ok",
+    "missing '='",
+    "invalid time",
+    "invalid temperature",
+    "unknown mode",
+    "invalid date",
+    "unknown profile",
+    "too many entries",
+};
+static_assert(sizeof(kErrorMessages) / sizeof(kErrorMessages[0]) ==
+                  static_cast<size_t>(ScheduleError::kTooManyEntries) + 1,
+              "kErrorMessages must cover every ScheduleError");
+
+constexpr long kMaxCentiDegrees = 32767;  // kNoTemperature stays unreachable.
+constexpr int kMinYear = 1970;
+constexpr int kMaxYear = 2149;  // DayOverride::day is 16 bits.
+
+bool isSpace(char c) { return c == ' ' || c == '\t'; }
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+char toLower(char c) { return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c; }
+
+/** Index of the name in `names` that matches `name` ignoring case, or `count` if none does. */
+size_t findName(const char *const *names, size_t count, const char *name, size_t length) {
+  for (size_t index = 0; index < count; ++index) {
+    const char *candidate = names[index];
+    size_t i = 0;
+    while (i < length && candidate[i] != '\0' && toLower(name[i]) == candidate[i]) {
+      ++i;
+    }
+    if (i == length && candidate[i] == '\0') {
+      return index;
+    }
+  }
+  return count;
+}
+
+void trim(const char *&begin, const char *&end) {
+  while (begin < end && isSpace(*begin)) {
+    ++begin;
+  }
+  while (end > begin && isSpace(end[-1])) {
+    --end;
+  }
+}
+
+const char *find(const char *begin, const char *end, char c) {
+  const char *found = static_cast<const char *>(memchr(begin, c, static_cast<size_t>(end - begin)));
+  return found != nullptr ? found : end;
+}
+
+/** Reads one or two (hour) or exactly two (minute) digits filling [begin, end). */
+bool parseClockField(const char *begin, const char *end, bool exactlyTwo, unsigned max,
+                     uint8_t &out) {
+  size_t digits = static_cast<size_t>(end - begin);
+  if (digits == 0 || digits > 2 || (exactlyTwo && digits != 2)) {
+    return false;
+  }
+  unsigned value = 0;
+  for (const char *p = begin; p < end; ++p) {
+    if (!isDigit(*p)) {
+      return false;
+    }
+    value = value * 10 + static_cast<unsigned>(*p - '0');
+  }
+  if (value > max) {
+    return false;
+  }
+  out = static_cast<uint8_t>(value);
+  return true;
+}
+
+/**
+ * Reads `[-]digits[.digits]` filling [begin, end) as hundredths of a degree,
+ * rounding half away from zero on the third decimal. Fixed point throughout,
+ * so the result matches what formatSchedule() wrote.
+ */
+bool parseCentiDegrees(const char *begin, const char *end, units::CentiCelsius &out) {
+  bool negative = begin < end && *begin == '-';
+  const char *p = negative ? begin + 1 : begin;
+  long whole = 0;
+  bool anyDigit = false;
+  for (; p < end && isDigit(*p); ++p) {
+    whole = whole * 10 + (*p - '0');
+    anyDigit = true;
+    if (whole > kMaxCentiDegrees / 100 + 1) {
+      return false;
+    }
+  }
+  long fraction = 0;
+  if (p < end && *p == '.') {
+    ++p;
+    int place = 0;
+    for (; p < end && isDigit(*p); ++p, ++place) {
+      anyDigit = true;
+      if (place < 2) {
+        fraction = fraction * 10 + (*p - '0');
+      } else if (place == 2 && *p >= '5') {
+        fraction += 1;
+      }
+    }
+    if (place == 1) {
+      fraction *= 10;
+    }
+  }
+  if (!anyDigit || p != end) {
+    return false;
+  }
+  long value = whole * 100 + fraction;
+  if (value > kMaxCentiDegrees) {
+    return false;
+  }
+  out = static_cast<units::CentiCelsius>(negative ? -value : value);
+  return true;
+}
+
+// Proleptic Gregorian date <-> days since 1970-01-01 (H. Hinnant's algorithms).
+long daysFromCivil(int year, unsigned month, unsigned day) {
+  year -= month <= 2 ? 1 : 0;
+  const int era = (year >= 0 ? year : year - 399) / 400;
+  const unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+  const unsigned dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return static_cast<long>(era) * 146097 + static_cast<long>(dayOfEra) - 719468;
+}
+
+void civilFromDays(long days, int &year, unsigned &month, unsigned &day) {
+  days += 719468;
+  const long era = (days >= 0 ? days : days - 146096) / 146097;
+  const unsigned dayOfEra = static_cast<unsigned>(days - era * 146097);
+  const unsigned yearOfEra =
+      (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+  const unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  const unsigned monthPrime = (5 * dayOfYear + 2) / 153;
+  day = dayOfYear - (153 * monthPrime + 2) / 5 + 1;
+  month = monthPrime < 10 ? monthPrime + 3 : monthPrime - 9;
+  year = static_cast<int>(yearOfEra + era * 400) + (month <= 2 ? 1 : 0);
+}
+
+/** Reads exactly `digits` decimal digits from `begin`. */
+bool parseDigits(const char *begin, size_t digits, unsigned &out) {
+  out = 0;
+  for (size_t i = 0; i < digits; ++i) {
+    if (!isDigit(begin[i])) {
+      return false;
+    }
+    out = out * 10 + static_cast<unsigned>(begin[i] - '0');
+  }
+  return true;
+}
+
+/** Reads a YYYY-MM-DD date filling [begin, end); rejects days a month does not have. */
+bool parseDate(const char *begin, const char *end, uint16_t &days) {
+  unsigned year = 0;
+  unsigned month = 0;
+  unsigned day = 0;
+  if (end - begin != 10 || begin[4] != '-' || begin[7] != '-' || !parseDigits(begin, 4, year) ||
+      !parseDigits(begin + 5, 2, month) || !parseDigits(begin + 8, 2, day) ||
+      static_cast<int>(year) < kMinYear || static_cast<int>(year) > kMaxYear || month < 1 ||
+      month > 12 || day < 1 || day > 31) {
+    return false;
+  }
+  long count = daysFromCivil(static_cast<int>(year), month, day);
+  int checkYear = 0;
+  unsigned checkMonth = 0;
+  unsigned checkDay = 0;
+  civilFromDays(count, checkYear, checkMonth, checkDay);
+  if (checkMonth != month || checkDay != day || count > 0xFFFF) {
+    return false;
+  }
+  days = static_cast<uint16_t>(count);
+  return true;
+}
+
+ScheduleError parseOverrideItem(const char *begin, const char *end, DayOverride &entry) {
+  const char *equals = find(begin, end, '=');
+  if (equals == end) {
+    return ScheduleError::kSyntax;
+  }
+  const char *dateEnd = equals;
+  trim(begin, dateEnd);
+  uint16_t days = 0;
+  if (!parseDate(begin, dateEnd, days)) {
+    return ScheduleError::kDate;
+  }
+  const char *profileBegin = equals + 1;
+  trim(profileBegin, end);
+  uint8_t profile = 0;
+  if (!scheduleProfileFromName(profileBegin, static_cast<size_t>(end - profileBegin), profile)) {
+    return ScheduleError::kProfile;
+  }
+  entry = DayOverride{days, profile, 0};
+  return ScheduleError::kNone;
+}
+
+/**
+ * Splits `text` into trimmed, non-empty ';' items and hands each to
+ * `parse` for the next element of `out`; stops at the first error.
+ */
+template <typename Entry, typename ParseItem>
+ScheduleParseResult parseItems(const char *text,
+                               size_t length,
+                               Entry *out,
+                               size_t capacity,
+                               ParseItem parse) {
+  ScheduleParseResult result{0, ScheduleError::kNone, length};
+  const char *end = text + length;
+  const char *item = text;
+  while (item < end) {
+    const char *itemEnd = find(item, end, ';');
+    const char *begin = item;
+    const char *trimmedEnd = itemEnd;
+    trim(begin, trimmedEnd);
+    if (begin != trimmedEnd) {
+      ScheduleError error = ScheduleError::kTooManyEntries;
+      if (result.count < capacity) {
+        error = parse(begin, trimmedEnd, out[result.count]);
+      }
+      if (error != ScheduleError::kNone) {
+        result.error = error;
+        result.position = static_cast<size_t>(begin - text);
+        return result;
+      }
+      ++result.count;
+    }
+    item = itemEnd < end ? itemEnd + 1 : end;
+  }
+  return result;
+}
+
+ScheduleError parseItem(const char *begin, const char *end, ScheduleEntry &entry) {
+  const char *equals = find(begin, end, '=');
+  if (equals == end) {
+    return ScheduleError::kSyntax;
+  }
+  const char *timeEnd = equals;
+  trim(begin, timeEnd);
+  const char *colon = find(begin, timeEnd, ':');
+  uint8_t hour = 0;
+  uint8_t minute = 0;
+  if (colon == timeEnd || !parseClockField(begin, colon, false, 23, hour) ||
+      !parseClockField(colon + 1, timeEnd, true, 59, minute)) {
+    return ScheduleError::kTime;
+  }
+
+  const char *separator = find(equals + 1, end, '|');
+  const char *temperatureBegin = equals + 1;
+  const char *temperatureEnd = separator;
+  trim(temperatureBegin, temperatureEnd);
+  units::CentiCelsius temperature = 0;
+  if (!parseCentiDegrees(temperatureBegin, temperatureEnd, temperature)) {
+    return ScheduleError::kTemperature;
+  }
+
+  ScheduledMode mode = ScheduledMode::kUnspecified;
+  if (separator != end) {
+    const char *modeBegin = separator + 1;
+    const char *modeEnd = end;
+    trim(modeBegin, modeEnd);
+    if (modeBegin != modeEnd &&
+        !scheduledModeFromName(modeBegin, static_cast<size_t>(modeEnd - modeBegin), mode)) {
+      return ScheduleError::kMode;
+    }
+  }
+  entry = ScheduleEntry(hour, minute, temperature, mode);
+  return ScheduleError::kNone;
+}
+}  // namespace
+
+ScheduleParseResult parseSchedule(const char *text,
+                                  size_t length,
+                                  ScheduleEntry *entries,
+                                  size_t capacity) {
+  return parseItems(text, length, entries, capacity, parseItem);
+}
+
+ScheduleParseResult parseDayOverrides(const char *text,
+                                      size_t length,
+                                      DayOverride *overrides,
+                                      size_t capacity) {
+  return parseItems(text, length, overrides, capacity, parseOverrideItem);
+}
+
+size_t formatDay(uint16_t day, char *buffer, size_t capacity) {
+  int year = 0;
+  unsigned month = 0;
+  unsigned dayOfMonth = 0;
+  civilFromDays(day, year, month, dayOfMonth);
+  int written = snprintf(buffer, capacity, "%04d-%02u-%02u", year, month, dayOfMonth);
+  return written > 0 ? static_cast<size_t>(written) : 0;
+}
+
+size_t formatSchedule(const ScheduleEntry *entries, size_t count, char *buffer, size_t capacity) {
+  size_t length = 0;
+  if (capacity > 0) {
+    buffer[0] = '\0';
+  }
+  for (size_t i = 0; i < count; ++i) {
+    const ScheduleEntry &entry = entries[i];
+    char item[kMaxScheduleItemLength + 1];
+    size_t itemLength = 0;
+    if (i > 0) {
+      item[itemLength++] = ';';
+    }
+    item[itemLength++] = static_cast<char>('0' + entry.hour / 10 % 10);
+    item[itemLength++] = static_cast<char>('0' + entry.hour % 10);
+    item[itemLength++] = ':';
+    item[itemLength++] = static_cast<char>('0' + entry.minute / 10 % 10);
+    item[itemLength++] = static_cast<char>('0' + entry.minute % 10);
+    item[itemLength++] = '=';
+    // One decimal unless the hundredths matter, so the text reads back exactly.
+    uint8_t decimals = entry.temperature % 10 == 0 ? 1 : 2;
+    itemLength += units::formatCelsius(entry.temperature, decimals, item + itemLength,
+                                       sizeof(item) - itemLength);
+    const char *mode = scheduledModeName(entry.mode);
+    if (*mode != '\0') {
+      item[itemLength++] = '|';
+      size_t modeLength = strlen(mode);
+      memcpy(item + itemLength, mode, modeLength);
+      itemLength += modeLength;
+    }
+    // Whole items only: a cut-off item would read back as a different entry.
+    if (length + itemLength < capacity) {
+      memcpy(buffer + length, item, itemLength);
+      buffer[length + itemLength] = '\0';
+    } else {
+      capacity = 0;
+    }
+    length += itemLength;
+  }
+  return length;
+}
+
+const char *scheduledModeName(ScheduledMode mode) {
+  size_t index = static_cast<size_t>(mode);
+  return index < kModeCount ? kModeNames[index] : "";
+}
+
+bool scheduledModeFromName(const char *name, size_t length, ScheduledMode &mode) {
+  // Skip kUnspecified, whose empty name would match empty text.
+  size_t index = findName(kModeNames + 1, kModeCount - 1, name, length);
+  if (index == kModeCount - 1) {
+    return false;
+  }
+  mode = static_cast<ScheduledMode>(index + 1);
+  return true;
+}
+
+const char *scheduleProfileName(uint8_t profile) {
+  return profile < ScheduleManager::kProfileCount ? kProfileNames[profile] : "";
+}
+
+bool scheduleProfileFromName(const char *name, size_t length, uint8_t &profile) {
+  size_t index = findName(kProfileNames, ScheduleManager::kProfileCount, name, length);
+  if (index == ScheduleManager::kProfileCount) {
+    return false;
+  }
+  profile = static_cast<uint8_t>(index);
+  return true;
+}
+
+const char *fanModeName(controller::FanMode mode) {
+  size_t index = static_cast<size_t>(mode);
+  return index < kFanModeCount ? kFanModeNames[index] : kFanModeNames[0];
+}
+
+bool fanModeFromName(const char *name, size_t length, controller::FanMode &mode) {
+  size_t index = findName(kFanModeNames, kFanModeCount, name, length);
+  if (index == kFanModeCount) {
+    return false;
+  }
+  mode = static_cast<controller::FanMode>(index);
+  return true;
+}
+
+const char *systemModeName(controller::SystemMode mode) {
+  size_t index = static_cast<size_t>(mode);
+  return index < kSystemModeCount ? kSystemModeNames[index] : kSystemModeNames[0];
+}
+
+bool systemModeFromName(const char *name, size_t length, controller::SystemMode &mode) {
+  size_t index = findName(kSystemModeNames, kSystemModeCount, name, length);
+  if (index == kSystemModeCount) {
+    return false;
+  }
+  mode = static_cast<controller::SystemMode>(index);
+  return true;
+}
+
+const char *scheduleErrorMessage(ScheduleError error) {
+  size_t index = static_cast<size_t>(error);
+  return index < sizeof(kErrorMessages) / sizeof(kErrorMessages[0]) ? kErrorMessages[index]
+                                                                    : "invalid schedule";
+}
+
+}  // namespace scheduler
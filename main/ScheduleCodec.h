@@ -0,0 +1,95 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "HVACController.h"
+#include "ScheduleManager.h"
+
+namespace scheduler {
+
+/**
+ * Text form of a day's schedule, shared by the web API and the settings
+ * migration: `HH:MM=temp[|mode];...`, e.g. `06:30=21.5|heating;22:00=18`.
+ *
+ * Items are separated by ';' and may be padded with whitespace; empty items
+ * are skipped. The hour takes one or two digits and the minute two. The
+ * temperature is a plain decimal in degrees Celsius, rounded to hundredths,
+ * and the mode is one of cooling, heating, fan or idle in any case. An item
+ * without '|' or with nothing after it leaves the mode unspecified.
+ *
+ * Dated overrides use the same item syntax: `YYYY-MM-DD=profile;...`, where
+ * the profile is one of sun..sat or holiday, e.g. `2024-12-25=holiday`.
+ *
+ * Both directions work on caller buffers without allocating, and parsing
+ * reads exactly `length` bytes, so the text needs no terminator.
+ */
+enum class ScheduleError : uint8_t {
+  kNone,
+  kSyntax,          // An item without '='.
+  kTime,            // Not H:MM or HH:MM within 00:00-23:59.
+  kTemperature,     // Not a decimal number within +/-327.67.
+  kMode,            // Not one of the mode names.
+  kDate,            // Not a YYYY-MM-DD calendar date from 1970 to 2149.
+  kProfile,         // Not one of the profile names.
+  kTooManyEntries,  // More items than the caller has room for.
+};
+
+struct ScheduleParseResult {
+  size_t count;         // Entries stored, including any before an error.
+  ScheduleError error;
+  size_t position;      // Offset of the item that failed, or the length on success.
+
+  bool ok() const { return error == ScheduleError::kNone; }
+};
+
+/** Longest formatted item, separator included: "23:59=-327.67|cooling;". */
+constexpr size_t kMaxScheduleItemLength = 22;
+/** Buffer size that holds any full profile with its terminator. */
+constexpr size_t kMaxScheduleTextSize = ScheduleManager::kMaxEntries * kMaxScheduleItemLength;
+
+/** Parses up to `capacity` entries; stops at the first invalid item. */
+ScheduleParseResult parseSchedule(const char *text,
+                                  size_t length,
+                                  ScheduleEntry *entries,
+                                  size_t capacity);
+
+/** Parses `YYYY-MM-DD=profile` items into up to `capacity` overrides. */
+ScheduleParseResult parseDayOverrides(const char *text,
+                                      size_t length,
+                                      DayOverride *overrides,
+                                      size_t capacity);
+
+/** Writes DayOverride::day as "YYYY-MM-DD"; returns the length, as formatSchedule() does. */
+size_t formatDay(uint16_t day, char *buffer, size_t capacity);
+
+/**
+ * Writes `count` entries in the form parseSchedule() reads back to the same
+ * entries. Like snprintf, returns the length of the whole text; when that is
+ * not below `capacity` only the items that fit are written. The buffer is
+ * always terminated when `capacity` is non-zero.
+ */
+size_t formatSchedule(const ScheduleEntry *entries, size_t count, char *buffer, size_t capacity);
+
+/** "cooling", "heating", "fan", "idle", or "" for kUnspecified and unknown values. */
+const char *scheduledModeName(ScheduledMode mode);
+
+/** Case-insensitive inverse of scheduledModeName(); false for anything else. */
+bool scheduledModeFromName(const char *name, size_t length, ScheduledMode &mode);
+
+/** "sun".."sat" for profiles 0-6, "holiday" for kHolidayProfile, "" otherwise. */
+const char *scheduleProfileName(uint8_t profile);
+bool scheduleProfileFromName(const char *name, size_t length, uint8_t &profile);
+
+// Names of the controller's modes, from the same kind of table as the
+// schedule's. The web API and the settings migration both read and write
+// modes through these, case-insensitively.
+const char *fanModeName(controller::FanMode mode);
+bool fanModeFromName(const char *name, size_t length, controller::FanMode &mode);
+const char *systemModeName(controller::SystemMode mode);
+bool systemModeFromName(const char *name, size_t length, controller::SystemMode &mode);
+
+/** Short description of an error, for API responses. */
+const char *scheduleErrorMessage(ScheduleError error);
+
+}  // namespace scheduler
@@ -1,43 +1,197 @@
 #include "ScheduleManager.h"
 
+#include <string.h>
+
+#include "ChangeSequence.h"
 #include "HVACController.h"
+#include "LogClock.h"
 
 namespace scheduler {
 
 namespace {
+constexpr long kSecondsPerDay = 24L * 60L * 60L;
+constexpr int kMinutesPerDay = 24 * 60;
+constexpr uint8_t kThursday = 4;  // 1970-01-01, local day 0.
+
 int toMinutes(uint8_t hour, uint8_t minute) { return hour * 60 + minute; }
+
+// Index of the last entry at or before `minutesOfDay`, or -1 when the day
+// has not reached its first entry yet.
+int lastEntryAtOrBefore(const PackedScheduleEntry *entries, size_t count, int minutesOfDay) {
+  size_t low = 0;
+  size_t high = count;
+  while (low < high) {
+    size_t middle = low + (high - low) / 2;
+    if (entries[middle].minutes() <= minutesOfDay) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return static_cast<int>(low) - 1;
+}
+}  // namespace
+
+PackedScheduleEntry PackedScheduleEntry::pack(const ScheduleEntry &entry) {
+  int minutes = toMinutes(entry.hour, entry.minute);
+  if (minutes >= kMinutesPerDay) {
+    minutes = kMinutesPerDay - 1;
+  }
+  uint16_t mode = static_cast<uint16_t>(entry.mode) & 0x07;
+  uint16_t explicitFlag = entry.mode != ScheduledMode::kUnspecified ? 0x4000 : 0;
+  return {static_cast<uint16_t>(minutes | (mode << 11) | explicitFlag),
+          entry.temperature};
+}
+
+ScheduleEntry PackedScheduleEntry::unpack() const {
+  uint16_t total = minutes();
+  return ScheduleEntry(static_cast<uint8_t>(total / 60), static_cast<uint8_t>(total % 60),
+                       temperature(), explicitMode() ? effectiveMode() : ScheduledMode::kUnspecified);
 }
 
 ScheduleManager::ScheduleManager() = default;
 
-void ScheduleManager::setDefaultTemperature(float temperature) {
+void ScheduleManager::setDefaultTemperature(units::CentiCelsius temperature) {
+  if (!units::isValid(temperature) || temperature == defaultTemperature_) {
+    return;
+  }
   defaultTemperature_ = temperature;
+  revision_ = tracking::ChangeSequence::next();
+}
+
+void ScheduleManager::setDaySchedule(uint8_t profile, const ScheduleEntry *entries, size_t count) {
+  if (profile >= kProfileCount) {
+    return;
+  }
+  PackedScheduleEntry packed[kMaxEntries];
+  count = min(count, kMaxEntries);
+  for (size_t i = 0; i < count; ++i) {
+    packed[i] = PackedScheduleEntry::pack(entries[i]);
+  }
+  storeSorted(packed, count, profiles_[profile]);
+  revision_ = tracking::ChangeSequence::next();
+}
+
+size_t ScheduleManager::daySchedule(uint8_t profile, ScheduleEntry *entries, size_t capacity) const {
+  if (profile >= kProfileCount) {
+    return 0;
+  }
+  const ScheduleData &schedule = profiles_[profile];
+  size_t count = min(static_cast<size_t>(schedule.count), capacity);
+  for (size_t i = 0; i < count; ++i) {
+    entries[i] = schedule.entries[i].unpack();
+  }
+  return count;
+}
+
+const PackedScheduleEntry *ScheduleManager::packedDaySchedule(uint8_t profile, size_t &count) const {
+  if (profile >= kProfileCount) {
+    count = 0;
+    return nullptr;
+  }
+  count = profiles_[profile].count;
+  return profiles_[profile].entries;
+}
+
+void ScheduleManager::setPackedDaySchedule(uint8_t profile,
+                                           const PackedScheduleEntry *entries,
+                                           size_t count) {
+  if (profile >= kProfileCount) {
+    return;
+  }
+  PackedScheduleEntry packed[kMaxEntries];
+  count = min(count, kMaxEntries);
+  for (size_t i = 0; i < count; ++i) {
+    // Round-trip through ScheduleEntry to drop out-of-range minutes and stale carried modes.
+    packed[i] = PackedScheduleEntry::pack(entries[i].unpack());
+  }
+  storeSorted(packed, count, profiles_[profile]);
+  revision_ = tracking::ChangeSequence::next();
 }
 
 void ScheduleManager::setWeekdaySchedule(const ScheduleEntry *entries, size_t count) {
-  copyAndSort(entries, count, weekday_);
+  for (uint8_t day = 1; day <= 5; ++day) {
+    setDaySchedule(day, entries, count);
+  }
 }
 
 void ScheduleManager::setWeekendSchedule(const ScheduleEntry *entries, size_t count) {
-  copyAndSort(entries, count, weekend_);
+  setDaySchedule(0, entries, count);
+  setDaySchedule(6, entries, count);
+}
+
+void ScheduleManager::setDayOverride(uint16_t day, uint8_t profile) {
+  if (profile >= kProfileCount) {
+    return;
+  }
+  size_t position = 0;
+  while (position < overrideCount_ && overrides_[position].day < day) {
+    ++position;
+  }
+  if (position < overrideCount_ && overrides_[position].day == day) {
+    if (overrides_[position].profile == profile) {
+      return;
+    }
+    overrides_[position].profile = profile;
+    revision_ = tracking::ChangeSequence::next();
+    return;
+  }
+  if (overrideCount_ == kMaxDayOverrides) {
+    if (position == 0) {
+      return;  // Older than every stored date.
+    }
+    // Drop the earliest date, which is most likely already past.
+    memmove(overrides_, overrides_ + 1, (kMaxDayOverrides - 1) * sizeof(DayOverride));
+    --overrideCount_;
+    --position;
+  }
+  memmove(overrides_ + position + 1, overrides_ + position,
+          (overrideCount_ - position) * sizeof(DayOverride));
+  overrides_[position] = {day, profile, 0};
+  ++overrideCount_;
+  revision_ = tracking::ChangeSequence::next();
+}
+
+void ScheduleManager::setDayOverrides(const DayOverride *overrides, size_t count) {
+  overrideCount_ = 0;
+  for (size_t i = 0; i < count; ++i) {
+    setDayOverride(overrides[i].day, overrides[i].profile);
+  }
+  revision_ = tracking::ChangeSequence::next();
+}
+
+const DayOverride *ScheduleManager::dayOverrides(size_t &count) const {
+  count = overrideCount_;
+  return overrides_;
 }
 
 ScheduleTarget ScheduleManager::targetFor(time_t now) const {
+  time_t nextTransition = 0;
+  return resolve(now, nextTransition);
+}
+
+ScheduleTarget ScheduleManager::resolve(time_t now, time_t &nextTransition) const {
+  // Until the clock is set, look again on the next second.
+  nextTransition = now + 1;
   if (now == 0) {
     return {defaultTemperature_, ScheduledMode::kUnspecified};
   }
 
   time_t adjusted = now + static_cast<time_t>(timezoneOffsetMinutes_) * 60;
-  tm timeinfo;
-  tm *timeinfoPtr = gmtime(&adjusted);
-  if (timeinfoPtr == nullptr) {
+  if (adjusted < 0) {
     return {defaultTemperature_, ScheduledMode::kUnspecified};
   }
-  timeinfo = *timeinfoPtr;
-  int minutes = toMinutes(static_cast<uint8_t>(timeinfo.tm_hour),
-                          static_cast<uint8_t>(timeinfo.tm_min));
-  bool weekend = (timeinfo.tm_wday == 0 || timeinfo.tm_wday == 6);
-  const ScheduleData &schedule = weekend ? weekend_ : weekday_;
+  uint32_t day = static_cast<uint32_t>(adjusted / kSecondsPerDay);
+  int secondsOfDay = static_cast<int>(adjusted % kSecondsPerDay);
+  int minutes = secondsOfDay / 60;
+  uint8_t weekday = static_cast<uint8_t>((day + kThursday) % 7);
+  const ScheduleData &schedule =
+      profiles_[profileForDay(static_cast<uint16_t>(min(day, static_cast<uint32_t>(UINT16_MAX))),
+                              weekday)];
+
+  // The next entry of today, or midnight, where the profile and the
+  // wrapped-around entry can both change.
+  nextTransition = now + (nextBoundaryMinutes(schedule, minutes) * 60 - secondsOfDay);
   return resolveTarget(schedule, minutes,
                        {defaultTemperature_, ScheduledMode::kUnspecified});
 }
@@ -50,7 +204,11 @@ void ScheduleManager::setTimezoneOffsetMinutes(int16_t offsetMinutes) {
   } else if (offsetMinutes > kMaxOffsetMinutes) {
     offsetMinutes = kMaxOffsetMinutes;
   }
+  if (offsetMinutes == timezoneOffsetMinutes_) {
+    return;
+  }
   timezoneOffsetMinutes_ = offsetMinutes;
+  revision_ = tracking::ChangeSequence::next();
 }
 
 void ScheduleManager::setTimezoneOffsetHours(float offsetHours) {
@@ -72,64 +230,105 @@ float ScheduleManager::timezoneOffsetHours() const {
   return static_cast<float>(timezoneOffsetMinutes_) / 60.0f;
 }
 
-void ScheduleManager::update(controller::HVACController &hvac) const {
+void ScheduleManager::update(controller::HVACController &hvac) {
   if (!hvac.scheduleUpdatesAllowed()) {
+    applied_ = false;
+    return;
+  }
+
+  time_t now = time(nullptr);
+  if (now < static_cast<time_t>(logging::LogClock::kMinSyncedEpoch)) {
+    // Until NTP has set the clock there is no day or time to schedule by.
+    applied_ = false;
+    return;
+  }
+  if (applied_ && now < nextTransition_ && revision_ == appliedRevision_ &&
+      hvac.configRevision() == appliedControllerRevision_) {
     return;
   }
 
-  ScheduleTarget scheduled = targetFor(time(nullptr));
-  hvac.setTargetTemperature(scheduled.temperature);
+  apply(resolve(now, nextTransition_), hvac);
+  applied_ = true;
+  appliedRevision_ = revision_;
+  appliedControllerRevision_ = hvac.configRevision();
+}
+
+void ScheduleManager::apply(const ScheduleTarget &scheduled, controller::HVACController &hvac) {
+  controller::SystemMode mode = hvac.systemMode();
   switch (scheduled.mode) {
     case ScheduledMode::kCooling:
-      hvac.setSystemMode(controller::SystemMode::kCooling);
+      mode = controller::SystemMode::kCooling;
       break;
     case ScheduledMode::kHeating:
-      hvac.setSystemMode(controller::SystemMode::kHeating);
+      mode = controller::SystemMode::kHeating;
       break;
     case ScheduledMode::kFanOnly:
-      hvac.setSystemMode(controller::SystemMode::kFanOnly);
+      mode = controller::SystemMode::kFanOnly;
       break;
     case ScheduledMode::kIdle:
-      hvac.setSystemMode(controller::SystemMode::kIdle);
+      mode = controller::SystemMode::kIdle;
       break;
     case ScheduledMode::kUnspecified:
       break;
   }
+  hvac.applyScheduledTarget(scheduled.temperature, scheduled.mode != ScheduledMode::kUnspecified,
+                            mode);
 }
 
-const ScheduleEntry *ScheduleManager::weekdayEntries(size_t &count) const {
-  count = weekday_.count;
-  return weekday_.entries;
-}
-
-const ScheduleEntry *ScheduleManager::weekendEntries(size_t &count) const {
-  count = weekend_.count;
-  return weekend_.entries;
-}
-
-void ScheduleManager::copyAndSort(const ScheduleEntry *entries,
+void ScheduleManager::storeSorted(PackedScheduleEntry *packed,
                                   size_t count,
                                   ScheduleData &destination) {
-  destination.count = min(count, kMaxEntries);
-  for (size_t i = 0; i < destination.count; ++i) {
-    destination.entries[i] = entries[i];
-  }
-  // Simple insertion sort by minutes of day.
-  for (size_t i = 1; i < destination.count; ++i) {
-    ScheduleEntry key = destination.entries[i];
-    int keyMinutes = toMinutes(key.hour, key.minute);
+  // Insertion sort by minute of day; stable, so equal times keep their order.
+  for (size_t i = 1; i < count; ++i) {
+    PackedScheduleEntry key = packed[i];
     size_t j = i;
-    while (j > 0) {
-      int prevMinutes = toMinutes(destination.entries[j - 1].hour,
-                                  destination.entries[j - 1].minute);
-      if (prevMinutes <= keyMinutes) {
-        break;
-      }
-      destination.entries[j] = destination.entries[j - 1];
+    while (j > 0 && packed[j - 1].minutes() > key.minutes()) {
+      packed[j] = packed[j - 1];
       --j;
     }
-    destination.entries[j] = key;
+    packed[j] = key;
+  }
+
+  // Before its first entry a day runs the last entry's own mode, so that is
+  // what carries into the entries that do not name one.
+  uint16_t carried = 0;
+  if (count > 0 && packed[count - 1].explicitMode()) {
+    carried = static_cast<uint16_t>(packed[count - 1].effectiveMode());
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if (packed[i].explicitMode()) {
+      carried = static_cast<uint16_t>(packed[i].effectiveMode());
+    }
+    destination.entries[i].minuteAndMode = static_cast<uint16_t>(
+        (packed[i].minuteAndMode & ~(0x07 << 11)) | (carried << 11));
+    destination.entries[i].centiDegrees = packed[i].centiDegrees;
+  }
+  destination.count = static_cast<uint8_t>(count);
+}
+
+uint8_t ScheduleManager::profileForDay(uint16_t day, uint8_t weekday) const {
+  size_t low = 0;
+  size_t high = overrideCount_;
+  while (low < high) {
+    size_t middle = low + (high - low) / 2;
+    if (overrides_[middle].day < day) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  if (low < overrideCount_ && overrides_[low].day == day) {
+    return overrides_[low].profile;
+  }
+  return weekday;
+}
+
+int ScheduleManager::nextBoundaryMinutes(const ScheduleData &schedule, int minutesOfDay) {
+  int last = lastEntryAtOrBefore(schedule.entries, schedule.count, minutesOfDay);
+  if (last + 1 < static_cast<int>(schedule.count)) {
+    return schedule.entries[last + 1].minutes();
   }
+  return kMinutesPerDay;
 }
 
 ScheduleTarget ScheduleManager::resolveTarget(const ScheduleData &schedule,
@@ -139,22 +338,21 @@ ScheduleTarget ScheduleManager::resolveTarget(const ScheduleData &schedule,
     return fallback;
   }
 
-  ScheduleTarget target = {schedule.entries[schedule.count - 1].temperature,
-                           schedule.entries[schedule.count - 1].mode};
+  int index = lastEntryAtOrBefore(schedule.entries, schedule.count, minutesOfDay);
+  ScheduleTarget target;
+  if (index < 0) {
+    // Before its first entry a day wraps around to its own last entry.
+    const PackedScheduleEntry &last = schedule.entries[schedule.count - 1];
+    target.temperature = last.temperature();
+    target.mode = last.explicitMode() ? last.effectiveMode() : ScheduledMode::kUnspecified;
+  } else {
+    const PackedScheduleEntry &entry = schedule.entries[index];
+    target.temperature = entry.temperature();
+    target.mode = entry.effectiveMode();
+  }
   if (target.mode == ScheduledMode::kUnspecified) {
     target.mode = fallback.mode;
   }
-  for (size_t i = 0; i < schedule.count; ++i) {
-    int entryMinutes = toMinutes(schedule.entries[i].hour, schedule.entries[i].minute);
-    if (entryMinutes <= minutesOfDay) {
-      target.temperature = schedule.entries[i].temperature;
-      if (schedule.entries[i].mode != ScheduledMode::kUnspecified) {
-        target.mode = schedule.entries[i].mode;
-      }
-    } else {
-      break;
-    }
-  }
   return target;
 }
 
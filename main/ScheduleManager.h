@@ -3,6 +3,8 @@
 #include <Arduino.h>
 #include <time.h>
 
+#include "Temperature.h"
+
 namespace controller {
 class HVACController;
 }
@@ -20,32 +22,86 @@ enum class ScheduledMode : uint8_t {
 struct ScheduleEntry {
   uint8_t hour;
   uint8_t minute;
-  float temperature;
+  units::CentiCelsius temperature;
   ScheduledMode mode;
 
   constexpr ScheduleEntry(uint8_t h = 0,
                           uint8_t m = 0,
-                          float t = 0.0f,
+                          units::CentiCelsius t = 0,
                           ScheduledMode mo = ScheduledMode::kUnspecified)
       : hour(h), minute(m), temperature(t), mode(mo) {}
 };
 
 struct ScheduleTarget {
-  float temperature;
+  units::CentiCelsius temperature;
   ScheduledMode mode;
 };
 
+/**
+ * Stored form of a ScheduleEntry, 4 bytes instead of 6.
+ *
+ * `minuteAndMode` holds the minute of day in bits 0-10 and, in bits 11-13,
+ * the mode in effect from this entry on (the entry's own mode, or the one
+ * carried over from an earlier entry). Bit 14 is set when the entry names
+ * its mode itself. Precomputing the carried mode keeps lookups a binary
+ * search. The layout is also what SettingsStorage persists.
+ */
+struct PackedScheduleEntry {
+  uint16_t minuteAndMode;
+  int16_t centiDegrees;
+
+  static PackedScheduleEntry pack(const ScheduleEntry &entry);
+
+  uint16_t minutes() const { return minuteAndMode & 0x07FF; }
+  ScheduledMode effectiveMode() const {
+    return static_cast<ScheduledMode>((minuteAndMode >> 11) & 0x07);
+  }
+  bool explicitMode() const { return (minuteAndMode & 0x4000) != 0; }
+  units::CentiCelsius temperature() const { return centiDegrees; }
+  ScheduleEntry unpack() const;
+};
+
+/** Replaces the day-of-week profile on one calendar date, e.g. a public holiday. */
+struct DayOverride {
+  uint16_t day;      // Local days since 1970-01-01.
+  uint8_t profile;   // 0-6 for Sunday-Saturday, kHolidayProfile for the holiday profile.
+  uint8_t reserved;
+};
+
 class ScheduleManager {
  public:
-  static constexpr size_t kMaxEntries = 12;
+  static constexpr size_t kMaxEntries = 24;  // Per profile.
+  static constexpr uint8_t kProfileCount = 8;  // Sunday..Saturday, then the holiday profile.
+  static constexpr uint8_t kHolidayProfile = 7;
+  static constexpr size_t kMaxDayOverrides = 16;
 
   ScheduleManager();
 
-  void setDefaultTemperature(float temperature);
+  void setDefaultTemperature(units::CentiCelsius temperature);
+  units::CentiCelsius defaultTemperature() const { return defaultTemperature_; }
+
+  /** Replaces one profile; entries are sorted by time of day. */
+  void setDaySchedule(uint8_t profile, const ScheduleEntry *entries, size_t count);
+  /** Copies up to `capacity` entries of a profile in time order; returns the count. */
+  size_t daySchedule(uint8_t profile, ScheduleEntry *entries, size_t capacity) const;
 
+  /** Stored form for persistence; setPackedDaySchedule() re-derives the carried modes. */
+  const PackedScheduleEntry *packedDaySchedule(uint8_t profile, size_t &count) const;
+  void setPackedDaySchedule(uint8_t profile, const PackedScheduleEntry *entries, size_t count);
+
+  /** Sets Monday-Friday to the same entries. */
   void setWeekdaySchedule(const ScheduleEntry *entries, size_t count);
+  /** Sets Saturday and Sunday to the same entries. */
   void setWeekendSchedule(const ScheduleEntry *entries, size_t count);
 
+  /**
+   * Runs `profile` on local calendar day `day` instead of its weekday profile.
+   * When the table is full the earliest date is dropped to make room.
+   */
+  void setDayOverride(uint16_t day, uint8_t profile);
+  void setDayOverrides(const DayOverride *overrides, size_t count);
+  const DayOverride *dayOverrides(size_t &count) const;
+
   ScheduleTarget targetFor(time_t now) const;
 
   void setTimezoneOffsetMinutes(int16_t offsetMinutes);
@@ -53,29 +109,49 @@ class ScheduleManager {
   int16_t timezoneOffsetMinutes() const { return timezoneOffsetMinutes_; }
   float timezoneOffsetHours() const;
 
-  void update(controller::HVACController &hvac) const;
+  /**
+   * Applies the scheduled target when a schedule boundary has been crossed,
+   * the schedule, default or timezone changed, scheduling was re-enabled, or
+   * the controller's settings were edited since the last apply. Otherwise it
+   * costs a time() call and a few integer compares.
+   */
+  void update(controller::HVACController &hvac);
+
+  /** Epoch second of the next boundary update() is waiting for (0 = none yet). */
+  time_t nextTransition() const { return nextTransition_; }
 
-  const ScheduleEntry *weekdayEntries(size_t &count) const;
-  const ScheduleEntry *weekendEntries(size_t &count) const;
+  /** Change sequence of the last schedule, override, default or timezone edit. */
+  uint32_t revision() const { return revision_; }
 
  private:
   struct ScheduleData {
-    ScheduleEntry entries[kMaxEntries];
-    size_t count = 0;
+    PackedScheduleEntry entries[kMaxEntries];
+    uint8_t count = 0;
   };
 
-  static void copyAndSort(const ScheduleEntry *entries,
-                          size_t count,
-                          ScheduleData &destination);
+  static void storeSorted(PackedScheduleEntry *packed, size_t count, ScheduleData &destination);
+  uint8_t profileForDay(uint16_t day, uint8_t weekday) const;
 
   static ScheduleTarget resolveTarget(const ScheduleData &schedule,
                                       int minutesOfDay,
                                       const ScheduleTarget &fallback);
+  static int nextBoundaryMinutes(const ScheduleData &schedule, int minutesOfDay);
 
-  float defaultTemperature_ = 23.0f;
-  ScheduleData weekday_;
-  ScheduleData weekend_;
+  ScheduleTarget resolve(time_t now, time_t &nextTransition) const;
+  static void apply(const ScheduleTarget &target, controller::HVACController &hvac);
+
+  units::CentiCelsius defaultTemperature_ = 2300;
+  ScheduleData profiles_[kProfileCount];
+  DayOverride overrides_[kMaxDayOverrides];
+  size_t overrideCount_ = 0;
   int16_t timezoneOffsetMinutes_ = 0;
+  uint32_t revision_ = 0;
+
+  // What the last update() applied, and when it has to look again.
+  bool applied_ = false;
+  time_t nextTransition_ = 0;
+  uint32_t appliedRevision_ = 0;
+  uint32_t appliedControllerRevision_ = 0;
 };
 
 }  // namespace scheduler
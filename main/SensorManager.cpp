@@ -14,15 +14,15 @@ void SensorManager::setCoilReader(TemperatureReader reader) {
 
 void SensorManager::update() {
   if (ambientReader_) {
-    float value = ambientReader_();
-    if (!isnan(value)) {
+    units::CentiCelsius value = ambientReader_();
+    if (units::isValid(value)) {
       ambient_.value = value;
       ambient_.timestamp = millis();
     }
   }
   if (coilReader_) {
-    float value = coilReader_();
-    if (!isnan(value)) {
+    units::CentiCelsius value = coilReader_();
+    if (units::isValid(value)) {
       coil_.value = value;
       coil_.timestamp = millis();
     }
@@ -2,12 +2,15 @@
 
 #include <Arduino.h>
 
+#include "Temperature.h"
+
 namespace controller {
 
-using TemperatureReader = float (*)();
+/** Returns the latest reading, or units::kNoTemperature when there is none. */
+using TemperatureReader = units::CentiCelsius (*)();
 
 struct TemperatureSample {
-  float value = NAN;
+  units::CentiCelsius value = units::kNoTemperature;
   unsigned long timestamp = 0;
 };
 
@@ -23,8 +26,8 @@ class SensorManager {
 
   void update();
 
-  bool hasAmbient() const { return !isnan(ambient_.value); }
-  bool hasCoil() const { return !isnan(coil_.value); }
+  bool hasAmbient() const { return units::isValid(ambient_.value); }
+  bool hasCoil() const { return units::isValid(coil_.value); }
 
   TemperatureSample ambient() const { return ambient_; }
   TemperatureSample coil() const { return coil_; }
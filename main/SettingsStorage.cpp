@@ -2,6 +2,11 @@
 
 #include <FS.h>
 #include <LittleFS.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ScheduleCodec.h"
 
 namespace storage {
 
@@ -19,21 +24,284 @@ constexpr const char *kKeyTimezoneMinutes = "timezoneOffsetMinutes";
 constexpr const char *kKeyWeekday = "weekday";
 constexpr const char *kKeyWeekend = "weekend";
 
-String toLowerCopy(const String &value) {
-  String copy = value;
-  copy.toLowerCase();
-  return copy;
+constexpr size_t kMaxPathLength = 32;
+
+uint32_t crc32(const uint8_t *data, size_t length) {
+  uint32_t crc = 0xFFFFFFFFUL;
+  for (size_t i = 0; i < length; ++i) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1UL)));
+    }
+  }
+  return ~crc;
+}
+
+// Scalar settings shared by every blob version.
+template <typename PayloadType>
+void applyControllerSettings(const PayloadType &payload,
+                             controller::HVACController &hvac,
+                             scheduler::ScheduleManager &schedule) {
+  hvac.setTargetTemperature(units::fromCelsius(payload.targetTemperature));
+  hvac.setHysteresis(units::fromCelsius(payload.hysteresis));
+  hvac.setCompressorTemperatureLimit(units::fromCelsius(payload.compressorTemperatureLimit));
+  hvac.setCompressorMinimumAmbient(units::fromCelsius(payload.compressorMinimumAmbient));
+  hvac.setCompressorCooldownTemperature(units::fromCelsius(payload.compressorCooldownTemperature));
+  hvac.setCompressorCooldownDurationMinutes(payload.compressorCooldownMinutes);
+  hvac.setFanMode(static_cast<controller::FanMode>(payload.fanMode));
+  hvac.setSystemMode(static_cast<controller::SystemMode>(payload.systemMode));
+  hvac.enableScheduling(payload.schedulingEnabled != 0);
+  schedule.setTimezoneOffsetMinutes(payload.timezoneOffsetMinutes);
 }
 
 }  // namespace
 
-SettingsStorage::SettingsStorage(const char *path) : path_(path) {}
+SettingsStorage::SettingsStorage(const char *path, const char *legacyPath)
+    : path_(path), legacyPath_(legacyPath) {}
 
-bool SettingsStorage::begin() const { return LittleFS.begin(); }
+bool SettingsStorage::begin() {
+  available_ = LittleFS.begin();
+  return available_;
+}
 
 bool SettingsStorage::load(controller::HVACController &hvac,
-                           scheduler::ScheduleManager &schedule) const {
+                           scheduler::ScheduleManager &schedule) {
+  recoverTemporary();
   File file = LittleFS.open(path_, "r");
+  if (!file) {
+    if (!loadLegacy(hvac, schedule)) {
+      return false;
+    }
+    if (save(hvac, schedule)) {
+      LittleFS.remove(legacyPath_);
+    }
+    return true;
+  }
+
+  // Peek at the version to pick the layout, then read the whole blob.
+  uint32_t magic = 0;
+  uint16_t version = 0;
+  bool headerRead = file.read(reinterpret_cast<uint8_t *>(&magic), sizeof(magic)) == sizeof(magic) &&
+                    file.read(reinterpret_cast<uint8_t *>(&version), sizeof(version)) ==
+                        sizeof(version) &&
+                    magic == kMagic && file.seek(0);
+  if (!headerRead) {
+    file.close();
+    return false;
+  }
+
+  if (version == 1) {
+    BlobV1 blob{};
+    bool valid = readBlob(file, version, blob);
+    file.close();
+    if (!valid) {
+      return false;
+    }
+    applyControllerSettings(blob.payload, hvac, schedule);
+    scheduler::ScheduleEntry entries[kV1MaxEntries];
+    size_t count = unpackV1Schedule(blob.payload.weekday, blob.payload.weekdayCount, entries);
+    schedule.setWeekdaySchedule(entries, count);
+    count = unpackV1Schedule(blob.payload.weekend, blob.payload.weekendCount, entries);
+    schedule.setWeekendSchedule(entries, count);
+    // Rewrite in the current layout so the conversion happens once.
+    save(hvac, schedule);
+    return true;
+  }
+
+  Blob blob{};
+  bool valid = readBlob(file, kVersion, blob);
+  file.close();
+  if (!valid) {
+    return false;
+  }
+
+  const Payload &payload = blob.payload;
+  applyControllerSettings(payload, hvac, schedule);
+  for (uint8_t profile = 0; profile < scheduler::ScheduleManager::kProfileCount; ++profile) {
+    schedule.setPackedDaySchedule(profile, payload.profiles[profile],
+                                  payload.profileCounts[profile]);
+  }
+  size_t overrideCount = payload.overrideCount;
+  if (overrideCount > scheduler::ScheduleManager::kMaxDayOverrides) {
+    overrideCount = scheduler::ScheduleManager::kMaxDayOverrides;
+  }
+  schedule.setDayOverrides(payload.overrides, overrideCount);
+  stored_ = true;
+  storedCrc_ = blob.crc;
+  markClean(hvac, schedule);
+  return true;
+}
+
+bool SettingsStorage::save(const controller::HVACController &hvac,
+                           const scheduler::ScheduleManager &schedule) {
+  Blob blob{};
+  fillBlob(hvac, schedule, blob);
+  if (!write(blob)) {
+    ++stats_.failures;
+    return false;
+  }
+  markClean(hvac, schedule);
+  return true;
+}
+
+void SettingsStorage::update(const controller::HVACController &hvac,
+                             const scheduler::ScheduleManager &schedule) {
+  if (!available_) {
+    return;
+  }
+  unsigned long now = millis();
+  if (hvac.settingsRevision() != controllerRevision_ || schedule.revision() != scheduleRevision_) {
+    controllerRevision_ = hvac.settingsRevision();
+    scheduleRevision_ = schedule.revision();
+    if (!pending_) {
+      pending_ = true;
+      firstEditMs_ = now;
+    }
+    lastEditMs_ = now;
+  }
+  if (pending_ && (now - lastEditMs_ >= kSaveDelayMs || now - firstEditMs_ >= kMaxSaveDelayMs)) {
+    flush(hvac, schedule);
+  }
+}
+
+bool SettingsStorage::flush(const controller::HVACController &hvac,
+                            const scheduler::ScheduleManager &schedule) {
+  bool edited =
+      hvac.settingsRevision() != controllerRevision_ || schedule.revision() != scheduleRevision_;
+  if (!pending_ && !edited) {
+    return true;
+  }
+  Blob blob{};
+  fillBlob(hvac, schedule, blob);
+  if (stored_ && blob.crc == storedCrc_) {
+    // Edits that were undone, or setters that ran without changing anything stored.
+    ++stats_.skipped;
+    markClean(hvac, schedule);
+    return true;
+  }
+  if (!write(blob)) {
+    ++stats_.failures;
+    pending_ = true;
+    firstEditMs_ = millis();
+    lastEditMs_ = firstEditMs_;
+    return false;
+  }
+  markClean(hvac, schedule);
+  return true;
+}
+
+void SettingsStorage::markClean(const controller::HVACController &hvac,
+                                const scheduler::ScheduleManager &schedule) {
+  controllerRevision_ = hvac.settingsRevision();
+  scheduleRevision_ = schedule.revision();
+  pending_ = false;
+}
+
+void SettingsStorage::fillBlob(const controller::HVACController &hvac,
+                               const scheduler::ScheduleManager &schedule,
+                               Blob &blob) {
+  blob.magic = kMagic;
+  blob.version = kVersion;
+  blob.payloadSize = sizeof(Payload);
+
+  Payload &payload = blob.payload;
+  payload.targetTemperature = units::toCelsius(hvac.targetTemperature());
+  payload.hysteresis = units::toCelsius(hvac.hysteresis());
+  payload.compressorTemperatureLimit = units::toCelsius(hvac.compressorTemperatureLimit());
+  payload.compressorMinimumAmbient = units::toCelsius(hvac.compressorMinimumAmbient());
+  payload.compressorCooldownTemperature = units::toCelsius(hvac.compressorCooldownTemperature());
+  payload.compressorCooldownMinutes = hvac.compressorCooldownDurationMinutes();
+  payload.timezoneOffsetMinutes = schedule.timezoneOffsetMinutes();
+  payload.fanMode = static_cast<uint8_t>(hvac.fanMode());
+  payload.systemMode = static_cast<uint8_t>(hvac.systemMode());
+  payload.schedulingEnabled = hvac.schedulingEnabled() ? 1 : 0;
+
+  for (uint8_t profile = 0; profile < scheduler::ScheduleManager::kProfileCount; ++profile) {
+    size_t count = 0;
+    const scheduler::PackedScheduleEntry *entries = schedule.packedDaySchedule(profile, count);
+    memcpy(payload.profiles[profile], entries, count * sizeof(scheduler::PackedScheduleEntry));
+    payload.profileCounts[profile] = static_cast<uint8_t>(count);
+  }
+  size_t overrideCount = 0;
+  const scheduler::DayOverride *overrides = schedule.dayOverrides(overrideCount);
+  memcpy(payload.overrides, overrides, overrideCount * sizeof(scheduler::DayOverride));
+  payload.overrideCount = static_cast<uint8_t>(overrideCount);
+
+  blob.crc = crc32(reinterpret_cast<const uint8_t *>(&blob), offsetof(Blob, crc));
+}
+
+bool SettingsStorage::write(const Blob &blob) {
+  // Write beside the live copy and swap it in with an atomic rename.
+  char tempPath[kMaxPathLength];
+  temporaryPath(tempPath, sizeof(tempPath));
+  File file = LittleFS.open(tempPath, "w");
+  if (!file) {
+    return false;
+  }
+  bool written =
+      file.write(reinterpret_cast<const uint8_t *>(&blob), sizeof(blob)) == sizeof(blob);
+  file.close();
+  if (!written) {
+    LittleFS.remove(tempPath);
+    return false;
+  }
+  if (!LittleFS.rename(tempPath, path_)) {
+    return false;
+  }
+  stored_ = true;
+  storedCrc_ = blob.crc;
+  ++stats_.writes;
+  return true;
+}
+
+void SettingsStorage::recoverTemporary() {
+  char tempPath[kMaxPathLength];
+  temporaryPath(tempPath, sizeof(tempPath));
+  File file = LittleFS.open(tempPath, "r");
+  if (!file) {
+    return;
+  }
+  // A whole record here is a save() cut off before its rename, and newer
+  // than the live copy; anything else is a torn write.
+  Blob blob{};
+  bool valid = readBlob(file, kVersion, blob);
+  file.close();
+  if (!valid || !LittleFS.rename(tempPath, path_)) {
+    LittleFS.remove(tempPath);
+  }
+}
+
+void SettingsStorage::temporaryPath(char *buffer, size_t size) const {
+  snprintf(buffer, size, "%s.tmp", path_);
+}
+
+template <typename BlobType>
+bool SettingsStorage::readBlob(File &file, uint16_t version, BlobType &blob) {
+  size_t read = file.read(reinterpret_cast<uint8_t *>(&blob), sizeof(blob));
+  return read == sizeof(blob) && blob.magic == kMagic && blob.version == version &&
+         blob.payloadSize == sizeof(blob.payload) &&
+         blob.crc == crc32(reinterpret_cast<const uint8_t *>(&blob), offsetof(BlobType, crc));
+}
+
+size_t SettingsStorage::unpackV1Schedule(const V1ScheduleEntry *packed,
+                                         uint8_t packedCount,
+                                         scheduler::ScheduleEntry *entries) {
+  size_t count = packedCount;
+  if (count > kV1MaxEntries) {
+    count = kV1MaxEntries;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    entries[i] = scheduler::ScheduleEntry(packed[i].hour, packed[i].minute,
+                                          units::fromCelsius(packed[i].temperature),
+                                          static_cast<scheduler::ScheduledMode>(packed[i].mode));
+  }
+  return count;
+}
+
+bool SettingsStorage::loadLegacy(controller::HVACController &hvac,
+                                 scheduler::ScheduleManager &schedule) {
+  // Text format written before the binary store; only read for migration.
+  File file = LittleFS.open(legacyPath_, "r");
   if (!file) {
     return false;
   }
@@ -54,28 +322,33 @@ bool SettingsStorage::load(controller::HVACController &hvac,
     key.trim();
     value.trim();
     if (key.equalsIgnoreCase(kKeyTarget)) {
-      hvac.setTargetTemperature(value.toFloat());
+      hvac.setTargetTemperature(units::fromCelsius(value.toFloat()));
       applied = true;
     } else if (key.equalsIgnoreCase(kKeyHysteresis)) {
-      hvac.setHysteresis(value.toFloat());
+      hvac.setHysteresis(units::fromCelsius(value.toFloat()));
       applied = true;
     } else if (key.equalsIgnoreCase(kKeyCompressorTempLimit)) {
-      hvac.setCompressorTemperatureLimit(value.toFloat());
+      hvac.setCompressorTemperatureLimit(units::fromCelsius(value.toFloat()));
       applied = true;
     } else if (key.equalsIgnoreCase(kKeyCompressorMinAmbient)) {
-      hvac.setCompressorMinimumAmbient(value.toFloat());
+      hvac.setCompressorMinimumAmbient(units::fromCelsius(value.toFloat()));
       applied = true;
     } else if (key.equalsIgnoreCase(kKeyCompressorCooldownTemp)) {
-      hvac.setCompressorCooldownTemperature(value.toFloat());
+      hvac.setCompressorCooldownTemperature(units::fromCelsius(value.toFloat()));
       applied = true;
     } else if (key.equalsIgnoreCase(kKeyCompressorCooldownMinutes)) {
       hvac.setCompressorCooldownDurationMinutes(value.toFloat());
       applied = true;
     } else if (key.equalsIgnoreCase(kKeyFanMode)) {
-      hvac.setFanMode(fanModeFromString(value));
+      // The old firmware fell back to the default for names it did not know.
+      controller::FanMode mode = controller::FanMode::kAuto;
+      scheduler::fanModeFromName(value.c_str(), value.length(), mode);
+      hvac.setFanMode(mode);
       applied = true;
     } else if (key.equalsIgnoreCase(kKeySystemMode)) {
-      hvac.setSystemMode(systemModeFromString(value));
+      controller::SystemMode mode = controller::SystemMode::kCooling;
+      scheduler::systemModeFromName(value.c_str(), value.length(), mode);
+      hvac.setSystemMode(mode);
       applied = true;
     } else if (key.equalsIgnoreCase(kKeyScheduling)) {
       hvac.enableScheduling(value.equalsIgnoreCase("true") || value == "1");
@@ -85,16 +358,18 @@ bool SettingsStorage::load(controller::HVACController &hvac,
       applied = true;
     } else if (key.equalsIgnoreCase(kKeyWeekday)) {
       scheduler::ScheduleEntry entries[scheduler::ScheduleManager::kMaxEntries];
-      size_t count = 0;
-      if (parseSchedule(value, entries, count)) {
-        schedule.setWeekdaySchedule(entries, count);
+      scheduler::ScheduleParseResult parsed = scheduler::parseSchedule(
+          value.c_str(), value.length(), entries, scheduler::ScheduleManager::kMaxEntries);
+      if (parsed.ok()) {
+        schedule.setWeekdaySchedule(entries, parsed.count);
         applied = true;
       }
     } else if (key.equalsIgnoreCase(kKeyWeekend)) {
       scheduler::ScheduleEntry entries[scheduler::ScheduleManager::kMaxEntries];
-      size_t count = 0;
-      if (parseSchedule(value, entries, count)) {
-        schedule.setWeekendSchedule(entries, count);
+      scheduler::ScheduleParseResult parsed = scheduler::parseSchedule(
+          value.c_str(), value.length(), entries, scheduler::ScheduleManager::kMaxEntries);
+      if (parsed.ok()) {
+        schedule.setWeekendSchedule(entries, parsed.count);
         applied = true;
       }
     }
@@ -103,196 +378,4 @@ bool SettingsStorage::load(controller::HVACController &hvac,
   return applied;
 }
 
-bool SettingsStorage::save(const controller::HVACController &hvac,
-                           const scheduler::ScheduleManager &schedule) const {
-  File file = LittleFS.open(path_, "w");
-  if (!file) {
-    return false;
-  }
-
-  file.printf("%s=%.2f\n", kKeyTarget, hvac.targetTemperature());
-  file.printf("%s=%.2f\n", kKeyHysteresis, hvac.hysteresis());
-  file.printf("%s=%.1f\n", kKeyCompressorTempLimit, hvac.compressorTemperatureLimit());
-  file.printf("%s=%.1f\n", kKeyCompressorMinAmbient, hvac.compressorMinimumAmbient());
-  file.printf("%s=%.1f\n", kKeyCompressorCooldownTemp, hvac.compressorCooldownTemperature());
-  file.printf("%s=%.2f\n", kKeyCompressorCooldownMinutes,
-              hvac.compressorCooldownDurationMinutes());
-  file.printf("%s=%s\n", kKeyFanMode, fanModeToString(hvac.fanMode()).c_str());
-  file.printf("%s=%s\n", kKeySystemMode, systemModeToString(hvac.systemMode()).c_str());
-  file.printf("%s=%s\n", kKeyScheduling, hvac.schedulingEnabled() ? "true" : "false");
-  file.printf("%s=%d\n", kKeyTimezoneMinutes, schedule.timezoneOffsetMinutes());
-
-  size_t weekdayCount = 0;
-  const scheduler::ScheduleEntry *weekday = schedule.weekdayEntries(weekdayCount);
-  String weekdayString = scheduleToString(weekday, weekdayCount);
-  file.printf("%s=%s\n", kKeyWeekday, weekdayString.c_str());
-
-  size_t weekendCount = 0;
-  const scheduler::ScheduleEntry *weekend = schedule.weekendEntries(weekendCount);
-  String weekendString = scheduleToString(weekend, weekendCount);
-  file.printf("%s=%s\n", kKeyWeekend, weekendString.c_str());
-
-  file.close();
-  return true;
-}
-
-bool SettingsStorage::parseSchedule(const String &value,
-                                    scheduler::ScheduleEntry *entries,
-                                    size_t &count) const {
-  count = 0;
-  if (value.length() == 0) {
-    return true;
-  }
-
-  int start = 0;
-  while (start < value.length() && count < scheduler::ScheduleManager::kMaxEntries) {
-    int end = value.indexOf(';', start);
-    if (end == -1) {
-      end = value.length();
-    }
-    String token = value.substring(start, end);
-    token.trim();
-    if (!token.isEmpty()) {
-      int colon = token.indexOf(':');
-      int equals = token.indexOf('=');
-      if (colon > 0 && equals > colon) {
-        uint8_t hour = static_cast<uint8_t>(token.substring(0, colon).toInt());
-        uint8_t minute = static_cast<uint8_t>(token.substring(colon + 1, equals).toInt());
-        int modeSeparator = token.indexOf('|', equals + 1);
-        String tempPart = modeSeparator == -1 ? token.substring(equals + 1)
-                                              : token.substring(equals + 1, modeSeparator);
-        float temperature = tempPart.toFloat();
-        scheduler::ScheduledMode mode = scheduler::ScheduledMode::kUnspecified;
-        if (modeSeparator != -1) {
-          String modePart = token.substring(modeSeparator + 1);
-          modePart.trim();
-          modePart = toLowerCopy(modePart);
-          mode = scheduleModeFromString(modePart);
-        }
-        entries[count++] = scheduler::ScheduleEntry(hour, minute, temperature, mode);
-      }
-    }
-    start = end + 1;
-  }
-  return true;
-}
-
-String SettingsStorage::scheduleToString(const scheduler::ScheduleEntry *entries, size_t count) {
-  String result;
-  for (size_t i = 0; i < count; ++i) {
-    if (i > 0) {
-      result += ';';
-    }
-    if (entries[i].hour < 10) {
-      result += '0';
-    }
-    result += String(entries[i].hour);
-    result += ':';
-    if (entries[i].minute < 10) {
-      result += '0';
-    }
-    result += String(entries[i].minute);
-    result += '=';
-    result += String(entries[i].temperature, 1);
-    if (entries[i].mode != scheduler::ScheduledMode::kUnspecified) {
-      result += '|';
-      result += scheduleModeToString(entries[i].mode);
-    }
-  }
-  return result;
-}
-
-String SettingsStorage::fanModeToString(controller::FanMode mode) {
-  switch (mode) {
-    case controller::FanMode::kAuto:
-      return "auto";
-    case controller::FanMode::kOff:
-      return "off";
-    case controller::FanMode::kLow:
-      return "low";
-    case controller::FanMode::kMedium:
-      return "medium";
-    case controller::FanMode::kHigh:
-      return "high";
-  }
-  return "auto";
-}
-
-controller::FanMode SettingsStorage::fanModeFromString(const String &value) {
-  String normalized = toLowerCopy(value);
-  if (normalized == "off") {
-    return controller::FanMode::kOff;
-  }
-  if (normalized == "low") {
-    return controller::FanMode::kLow;
-  }
-  if (normalized == "medium") {
-    return controller::FanMode::kMedium;
-  }
-  if (normalized == "high") {
-    return controller::FanMode::kHigh;
-  }
-  return controller::FanMode::kAuto;
-}
-
-String SettingsStorage::systemModeToString(controller::SystemMode mode) {
-  switch (mode) {
-    case controller::SystemMode::kCooling:
-      return "cooling";
-    case controller::SystemMode::kHeating:
-      return "heating";
-    case controller::SystemMode::kFanOnly:
-      return "fan";
-    case controller::SystemMode::kIdle:
-      return "idle";
-  }
-  return "cooling";
-}
-
-controller::SystemMode SettingsStorage::systemModeFromString(const String &value) {
-  String normalized = toLowerCopy(value);
-  if (normalized == "heating") {
-    return controller::SystemMode::kHeating;
-  }
-  if (normalized == "fan") {
-    return controller::SystemMode::kFanOnly;
-  }
-  if (normalized == "idle") {
-    return controller::SystemMode::kIdle;
-  }
-  return controller::SystemMode::kCooling;
-}
-
-String SettingsStorage::scheduleModeToString(scheduler::ScheduledMode mode) {
-  switch (mode) {
-    case scheduler::ScheduledMode::kCooling:
-      return "cooling";
-    case scheduler::ScheduledMode::kHeating:
-      return "heating";
-    case scheduler::ScheduledMode::kFanOnly:
-      return "fan";
-    case scheduler::ScheduledMode::kIdle:
-      return "idle";
-    case scheduler::ScheduledMode::kUnspecified:
-      break;
-  }
-  return "";
-}
-
-scheduler::ScheduledMode SettingsStorage::scheduleModeFromString(const String &value) {
-  if (value == "cooling") {
-    return scheduler::ScheduledMode::kCooling;
-  }
-  if (value == "heating") {
-    return scheduler::ScheduledMode::kHeating;
-  }
-  if (value == "fan") {
-    return scheduler::ScheduledMode::kFanOnly;
-  }
-  if (value == "idle") {
-    return scheduler::ScheduledMode::kIdle;
-  }
-  return scheduler::ScheduledMode::kUnspecified;
-}
-
 }  // namespace storage
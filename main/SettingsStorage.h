@@ -1,35 +1,159 @@
 #pragma once
 
 #include <Arduino.h>
+#include <FS.h>
+
 #include "HVACController.h"
 #include "ScheduleManager.h"
 
 namespace storage {
 
+/**
+ * Settings persisted as one fixed-layout binary blob.
+ *
+ * The blob carries a magic, schema version, payload size and CRC32 and is
+ * written to a temporary file that is renamed over the previous copy, so a
+ * brown-out mid-save leaves the last good settings in place; load() finishes
+ * the rename of a temporary file that was written whole. A version 1
+ * blob (weekday/weekend schedules) is converted on load and rewritten; the
+ * old `key=value` text file is read once for migration and then removed.
+ *
+ * Edits are persisted from loop() by update() rather than by the code that
+ * makes them. It watches the controller's and schedule's change revisions,
+ * waits until the edits settle, and rewrites the file only if the record
+ * differs from the one on flash, so a burst of edits costs at most one
+ * write and a request that changes nothing costs none.
+ */
 class SettingsStorage {
  public:
-  explicit SettingsStorage(const char *path = "/settings.cfg");
+  explicit SettingsStorage(const char *path = "/settings.bin",
+                           const char *legacyPath = "/settings.cfg");
+
+  /** Quiet time after the last edit before update() writes it. */
+  static constexpr unsigned long kSaveDelayMs = 5000;
+  /** Longest update() holds back an edit while further edits keep arriving. */
+  static constexpr unsigned long kMaxSaveDelayMs = 30000;
+
+  struct Stats {
+    uint32_t writes = 0;
+    uint32_t skipped = 0;   // Settled edits that left the record as it was on flash.
+    uint32_t failures = 0;  // Writes that failed; update() tries again after kSaveDelayMs.
+  };
 
-  bool begin() const;
+  /** Mounts the file system; update() does nothing until this succeeds. */
+  bool begin();
 
-  bool load(controller::HVACController &hvac, scheduler::ScheduleManager &schedule) const;
-  bool save(const controller::HVACController &hvac,
-            const scheduler::ScheduleManager &schedule) const;
+  bool load(controller::HVACController &hvac, scheduler::ScheduleManager &schedule);
+  /** Writes the settings now, whether or not they changed. */
+  bool save(const controller::HVACController &hvac, const scheduler::ScheduleManager &schedule);
+
+  /**
+   * Call from loop(). Notes edits by their change revisions and, once they
+   * have settled, writes them if the record differs from the stored one.
+   * Costs two compares while nothing changes.
+   */
+  void update(const controller::HVACController &hvac,
+              const scheduler::ScheduleManager &schedule);
+  /** Writes a pending edit without waiting for it to settle, e.g. before a restart. */
+  bool flush(const controller::HVACController &hvac, const scheduler::ScheduleManager &schedule);
+  /** True while an edit is waiting to be written. */
+  bool pending() const { return pending_; }
+
+  const Stats &stats() const { return stats_; }
 
  private:
-  bool parseSchedule(const String &value,
-                     scheduler::ScheduleEntry *entries,
-                     size_t &count) const;
-
-  static String scheduleToString(const scheduler::ScheduleEntry *entries, size_t count);
-  static String fanModeToString(controller::FanMode mode);
-  static controller::FanMode fanModeFromString(const String &value);
-  static String systemModeToString(controller::SystemMode mode);
-  static controller::SystemMode systemModeFromString(const String &value);
-  static String scheduleModeToString(scheduler::ScheduledMode mode);
-  static scheduler::ScheduledMode scheduleModeFromString(const String &value);
+  static constexpr size_t kV1MaxEntries = 12;
+
+  // Version 1 layout: weekday and weekend tables only.
+  struct V1ScheduleEntry {
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t mode;
+    uint8_t reserved;
+    float temperature;
+  };
+
+  struct PayloadV1 {
+    float targetTemperature;
+    float hysteresis;
+    float compressorTemperatureLimit;
+    float compressorMinimumAmbient;
+    float compressorCooldownTemperature;
+    float compressorCooldownMinutes;
+    int16_t timezoneOffsetMinutes;
+    uint8_t fanMode;
+    uint8_t systemMode;
+    uint8_t schedulingEnabled;
+    uint8_t weekdayCount;
+    uint8_t weekendCount;
+    uint8_t reserved;
+    V1ScheduleEntry weekday[kV1MaxEntries];
+    V1ScheduleEntry weekend[kV1MaxEntries];
+  };
+
+  // Version 2: one table per day-of-week profile plus holiday overrides,
+  // stored in ScheduleManager's packed form. Controller temperatures stay
+  // float Celsius here and are converted to fixed point on load.
+  struct Payload {
+    float targetTemperature;
+    float hysteresis;
+    float compressorTemperatureLimit;
+    float compressorMinimumAmbient;
+    float compressorCooldownTemperature;
+    float compressorCooldownMinutes;
+    int16_t timezoneOffsetMinutes;
+    uint8_t fanMode;
+    uint8_t systemMode;
+    uint8_t schedulingEnabled;
+    uint8_t overrideCount;
+    uint8_t profileCounts[scheduler::ScheduleManager::kProfileCount];
+    scheduler::PackedScheduleEntry profiles[scheduler::ScheduleManager::kProfileCount]
+                                           [scheduler::ScheduleManager::kMaxEntries];
+    scheduler::DayOverride overrides[scheduler::ScheduleManager::kMaxDayOverrides];
+  };
+
+  template <typename PayloadType>
+  struct BlobOf {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t payloadSize;
+    PayloadType payload;
+    uint32_t crc;
+  };
+  using Blob = BlobOf<Payload>;
+  using BlobV1 = BlobOf<PayloadV1>;
+
+  static constexpr uint32_t kMagic = 0x534E4854;  // 'THNS'
+  static constexpr uint16_t kVersion = 2;
+
+  static void fillBlob(const controller::HVACController &hvac,
+                       const scheduler::ScheduleManager &schedule,
+                       Blob &blob);
+  template <typename BlobType>
+  static bool readBlob(File &file, uint16_t version, BlobType &blob);
+  static size_t unpackV1Schedule(const V1ScheduleEntry *packed,
+                                 uint8_t packedCount,
+                                 scheduler::ScheduleEntry *entries);
+
+  bool loadLegacy(controller::HVACController &hvac, scheduler::ScheduleManager &schedule);
+  bool write(const Blob &blob);
+  /** Renames a valid temporary file left by an interrupted write() into place, or removes it. */
+  void recoverTemporary();
+  void temporaryPath(char *buffer, size_t size) const;
+  void markClean(const controller::HVACController &hvac,
+                 const scheduler::ScheduleManager &schedule);
 
   const char *path_;
+  const char *legacyPath_;
+  bool available_ = false;
+  bool stored_ = false;  // storedCrc_ describes the file on flash.
+  uint32_t storedCrc_ = 0;
+  uint32_t controllerRevision_ = 0;
+  uint32_t scheduleRevision_ = 0;
+  bool pending_ = false;
+  unsigned long firstEditMs_ = 0;
+  unsigned long lastEditMs_ = 0;
+  Stats stats_;
 };
 
 }  // namespace storage
@@ -0,0 +1,39 @@
+#include "Temperature.h"
+
+#include <stdio.h>
+
+namespace units {
+
+size_t formatCelsius(CentiCelsius value, uint8_t decimals, char *buffer, size_t capacity) {
+  if (capacity == 0) {
+    return 0;
+  }
+  int written;
+  if (!isValid(value)) {
+    written = snprintf(buffer, capacity, "null");
+  } else {
+    if (decimals > 2) {
+      decimals = 2;
+    }
+    // Round the magnitude half away from zero at the requested precision.
+    long divisor = decimals == 2 ? 1 : decimals == 1 ? 10 : 100;
+    long magnitude = value < 0 ? -static_cast<long>(value) : static_cast<long>(value);
+    long scaled = (magnitude + divisor / 2) / divisor;
+    const char *sign = value < 0 && scaled != 0 ? "-" : "";
+    long unit = 100 / divisor;
+    if (decimals == 0) {
+      written = snprintf(buffer, capacity, "%s%ld", sign, scaled);
+    } else {
+      written = snprintf(buffer, capacity, "%s%ld.%0*ld", sign, scaled / unit,
+                         static_cast<int>(decimals), scaled % unit);
+    }
+  }
+  if (written < 0) {
+    buffer[0] = '\0';
+    return 0;
+  }
+  size_t length = static_cast<size_t>(written);
+  return length < capacity ? length : capacity - 1;
+}
+
+}  // namespace units
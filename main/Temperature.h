@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace units {
+
+/**
+ * Temperature in hundredths of a degree Celsius.
+ *
+ * Sensors, schedules, the temperature log and the control loop carry
+ * temperatures in this form so that comparisons and averages stay integer
+ * on a core without an FPU. Floats appear only where text is parsed or
+ * written. kNoTemperature marks a missing reading.
+ */
+using CentiCelsius = int16_t;
+
+constexpr CentiCelsius kNoTemperature = INT16_MIN;
+
+constexpr bool isValid(CentiCelsius value) { return value != kNoTemperature; }
+
+/** Rounds to the nearest hundredth and clamps to +/-327.67; NaN gives kNoTemperature. */
+constexpr CentiCelsius fromCelsius(float celsius) {
+  return celsius != celsius        ? kNoTemperature
+         : celsius >= 327.67f      ? INT16_MAX
+         : celsius <= -327.67f     ? -INT16_MAX
+         : celsius >= 0.0f         ? static_cast<CentiCelsius>(celsius * 100.0f + 0.5f)
+                                   : static_cast<CentiCelsius>(celsius * 100.0f - 0.5f);
+}
+
+inline float toCelsius(CentiCelsius value) {
+  return isValid(value) ? static_cast<float>(value) / 100.0f : NAN;
+}
+
+/**
+ * Writes `value` with one or two decimals, e.g. "23.5" or "-0.25", or "null"
+ * for a missing reading. Returns the length written, excluding the
+ * terminator, which is always written when `capacity` is non-zero.
+ */
+size_t formatCelsius(CentiCelsius value, uint8_t decimals, char *buffer, size_t capacity);
+
+}  // namespace units
@@ -1,47 +1,200 @@
 #include "TemperatureLog.h"
 
-#include <math.h>
+#include "LogClock.h"
 
 namespace logging {
 
-TemperatureLog::TemperatureLog() = default;
+namespace {
+constexpr unsigned long kQuarterHourSeconds = 15UL * TemperatureLog::kMinuteSeconds;
+constexpr unsigned long kHourSeconds = 60UL * TemperatureLog::kMinuteSeconds;
+constexpr unsigned long kDaySeconds = 24UL * kHourSeconds;
+
+void foldReading(int16_t value, int16_t &minimum, int16_t &maximum, long &sum, uint16_t &count) {
+  if (value == TemperatureLog::kNoReading) {
+    return;
+  }
+  if (count == 0 || value < minimum) {
+    minimum = value;
+  }
+  if (count == 0 || value > maximum) {
+    maximum = value;
+  }
+  sum += value;
+  ++count;
+}
+
+int16_t average(long sum, uint16_t count) {
+  if (count == 0) {
+    return TemperatureLog::kNoReading;
+  }
+  long half = count / 2;
+  return static_cast<int16_t>(sum >= 0 ? (sum + half) / count : (sum - half) / count);
+}
+}  // namespace
+
+TemperatureLog::TemperatureLog()
+    : tiers_{{quarterHours_, kQuarterHourBuckets, kQuarterHourSeconds, 0, 0, {}},
+             {hours_, kHourBuckets, kHourSeconds, 0, 0, {}},
+             {days_, kDayBuckets, kDaySeconds, 0, 0, {}}} {}
+
+unsigned long TemperatureLog::periodSeconds(Resolution resolution) {
+  switch (resolution) {
+    case Resolution::kMinute:
+      return kMinuteSeconds;
+    case Resolution::kQuarterHour:
+      return kQuarterHourSeconds;
+    case Resolution::kHour:
+      return kHourSeconds;
+    case Resolution::kDay:
+      return kDaySeconds;
+  }
+  return kMinuteSeconds;
+}
+
+TemperatureLog::Resolution TemperatureLog::selectResolution(unsigned long start,
+                                                            unsigned long resolutionSeconds) const {
+  static constexpr Resolution kOrder[] = {Resolution::kMinute, Resolution::kQuarterHour,
+                                          Resolution::kHour, Resolution::kDay};
+  constexpr size_t kCount = sizeof(kOrder) / sizeof(kOrder[0]);
+  size_t chosen = 0;
+  for (size_t i = 0; i < kCount; ++i) {
+    if (periodSeconds(kOrder[i]) <= resolutionSeconds) {
+      chosen = i;
+    }
+  }
+  for (; chosen + 1 < kCount; ++chosen) {
+    unsigned long oldest = 0;
+    if (oldestTimestamp(kOrder[chosen], oldest) && oldest <= start) {
+      break;
+    }
+  }
+  return kOrder[chosen];
+}
+
+bool TemperatureLog::oldestTimestamp(Resolution resolution, unsigned long &timestamp) const {
+  if (resolution == Resolution::kMinute) {
+    if (ring_.size() == 0) {
+      return false;
+    }
+    timestamp = ring_.minute(0) * kMinuteSeconds;
+    return true;
+  }
+  const Tier &tier = tiers_[tierIndex(resolution)];
+  if (tier.count == 0) {
+    return false;
+  }
+  timestamp = tier.buckets[(tier.head + tier.capacity - tier.count) % tier.capacity].timestamp;
+  return true;
+}
+
+size_t TemperatureLog::lowerBound(unsigned long timestamp) const {
+  unsigned long minute = timestamp / kMinuteSeconds;
+  return ring_.lowerBound(timestamp % kMinuteSeconds == 0 ? minute : minute + 1);
+}
+
+size_t TemperatureLog::upperBound(unsigned long timestamp) const {
+  return ring_.upperBound(timestamp / kMinuteSeconds);
+}
+
+TemperatureLog::Rollup TemperatureLog::fromEntry(const Entry &entry) {
+  return {entry.timestamp, entry.ambient, entry.ambient, entry.ambient,
+          entry.coil,      entry.coil,    entry.coil};
+}
+
+void TemperatureLog::rollUp(const Entry &entry) {
+  int16_t ambient = entry.ambient;
+  int16_t coil = entry.coil;
+  for (Tier &tier : tiers_) {
+    unsigned long bucketStart = entry.timestamp - (entry.timestamp % tier.periodSeconds);
+    size_t newest = (tier.head + tier.capacity - 1) % tier.capacity;
+    if (tier.count == 0 || tier.buckets[newest].timestamp != bucketStart) {
+      newest = tier.head;
+      tier.buckets[newest] = {bucketStart, kNoReading, kNoReading, kNoReading,
+                              kNoReading, kNoReading, kNoReading};
+      tier.head = (tier.head + 1) % tier.capacity;
+      if (tier.count < tier.capacity) {
+        ++tier.count;
+      }
+      tier.sums = {};
+    }
+    Rollup &bucket = tier.buckets[newest];
+    foldReading(ambient, bucket.ambientMin, bucket.ambientMax, tier.sums.ambientSum,
+                tier.sums.ambientCount);
+    foldReading(coil, bucket.coilMin, bucket.coilMax, tier.sums.coilSum, tier.sums.coilCount);
+    bucket.ambientAverage = average(tier.sums.ambientSum, tier.sums.ambientCount);
+    bucket.coilAverage = average(tier.sums.coilSum, tier.sums.coilCount);
+  }
+}
 
 void TemperatureLog::ensureMinute(unsigned long minute) {
   if (hasCurrentMinute_ && minute == currentMinute_) {
     return;
   }
 
+  if (hasCurrentMinute_) {
+    // The previous minute is final once a new one starts.
+    rollUp({currentMinute_ * kMinuteSeconds, ambient_[currentSlot_], coil_[currentSlot_]});
+  }
+
   currentMinute_ = minute;
   hasCurrentMinute_ = true;
-  ambientSum_ = 0.0f;
+  ambientSum_ = 0;
   ambientCount_ = 0;
-  coilSum_ = 0.0f;
+  coilSum_ = 0;
   coilCount_ = 0;
 
-  currentIndex_ = head_;
-  entries_[currentIndex_] = {minute * 60000UL, NAN, NAN};
-  head_ = (head_ + 1) % kMaxEntries;
-  if (count_ < kMaxEntries) {
-    ++count_;
+  currentSlot_ = ring_.append(minute, [](size_t) {});
+  ambient_[currentSlot_] = kNoReading;
+  coil_[currentSlot_] = kNoReading;
+  revisions_.rowCreated();
+}
+
+void TemperatureLog::rebase(unsigned long since, long deltaSeconds) {
+  long deltaMinutes = deltaSeconds / static_cast<long>(kMinuteSeconds);
+  unsigned long sinceMinute = since / kMinuteSeconds;
+  ring_.shiftFrom(ring_.lowerBound(sinceMinute), deltaMinutes, [](size_t) {});
+  if (hasCurrentMinute_ && currentMinute_ >= sinceMinute) {
+    currentMinute_ += deltaMinutes;
   }
+  // Each bucket goes where its first row went; rows move by whole minutes.
+  long rowShift = deltaMinutes * static_cast<long>(kMinuteSeconds);
+  for (Tier &tier : tiers_) {
+    for (size_t processed = 0; processed < tier.count; ++processed) {
+      Rollup &bucket = tier.buckets[(tier.head + tier.capacity - tier.count + processed) %
+                                    tier.capacity];
+      if (bucket.timestamp >= since) {
+        bucket.timestamp =
+            LogClock::movedPeriodStart(bucket.timestamp, rowShift, tier.periodSeconds);
+      }
+    }
+  }
+  revisions_.reset();
 }
 
-void TemperatureLog::addReading(unsigned long timestamp, float ambient, float coil) {
-  unsigned long minute = timestamp / 60000UL;
+void TemperatureLog::addReading(unsigned long timestamp,
+                                units::CentiCelsius ambient,
+                                units::CentiCelsius coil) {
+  unsigned long minute = timestamp / kMinuteSeconds;
   ensureMinute(minute);
 
-  if (!isnan(ambient)) {
+  if (units::isValid(ambient)) {
     ambientSum_ += ambient;
     ++ambientCount_;
   }
-  if (!isnan(coil)) {
+  if (units::isValid(coil)) {
     coilSum_ += coil;
     ++coilCount_;
   }
 
-  float ambientAverage = ambientCount_ > 0 ? ambientSum_ / static_cast<float>(ambientCount_) : NAN;
-  float coilAverage = coilCount_ > 0 ? coilSum_ / static_cast<float>(coilCount_) : NAN;
-  entries_[currentIndex_] = {minute * 60000UL, ambientAverage, coilAverage};
+  // Most readings leave the rounded averages where they were, and pollers
+  // should only see a new revision when the row they were sent changed.
+  units::CentiCelsius ambientAverage = average(ambientSum_, ambientCount_);
+  units::CentiCelsius coilAverage = average(coilSum_, coilCount_);
+  if (ambientAverage != ambient_[currentSlot_] || coilAverage != coil_[currentSlot_]) {
+    ambient_[currentSlot_] = ambientAverage;
+    coil_[currentSlot_] = coilAverage;
+    revisions_.rowModified();
+  }
 }
 
 }  // namespace logging
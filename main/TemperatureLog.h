@@ -2,48 +2,185 @@
 
 #include <Arduino.h>
 
+#include "ChangeSequence.h"
+#include "MinuteRing.h"
+#include "Temperature.h"
+
 namespace logging {
 
+/**
+ * One-minute temperature averages plus fixed-size rollup tiers.
+ *
+ * The minute ring stores only the two averages per row (4 bytes); row times
+ * come from MinuteRing. Every completed minute is folded into 15-minute,
+ * hourly and daily buckets holding min/max/average in hundredths of a
+ * degree, so several weeks of history fit in a few kilobytes alongside the
+ * six-hour minute ring.
+ */
 class TemperatureLog {
  public:
+  /** One minute row as handed to forEachRow(); not the stored layout. */
   struct Entry {
-    unsigned long timestamp;
-    float ambient;
-    float coil;
+    unsigned long timestamp;  // Epoch seconds at the start of the minute.
+    units::CentiCelsius ambient;  // Minute average; kNoReading when none.
+    units::CentiCelsius coil;
+  };
+
+  enum class Resolution : uint8_t { kMinute, kQuarterHour, kHour, kDay };
+
+  struct Rollup {
+    unsigned long timestamp;  // Start of the bucket.
+    int16_t ambientMin;       // Hundredths of a degree; kNoReading when empty.
+    int16_t ambientMax;
+    int16_t ambientAverage;
+    int16_t coilMin;
+    int16_t coilMax;
+    int16_t coilAverage;
   };
 
-  static constexpr size_t kMaxEntries = 120;
+  static constexpr size_t kMaxEntries = 360;         // 6 hours
+  static constexpr unsigned long kMinuteSeconds = 60UL;
+  static constexpr size_t kQuarterHourBuckets = 64;  // 16 hours
+  static constexpr size_t kHourBuckets = 168;        // 7 days
+  static constexpr size_t kDayBuckets = 42;          // 6 weeks
+  static constexpr int16_t kNoReading = units::kNoTemperature;
+
+  static unsigned long periodSeconds(Resolution resolution);
+  static float toCelsius(int16_t centiDegrees) { return units::toCelsius(centiDegrees); }
 
   TemperatureLog();
 
-  void addReading(unsigned long timestamp, float ambient, float coil);
+  void addReading(unsigned long timestamp, units::CentiCelsius ambient, units::CentiCelsius coil);
+
+  size_t size() const { return ring_.size(); }
+  /** Rows opened since the log was created; the oldest one kept is number this minus size(). */
+  uint32_t rowsAppended() const { return ring_.rowsAppended(); }
 
-  size_t size() const { return count_; }
+  /**
+   * Moves rows and buckets stamped at or after `since` by `deltaSeconds`
+   * once the clock they were stamped with turns out to be off (see
+   * LogClock). Rollup buckets move by whole periods.
+   */
+  void rebase(unsigned long since, long deltaSeconds);
+
+  uint32_t revision() const { return revisions_.revision(); }
+  size_t rowsChangedSince(uint32_t since, bool &replaceAll) const {
+    return revisions_.rowsChangedSince(since, ring_.size(), replaceAll);
+  }
 
   template <typename Callback>
   void forEach(Callback callback) const {
-    size_t processed = 0;
-    while (processed < count_) {
-      size_t index = (head_ + kMaxEntries - count_ + processed) % kMaxEntries;
-      callback(entries_[index]);
-      ++processed;
+    forEachRow(0, ring_.size(), callback);
+  }
+
+  /** Position of the first row starting at or after `timestamp`; size() when there is none. */
+  size_t lowerBound(unsigned long timestamp) const;
+  /** Position past the last row starting at or before `timestamp`; see PowerLog::upperBound(). */
+  size_t upperBound(unsigned long timestamp) const;
+
+  /** Visits the rows at positions [first, last), oldest first, without touching the others. */
+  template <typename Callback>
+  void forEachRow(size_t first, size_t last, Callback callback) const {
+    ring_.forEachIn(first, last, [&](size_t slot, unsigned long minute) {
+      callback(Entry{minute * kMinuteSeconds, ambient_[slot], coil_[slot]});
+    });
+  }
+
+  /**
+   * Picks the coarsest tier whose bucket size does not exceed `resolutionSeconds`,
+   * moving to coarser tiers when the chosen one no longer reaches back to
+   * `start`.
+   */
+  Resolution selectResolution(unsigned long start, unsigned long resolutionSeconds) const;
+  /** Start of the oldest bucket of one tier; false when it is empty. */
+  bool oldestTimestamp(Resolution resolution, unsigned long &timestamp) const;
+
+  /**
+   * Visits the buckets of one tier that overlap [start, end], oldest first,
+   * stopping after `limit` of them. Returns true when it stopped early, so
+   * a caller writing the range in passes can go on from the last bucket.
+   */
+  template <typename Callback>
+  bool forEachRollup(Resolution resolution,
+                     unsigned long start,
+                     unsigned long end,
+                     Callback callback,
+                     size_t limit = SIZE_MAX) const {
+    unsigned long period = periodSeconds(resolution);
+    size_t visited = 0;
+    if (resolution == Resolution::kMinute) {
+      size_t position = ring_.lowerBound(start / kMinuteSeconds);
+      size_t last = upperBound(end);
+      while (position < last && visited < limit) {
+        size_t stop = last - position > limit - visited ? position + (limit - visited) : last;
+        forEachRow(position, stop, [&](const Entry &entry) {
+          if (entry.timestamp + period > start && entry.timestamp <= end) {
+            callback(fromEntry(entry));
+            ++visited;
+          }
+        });
+        position = stop;
+      }
+      return position < last;
     }
+    const Tier &tier = tiers_[tierIndex(resolution)];
+    for (size_t processed = 0; processed < tier.count; ++processed) {
+      size_t index = (tier.head + tier.capacity - tier.count + processed) % tier.capacity;
+      const Rollup &bucket = tier.buckets[index];
+      if (bucket.timestamp + period > start && bucket.timestamp <= end) {
+        if (visited == limit) {
+          return true;
+        }
+        callback(bucket);
+        ++visited;
+      }
+    }
+    return false;
   }
 
  private:
-  Entry entries_[kMaxEntries];
-  size_t head_ = 0;
-  size_t count_ = 0;
+  struct Accumulator {
+    long ambientSum;
+    long coilSum;
+    uint16_t ambientCount;
+    uint16_t coilCount;
+  };
+
+  struct Tier {
+    Rollup *buckets;
+    size_t capacity;
+    unsigned long periodSeconds;
+    size_t head;
+    size_t count;
+    Accumulator sums;
+  };
+
+  static size_t tierIndex(Resolution resolution) {
+    return static_cast<size_t>(resolution) - 1;
+  }
+  static Rollup fromEntry(const Entry &entry);
+
+  void rollUp(const Entry &entry);
+
+  MinuteRing ring_{kMaxEntries};
+  units::CentiCelsius ambient_[kMaxEntries];
+  units::CentiCelsius coil_[kMaxEntries];
+  tracking::RowRevisions revisions_;
 
   void ensureMinute(unsigned long minute);
 
   unsigned long currentMinute_ = 0;
   bool hasCurrentMinute_ = false;
-  size_t currentIndex_ = kMaxEntries;
-  float ambientSum_ = 0.0f;
-  size_t ambientCount_ = 0;
-  float coilSum_ = 0.0f;
-  size_t coilCount_ = 0;
+  size_t currentSlot_ = 0;
+  long ambientSum_ = 0;
+  uint16_t ambientCount_ = 0;
+  long coilSum_ = 0;
+  uint16_t coilCount_ = 0;
+
+  Rollup quarterHours_[kQuarterHourBuckets];
+  Rollup hours_[kHourBuckets];
+  Rollup days_[kDayBuckets];
+  Tier tiers_[3];
 };
 
 }  // namespace logging
@@ -0,0 +1,77 @@
+#include "TemperatureProbes.h"
+
+namespace controller {
+
+void TemperatureProbes::poll() {
+  if (!bus_.present(Probe::kAmbient) && !bus_.present(Probe::kCoil)) {
+    return;
+  }
+  unsigned long now = millis();
+  switch (state_) {
+    case State::kIdle:
+      if (!started_ || now - startedAt_ >= kPollIntervalMs) {
+        startConversion();
+      }
+      break;
+    case State::kConverting:
+      if (now - startedAt_ >= conversionMs_) {
+        collect();
+      }
+      break;
+  }
+}
+
+void TemperatureProbes::readNow() {
+  if (!bus_.present(Probe::kAmbient) && !bus_.present(Probe::kCoil)) {
+    return;
+  }
+  startConversion();
+  delay(conversionMs_);
+  collect();
+}
+
+units::CentiCelsius TemperatureProbes::takeAmbient() {
+  if (!ambientFresh_) {
+    return units::kNoTemperature;
+  }
+  ambientFresh_ = false;
+  return ambient_;
+}
+
+units::CentiCelsius TemperatureProbes::takeCoil() {
+  if (!coilFresh_) {
+    return units::kNoTemperature;
+  }
+  coilFresh_ = false;
+  return coil_;
+}
+
+// Converting the 1/128 degree steps directly keeps DallasTemperature's
+// float getTempC() path out of the sensor loop.
+units::CentiCelsius TemperatureProbes::fromRaw(int32_t raw) {
+  if (raw == Bus::kDisconnected) {
+    return units::kNoTemperature;
+  }
+  int32_t scaled = raw * 100;
+  return static_cast<units::CentiCelsius>(scaled >= 0 ? (scaled + 64) / 128 : (scaled - 64) / 128);
+}
+
+void TemperatureProbes::startConversion() {
+  bus_.requestConversion();
+  startedAt_ = millis();
+  conversionMs_ = bus_.conversionTimeMs();
+  started_ = true;
+  state_ = State::kConverting;
+}
+
+void TemperatureProbes::collect() {
+  ambient_ = bus_.present(Probe::kAmbient) ? fromRaw(bus_.readRaw(Probe::kAmbient))
+                                           : units::kNoTemperature;
+  coil_ = bus_.present(Probe::kCoil) ? fromRaw(bus_.readRaw(Probe::kCoil))
+                                     : units::kNoTemperature;
+  ambientFresh_ = bus_.present(Probe::kAmbient);
+  coilFresh_ = bus_.present(Probe::kCoil);
+  state_ = State::kIdle;
+}
+
+}  // namespace controller
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "Temperature.h"
+
+namespace controller {
+
+/**
+ * Reads the ambient and coil DS18B20 probes without blocking loop().
+ *
+ * poll() starts a conversion on the bus, returns at once, and collects both
+ * scratchpads on the first call after the conversion time has passed; the
+ * next conversion starts kPollIntervalMs after the previous one did. Each
+ * collected reading is handed out once through takeAmbient()/takeCoil(), the
+ * SensorManager readers, which report no reading in between so a sample's
+ * timestamp tracks the real measurement.
+ */
+class TemperatureProbes {
+ public:
+  enum class Probe : uint8_t { kAmbient, kCoil };
+  enum class State : uint8_t { kIdle, kConverting };
+
+  /** The OneWire side: DallasTemperature on the device, a fake in host checks. */
+  class Bus {
+   public:
+    /** Raw reading of a probe that did not answer; DallasTemperature's DEVICE_DISCONNECTED_RAW. */
+    static constexpr int32_t kDisconnected = -7040;
+
+    virtual ~Bus() = default;
+    virtual bool present(Probe probe) const = 0;
+    /** Starts a conversion on every probe without waiting for it. */
+    virtual void requestConversion() = 0;
+    /** How long a conversion takes at the configured resolution. */
+    virtual unsigned long conversionTimeMs() const = 0;
+    /** The last conversion of `probe` in 1/128 degree steps, or kDisconnected. */
+    virtual int32_t readRaw(Probe probe) = 0;
+  };
+
+  static constexpr unsigned long kPollIntervalMs = 1000;
+
+  explicit TemperatureProbes(Bus &bus) : bus_(bus) {}
+
+  /** Steps the conversion cycle; call from every loop(). */
+  void poll();
+  /** Converts and collects at once, waiting out the conversion; for setup() only. */
+  void readNow();
+
+  State state() const { return state_; }
+
+  /** Latest collected readings; units::kNoTemperature when absent. */
+  units::CentiCelsius ambient() const { return ambient_; }
+  units::CentiCelsius coil() const { return coil_; }
+
+  /** The reading collected since the last call, or units::kNoTemperature. */
+  units::CentiCelsius takeAmbient();
+  units::CentiCelsius takeCoil();
+
+  /** Rounds a raw 1/128 degree reading to centi-degrees; kDisconnected gives kNoTemperature. */
+  static units::CentiCelsius fromRaw(int32_t raw);
+
+ private:
+  void startConversion();
+  void collect();
+
+  Bus &bus_;
+  State state_ = State::kIdle;
+  bool started_ = false;
+  unsigned long startedAt_ = 0;
+  unsigned long conversionMs_ = 0;
+
+  units::CentiCelsius ambient_ = units::kNoTemperature;
+  units::CentiCelsius coil_ = units::kNoTemperature;
+  bool ambientFresh_ = false;
+  bool coilFresh_ = false;
+};
+
+}  // namespace controller
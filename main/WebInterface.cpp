@@ -3,12 +3,441 @@
 
 #include <Arduino.h>
 #include <ESP8266WiFi.h>
+#include <limits.h>
+#include <math.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <strings.h>
 #include <time.h>
 
+#include "ChangeSequence.h"
+#include "FieldReader.h"
+#include "LogCursor.h"
+#include "RollupGroups.h"
+#include "ScheduleCodec.h"
+
 namespace interface {
 
+namespace {
+constexpr size_t kStateLogRows = 30;
+// Rows or buckets written per step of a streamed response, between checks
+// for queue space.
+constexpr size_t kStreamRows = 8;
+constexpr unsigned long kHistoryTargetPoints = 120;
+constexpr unsigned long kHistoryDefaultSpanSeconds = 24UL * 60UL * 60UL;
+
+/** Streamed plain-text counterpart of JsonStreamWriter for line-oriented formats. */
+class TextStreamWriter {
+ public:
+  explicit TextStreamWriter(HttpServer &server) : server_(server) {}
+
+  void begin(int code, const char *contentType) {
+    server_.setContentLength(HttpServer::kContentLengthUnknown);
+    server_.send(code, contentType, "");
+  }
+
+  void printf(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+    char line[128];
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if (written <= 0) {
+      return;
+    }
+    size_t length = static_cast<size_t>(written) < sizeof(line) ? static_cast<size_t>(written)
+                                                                : sizeof(line) - 1;
+    if (length_ + length > sizeof(buffer_)) {
+      flush();
+    }
+    memcpy(buffer_ + length_, line, length);
+    length_ += length;
+  }
+
+  void end() { flush(); }
+
+ private:
+  void flush() {
+    if (length_ > 0) {
+      server_.sendContent(buffer_, length_);
+      length_ = 0;
+    }
+  }
+
+  HttpServer &server_;
+  char buffer_[JsonStreamWriter::kBufferSize];
+  size_t length_ = 0;
+};
+
+/**
+ * Streamed little-endian binary counterpart of JsonStreamWriter for format=bin.
+ * Floats go out as their IEEE bits, so nothing is formatted on the device.
+ */
+class BinaryStreamWriter {
+ public:
+  explicit BinaryStreamWriter(HttpServer &server) : server_(server) {}
+
+  void begin(int code) {
+    server_.setContentLength(HttpServer::kContentLengthUnknown);
+    server_.send(code, "application/octet-stream", "");
+  }
+
+  void u8(uint8_t value) {
+    if (length_ == sizeof(buffer_)) {
+      flush();
+    }
+    buffer_[length_++] = static_cast<char>(value);
+  }
+
+  void u16(uint16_t value) {
+    u8(static_cast<uint8_t>(value));
+    u8(static_cast<uint8_t>(value >> 8));
+  }
+
+  void u32(uint32_t value) {
+    u16(static_cast<uint16_t>(value));
+    u16(static_cast<uint16_t>(value >> 16));
+  }
+
+  void i16(int16_t value) { u16(static_cast<uint16_t>(value)); }
+
+  void f32(float value) {
+    uint32_t bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    u32(bits);
+  }
+
+  void end() { flush(); }
+
+ private:
+  void flush() {
+    if (length_ > 0) {
+      server_.sendContent(buffer_, length_);
+      length_ = 0;
+    }
+  }
+
+  HttpServer &server_;
+  char buffer_[JsonStreamWriter::kBufferSize];
+  size_t length_ = 0;
+};
+
+// Layout of the format=bin history responses; web/index.html decodes it.
+// Every response opens with a common header, then a kind-specific part,
+// then fixed-size records up to the end of the body:
+//   u8 version, u8 kind, u16 header size, u16 record size, u8 resolution
+//   (tier index), u8 reserved, u32 period seconds
+constexpr uint8_t kBinaryVersion = 1;
+constexpr uint16_t kBinaryCommonHeaderSize = 12;
+// Power: u32 available count, u32 earliest, u32 latest (0xFFFFFFFF when the
+// tier is empty), f32 total Wh, f32 range start Wh, f32 range end Wh (NaN
+// when the range holds no counter).
+constexpr uint16_t kBinaryPowerHeaderSize = kBinaryCommonHeaderSize + 24;
+// Temperature: u32 requested start, u32 requested end.
+constexpr uint16_t kBinaryTemperatureHeaderSize = kBinaryCommonHeaderSize + 8;
+
+enum class BinaryKind : uint8_t {
+  // u32 t, f32 cumulative Wh, u16 deci-watts, u8 fan speed (bits 0-1) and
+  // compressor (bit 2).
+  kPowerRows = 1,
+  // u32 t, u32 seconds covered, f32 Wh at start, f32 Wh at end, u16 lowest
+  // and u16 highest row average in deci-watts.
+  kPowerBuckets = 2,
+  // u32 t, then ambient min, max, average and coil min, max, average as
+  // i16 centi-degrees (INT16_MIN when missing).
+  kTemperatureBuckets = 3,
+};
+
+constexpr uint16_t binaryRecordSize(BinaryKind kind) {
+  return kind == BinaryKind::kPowerRows      ? 11
+         : kind == BinaryKind::kPowerBuckets ? 20
+                                             : 16;
+}
+
+uint16_t toDeciWatts(float watts) {
+  float deciWatts = watts * 10.0f + 0.5f;
+  if (!(deciWatts > 0.0f)) {
+    return 0;
+  }
+  return deciWatts >= 65535.0f ? 65535 : static_cast<uint16_t>(deciWatts);
+}
+
+void beginBinary(BinaryStreamWriter &out,
+                 BinaryKind kind,
+                 uint16_t headerSize,
+                 uint8_t resolution,
+                 unsigned long periodSeconds) {
+  out.begin(200);
+  out.u8(kBinaryVersion);
+  out.u8(static_cast<uint8_t>(kind));
+  out.u16(headerSize);
+  out.u16(binaryRecordSize(kind));
+  out.u8(resolution);
+  out.u8(0);
+  out.u32(periodSeconds);
+}
+
+bool parseUnsigned(const String &value, unsigned long &out) {
+  const char *cstr = value.c_str();
+  if (cstr == nullptr || *cstr == '\0') {
+    return false;
+  }
+  char *endPtr = nullptr;
+  unsigned long parsed = strtoul(cstr, &endPtr, 10);
+  if (endPtr == cstr) {
+    return false;
+  }
+  out = parsed;
+  return true;
+}
+
+bool parseFloat(const char *text, float &out) {
+  char *endPtr = nullptr;
+  float parsed = strtof(text, &endPtr);
+  if (endPtr == text || !isfinite(parsed)) {
+    return false;
+  }
+  out = parsed;
+  return true;
+}
+
+/** Parses a whole decimal integer; anything after the digits rejects it. */
+bool parseLong(const char *text, long &out) {
+  char *endPtr = nullptr;
+  long parsed = strtol(text, &endPtr, 10);
+  if (endPtr == text || *endPtr != '\0') {
+    return false;
+  }
+  out = parsed;
+  return true;
+}
+
+/** Describes a failed parse of config field `name` in `error` unless it already holds one. */
+bool acceptParse(const char *name,
+                 const scheduler::ScheduleParseResult &parsed,
+                 char *error,
+                 size_t errorSize) {
+  if (parsed.ok()) {
+    return true;
+  }
+  if (error[0] == '\0') {
+    snprintf(error, errorSize, "%s: %s at character %u", name,
+             scheduler::scheduleErrorMessage(parsed.error),
+             static_cast<unsigned>(parsed.position + 1));
+  }
+  return false;
+}
+
+/**
+ * Parses the schedule text of config field `name`. On failure the first
+ * rejection of the request is described in `error`, which starts out empty.
+ */
+bool parseScheduleField(const char *name,
+                        const char *value,
+                        scheduler::ScheduleEntry *entries,
+                        size_t &count,
+                        char *error,
+                        size_t errorSize) {
+  scheduler::ScheduleParseResult parsed = scheduler::parseSchedule(
+      value, strlen(value), entries, scheduler::ScheduleManager::kMaxEntries);
+  count = parsed.count;
+  return acceptParse(name, parsed, error, errorSize);
+}
+
+/** Like parseScheduleField(), for the dated overrides; an empty value parses to none. */
+bool parseOverridesField(const char *name,
+                         const char *value,
+                         scheduler::DayOverride *overrides,
+                         size_t &count,
+                         char *error,
+                         size_t errorSize) {
+  scheduler::ScheduleParseResult parsed = scheduler::parseDayOverrides(
+      value, strlen(value), overrides, scheduler::ScheduleManager::kMaxDayOverrides);
+  count = parsed.count;
+  return acceptParse(name, parsed, error, errorSize);
+}
+
+// Fields accepted by /api/config besides the per-day schedule profiles
+// (sun..sat, holiday), which are matched against scheduler::scheduleProfileName().
+enum class ConfigField : uint8_t {
+  kTarget,
+  kHysteresis,
+  kCompressorTempLimit,
+  kCompressorMinAmbient,
+  kCompressorCooldownTemp,
+  kCompressorCooldownMinutes,
+  kFanMode,
+  kSystemMode,
+  kScheduling,
+  kScheduleIgnoreMinutes,
+  kWeekday,
+  kWeekend,
+  kOverrides,
+  kTimezoneOffset,
+};
+
+struct ConfigKey {
+  const char *name;
+  ConfigField field;
+};
+
+const ConfigKey kConfigKeys[] = {
+    {"target", ConfigField::kTarget},
+    {"hysteresis", ConfigField::kHysteresis},
+    {"compressorTempLimit", ConfigField::kCompressorTempLimit},
+    {"compressorMinAmbient", ConfigField::kCompressorMinAmbient},
+    {"compressorCooldownTemp", ConfigField::kCompressorCooldownTemp},
+    {"compressorCooldownMinutes", ConfigField::kCompressorCooldownMinutes},
+    {"fanMode", ConfigField::kFanMode},
+    {"systemMode", ConfigField::kSystemMode},
+    {"scheduling", ConfigField::kScheduling},
+    {"scheduleIgnoreMinutes", ConfigField::kScheduleIgnoreMinutes},
+    {"weekday", ConfigField::kWeekday},
+    {"weekend", ConfigField::kWeekend},
+    {"overrides", ConfigField::kOverrides},
+    {"timezoneOffset", ConfigField::kTimezoneOffset},
+};
+
+const ConfigKey *findConfigKey(const char *name) {
+  for (const ConfigKey &key : kConfigKeys) {
+    if (strcmp(key.name, name) == 0) {
+      return &key;
+    }
+  }
+  return nullptr;
+}
+
+/** The parts of /api/state after the status, written in this order. */
+enum class StatePart : uint8_t {
+  kSchedules,
+  kProfiles,
+  kTemperatureHead,
+  kTemperatureRows,
+  kPowerHead,
+  kPowerRows,
+  kEnd,
+};
+
+/** How far a streamed /api/state response has got. */
+struct StateStream {
+  StatePart part;
+  uint8_t profile;
+  bool temperature;  // Whether the response carries each log at all.
+  bool temperatureReplace;
+  bool power;
+  bool powerReplace;
+  logging::RowCursor temperatureRows;
+  logging::RowCursor powerRows;
+};
+
+/**
+ * A /api/power-log request and how far its response has got. Everything
+ * the trailer reports about the range is taken when the request arrives,
+ * so it matches the rows even if the log moves on while they are sent.
+ */
+struct PowerLogStream {
+  explicit PowerLogStream(const logging::GroupWindow &groupWindow) : window(groupWindow) {}
+
+  /** The newest bucket is still filling; average over the time it covers so far. */
+  unsigned long coveredSeconds(unsigned long timestamp) const {
+    if (liveEnd > timestamp && liveEnd - timestamp < period) {
+      return liveEnd - timestamp;
+    }
+    return period;
+  }
+
+  void countRow(unsigned long timestamp) {
+    if (appended == 0) {
+      filteredStart = timestamp;
+    }
+    filteredEnd = timestamp;
+    ++appended;
+  }
+
+  logging::PowerLog::Resolution resolution = logging::PowerLog::Resolution::kMinute;
+  unsigned long period = 0;
+  unsigned long liveEnd = 0;
+  unsigned long start = 0;
+  unsigned long end = 0;
+  bool hasStart = false;
+  bool hasEnd = false;
+  unsigned long rangeStart = 0;
+  unsigned long rangeEnd = 0;
+  unsigned long points = 0;
+  bool hasEntries = false;
+  unsigned long earliest = 0;
+  unsigned long latest = 0;
+  size_t available = 0;
+  bool hasRange = false;
+  float rangeStartWh = 0.0f;
+  float rangeEndWh = 0.0f;
+
+  logging::GroupWindow window;
+  logging::PowerGroup group;
+  logging::RowCursor rows{0, 0};  // Minute rows, when the response lists them.
+  logging::BucketCursor buckets{0, 0, false};
+  size_t appended = 0;
+  unsigned long filteredStart = 0;
+  unsigned long filteredEnd = 0;
+};
+
+/**
+ * Adds the next buckets of `stream` to its groups and hands each one that
+ * is complete to `emit`, the last one once the range runs out. Returns
+ * false when there is nothing left to emit.
+ */
+template <typename Emit>
+bool nextPowerGroups(const logging::PowerLog &log, PowerLogStream &stream, Emit emit) {
+  bool more = logging::nextRollups(
+      log, stream.resolution, stream.buckets, kStreamRows,
+      [&](const logging::PowerLog::Rollup &bucket) {
+        if (stream.window.opensGroup(bucket.timestamp) && !stream.group.empty()) {
+          emit(stream.group);
+          stream.group.clear();
+        }
+        stream.group.add(bucket, stream.coveredSeconds(bucket.timestamp));
+      });
+  if (!more && !stream.group.empty()) {
+    emit(stream.group);
+    stream.group.clear();
+    return true;
+  }
+  return more;
+}
+
+/** How far a streamed /api/temperature-history response has got. */
+struct TemperatureStream {
+  logging::TemperatureLog::Resolution resolution;
+  logging::GroupWindow window;
+  logging::TemperatureGroup group;
+  logging::BucketCursor buckets;
+};
+
+/** Like nextPowerGroups(), for the temperature buckets. */
+template <typename Emit>
+bool nextTemperatureGroups(const logging::TemperatureLog &log,
+                           TemperatureStream &stream,
+                           Emit emit) {
+  bool more = logging::nextRollups(
+      log, stream.resolution, stream.buckets, kStreamRows,
+      [&](const logging::TemperatureLog::Rollup &bucket) {
+        if (stream.window.opensGroup(bucket.timestamp) && !stream.group.empty()) {
+          emit(stream.group.result());
+          stream.group.clear();
+        }
+        stream.group.add(bucket);
+      });
+  if (!more && !stream.group.empty()) {
+    emit(stream.group.result());
+    stream.group.clear();
+    return true;
+  }
+  return more;
+}
+}  // namespace
+
 WebInterface::WebInterface(controller::HVACController &controller,
                            scheduler::ScheduleManager &schedule,
                            logging::TemperatureLog &temperatureLog,
@@ -23,79 +452,213 @@ WebInterface::WebInterface(controller::HVACController &controller,
       server_(port) {}
 
 void WebInterface::begin() {
+  bootId_ = ESP.random();
+  static const char *kCollectedHeaders[] = {"If-None-Match"};
+  server_.collectHeaders(kCollectedHeaders, sizeof(kCollectedHeaders) / sizeof(kCollectedHeaders[0]));
   registerRoutes();
   server_.begin();
   Serial.println(F("Web interface started."));
 }
 
-void WebInterface::handleClient() { server_.handleClient(); }
+void WebInterface::handleClient() {
+  server_.poll();
+  if (configEventPending_) {
+    // Several setters fire per config POST; subscribers get one event.
+    configEventPending_ = false;
+    char payload[24];
+    snprintf(payload, sizeof(payload), "{\"seq\":%lu}",
+             static_cast<unsigned long>(tracking::ChangeSequence::current()));
+    events_.publish("config", payload);
+  }
+  events_.poll();
+}
+
+void WebInterface::publishControllerEvent(controller::ControllerEvent event) {
+  if (events_.subscriberCount() == 0) {
+    return;
+  }
+  switch (event) {
+    case controller::ControllerEvent::kStatusChanged:
+      publishStatusEvent();
+      break;
+    case controller::ControllerEvent::kConfigChanged:
+      configEventPending_ = true;
+      break;
+    case controller::ControllerEvent::kLogRowCompleted:
+      publishLogEvent();
+      break;
+  }
+}
 
 void WebInterface::registerRoutes() {
-  server_.on("/", HTTP_GET, [this]() { serveIndex(); });
-  server_.on("/api/state", HTTP_GET, [this]() { handleState(); });
-  server_.on("/api/config", HTTP_POST, [this]() { handleConfig(); });
-  server_.on("/api/power-log", HTTP_GET, [this]() { handlePowerLog(); });
-  server_.on("/api/power-log", HTTP_DELETE, [this]() { handlePowerLogReset(); });
+  server_.on("/", HttpMethod::kGet, [this]() { serveIndex(); });
+  server_.on("/api/state", HttpMethod::kGet, [this]() { handleState(); });
+  server_.on("/api/config", HttpMethod::kPost, [this]() { handleConfig(); });
+  server_.on("/api/power-log", HttpMethod::kGet, [this]() { handlePowerLog(); });
+  server_.on("/api/power-log", HttpMethod::kDelete, [this]() { handlePowerLogReset(); });
+  server_.on("/api/temperature-history", HttpMethod::kGet, [this]() { handleTemperatureHistory(); });
+  server_.on("/api/events", HttpMethod::kGet, [this]() { handleEvents(); });
+  server_.on("/api/metrics", HttpMethod::kGet, [this]() { handleMetrics(); });
+  server_.on("/api/metrics", HttpMethod::kDelete, [this]() { handleMetricsReset(); });
   server_.onNotFound([this]() { handleNotFound(); });
 }
 
 void WebInterface::serveIndex() {
-  server_.send_P(200, "text/html", kWebInterfaceHtml);
+  // The dashboard is embedded pre-compressed; the ETag changes whenever the
+  // asset does, so browsers revalidate and normally get an empty 304.
+  server_.sendHeader("ETag", kWebInterfaceHtmlEtag);
+  server_.sendHeader("Cache-Control", "no-cache");
+  if (server_.header("If-None-Match") == kWebInterfaceHtmlEtag) {
+    server_.send(304);
+    return;
+  }
+  server_.sendHeader("Content-Encoding", "gzip");
+  server_.send_P(200, "text/html", reinterpret_cast<PGM_P>(kWebInterfaceHtmlGzip),
+                 kWebInterfaceHtmlGzipLength);
 }
 
 void WebInterface::handleState() {
-  String json = "{";
-  json += "\"ssid\":\"" + WiFi.SSID() + "\"";
-  json += ",\"ip\":\"" + WiFi.localIP().toString() + "\"";
-  json += ",\"uptimeSeconds\":" + String(static_cast<unsigned long>(millis() / 1000UL));
-  json += ",\"target\":" + String(controller_.targetTemperature(), 2);
-  json += ",\"hysteresis\":" + String(controller_.hysteresis(), 2);
-  json += ",\"compressorTempLimit\":" + String(controller_.compressorTemperatureLimit(), 1);
-  json += ",\"compressorMinAmbient\":" + String(controller_.compressorMinimumAmbient(), 1);
-  json += ",\"compressorCooldownTemp\":" + String(controller_.compressorCooldownTemperature(), 1);
-  json += ",\"compressorCooldownMinutes\":" +
-          String(controller_.compressorCooldownDurationMinutes(), 2);
-  json += ",\"fanMode\":\"" + fanModeToString(controller_.fanMode()) + "\"";
-  json += ",\"systemMode\":\"" + systemModeToString(controller_.systemMode()) + "\"";
-  json += controller_.schedulingEnabled() ? ",\"scheduling\":true" : ",\"scheduling\":false";
-  if (controller_.scheduleIgnoreActive()) {
-    unsigned long remainingSeconds =
-        (controller_.scheduleIgnoreRemainingMs() + 500UL) / 1000UL;
-    json += ",\"scheduleIgnoreActive\":true";
-    json += ",\"scheduleIgnoreRemainingSeconds\":" +
-            String(static_cast<unsigned long>(remainingSeconds));
-  } else {
-    json += ",\"scheduleIgnoreActive\":false";
-    json += ",\"scheduleIgnoreRemainingSeconds\":0";
+  // Clients that pass back the boot id and sequence of their last response get
+  // only the groups and log rows that changed since, or 304 if nothing did.
+  uint32_t sequence = tracking::ChangeSequence::current();
+  bool delta = false;
+  uint32_t since = 0;
+  unsigned long requestedBoot = 0;
+  unsigned long requestedSince = 0;
+  if (parseUnsigned(server_.arg("boot"), requestedBoot) && requestedBoot == bootId_ &&
+      parseUnsigned(server_.arg("since"), requestedSince) && requestedSince <= sequence) {
+    delta = true;
+    since = static_cast<uint32_t>(requestedSince);
   }
-  json += controller_.compressorRunning() ? ",\"compressor\":true" : ",\"compressor\":false";
-  float compressorTimeoutSeconds =
-      static_cast<float>(controller_.compressor().restartDelayRemaining()) / 1000.0f;
-  json += ",\"compressorTimeout\":" + String(compressorTimeoutSeconds, 1);
-  float compressorOffTimeoutSeconds =
-      static_cast<float>(controller_.compressor().minimumRuntimeRemaining()) / 1000.0f;
-  json += ",\"compressorOffTimeout\":" + String(compressorOffTimeoutSeconds, 1);
-  json += controller_.compressorCooldownActive() ? ",\"compressorCooldown\":true"
-                                                 : ",\"compressorCooldown\":false";
-  float cooldownRemainingSeconds =
-      static_cast<float>(controller_.compressorCooldownRemainingMs()) / 1000.0f;
-  json += ",\"compressorCooldownRemaining\":" + String(cooldownRemainingSeconds, 1);
-  json += ",\"fanSpeed\":\"" + fanSpeedToString(controller_.fan().currentSpeed()) + "\"";
 
-  const controller::SensorManager &sensors = controller_.sensors();
-  if (sensors.hasAmbient()) {
-    json += ",\"ambient\":" + String(sensors.ambient().value, 2);
+  bool configChanged = !delta || controller_.configRevision() > since;
+  bool statusChanged = !delta || controller_.statusRevision() > since;
+  bool scheduleChanged = !delta || schedule_.revision() > since;
+  bool temperatureReplace = true;
+  size_t temperatureRows = delta ? temperatureLog_.rowsChangedSince(since, temperatureReplace)
+                                 : temperatureLog_.size();
+  bool powerReplace = true;
+  size_t powerRows = delta ? powerLog_.rowsChangedSince(since, powerReplace) : powerLog_.size();
+
+  if (delta && !configChanged && !statusChanged && !scheduleChanged && temperatureRows == 0 &&
+      powerRows == 0) {
+    server_.send(304);
+    return;
   }
-  if (sensors.hasCoil()) {
-    json += ",\"coil\":" + String(sensors.coil().value, 2);
+
+  JsonStreamWriter json(server_);
+  json.begin(200);
+  json.beginObject();
+  json.field("boot", static_cast<unsigned long>(bootId_));
+  json.field("seq", static_cast<unsigned long>(sequence));
+  if (delta) {
+    json.field("delta", true);
+  }
+  appendConnection(json);
+  if (configChanged) {
+    appendConfig(json);
+  }
+  if (statusChanged) {
+    appendStatus(json, delta);
   }
 
+  // The schedules and log rows can outgrow the send queue, so they follow
+  // a part at a time as the client reads them.
+  size_t temperatureTotal = temperatureLog_.size();
+  size_t temperatureFirst = temperatureTotal - min(temperatureTotal, min(temperatureRows,
+                                                                         kStateLogRows));
+  size_t powerTotal = powerLog_.size();
+  size_t powerFirst = powerTotal - min(powerTotal, min(powerRows, kStateLogRows));
+  StateStream stream;
+  stream.part = scheduleChanged ? StatePart::kSchedules : StatePart::kTemperatureHead;
+  stream.profile = 0;
+  stream.temperature = !delta || temperatureRows > 0;
+  stream.temperatureReplace = temperatureReplace;
+  stream.temperatureRows = logging::rowCursor(temperatureLog_, temperatureFirst, temperatureTotal);
+  stream.power = !delta || powerRows > 0;
+  stream.powerReplace = powerReplace;
+  stream.powerRows = logging::rowCursor(powerLog_, powerFirst, powerTotal);
+
+  server_.continueWith([this, json, stream]() mutable {
+    while (server_.hasRoom()) {
+      switch (stream.part) {
+        case StatePart::kSchedules:
+          json.field("timezoneOffset", schedule_.timezoneOffsetHours(), 2);
+          json.key("schedules");
+          json.beginObject();
+          stream.part = StatePart::kProfiles;
+          break;
+        case StatePart::kProfiles:
+          json.key(scheduler::scheduleProfileName(stream.profile));
+          appendSchedule(json, stream.profile);
+          if (++stream.profile == scheduler::ScheduleManager::kProfileCount) {
+            json.endObject();
+            json.key("overrides");
+            appendDayOverrides(json);
+            stream.part = StatePart::kTemperatureHead;
+          }
+          break;
+        case StatePart::kTemperatureHead:
+          stream.part = StatePart::kPowerHead;
+          if (stream.temperature) {
+            json.field("temperatureLogReset", stream.temperatureReplace);
+            json.key("temperatureLog");
+            json.beginArray();
+            stream.part = StatePart::kTemperatureRows;
+          }
+          break;
+        case StatePart::kTemperatureRows:
+          if (!logging::nextRows(temperatureLog_, stream.temperatureRows, kStreamRows,
+                                 [&](const logging::TemperatureLog::Entry &entry) {
+                                   appendTemperatureRow(json, entry);
+                                 })) {
+            json.endArray();
+            stream.part = StatePart::kPowerHead;
+          }
+          break;
+        case StatePart::kPowerHead:
+          stream.part = StatePart::kEnd;
+          if (stream.power) {
+            json.field("powerLogReset", stream.powerReplace);
+            json.key("powerLog");
+            json.beginArray();
+            stream.part = StatePart::kPowerRows;
+          }
+          break;
+        case StatePart::kPowerRows:
+          if (!logging::nextRows(powerLog_, stream.powerRows, kStreamRows,
+                                 [&](const logging::PowerLog::Entry &entry) {
+                                   appendPowerRow(json, entry);
+                                 })) {
+            json.endArray();
+            json.field("energyWh", powerLog_.totalEnergyWh(), 2);
+            stream.part = StatePart::kEnd;
+          }
+          break;
+        case StatePart::kEnd:
+          json.endObject();
+          json.end();
+          return true;
+      }
+    }
+    return false;
+  });
+}
+
+void WebInterface::appendConnection(JsonStreamWriter &json) const {
+  json.field("ssid", WiFi.SSID().c_str());
+  IPAddress ip = WiFi.localIP();
+  char ipBuffer[16];
+  snprintf(ipBuffer, sizeof(ipBuffer), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+  json.field("ip", ipBuffer);
+  json.field("uptimeSeconds", static_cast<unsigned long>(millis() / 1000UL));
+
   time_t now = time(nullptr);
   if (now > 0) {
     time_t adjusted = now + static_cast<time_t>(schedule_.timezoneOffsetMinutes()) * 60;
     struct tm *timeinfo = gmtime(&adjusted);
     if (timeinfo != nullptr) {
-      char buffer[25];
+      char buffer[64];
       snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02d:%02d:%02d",
                timeinfo->tm_year + 1900,
                timeinfo->tm_mon + 1,
@@ -103,118 +666,198 @@ void WebInterface::handleState() {
                timeinfo->tm_hour,
                timeinfo->tm_min,
                timeinfo->tm_sec);
-      json += ",\"currentTime\":\"" + String(buffer) + "\"";
+      json.field("currentTime", buffer);
     }
-    json += ",\"currentTimeEpoch\":" + String(static_cast<unsigned long>(now));
+    json.field("currentTimeEpoch", static_cast<unsigned long>(now));
   }
+  // Log times are provisional until the clock has been set.
+  json.field("clockSynced", controller_.logClock().synced());
+}
 
-  json += ",\"timezoneOffset\":" + String(schedule_.timezoneOffsetHours(), 2);
-
-  appendTemperatureLog(json, 30);
-  appendPowerLog(json, 30);
+void WebInterface::appendConfig(JsonStreamWriter &json) const {
+  json.temperatureField("target", controller_.targetTemperature());
+  json.temperatureField("hysteresis", controller_.hysteresis());
+  json.temperatureField("compressorTempLimit", controller_.compressorTemperatureLimit(), 1);
+  json.temperatureField("compressorMinAmbient", controller_.compressorMinimumAmbient(), 1);
+  json.temperatureField("compressorCooldownTemp", controller_.compressorCooldownTemperature(), 1);
+  json.field("compressorCooldownMinutes", controller_.compressorCooldownDurationMinutes(), 2);
+  json.field("fanMode", scheduler::fanModeName(controller_.fanMode()));
+  json.field("systemMode", scheduler::systemModeName(controller_.systemMode()));
+  json.field("scheduling", controller_.schedulingEnabled());
+}
 
-  size_t weekdayCount = 0;
-  const scheduler::ScheduleEntry *weekday = schedule_.weekdayEntries(weekdayCount);
-  json += ",\"weekday\":[";
-  for (size_t i = 0; i < weekdayCount; ++i) {
-    if (i > 0) {
-      json += ",";
-    }
-    String hourStr = weekday[i].hour < 10 ? "0" + String(weekday[i].hour)
-                                          : String(weekday[i].hour);
-    String minuteStr = weekday[i].minute < 10 ? "0" + String(weekday[i].minute)
-                                              : String(weekday[i].minute);
-    json += "{\"time\":\"" + hourStr + ":" + minuteStr +
-            "\",\"temp\":" + String(weekday[i].temperature, 1);
-    json += ",\"mode\":";
-    if (weekday[i].mode == scheduler::ScheduledMode::kUnspecified) {
-      json += "null";
-    } else {
-      json += "\"" + scheduleModeToString(weekday[i].mode) + "\"";
-    }
-    json += "}";
+void WebInterface::appendStatus(JsonStreamWriter &json, bool delta) const {
+  if (controller_.scheduleIgnoreActive()) {
+    unsigned long remainingSeconds =
+        (controller_.scheduleIgnoreRemainingMs() + 500UL) / 1000UL;
+    json.field("scheduleIgnoreActive", true);
+    json.field("scheduleIgnoreRemainingSeconds", remainingSeconds);
+  } else {
+    json.field("scheduleIgnoreActive", false);
+    json.field("scheduleIgnoreRemainingSeconds", 0UL);
   }
-  json += "]";
+  json.field("compressor", controller_.compressorRunning());
+  float compressorTimeoutSeconds =
+      static_cast<float>(controller_.compressor().restartDelayRemaining()) / 1000.0f;
+  json.field("compressorTimeout", compressorTimeoutSeconds, 1);
+  float compressorOffTimeoutSeconds =
+      static_cast<float>(controller_.compressor().minimumRuntimeRemaining()) / 1000.0f;
+  json.field("compressorOffTimeout", compressorOffTimeoutSeconds, 1);
+  json.field("compressorCooldown", controller_.compressorCooldownActive());
+  float cooldownRemainingSeconds =
+      static_cast<float>(controller_.compressorCooldownRemainingMs()) / 1000.0f;
+  json.field("compressorCooldownRemaining", cooldownRemainingSeconds, 1);
+  json.field("fanSpeed", fanSpeedToString(controller_.fan().currentSpeed()));
 
-  size_t weekendCount = 0;
-  const scheduler::ScheduleEntry *weekend = schedule_.weekendEntries(weekendCount);
-  json += ",\"weekend\":[";
-  for (size_t i = 0; i < weekendCount; ++i) {
-    if (i > 0) {
-      json += ",";
-    }
-    String hourStr = weekend[i].hour < 10 ? "0" + String(weekend[i].hour)
-                                          : String(weekend[i].hour);
-    String minuteStr = weekend[i].minute < 10 ? "0" + String(weekend[i].minute)
-                                              : String(weekend[i].minute);
-    json += "{\"time\":\"" + hourStr + ":" + minuteStr +
-            "\",\"temp\":" + String(weekend[i].temperature, 1);
-    json += ",\"mode\":";
-    if (weekend[i].mode == scheduler::ScheduledMode::kUnspecified) {
-      json += "null";
-    } else {
-      json += "\"" + scheduleModeToString(weekend[i].mode) + "\"";
-    }
-    json += "}";
+  // A full response omits missing readings; a delta sends null so the client
+  // drops a reading that has gone away.
+  const controller::SensorManager &sensors = controller_.sensors();
+  if (sensors.hasAmbient()) {
+    json.temperatureField("ambient", sensors.ambient().value);
+  } else if (delta) {
+    json.key("ambient");
+    json.null();
+  }
+  if (sensors.hasCoil()) {
+    json.temperatureField("coil", sensors.coil().value);
+  } else if (delta) {
+    json.key("coil");
+    json.null();
   }
-  json += "]";
-
-  json += "}";
-  server_.send(200, "application/json", json);
 }
 
 void WebInterface::handleConfig() {
-  if (server_.hasArg("target")) {
-    controller_.setTargetTemperature(server_.arg("target").toFloat());
-  }
-  if (server_.hasArg("hysteresis")) {
-    controller_.setHysteresis(server_.arg("hysteresis").toFloat());
+  // Fields are applied in the order they arrive, query arguments first, and
+  // read in place from the request buffers: nothing is copied or allocated.
+  // A schedule that does not parse is left as it was and reported below.
+  char rejected[80] = "";
+  for (size_t i = 0; i < server_.args(); ++i) {
+    applyConfigField(server_.argName(i), server_.argValue(i), rejected, sizeof(rejected));
   }
-  if (server_.hasArg("compressorTempLimit")) {
-    controller_.setCompressorTemperatureLimit(server_.arg("compressorTempLimit").toFloat());
+  FieldReader body(server_.body(), server_.bodyLength());
+  const char *name = nullptr;
+  const char *value = nullptr;
+  while (body.next(name, value)) {
+    applyConfigField(name, value, rejected, sizeof(rejected));
   }
-  if (server_.hasArg("compressorMinAmbient")) {
-    controller_.setCompressorMinimumAmbient(server_.arg("compressorMinAmbient").toFloat());
-  }
-  if (server_.hasArg("compressorCooldownTemp")) {
-    controller_.setCompressorCooldownTemperature(server_.arg("compressorCooldownTemp").toFloat());
-  }
-  if (server_.hasArg("compressorCooldownMinutes")) {
-    controller_.setCompressorCooldownDurationMinutes(
-        server_.arg("compressorCooldownMinutes").toFloat());
-  }
-  if (server_.hasArg("fanMode")) {
-    controller_.setFanMode(fanModeFromString(server_.arg("fanMode")));
-  }
-  if (server_.hasArg("systemMode")) {
-    controller_.setSystemMode(systemModeFromString(server_.arg("systemMode")));
+
+  // Whatever was applied is persisted by SettingsStorage::update() once the edits settle.
+  if (body.malformed()) {
+    JsonStreamWriter::sendMessage(server_, 400, "error", "malformed request body");
+    return;
   }
-  if (server_.hasArg("scheduling")) {
-    controller_.enableScheduling(server_.arg("scheduling") == "true");
+  if (rejected[0] != '\0') {
+    JsonStreamWriter::sendMessage(server_, 400, "error", rejected);
+    return;
   }
-  if (server_.hasArg("scheduleIgnoreMinutes")) {
-    int minutes = server_.arg("scheduleIgnoreMinutes").toInt();
-    if (minutes <= 0) {
-      controller_.ignoreScheduleForMinutes(0);
-    } else {
-      controller_.ignoreScheduleForMinutes(static_cast<uint16_t>(min(minutes, 1440)));
+  JsonStreamWriter::sendMessage(server_, 200, "status", "ok");
+}
+
+void WebInterface::applyConfigField(const char *name,
+                                    const char *value,
+                                    char *error,
+                                    size_t errorSize) {
+  scheduler::ScheduleEntry entries[scheduler::ScheduleManager::kMaxEntries];
+  size_t count = 0;
+  for (uint8_t profile = 0; profile < scheduler::ScheduleManager::kProfileCount; ++profile) {
+    if (strcmp(name, scheduler::scheduleProfileName(profile)) == 0) {
+      // Unlike the weekday/weekend shortcuts an empty profile is accepted and clears the day.
+      if (parseScheduleField(name, value, entries, count, error, errorSize)) {
+        schedule_.setDaySchedule(profile, entries, count);
+      }
+      return;
     }
   }
-  if (server_.hasArg("weekday")) {
-    updateScheduleFromArg(server_.arg("weekday"), &scheduler::ScheduleManager::setWeekdaySchedule);
-  }
-  if (server_.hasArg("weekend")) {
-    updateScheduleFromArg(server_.arg("weekend"), &scheduler::ScheduleManager::setWeekendSchedule);
-  }
-  if (server_.hasArg("timezoneOffset")) {
-    schedule_.setTimezoneOffsetHours(server_.arg("timezoneOffset").toFloat());
+  const ConfigKey *key = findConfigKey(name);
+  if (key == nullptr) {
+    return;
   }
 
-  if (settings_ != nullptr) {
-    settings_->save(controller_, schedule_);
+  // Numbers and mode names that do not parse are ignored rather than read as a default.
+  float number = 0.0f;
+  switch (key->field) {
+    case ConfigField::kTarget:
+      if (parseFloat(value, number)) {
+        controller_.setTargetTemperature(units::fromCelsius(number));
+      }
+      break;
+    case ConfigField::kHysteresis:
+      if (parseFloat(value, number)) {
+        controller_.setHysteresis(units::fromCelsius(number));
+      }
+      break;
+    case ConfigField::kCompressorTempLimit:
+      if (parseFloat(value, number)) {
+        controller_.setCompressorTemperatureLimit(units::fromCelsius(number));
+      }
+      break;
+    case ConfigField::kCompressorMinAmbient:
+      if (parseFloat(value, number)) {
+        controller_.setCompressorMinimumAmbient(units::fromCelsius(number));
+      }
+      break;
+    case ConfigField::kCompressorCooldownTemp:
+      if (parseFloat(value, number)) {
+        controller_.setCompressorCooldownTemperature(units::fromCelsius(number));
+      }
+      break;
+    case ConfigField::kCompressorCooldownMinutes:
+      if (parseFloat(value, number)) {
+        controller_.setCompressorCooldownDurationMinutes(number);
+      }
+      break;
+    case ConfigField::kFanMode: {
+      controller::FanMode mode = controller::FanMode::kAuto;
+      if (scheduler::fanModeFromName(value, strlen(value), mode)) {
+        controller_.setFanMode(mode);
+      }
+      break;
+    }
+    case ConfigField::kSystemMode: {
+      controller::SystemMode mode = controller::SystemMode::kCooling;
+      if (scheduler::systemModeFromName(value, strlen(value), mode)) {
+        controller_.setSystemMode(mode);
+      }
+      break;
+    }
+    case ConfigField::kScheduling:
+      controller_.enableScheduling(strcmp(value, "true") == 0);
+      break;
+    case ConfigField::kScheduleIgnoreMinutes: {
+      long minutes = 0;
+      if (!parseLong(value, minutes)) {
+        break;
+      }
+      if (minutes <= 0) {
+        controller_.ignoreScheduleForMinutes(0);
+      } else {
+        controller_.ignoreScheduleForMinutes(static_cast<uint16_t>(min(minutes, 1440L)));
+      }
+      break;
+    }
+    case ConfigField::kWeekday:
+      if (parseScheduleField(name, value, entries, count, error, errorSize) && count > 0) {
+        schedule_.setWeekdaySchedule(entries, count);
+      }
+      break;
+    case ConfigField::kWeekend:
+      if (parseScheduleField(name, value, entries, count, error, errorSize) && count > 0) {
+        schedule_.setWeekendSchedule(entries, count);
+      }
+      break;
+    case ConfigField::kOverrides: {
+      scheduler::DayOverride overrides[scheduler::ScheduleManager::kMaxDayOverrides];
+      if (parseOverridesField(name, value, overrides, count, error, errorSize)) {
+        schedule_.setDayOverrides(overrides, count);
+      }
+      break;
+    }
+    case ConfigField::kTimezoneOffset:
+      if (parseFloat(value, number)) {
+        schedule_.setTimezoneOffsetHours(number);
+      }
+      break;
   }
-
-  server_.send(200, "application/json", "{\"status\":\"ok\"}");
 }
 
 void WebInterface::handlePowerLog() {
@@ -223,201 +866,532 @@ void WebInterface::handlePowerLog() {
   bool hasStart = false;
   bool hasEnd = false;
 
-  auto parseUnsigned = [](const String &value, unsigned long &out) -> bool {
-    const char *cstr = value.c_str();
-    if (cstr == nullptr || *cstr == '\0') {
-      return false;
-    }
-    char *endPtr = nullptr;
-    unsigned long parsed = strtoul(cstr, &endPtr, 10);
-    if (endPtr == cstr) {
-      return false;
-    }
-    out = parsed;
-    return true;
-  };
-
   if (server_.hasArg("start")) {
     hasStart = parseUnsigned(server_.arg("start"), start);
   }
   if (server_.hasArg("end")) {
     hasEnd = parseUnsigned(server_.arg("end"), end);
   }
+  unsigned long rangeStart = hasStart ? start : 0;
+  unsigned long rangeEnd = hasEnd ? end : ULONG_MAX;
 
-  String json = "{";
-  json += "\"entries\":[";
+  // Without a resolution the per-minute rows are returned as before; longer
+  // ranges ask for hourly, daily or monthly buckets instead.
+  using Resolution = logging::PowerLog::Resolution;
+  Resolution resolution = Resolution::kMinute;
+  unsigned long resolutionSeconds = 0;
+  if (parseUnsigned(server_.arg("resolution"), resolutionSeconds)) {
+    resolution = powerLog_.selectResolution(rangeStart, resolutionSeconds);
+  }
+  unsigned long period = logging::PowerLog::periodSeconds(resolution);
 
-  size_t appended = 0;
-  const size_t totalCount = powerLog_.size();
-  bool hasEarliest = false;
   unsigned long earliest = 0;
   unsigned long latest = 0;
-  bool baselineSet = false;
-  float baselineEnergy = 0.0f;
-  bool startEnergySet = false;
-  float startEnergy = 0.0f;
-  bool endEnergySet = false;
-  float endEnergy = 0.0f;
-  bool filteredStartSet = false;
-  unsigned long filteredStart = 0;
-  unsigned long filteredEnd = 0;
+  bool hasEntries = powerLog_.timeSpan(resolution, earliest, latest);
 
-  powerLog_.forEach([&](const logging::PowerLog::Entry &entry) {
-    if (!hasEarliest) {
-      earliest = entry.timestamp;
-      hasEarliest = true;
-    }
-    latest = entry.timestamp;
+  // With points=N consecutive buckets are merged so at most N rows come back.
+  unsigned long points = 0;
+  parseUnsigned(server_.arg("points"), points);
+  PowerLogStream stream(logging::GroupWindow(
+      hasEntries && earliest > rangeStart ? earliest : rangeStart,
+      hasEntries && latest < rangeEnd ? latest : rangeEnd, period, points));
+  stream.resolution = resolution;
+  stream.period = period;
+  logging::PowerLog::Entry latestMinute;
+  if (powerLog_.latestEntry(latestMinute)) {
+    stream.liveEnd = latestMinute.timestamp + logging::PowerLog::kMinuteSeconds;
+  }
+  stream.start = start;
+  stream.end = end;
+  stream.hasStart = hasStart;
+  stream.hasEnd = hasEnd;
+  stream.rangeStart = rangeStart;
+  stream.rangeEnd = rangeEnd;
+  stream.points = points;
+  stream.hasEntries = hasEntries;
+  stream.earliest = earliest;
+  stream.latest = latest;
+  stream.available = powerLog_.size(resolution);
+  // Range totals come from two counter lookups, independent of row count.
+  stream.hasRange = powerLog_.energyRange(rangeStart, rangeEnd, stream.rangeStartWh,
+                                          stream.rangeEndWh);
+  stream.rows = logging::rowCursor(powerLog_, powerLog_.lowerBound(rangeStart),
+                                   powerLog_.upperBound(rangeEnd));
+  stream.buckets = logging::BucketCursor{rangeStart, rangeEnd, false};
 
-    if (hasEnd && entry.timestamp > end) {
-      return;
-    }
+  // The rows follow a few at a time as the client reads them.
+  if (server_.arg("format") == "bin") {
+    BinaryKind kind = points == 0 && resolution == Resolution::kMinute ? BinaryKind::kPowerRows
+                                                                       : BinaryKind::kPowerBuckets;
+    BinaryStreamWriter out(server_);
+    beginBinary(out, kind, kBinaryPowerHeaderSize, static_cast<uint8_t>(resolution),
+                stream.window.widthSeconds());
+    out.u32(static_cast<uint32_t>(stream.available));
+    out.u32(hasEntries ? earliest : 0xFFFFFFFFUL);
+    out.u32(hasEntries ? latest : 0xFFFFFFFFUL);
+    out.f32(powerLog_.totalEnergyWh());
+    out.f32(stream.hasRange ? stream.rangeStartWh : NAN);
+    out.f32(stream.hasRange ? stream.rangeEndWh : NAN);
+    server_.continueWith([this, out, stream, kind]() mutable {
+      while (server_.hasRoom()) {
+        bool more = false;
+        if (kind == BinaryKind::kPowerRows) {
+          more = logging::nextRows(
+              powerLog_, stream.rows, kStreamRows, [&](const logging::PowerLog::Entry &entry) {
+                if (entry.timestamp < stream.rangeStart || entry.timestamp > stream.rangeEnd) {
+                  return;
+                }
+                out.u32(entry.timestamp);
+                out.f32(entry.energyWhAccumulated);
+                out.u16(toDeciWatts(entry.instantaneousWatts));
+                out.u8(static_cast<uint8_t>((static_cast<uint8_t>(entry.fanSpeed) & 0x03) |
+                                            (entry.compressorActive ? 0x04 : 0)));
+              });
+        } else {
+          // Without points every bucket is a group of its own.
+          more = nextPowerGroups(powerLog_, stream, [&](const logging::PowerGroup &group) {
+            out.u32(group.timestamp());
+            out.u32(group.coveredSeconds());
+            out.f32(group.energyWhStart());
+            out.f32(group.energyWhEnd());
+            out.u16(toDeciWatts(group.minWatts()));
+            out.u16(toDeciWatts(group.maxWatts()));
+          });
+        }
+        if (!more) {
+          out.end();
+          return true;
+        }
+      }
+      return false;
+    });
+    return;
+  }
 
-    if (hasStart && entry.timestamp < start) {
-      baselineEnergy = entry.energyWhAccumulated;
-      baselineSet = true;
-      return;
-    }
+  JsonStreamWriter json(server_);
+  json.begin(200);
+  json.beginObject();
+  json.field("resolution", powerResolutionToString(resolution));
+  json.field("periodSeconds", stream.window.widthSeconds());
+  json.key("entries");
+  json.beginArray();
+  server_.continueWith([this, json, stream]() mutable {
+    while (server_.hasRoom()) {
+      bool more = false;
+      if (stream.points > 0) {
+        more = nextPowerGroups(powerLog_, stream, [&](const logging::PowerGroup &group) {
+          json.beginObject();
+          json.field("t", group.timestamp());
+          json.field("wh", group.energyWhEnd(), 3);
+          json.field("watts", group.averageWatts(), 1);
+          json.field("wattsMin", group.minWatts(), 1);
+          json.field("wattsMax", group.maxWatts(), 1);
+          json.endObject();
+          stream.countRow(group.timestamp());
+        });
+      } else if (stream.resolution == Resolution::kMinute) {
+        more = logging::nextRows(
+            powerLog_, stream.rows, kStreamRows, [&](const logging::PowerLog::Entry &entry) {
+              if (entry.timestamp < stream.rangeStart || entry.timestamp > stream.rangeEnd) {
+                return;
+              }
+              json.beginObject();
+              json.field("t", entry.timestamp);
+              json.field("wh", entry.energyWhAccumulated, 3);
+              json.field("watts", entry.instantaneousWatts, 1);
+              json.field("fan", fanSpeedToString(entry.fanSpeed));
+              json.field("compressor", entry.compressorActive);
+              json.endObject();
+              stream.countRow(entry.timestamp);
+            });
+      } else {
+        more = logging::nextRollups(
+            powerLog_, stream.resolution, stream.buckets, kStreamRows,
+            [&](const logging::PowerLog::Rollup &bucket) {
+              unsigned long covered = stream.coveredSeconds(bucket.timestamp);
+              float energyWh = bucket.energyWhEnd - bucket.energyWhStart;
+              json.beginObject();
+              json.field("t", bucket.timestamp);
+              json.field("wh", bucket.energyWhEnd, 3);
+              json.field("watts", energyWh * 3600.0f / static_cast<float>(covered), 1);
+              json.endObject();
+              stream.countRow(bucket.timestamp);
+            });
+      }
+      if (more) {
+        continue;
+      }
+      json.endArray();
 
-    if (!startEnergySet) {
-      startEnergy = baselineSet ? baselineEnergy : entry.energyWhAccumulated;
-      startEnergySet = true;
-    }
+      unsigned long availableSpan = 0;
+      if (stream.hasEntries && stream.available > 1 && stream.latest >= stream.earliest) {
+        availableSpan = stream.latest - stream.earliest;
+      }
+      unsigned long filteredSpan = 0;
+      if (stream.appended > 1 && stream.filteredEnd >= stream.filteredStart) {
+        filteredSpan = stream.filteredEnd - stream.filteredStart;
+      }
 
-    if (!filteredStartSet) {
-      filteredStart = entry.timestamp;
-      filteredStartSet = true;
-    }
-    filteredEnd = entry.timestamp;
+      json.field("availableCount", static_cast<unsigned long>(stream.available));
+      json.field("filteredCount", static_cast<unsigned long>(stream.appended));
+      json.key("earliest");
+      if (stream.hasEntries) {
+        json.value(stream.earliest);
+      } else {
+        json.null();
+      }
+      json.key("latest");
+      if (stream.hasEntries) {
+        json.value(stream.latest);
+      } else {
+        json.null();
+      }
+      json.field("availableSpanSeconds", availableSpan);
+      json.field("filteredSpanSeconds", filteredSpan);
 
-    if (appended > 0) {
-      json += ",";
-    }
+      if (stream.hasStart) {
+        json.field("requestedStart", stream.start);
+      }
+      if (stream.hasEnd) {
+        json.field("requestedEnd", stream.end);
+      }
 
-    json += "{\"t\":" + String(entry.timestamp);
-    json += ",\"wh\":" + String(entry.energyWhAccumulated, 3);
-    json += ",\"watts\":" + String(entry.instantaneousWatts, 1);
-    json += ",\"fan\":\"" + fanSpeedToString(entry.fanSpeed) + "\"";
-    json += ",\"compressor\":";
-    json += entry.compressorActive ? "true" : "false";
-    json += "}";
+      if (stream.hasRange) {
+        json.field("baselineWh", stream.rangeStartWh, 3);
+        json.field("rangeStartEnergyWh", stream.rangeStartWh, 3);
+        json.field("rangeEndEnergyWh", stream.rangeEndWh, 3);
+        json.field("rangeEnergyWh", stream.rangeEndWh - stream.rangeStartWh, 3);
+      } else {
+        json.key("baselineWh");
+        json.null();
+        json.key("rangeStartEnergyWh");
+        json.null();
+        json.key("rangeEndEnergyWh");
+        json.null();
+        json.key("rangeEnergyWh");
+        json.null();
+      }
 
-    ++appended;
-    endEnergy = entry.energyWhAccumulated;
-    endEnergySet = true;
+      json.field("totalEnergyWh", powerLog_.totalEnergyWh(), 2);
+      json.endObject();
+      json.end();
+      return true;
+    }
+    return false;
   });
+}
 
-  json += "]";
+void WebInterface::handlePowerLogReset() {
+  powerLog_.clear();
+  JsonStreamWriter::sendMessage(server_, 200, "status", "ok");
+}
 
-  if (!startEnergySet && baselineSet) {
-    startEnergy = baselineEnergy;
-    startEnergySet = true;
-  }
-  if (!endEnergySet && startEnergySet) {
-    endEnergy = startEnergy;
-    endEnergySet = true;
+void WebInterface::handleTemperatureHistory() {
+  unsigned long end = controller_.logClock().now();
+  parseUnsigned(server_.arg("end"), end);
+  unsigned long start = end > kHistoryDefaultSpanSeconds ? end - kHistoryDefaultSpanSeconds : 0;
+  parseUnsigned(server_.arg("start"), start);
+  unsigned long points = 0;
+  parseUnsigned(server_.arg("points"), points);
+  unsigned long resolutionSeconds = 0;
+  if (!parseUnsigned(server_.arg("resolution"), resolutionSeconds) || resolutionSeconds == 0) {
+    // Without an explicit resolution aim for roughly kHistoryTargetPoints rows,
+    // or the requested number of points.
+    unsigned long target = points > 0 ? points : kHistoryTargetPoints;
+    resolutionSeconds = end > start ? (end - start) / target : 0;
   }
 
-  unsigned long availableSpan = 0;
-  if (hasEarliest && totalCount > 1 && latest >= earliest) {
-    availableSpan = latest - earliest;
-  }
-  unsigned long filteredSpan = 0;
-  if (filteredStartSet && appended > 1 && filteredEnd >= filteredStart) {
-    filteredSpan = filteredEnd - filteredStart;
+  logging::TemperatureLog::Resolution resolution =
+      temperatureLog_.selectResolution(start, resolutionSeconds);
+  unsigned long period = logging::TemperatureLog::periodSeconds(resolution);
+
+  // The chosen tier may still be finer than the points asked for; merge its
+  // buckets over the part of the range it actually holds.
+  unsigned long oldest = 0;
+  bool hasOldest = temperatureLog_.oldestTimestamp(resolution, oldest);
+  TemperatureStream stream{
+      resolution,
+      logging::GroupWindow(hasOldest && oldest > start ? oldest : start, end, period, points),
+      logging::TemperatureGroup(),
+      logging::BucketCursor{start, end, false}};
+
+  // The buckets follow a few at a time as the client reads them.
+  if (server_.arg("format") == "bin") {
+    BinaryStreamWriter out(server_);
+    beginBinary(out, BinaryKind::kTemperatureBuckets, kBinaryTemperatureHeaderSize,
+                static_cast<uint8_t>(resolution), stream.window.widthSeconds());
+    out.u32(start);
+    out.u32(end);
+    server_.continueWith([this, out, stream]() mutable {
+      while (server_.hasRoom()) {
+        if (!nextTemperatureGroups(temperatureLog_, stream,
+                                   [&](const logging::TemperatureLog::Rollup &bucket) {
+                                     out.u32(bucket.timestamp);
+                                     out.i16(bucket.ambientMin);
+                                     out.i16(bucket.ambientMax);
+                                     out.i16(bucket.ambientAverage);
+                                     out.i16(bucket.coilMin);
+                                     out.i16(bucket.coilMax);
+                                     out.i16(bucket.coilAverage);
+                                   })) {
+          out.end();
+          return true;
+        }
+      }
+      return false;
+    });
+    return;
   }
 
-  json += ",\"availableCount\":" + String(totalCount);
-  json += ",\"filteredCount\":" + String(appended);
-  json += ",\"earliest\":";
-  json += hasEarliest ? String(earliest) : String("null");
-  json += ",\"latest\":";
-  json += hasEarliest ? String(latest) : String("null");
-  json += ",\"availableSpanMs\":" + String(availableSpan);
-  json += ",\"filteredSpanMs\":" + String(filteredSpan);
+  JsonStreamWriter json(server_);
+  json.begin(200);
+  json.beginObject();
+  json.field("resolution", temperatureResolutionToString(resolution));
+  json.field("periodSeconds", stream.window.widthSeconds());
+  json.field("requestedStart", start);
+  json.field("requestedEnd", end);
+  json.key("entries");
+  json.beginArray();
+  server_.continueWith([this, json, stream]() mutable {
+    while (server_.hasRoom()) {
+      if (!nextTemperatureGroups(temperatureLog_, stream,
+                                 [&](const logging::TemperatureLog::Rollup &bucket) {
+                                   json.beginObject();
+                                   json.field("t", bucket.timestamp);
+                                   json.temperatureField("ambient", bucket.ambientAverage);
+                                   json.temperatureField("ambientMin", bucket.ambientMin);
+                                   json.temperatureField("ambientMax", bucket.ambientMax);
+                                   json.temperatureField("coil", bucket.coilAverage);
+                                   json.temperatureField("coilMin", bucket.coilMin);
+                                   json.temperatureField("coilMax", bucket.coilMax);
+                                   json.endObject();
+                                 })) {
+        json.endArray();
+        json.endObject();
+        json.end();
+        return true;
+      }
+    }
+    return false;
+  });
+}
 
-  if (hasStart) {
-    json += ",\"requestedStart\":" + String(start);
+void WebInterface::handleMetrics() {
+  if (loopMetrics_ == nullptr) {
+    JsonStreamWriter::sendMessage(server_, 404, "error", "Metrics unavailable");
+    return;
   }
-  if (hasEnd) {
-    json += ",\"requestedEnd\":" + String(end);
+  if (server_.arg("format") == "prometheus") {
+    sendPrometheusMetrics();
+    return;
   }
 
-  json += ",\"baselineWh\":";
-  if (baselineSet) {
-    json += String(baselineEnergy, 3);
-  } else if (startEnergySet) {
-    json += String(startEnergy, 3);
-  } else {
-    json += "null";
+  using diagnostics::LoopMetrics;
+  LoopMetrics::HeapStats heap = loopMetrics_->heap();
+  JsonStreamWriter json(server_);
+  json.begin(200);
+  json.beginObject();
+  json.field("uptimeMs", millis());
+  json.field("cpuMHz", static_cast<unsigned int>(ESP.getCpuFreqMHz()));
+  json.key("heap");
+  json.beginObject();
+  json.field("free", static_cast<unsigned long>(heap.freeBytes));
+  json.field("minFree", static_cast<unsigned long>(heap.minFreeBytes));
+  json.field("maxBlock", static_cast<unsigned long>(heap.maxBlockBytes));
+  json.field("fragmentation", static_cast<unsigned int>(heap.fragmentationPercent));
+  json.endObject();
+  const HttpServer::Stats &http = server_.stats();
+  json.key("http");
+  json.beginObject();
+  json.field("requests", static_cast<unsigned long>(http.requests));
+  json.field("rejected", static_cast<unsigned long>(http.rejected));
+  json.field("timeouts", static_cast<unsigned long>(http.timeouts));
+  json.field("throttled", static_cast<unsigned long>(http.throttled));
+  json.field("heldBack", static_cast<unsigned long>(http.heldBack));
+  json.field("openConnections", static_cast<unsigned long>(server_.openConnections()));
+  json.field("peakQueuedBytes", static_cast<unsigned long>(http.peakQueuedBytes));
+  json.endObject();
+  if (settings_ != nullptr) {
+    const storage::SettingsStorage::Stats &settings = settings_->stats();
+    json.key("settings");
+    json.beginObject();
+    json.field("writes", static_cast<unsigned long>(settings.writes));
+    json.field("skipped", static_cast<unsigned long>(settings.skipped));
+    json.field("failures", static_cast<unsigned long>(settings.failures));
+    json.field("pending", settings_->pending());
+    json.endObject();
   }
-
-  json += ",\"rangeStartEnergyWh\":";
-  if (startEnergySet) {
-    json += String(startEnergy, 3);
-  } else if (baselineSet) {
-    json += String(baselineEnergy, 3);
-  } else {
-    json += "null";
+  json.key("stages");
+  json.beginArray();
+  for (size_t i = 0; i < LoopMetrics::kStageCount; ++i) {
+    LoopMetrics::Stage stage = static_cast<LoopMetrics::Stage>(i);
+    const LoopMetrics::StageStats &stats = loopMetrics_->stats(stage);
+    json.beginObject();
+    json.field("name", LoopMetrics::stageName(stage));
+    json.field("count", static_cast<unsigned long>(stats.count));
+    json.field("minUs", static_cast<unsigned long>(stats.minUs));
+    json.field("maxUs", static_cast<unsigned long>(stats.maxUs));
+    json.field("meanUs", static_cast<unsigned long>(stats.count > 0 ? stats.totalUs / stats.count
+                                                                      : 0));
+    json.field("p50Us", static_cast<unsigned long>(loopMetrics_->percentileUs(stage, 0.5f)));
+    json.field("p99Us", static_cast<unsigned long>(loopMetrics_->percentileUs(stage, 0.99f)));
+    json.endObject();
   }
+  json.endArray();
+  json.endObject();
+  json.end();
+}
 
-  json += ",\"rangeEndEnergyWh\":";
-  if (endEnergySet) {
-    json += String(endEnergy, 3);
-  } else if (startEnergySet) {
-    json += String(startEnergy, 3);
-  } else if (baselineSet) {
-    json += String(baselineEnergy, 3);
-  } else {
-    json += "null";
+void WebInterface::handleMetricsReset() {
+  if (loopMetrics_ == nullptr) {
+    JsonStreamWriter::sendMessage(server_, 404, "error", "Metrics unavailable");
+    return;
   }
+  loopMetrics_->reset();
+  JsonStreamWriter::sendMessage(server_, 200, "status", "ok");
+}
 
-  json += ",\"totalEnergyWh\":" + String(powerLog_.totalEnergyWh(), 2);
-  json += "}";
+void WebInterface::sendPrometheusMetrics() {
+  using diagnostics::LoopMetrics;
+  LoopMetrics::HeapStats heap = loopMetrics_->heap();
+  TextStreamWriter text(server_);
+  text.begin(200, "text/plain; version=0.0.4");
+  text.printf("# HELP thn_uptime_seconds Time since boot.\n# TYPE thn_uptime_seconds gauge\n");
+  text.printf("thn_uptime_seconds %lu\n", millis() / 1000UL);
+  text.printf("# TYPE thn_heap_free_bytes gauge\nthn_heap_free_bytes %lu\n",
+              static_cast<unsigned long>(heap.freeBytes));
+  text.printf("# TYPE thn_heap_min_free_bytes gauge\nthn_heap_min_free_bytes %lu\n",
+              static_cast<unsigned long>(heap.minFreeBytes));
+  text.printf("# TYPE thn_heap_max_block_bytes gauge\nthn_heap_max_block_bytes %lu\n",
+              static_cast<unsigned long>(heap.maxBlockBytes));
+  text.printf("# TYPE thn_heap_fragmentation_percent gauge\nthn_heap_fragmentation_percent %u\n",
+              static_cast<unsigned int>(heap.fragmentationPercent));
+  const HttpServer::Stats &http = server_.stats();
+  text.printf("# TYPE thn_http_requests_total counter\nthn_http_requests_total %lu\n",
+              static_cast<unsigned long>(http.requests));
+  text.printf("# TYPE thn_http_rejected_total counter\nthn_http_rejected_total %lu\n",
+              static_cast<unsigned long>(http.rejected));
+  text.printf("# TYPE thn_http_timeouts_total counter\nthn_http_timeouts_total %lu\n",
+              static_cast<unsigned long>(http.timeouts));
+  text.printf("# TYPE thn_http_throttled_total counter\nthn_http_throttled_total %lu\n",
+              static_cast<unsigned long>(http.throttled));
+  text.printf("# TYPE thn_http_held_back_total counter\nthn_http_held_back_total %lu\n",
+              static_cast<unsigned long>(http.heldBack));
+  text.printf("# TYPE thn_http_peak_queued_bytes gauge\nthn_http_peak_queued_bytes %lu\n",
+              static_cast<unsigned long>(http.peakQueuedBytes));
+  if (settings_ != nullptr) {
+    const storage::SettingsStorage::Stats &settings = settings_->stats();
+    text.printf("# TYPE thn_settings_writes_total counter\nthn_settings_writes_total %lu\n",
+                static_cast<unsigned long>(settings.writes));
+    text.printf("# TYPE thn_settings_skipped_total counter\nthn_settings_skipped_total %lu\n",
+                static_cast<unsigned long>(settings.skipped));
+    text.printf("# TYPE thn_settings_failures_total counter\nthn_settings_failures_total %lu\n",
+                static_cast<unsigned long>(settings.failures));
+  }
 
-  server_.send(200, "application/json", json);
+  text.printf("# HELP thn_loop_stage_microseconds Time spent in each loop() stage.\n"
+              "# TYPE thn_loop_stage_microseconds summary\n");
+  for (size_t i = 0; i < LoopMetrics::kStageCount; ++i) {
+    LoopMetrics::Stage stage = static_cast<LoopMetrics::Stage>(i);
+    const char *name = LoopMetrics::stageName(stage);
+    const LoopMetrics::StageStats &stats = loopMetrics_->stats(stage);
+    text.printf("thn_loop_stage_microseconds{stage=\"%s\",quantile=\"0.5\"} %lu\n", name,
+                static_cast<unsigned long>(loopMetrics_->percentileUs(stage, 0.5f)));
+    text.printf("thn_loop_stage_microseconds{stage=\"%s\",quantile=\"0.99\"} %lu\n", name,
+                static_cast<unsigned long>(loopMetrics_->percentileUs(stage, 0.99f)));
+    text.printf("thn_loop_stage_microseconds_sum{stage=\"%s\"} %llu\n", name,
+                static_cast<unsigned long long>(stats.totalUs));
+    text.printf("thn_loop_stage_microseconds_count{stage=\"%s\"} %lu\n", name,
+                static_cast<unsigned long>(stats.count));
+  }
+  text.printf("# TYPE thn_loop_stage_max_microseconds gauge\n");
+  for (size_t i = 0; i < LoopMetrics::kStageCount; ++i) {
+    LoopMetrics::Stage stage = static_cast<LoopMetrics::Stage>(i);
+    text.printf("thn_loop_stage_max_microseconds{stage=\"%s\"} %lu\n",
+                LoopMetrics::stageName(stage),
+                static_cast<unsigned long>(loopMetrics_->stats(stage).maxUs));
+  }
+  text.end();
 }
 
-void WebInterface::handlePowerLogReset() {
-  powerLog_.clear();
-  server_.send(200, "application/json", "{\"status\":\"ok\"}");
+void WebInterface::handleEvents() {
+  // The subscriber keeps its own copy of the client, which holds the socket
+  // open after the server moves on to the next request.
+  WiFiClient client = server_.client();
+  if (!events_.subscribe(client)) {
+    JsonStreamWriter::sendMessage(server_, 503, "error", "too many event subscribers");
+  }
 }
 
-void WebInterface::handleNotFound() { server_.send(404, "application/json", "{\"error\":\"not found\"}"); }
-
-String WebInterface::fanModeToString(controller::FanMode mode) {
-  switch (mode) {
-    case controller::FanMode::kAuto:
-      return "auto";
-    case controller::FanMode::kOff:
-      return "off";
-    case controller::FanMode::kLow:
-      return "low";
-    case controller::FanMode::kMedium:
-      return "medium";
-    case controller::FanMode::kHigh:
-      return "high";
-  }
-  return "auto";
+void WebInterface::publishStatusEvent() {
+  char payload[128];
+  snprintf(payload, sizeof(payload),
+           "{\"seq\":%lu,\"compressor\":%s,\"fanSpeed\":\"%s\",\"compressorCooldown\":%s}",
+           static_cast<unsigned long>(tracking::ChangeSequence::current()),
+           controller_.compressorRunning() ? "true" : "false",
+           fanSpeedToString(controller_.fan().currentSpeed()),
+           controller_.compressorCooldownActive() ? "true" : "false");
+  events_.publish("status", payload);
 }
 
-controller::FanMode WebInterface::fanModeFromString(const String &value) {
-  if (value == "off") {
-    return controller::FanMode::kOff;
+void WebInterface::publishLogEvent() {
+  // Both logs have just opened a row for the new minute, so the completed
+  // rows are the second newest.
+  bool hasTemperature = false;
+  logging::TemperatureLog::Entry temperature{};
+  size_t temperatureCount = temperatureLog_.size();
+  if (temperatureCount >= 2) {
+    temperatureLog_.forEachRow(temperatureCount - 2, temperatureCount - 1,
+                               [&](const logging::TemperatureLog::Entry &entry) {
+      temperature = entry;
+      hasTemperature = true;
+    });
+  }
+  bool hasPower = false;
+  logging::PowerLog::Entry power{};
+  size_t powerCount = powerLog_.size();
+  if (powerCount >= 2) {
+    powerLog_.forEachRow(powerCount - 2, powerCount - 1,
+                         [&](const logging::PowerLog::Entry &entry) {
+      power = entry;
+      hasPower = true;
+    });
   }
-  if (value == "low") {
-    return controller::FanMode::kLow;
+
+  char payload[256];
+  size_t length = static_cast<size_t>(
+      snprintf(payload, sizeof(payload), "{\"seq\":%lu",
+               static_cast<unsigned long>(tracking::ChangeSequence::current())));
+  if (hasTemperature && length < sizeof(payload)) {
+    char ambient[16];
+    char coil[16];
+    units::formatCelsius(temperature.ambient, 2, ambient, sizeof(ambient));
+    units::formatCelsius(temperature.coil, 2, coil, sizeof(coil));
+    length += static_cast<size_t>(
+        snprintf(payload + length, sizeof(payload) - length,
+                 ",\"temperature\":{\"t\":%lu,\"ambient\":%s,\"coil\":%s}",
+                 temperature.timestamp, ambient, coil));
   }
-  if (value == "medium") {
-    return controller::FanMode::kMedium;
+  if (hasPower && length < sizeof(payload)) {
+    length += static_cast<size_t>(snprintf(
+        payload + length, sizeof(payload) - length,
+        ",\"power\":{\"t\":%lu,\"wh\":%.2f,\"watts\":%.1f,\"fan\":\"%s\",\"compressor\":%s}",
+        power.timestamp, static_cast<double>(power.energyWhAccumulated),
+        static_cast<double>(power.instantaneousWatts), fanSpeedToString(power.fanSpeed),
+        power.compressorActive ? "true" : "false"));
   }
-  if (value == "high") {
-    return controller::FanMode::kHigh;
+  if (length < sizeof(payload)) {
+    snprintf(payload + length, sizeof(payload) - length, ",\"energyWh\":%.2f}",
+             static_cast<double>(powerLog_.totalEnergyWh()));
   }
-  return controller::FanMode::kAuto;
+  events_.publish("log", payload);
+}
+
+void WebInterface::handleNotFound() {
+  JsonStreamWriter::sendMessage(server_, 404, "error", "not found");
 }
 
-String WebInterface::fanSpeedToString(controller::FanSpeed speed) {
+const char *WebInterface::fanSpeedToString(controller::FanSpeed speed) {
   switch (speed) {
     case controller::FanSpeed::kOff:
       return "off";
@@ -431,152 +1405,90 @@ String WebInterface::fanSpeedToString(controller::FanSpeed speed) {
   return "off";
 }
 
-String WebInterface::systemModeToString(controller::SystemMode mode) {
-  switch (mode) {
-    case controller::SystemMode::kCooling:
-      return "cooling";
-    case controller::SystemMode::kHeating:
-      return "heating";
-    case controller::SystemMode::kFanOnly:
-      return "fan";
-    case controller::SystemMode::kIdle:
-      return "idle";
-  }
-  return "cooling";
-}
-
-controller::SystemMode WebInterface::systemModeFromString(const String &value) {
-  if (value == "heating") {
-    return controller::SystemMode::kHeating;
-  }
-  if (value == "fan") {
-    return controller::SystemMode::kFanOnly;
-  }
-  if (value == "idle") {
-    return controller::SystemMode::kIdle;
+const char *WebInterface::powerResolutionToString(logging::PowerLog::Resolution resolution) {
+  switch (resolution) {
+    case logging::PowerLog::Resolution::kMinute:
+      return "minute";
+    case logging::PowerLog::Resolution::kHour:
+      return "hour";
+    case logging::PowerLog::Resolution::kDay:
+      return "day";
+    case logging::PowerLog::Resolution::kMonth:
+      return "month";
   }
-  return controller::SystemMode::kCooling;
+  return "minute";
 }
 
-String WebInterface::scheduleModeToString(scheduler::ScheduledMode mode) {
-  switch (mode) {
-    case scheduler::ScheduledMode::kCooling:
-      return "cooling";
-    case scheduler::ScheduledMode::kHeating:
-      return "heating";
-    case scheduler::ScheduledMode::kFanOnly:
-      return "fan";
-    case scheduler::ScheduledMode::kIdle:
-      return "idle";
-    case scheduler::ScheduledMode::kUnspecified:
-      break;
+const char *WebInterface::temperatureResolutionToString(
+    logging::TemperatureLog::Resolution resolution) {
+  switch (resolution) {
+    case logging::TemperatureLog::Resolution::kMinute:
+      return "minute";
+    case logging::TemperatureLog::Resolution::kQuarterHour:
+      return "quarter-hour";
+    case logging::TemperatureLog::Resolution::kHour:
+      return "hour";
+    case logging::TemperatureLog::Resolution::kDay:
+      return "day";
   }
-  return "";
+  return "minute";
 }
 
-scheduler::ScheduledMode WebInterface::scheduleModeFromString(const String &value) {
-  if (value == "cooling") {
-    return scheduler::ScheduledMode::kCooling;
-  }
-  if (value == "heating") {
-    return scheduler::ScheduledMode::kHeating;
-  }
-  if (value == "fan") {
-    return scheduler::ScheduledMode::kFanOnly;
-  }
-  if (value == "idle") {
-    return scheduler::ScheduledMode::kIdle;
-  }
-  return scheduler::ScheduledMode::kUnspecified;
+void WebInterface::appendTemperatureRow(JsonStreamWriter &json,
+                                        const logging::TemperatureLog::Entry &entry) {
+  json.beginObject();
+  json.field("t", entry.timestamp);
+  json.temperatureField("ambient", entry.ambient);
+  json.temperatureField("coil", entry.coil);
+  json.endObject();
 }
 
-void WebInterface::appendTemperatureLog(String &json, size_t maxEntries) const {
-  json += ",\"temperatureLog\":[";
-  size_t appended = 0;
-  size_t processed = 0;
-  size_t total = temperatureLog_.size();
-  size_t skip = total > maxEntries ? total - maxEntries : 0;
-  temperatureLog_.forEach([&](const logging::TemperatureLog::Entry &entry) {
-    if (processed++ < skip) {
-      return;
-    }
-    if (appended > 0) {
-      json += ",";
-    }
-    String ambient = isnan(entry.ambient) ? String("null") : String(entry.ambient, 2);
-    String coil = isnan(entry.coil) ? String("null") : String(entry.coil, 2);
-    json += "{\"t\":" + String(entry.timestamp) + ",\"ambient\":" +
-            ambient + ",\"coil\":" + coil + "}";
-    ++appended;
-  });
-  json += "]";
+void WebInterface::appendPowerRow(JsonStreamWriter &json, const logging::PowerLog::Entry &entry) {
+  json.beginObject();
+  json.field("t", entry.timestamp);
+  json.field("wh", entry.energyWhAccumulated, 2);
+  json.field("watts", entry.instantaneousWatts, 1);
+  json.field("fan", fanSpeedToString(entry.fanSpeed));
+  json.field("compressor", entry.compressorActive);
+  json.endObject();
 }
 
-void WebInterface::appendPowerLog(String &json, size_t maxEntries) const {
-  json += ",\"powerLog\":[";
-  size_t appended = 0;
-  size_t processed = 0;
-  size_t total = powerLog_.size();
-  size_t skip = total > maxEntries ? total - maxEntries : 0;
-  powerLog_.forEach([&](const logging::PowerLog::Entry &entry) {
-    if (processed++ < skip) {
-      return;
-    }
-    if (appended > 0) {
-      json += ",";
+void WebInterface::appendSchedule(JsonStreamWriter &json, uint8_t profile) const {
+  scheduler::ScheduleEntry entries[scheduler::ScheduleManager::kMaxEntries];
+  size_t count = schedule_.daySchedule(profile, entries, scheduler::ScheduleManager::kMaxEntries);
+  json.beginArray();
+  for (size_t i = 0; i < count; ++i) {
+    char timeBuffer[6];
+    snprintf(timeBuffer, sizeof(timeBuffer), "%02u:%02u",
+             static_cast<unsigned>(entries[i].hour % 100),
+             static_cast<unsigned>(entries[i].minute % 100));
+    json.beginObject();
+    json.field("time", timeBuffer);
+    json.temperatureField("temp", entries[i].temperature, 1);
+    json.key("mode");
+    if (entries[i].mode == scheduler::ScheduledMode::kUnspecified) {
+      json.null();
+    } else {
+      json.value(scheduler::scheduledModeName(entries[i].mode));
     }
-    json += "{\"t\":" + String(entry.timestamp) +
-            ",\"wh\":" + String(entry.energyWhAccumulated, 2) +
-            ",\"watts\":" + String(entry.instantaneousWatts, 1) +
-            ",\"fan\":\"" + fanSpeedToString(entry.fanSpeed) +
-            "\",\"compressor\":" + String(entry.compressorActive ? "true" : "false") + "}";
-    ++appended;
-  });
-  json += "]";
-  json += ",\"energyWh\":" + String(powerLog_.totalEnergyWh(), 2);
+    json.endObject();
+  }
+  json.endArray();
 }
 
-void WebInterface::updateScheduleFromArg(
-    const String &arg,
-    void (scheduler::ScheduleManager::*setter)(const scheduler::ScheduleEntry *, size_t)) {
-  if (arg.length() == 0) {
-    return;
-  }
-  scheduler::ScheduleEntry entries[scheduler::ScheduleManager::kMaxEntries];
+void WebInterface::appendDayOverrides(JsonStreamWriter &json) const {
   size_t count = 0;
-  int start = 0;
-  while (start < arg.length() && count < scheduler::ScheduleManager::kMaxEntries) {
-    int end = arg.indexOf(';', start);
-    if (end == -1) {
-      end = arg.length();
-    }
-    String token = arg.substring(start, end);
-    token.trim();
-    if (token.length() > 0) {
-      int equals = token.indexOf('=');
-      int colon = token.indexOf(':');
-      if (equals > colon && colon > 0) {
-        uint8_t hour = static_cast<uint8_t>(token.substring(0, colon).toInt());
-        uint8_t minute = static_cast<uint8_t>(token.substring(colon + 1, equals).toInt());
-        int modeSeparator = token.indexOf('|', equals + 1);
-        String tempPart = modeSeparator == -1 ? token.substring(equals + 1)
-                                             : token.substring(equals + 1, modeSeparator);
-        float temperature = tempPart.toFloat();
-        scheduler::ScheduledMode mode = scheduler::ScheduledMode::kUnspecified;
-        if (modeSeparator != -1) {
-          String modePart = token.substring(modeSeparator + 1);
-          modePart.trim();
-          modePart.toLowerCase();
-          mode = scheduleModeFromString(modePart);
-        }
-        entries[count++] = scheduler::ScheduleEntry(hour, minute, temperature, mode);
-      }
-    }
-    start = end + 1;
-  }
-  if (count > 0) {
-    (schedule_.*setter)(entries, count);
+  const scheduler::DayOverride *overrides = schedule_.dayOverrides(count);
+  json.beginArray();
+  for (size_t i = 0; i < count; ++i) {
+    char dateBuffer[11];
+    scheduler::formatDay(overrides[i].day, dateBuffer, sizeof(dateBuffer));
+    json.beginObject();
+    json.field("date", dateBuffer);
+    json.field("profile", scheduler::scheduleProfileName(overrides[i].profile));
+    json.endObject();
   }
+  json.endArray();
 }
 
 }  // namespace interface
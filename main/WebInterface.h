@@ -1,8 +1,10 @@
 #pragma once
 
-#include <ESP8266WebServer.h>
-
+#include "EventStream.h"
 #include "HVACController.h"
+#include "HttpServer.h"
+#include "JsonStreamWriter.h"
+#include "LoopMetrics.h"
 #include "PowerLog.h"
 #include "TemperatureLog.h"
 #include "ScheduleManager.h"
@@ -22,37 +24,58 @@ class WebInterface {
   void begin();
   void handleClient();
 
+  /** Forwards a controller transition to /api/events subscribers. */
+  void publishControllerEvent(controller::ControllerEvent event);
+
+  /** Exposes loop timing and heap statistics at /api/metrics; pass nullptr to detach. */
+  void setLoopMetrics(diagnostics::LoopMetrics *metrics) { loopMetrics_ = metrics; }
+
+  /** Request and connection counters of the HTTP server, also reported at /api/metrics. */
+  const HttpServer::Stats &httpStats() const { return server_.stats(); }
+
  private:
   void registerRoutes();
   void handleState();
   void handleConfig();
+  /** Applies one /api/config field; the request's first rejected value is put in `error`. */
+  void applyConfigField(const char *name, const char *value, char *error, size_t errorSize);
   void handlePowerLog();
   void handlePowerLogReset();
+  void handleTemperatureHistory();
+  void handleEvents();
+  void handleMetrics();
+  void handleMetricsReset();
+  void sendPrometheusMetrics();
+  void publishStatusEvent();
+  void publishLogEvent();
   void handleNotFound();
   void serveIndex();
 
-  static String fanModeToString(controller::FanMode mode);
-  static controller::FanMode fanModeFromString(const String &value);
-  static String fanSpeedToString(controller::FanSpeed speed);
-  static String systemModeToString(controller::SystemMode mode);
-  static controller::SystemMode systemModeFromString(const String &value);
-  static String scheduleModeToString(scheduler::ScheduledMode mode);
-  static scheduler::ScheduledMode scheduleModeFromString(const String &value);
-
-  void appendTemperatureLog(String &json, size_t maxEntries) const;
-  void appendPowerLog(String &json, size_t maxEntries) const;
+  static const char *fanSpeedToString(controller::FanSpeed speed);
+  static const char *powerResolutionToString(logging::PowerLog::Resolution resolution);
+  static const char *temperatureResolutionToString(
+      logging::TemperatureLog::Resolution resolution);
 
-  void updateScheduleFromArg(const String &arg,
-                             void (scheduler::ScheduleManager::*setter)(const scheduler::ScheduleEntry *,
-                                                                          size_t));
+  void appendConnection(JsonStreamWriter &json) const;
+  void appendConfig(JsonStreamWriter &json) const;
+  void appendStatus(JsonStreamWriter &json, bool delta) const;
+  static void appendTemperatureRow(JsonStreamWriter &json,
+                                   const logging::TemperatureLog::Entry &entry);
+  static void appendPowerRow(JsonStreamWriter &json, const logging::PowerLog::Entry &entry);
+  void appendSchedule(JsonStreamWriter &json, uint8_t profile) const;
+  void appendDayOverrides(JsonStreamWriter &json) const;
 
   controller::HVACController &controller_;
   scheduler::ScheduleManager &schedule_;
   logging::TemperatureLog &temperatureLog_;
   logging::PowerLog &powerLog_;
   storage::SettingsStorage *settings_;
+  diagnostics::LoopMetrics *loopMetrics_ = nullptr;
+  uint32_t bootId_ = 0;
+  bool configEventPending_ = false;
 
-  ESP8266WebServer server_;
+  HttpServer server_;
+  EventStream events_;
 };
 
 }  // namespace interface
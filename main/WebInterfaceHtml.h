@@ -1,2376 +1,996 @@
 #pragma once
 
+// Generated by tools/build_web_assets.py from web/index.html -- do not edit.
+// Source 94159 bytes, minified 71066 bytes, gzip 15657 bytes.
+
 #include <pgmspace.h>
 
 namespace interface {
 
-static const char kWebInterfaceHtml[] PROGMEM = R"rawliteral(<!DOCTYPE html>
-<html>
-  <head>
-    <meta charset="utf-8" />
-    <title>HVAC Controller</title>
-    <meta name="viewport" content="width=device-width, initial-scale=1" />
-    <style>
-      body {
-        font-family: Arial, sans-serif;
-        margin: 0 auto;
-        padding: 1rem;
-        max-width: 960px;
-        background: #f4f7f9;
-        color: #222;
-      }
-      header {
-        display: flex;
-        justify-content: space-between;
-        align-items: center;
-        margin-bottom: 1.5rem;
-      }
-      h1 {
-        margin: 0;
-      }
-      section {
-        background: #fff;
-        border-radius: 8px;
-        padding: 1rem;
-        margin-bottom: 1rem;
-        box-shadow: 0 1px 3px rgba(0, 0, 0, 0.1);
-      }
-      label {
-        display: block;
-        font-weight: bold;
-        margin-top: 0.5rem;
-      }
-      input,
-      select,
-      textarea,
-      button {
-        width: 100%;
-        padding: 0.5rem;
-        margin-top: 0.25rem;
-        box-sizing: border-box;
-        border: 1px solid #ccd6dd;
-        border-radius: 4px;
-      }
-      button {
-        background: #0078d4;
-        color: #fff;
-        border: none;
-        cursor: pointer;
-      }
-      button:disabled {
-        background: #aac6eb;
-        cursor: not-allowed;
-      }
-      .chart-card-header {
-        display: flex;
-        flex-wrap: wrap;
-        justify-content: space-between;
-        align-items: center;
-        gap: 0.75rem;
-      }
-      .power-controls {
-        display: flex;
-        flex-wrap: wrap;
-        align-items: center;
-        gap: 0.5rem;
-      }
-      .power-controls-label {
-        font-weight: 600;
-        color: #1f2937;
-      }
-      .power-range-buttons {
-        display: inline-flex;
-        flex-wrap: wrap;
-        gap: 0.5rem;
-      }
-      .range-button {
-        width: auto;
-        padding: 0.35rem 0.9rem;
-        border-radius: 999px;
-        border: 1px solid #0078d4;
-        background: rgba(0, 120, 212, 0.08);
-        color: #0f3558;
-        font-weight: 600;
-        transition: background 0.2s ease, color 0.2s ease, border-color 0.2s ease;
-      }
-      .range-button:hover:not(:disabled) {
-        background: rgba(0, 120, 212, 0.2);
-      }
-      .range-button.active {
-        background: #0078d4;
-        border-color: #0062aa;
-        color: #fff;
-      }
-      .range-button:disabled {
-        background: #e2e8f0;
-        border-color: #cbd5e1;
-        color: #94a3b8;
-      }
-      .danger-button {
-        width: auto;
-        padding: 0.35rem 0.9rem;
-        border-radius: 999px;
-        border: 1px solid #dc2626;
-        background: #dc2626;
-        color: #fff;
-        font-weight: 600;
-        transition: background 0.2s ease, border-color 0.2s ease;
-      }
-      .danger-button:hover:not(:disabled) {
-        background: #b91c1c;
-        border-color: #991b1b;
-      }
-      .danger-button:disabled {
-        background: #fca5a5;
-        border-color: #f87171;
-        color: #7f1d1d;
-        cursor: not-allowed;
-      }
-      .power-summary {
-        display: grid;
-        grid-template-columns: repeat(auto-fit, minmax(180px, 1fr));
-        gap: 0.75rem;
-      }
-      .summary-card {
-        background: #f8fafc;
-        border: 1px solid #d8e0e7;
-        border-radius: 8px;
-        padding: 0.75rem;
-        display: flex;
-        flex-direction: column;
-        gap: 0.25rem;
-      }
-      .summary-label {
-        font-size: 0.75rem;
-        letter-spacing: 0.06em;
-        text-transform: uppercase;
-        color: #64748b;
-      }
-      .summary-value {
-        font-size: 1.35rem;
-        font-weight: 600;
-        color: #0f172a;
-      }
-      .muted {
-        color: #64748b;
-        font-size: 0.9rem;
-      }
-      .power-notice {
-        margin: 0.35rem 0 0;
-      }
-      .grid {
-        display: grid;
-        grid-template-columns: repeat(auto-fit, minmax(220px, 1fr));
-        gap: 1rem;
-      }
-      table {
-        width: 100%;
-        border-collapse: collapse;
-      }
-      th,
-      td {
-        border-bottom: 1px solid #e5e8eb;
-        padding: 0.4rem 0.6rem;
-        text-align: left;
-        font-size: 0.9rem;
-      }
-      th {
-        background: #f0f3f5;
-      }
-      .status {
-        display: flex;
-        flex-wrap: wrap;
-        gap: 1rem;
-      }
-      .status div {
-        min-width: 140px;
-      }
-      .chart-card {
-        display: flex;
-        flex-direction: column;
-        gap: 0.75rem;
-      }
-      .chart-card canvas {
-        width: 100%;
-        max-width: 100%;
-      }
-      canvas.chart {
-        display: block;
-        background: #fafbfd;
-        border: 1px solid #d8e0e7;
-        border-radius: 6px;
-      }
-      .inline {
-        display: inline-flex;
-        align-items: center;
-        gap: 0.5rem;
-      }
-      .schedule-ignore-controls {
-        display: flex;
-        flex-wrap: wrap;
-        align-items: center;
-        gap: 0.5rem;
-        margin: 0.5rem 0;
-      }
-      .schedule-ignore-controls label {
-        margin: 0;
-        font-weight: 600;
-      }
-      .schedule-ignore-controls select,
-      .schedule-ignore-controls button {
-        width: auto;
-      }
-      .schedule-ignore-status {
-        font-size: 0.9rem;
-        color: #374151;
-        min-height: 1.25rem;
-        margin: 0.25rem 0 0;
-      }
-      .header-meta {
-        display: flex;
-        flex-direction: column;
-        align-items: flex-end;
-        gap: 0.25rem;
-        text-align: right;
-      }
-      .header-meta div {
-        font-size: 0.9rem;
-      }
-    </style>
-  </head>
-  <body>
-    <header>
-      <h1>HVAC Controller</h1>
-      <div class="header-meta">
-        <div id="wifiInfo"></div>
-        <div>Uptime: <span id="uptime">-</span></div>
-        <div id="currentTime">-</div>
-      </div>
-    </header>
-
-    <section id="statusSection">
-      <h2>Current Status</h2>
-      <div class="status">
-        <div>Mode: <span id="systemMode">-</span></div>
-        <div>Fan: <span id="fanMode">-</span> (<span id="fanSpeed">-</span>)</div>
-        <div>Compressor: <span id="compressor">-</span></div>
-        <div>Compressor Timeout: <span id="compressorTimeout">-</span></div>
-        <div>Compressor Off Timeout: <span id="compressorOffTimeout">-</span></div>
-        <div>Cooldown Active: <span id="compressorCooldown">-</span></div>
-        <div>Cooldown Remaining: <span id="compressorCooldownRemaining">-</span></div>
-        <div>Scheduling: <span id="schedulingState">-</span></div>
-        <div>Schedule Hold: <span id="scheduleHoldState">-</span></div>
-        <div>Target: <span id="target">-</span>°C</div>
-        <div>Hysteresis: <span id="hysteresis">-</span>°C</div>
-        <div>Compressor Temp Limit: <span id="compressorTempLimit">-</span>°C</div>
-        <div>Compressor Min Ambient: <span id="compressorMinAmbient">-</span>°C</div>
-        <div>Cooldown Temp: <span id="compressorCooldownTemp">-</span>°C</div>
-        <div>Cooldown Duration: <span id="compressorCooldownMinutes">-</span> min</div>
-        <div>Ambient: <span id="ambient">-</span>°C</div>
-        <div>Coil: <span id="coil">-</span>°C</div>
-        <div>Energy: <span id="energy">-</span> Wh</div>
-      </div>
-    </section>
-
-    <section>
-      <h2>Configuration</h2>
-      <form id="configForm">
-        <div class="grid">
-          <div>
-            <label for="targetInput">Target Temperature (°C)</label>
-            <input id="targetInput" name="target" type="number" step="0.1" />
-          </div>
-          <div>
-            <label for="hysteresisInput">Hysteresis (°C)</label>
-            <input id="hysteresisInput" name="hysteresis" type="number" step="0.1" />
-          </div>
-          <div>
-            <label for="compressorTempLimitInput">Compressor Temp Limit (°C)</label>
-            <input
-              id="compressorTempLimitInput"
-              name="compressorTempLimit"
-              type="number"
-              step="0.1"
-              min="0"
-            />
-          </div>
-          <div>
-            <label for="compressorMinAmbientInput">Compressor Min Ambient (°C)</label>
-            <input
-              id="compressorMinAmbientInput"
-              name="compressorMinAmbient"
-              type="number"
-              step="0.1"
-            />
-          </div>
-          <div>
-            <label for="compressorCooldownTempInput">Compressor Cooldown Temp (°C)</label>
-            <input
-              id="compressorCooldownTempInput"
-              name="compressorCooldownTemp"
-              type="number"
-              step="0.1"
-              min="0"
-            />
-          </div>
-          <div>
-            <label for="compressorCooldownMinutesInput">Compressor Cooldown Duration (minutes)</label>
-            <input
-              id="compressorCooldownMinutesInput"
-              name="compressorCooldownMinutes"
-              type="number"
-              step="0.1"
-              min="0"
-            />
-          </div>
-          <div>
-            <label for="fanModeInput">Fan Mode</label>
-            <select id="fanModeInput" name="fanMode">
-              <option value="auto">Automatic</option>
-              <option value="off">Off</option>
-              <option value="low">Low</option>
-              <option value="medium">Medium</option>
-              <option value="high">High</option>
-            </select>
-          </div>
-          <div>
-            <label for="systemModeInput">System Mode</label>
-            <select id="systemModeInput" name="systemMode">
-              <option value="cooling">Cooling</option>
-              <option value="heating">Heating</option>
-              <option value="fan">Fan Only</option>
-              <option value="idle">Idle</option>
-            </select>
-          </div>
-          <div>
-            <label for="timezoneOffsetInput">Timezone Offset (hours from UTC)</label>
-            <input
-              id="timezoneOffsetInput"
-              name="timezoneOffset"
-              type="number"
-              step="0.25"
-              min="-12"
-              max="14"
-            />
-          </div>
-        </div>
-        <label class="inline">
-          <input id="schedulingInput" name="scheduling" type="checkbox" value="true" />
-          Enable scheduling
-        </label>
-        <label for="weekdayInput">
-          Weekday Schedule (HH:MM=TEMP|mode;… – mode optional, e.g. cooling/idle)
-        </label>
-        <div class="schedule-ignore-controls" id="scheduleIgnoreControls">
-          <label for="scheduleIgnoreSelect">Ignore schedule for</label>
-          <select id="scheduleIgnoreSelect">
-            <option value="10">10 minutes</option>
-            <option value="20">20 minutes</option>
-            <option value="30">30 minutes</option>
-            <option value="40">40 minutes</option>
-            <option value="50">50 minutes</option>
-            <option value="60">60 minutes</option>
-            <option value="70">70 minutes</option>
-            <option value="80">80 minutes</option>
-            <option value="90">90 minutes</option>
-            <option value="100">100 minutes</option>
-            <option value="110">110 minutes</option>
-            <option value="120" selected>120 minutes</option>
-          </select>
-          <button type="button" id="scheduleIgnoreButton">Apply hold</button>
-        </div>
-        <p class="muted">
-          Temporarily hold the automatic schedule to keep manual adjustments for a short time.
-        </p>
-        <p id="scheduleIgnoreMessage" class="schedule-ignore-status"></p>
-        <textarea
-          id="weekdayInput"
-          name="weekday"
-          rows="3"
-          placeholder="06:00=23.0|cooling;09:00=26.0|cooling;17:30=23.5|cooling;22:00=25.0|idle"
-        ></textarea>
-        <label for="weekendInput">
-          Weekend Schedule (HH:MM=TEMP|mode;… – mode optional, e.g. cooling/idle)
-        </label>
-        <textarea
-          id="weekendInput"
-          name="weekend"
-          rows="3"
-          placeholder="08:00=23.5|cooling;12:00=25.0|cooling;18:00=23.0|cooling;23:00=25.5|idle"
-        ></textarea>
-        <button type="submit">Save Configuration</button>
-        <p id="configStatus"></p>
-      </form>
-    </section>
-
-    <section>
-      <h2>Logs</h2>
-      <div class="grid">
-        <div class="chart-card">
-          <h3>Temperature (°C)</h3>
-          <canvas id="temperatureChart" class="chart" width="720" height="320"></canvas>
-        </div>
-        <div class="chart-card">
-          <div class="chart-card-header">
-            <h3>Power (W)</h3>
-            <div class="power-controls">
-              <span class="power-controls-label">Range</span>
-              <div class="power-range-buttons">
-                <button type="button" class="range-button active" data-power-range="current">
-                  Current
-                </button>
-                <button type="button" class="range-button" data-power-range="day">
-                  Past day
-                </button>
-                <button type="button" class="range-button" data-power-range="week">
-                  Past week
-                </button>
-                <button type="button" class="range-button" data-power-range="month">
-                  Past month
-                </button>
-                <button type="button" class="range-button" data-power-range="year">
-                  Past year
-                </button>
-              </div>
-              <button type="button" id="resetPowerLogButton" class="danger-button">Reset power log</button>
-            </div>
-          </div>
-          <div class="power-summary">
-            <div class="summary-card">
-              <div class="summary-label">Total usage</div>
-              <div class="summary-value" id="powerSummaryTotal">-</div>
-            </div>
-            <div class="summary-card">
-              <div class="summary-label">Average per day</div>
-              <div class="summary-value" id="powerSummaryAverage">-</div>
-            </div>
-          </div>
-          <p id="powerRangeMessage" class="muted power-notice">Loading power history…</p>
-          <canvas id="powerChart" class="chart" width="720" height="320"></canvas>
-        </div>
-      </div>
-    </section>
-
-    <script>
-      const configForm = document.getElementById('configForm');
-      const configStatus = document.getElementById('configStatus');
-      const timezoneOffsetInput = document.getElementById('timezoneOffsetInput');
-      const detectedTimezoneOffsetHours = -new Date().getTimezoneOffset() / 60;
-      let timezoneOffsetAutoApplied = false;
-      const systemModeLabels = {
-        cooling: 'Cooling',
-        heating: 'Heating',
-        fan: 'Fan Only',
-        idle: 'Idle',
-      };
-      const fanModeLabels = {
-        auto: 'Auto',
-        off: 'Off',
-        low: 'Low',
-        medium: 'Medium',
-        high: 'High',
-      };
-      const fanSpeedLabels = {
-        off: 'Off',
-        low: 'Low',
-        medium: 'Medium',
-        high: 'High',
-      };
-      let currentTimeState = {
-        epochSeconds: null,
-        receivedAtMs: null,
-        formatted: null,
-        uptimeMs: null,
-        uptimeReceivedAtMs: null,
-        clockOffsetMs: null,
-      };
-      const powerRangeButtons = Array.from(
-        document.querySelectorAll('.range-button[data-power-range]'),
-      );
-      const powerResetButton = document.getElementById('resetPowerLogButton');
-      const powerSummaryTotal = document.getElementById('powerSummaryTotal');
-      const powerSummaryAverage = document.getElementById('powerSummaryAverage');
-      const powerRangeMessage = document.getElementById('powerRangeMessage');
-      const scheduleHoldStateElement = document.getElementById('scheduleHoldState');
-      const schedulingStateElement = document.getElementById('schedulingState');
-      const scheduleIgnoreSelect = document.getElementById('scheduleIgnoreSelect');
-      const scheduleIgnoreButton = document.getElementById('scheduleIgnoreButton');
-      const scheduleIgnoreMessage = document.getElementById('scheduleIgnoreMessage');
-      if (scheduleIgnoreButton) {
-        scheduleIgnoreButton.dataset.busy = 'false';
-      }
-      let latestSchedulingEnabled = false;
-      const currentPowerWindowMs = 30 * 60 * 1000;
-      const powerRangeDurations = {
-        current: currentPowerWindowMs,
-        day: 24 * 60 * 60 * 1000,
-        week: 7 * 24 * 60 * 60 * 1000,
-        month: 30 * 24 * 60 * 60 * 1000,
-        year: 365 * 24 * 60 * 60 * 1000,
-      };
-      let selectedPowerRange = 'current';
-      let lastPowerHistoryRefresh = 0;
-      const powerHistoryRefreshIntervalMs = 60 * 1000;
-      let powerHistoryRequest = null;
-
-      async function fetchState() {
-        const response = await fetch('/api/state');
-        if (!response.ok) {
-          throw new Error('Failed to load state');
-        }
-        return await response.json();
-      }
-
-      function scheduleToText(entries) {
-        return entries
-          .map((entry) => {
-            const time = entry.time;
-            const temp = Number(entry.temp).toFixed(1);
-            const mode = typeof entry.mode === 'string' && entry.mode.length > 0 ? `|${entry.mode}` : '';
-            return `${time}=${temp}${mode}`;
-          })
-          .join(';');
-      }
-
-      function renderLineChart(canvas, series, options = {}) {
-        if (!canvas) {
-          return;
-        }
-        const context = canvas.getContext('2d');
-        if (!context) {
-          return;
-        }
-
-        const width = canvas.width;
-        const height = canvas.height;
-        context.clearRect(0, 0, width, height);
-        context.fillStyle = '#ffffff';
-        context.fillRect(0, 0, width, height);
-
-        const processedSeries = series
-          .map((item) => ({
-            label: item.label,
-            color: item.color,
-            data: item.data
-              .map((point) => {
-                const x = Number(point.x);
-                const yValue =
-                  point.y === null || typeof point.y === 'undefined'
-                    ? NaN
-                    : Number(point.y);
-                return {
-                  x,
-                  y: Number.isFinite(yValue) ? yValue : NaN,
-                };
-              })
-              .filter((point) => Number.isFinite(point.x)),
-          }))
-          .filter((item) => item.data.length > 0);
-
-        const drawEmptyState = (message) => {
-          context.fillStyle = '#6b7280';
-          context.font = '14px sans-serif';
-          context.textAlign = 'center';
-          context.textBaseline = 'middle';
-          context.fillText(message, width / 2, height / 2);
-        };
-
-        if (processedSeries.length === 0) {
-          drawEmptyState('No data available');
-          return;
-        }
-
-        const xValues = processedSeries.flatMap((item) => item.data.map((point) => point.x));
-        if (xValues.length === 0) {
-          drawEmptyState('No data available');
-          return;
-        }
-        let xMin = Math.min(...xValues);
-        let xMax = Math.max(...xValues);
-        if (!Number.isFinite(xMin) || !Number.isFinite(xMax)) {
-          drawEmptyState('No data available');
-          return;
-        }
-        if (xMax === xMin) {
-          xMin -= 30000;
-          xMax += 30000;
-        }
-
-        const yValues = processedSeries.flatMap((item) =>
-          item.data.filter((point) => Number.isFinite(point.y)).map((point) => point.y),
-        );
-        if (yValues.length === 0) {
-          drawEmptyState('No data available');
-          return;
-        }
-        let yMin = Math.min(...yValues);
-        let yMax = Math.max(...yValues);
-        if (yMax === yMin) {
-          const padding = yMin === 0 ? 1 : Math.abs(yMin) * 0.1;
-          yMin -= padding;
-          yMax += padding;
-        }
-        const yPadding = (yMax - yMin) * 0.1;
-        if (yPadding > 0) {
-          yMin -= yPadding;
-          yMax += yPadding;
-        }
-
-        const margin = options.margin || { left: 60, right: 18, top: 52, bottom: 42 };
-        const chartWidth = Math.max(1, width - margin.left - margin.right);
-        const chartHeight = Math.max(1, height - margin.top - margin.bottom);
-
-        const xRange = xMax - xMin;
-        const yRange = yMax - yMin;
-        if (xRange <= 0 || yRange <= 0) {
-          drawEmptyState('Waiting for more data');
-          return;
-        }
-
-        const toX = (value) => margin.left + ((value - xMin) / xRange) * chartWidth;
-        const toY = (value) => margin.top + chartHeight - ((value - yMin) / yRange) * chartHeight;
-
-        const xFormatter = typeof options.xFormatter === 'function' ? options.xFormatter : null;
-
-        context.strokeStyle = '#e2e8f0';
-        context.lineWidth = 1;
-        const xTicks = options.xTicks ?? 5;
-        for (let i = 0; i <= xTicks; ++i) {
-          const ratio = i / xTicks;
-          const x = margin.left + ratio * chartWidth;
-          context.beginPath();
-          context.moveTo(x, margin.top);
-          context.lineTo(x, margin.top + chartHeight);
-          context.stroke();
-        }
-        const yTicks = options.yTicks ?? 5;
-        for (let i = 0; i <= yTicks; ++i) {
-          const ratio = i / yTicks;
-          const y = margin.top + chartHeight - ratio * chartHeight;
-          context.beginPath();
-          context.moveTo(margin.left, y);
-          context.lineTo(margin.left + chartWidth, y);
-          context.stroke();
-        }
-
-        context.strokeStyle = '#94a3b8';
-        context.beginPath();
-        context.moveTo(margin.left, margin.top);
-        context.lineTo(margin.left, margin.top + chartHeight);
-        context.lineTo(margin.left + chartWidth, margin.top + chartHeight);
-        context.stroke();
-
-        context.fillStyle = '#475569';
-        context.font = '12px sans-serif';
-        context.textBaseline = 'top';
-        context.textAlign = 'center';
-        for (let i = 0; i <= xTicks; ++i) {
-          const ratio = i / xTicks;
-          const x = margin.left + ratio * chartWidth;
-          let label = '';
-          if (xFormatter) {
-            label = xFormatter({ ratio, range: xRange, min: xMin, max: xMax });
-          } else {
-            const totalMinutes = xRange / 60000;
-            const minuteDecimals =
-              totalMinutes >= 60 ? 0 : totalMinutes >= 10 ? 0 : totalMinutes >= 3 ? 1 : 2;
-            const minutes = (ratio * xRange) / 60000;
-            label = `${minutes.toFixed(minuteDecimals)} min`;
-          }
-          if (typeof label === 'string' && label.length > 0) {
-            context.fillText(label, x, margin.top + chartHeight + 8);
-          }
-        }
-
-        context.textAlign = 'right';
-        context.textBaseline = 'middle';
-        const yDecimals = yRange >= 50 ? 0 : yRange >= 10 ? 1 : 2;
-        for (let i = 0; i <= yTicks; ++i) {
-          const ratio = i / yTicks;
-          const y = margin.top + chartHeight - ratio * chartHeight;
-          const value = yMin + ratio * yRange;
-          const label = value.toFixed(yDecimals);
-          if (options.yUnit) {
-            context.fillText(`${label} ${options.yUnit}`, margin.left - 8, y);
-          } else {
-            context.fillText(label, margin.left - 8, y);
-          }
-        }
-
-        context.textAlign = 'left';
-        context.textBaseline = 'middle';
-        const legendY = Math.max(18, margin.top - 26);
-        const legendSpacing = 132;
-        processedSeries.forEach((item, index) => {
-          const x = margin.left + index * legendSpacing;
-          context.fillStyle = item.color;
-          context.fillRect(x, legendY, 12, 12);
-          context.fillStyle = '#1f2937';
-          context.fillText(item.label, x + 16, legendY + 6);
-        });
-
-        processedSeries.forEach((item) => {
-          context.beginPath();
-          context.strokeStyle = item.color;
-          context.lineWidth = 2;
-          let started = false;
-          const sorted = [...item.data].sort((a, b) => a.x - b.x);
-          sorted.forEach((point) => {
-            if (!Number.isFinite(point.y)) {
-              started = false;
-              return;
-            }
-            const x = toX(point.x);
-            const y = toY(point.y);
-            if (!started) {
-              context.moveTo(x, y);
-              started = true;
-            } else {
-              context.lineTo(x, y);
-            }
-          });
-          context.stroke();
-        });
-      }
-
-      function renderTemperatureChart(canvas, entries) {
-        const prepared = Array.isArray(entries)
-          ? entries
-              .map((entry) => {
-                const time = Number(entry.t);
-                if (!Number.isFinite(time)) {
-                  return null;
-                }
-                const ambientValue =
-                  entry.ambient === null || typeof entry.ambient === 'undefined'
-                    ? NaN
-                    : Number(entry.ambient);
-                const coilValue =
-                  entry.coil === null || typeof entry.coil === 'undefined'
-                    ? NaN
-                    : Number(entry.coil);
-                return {
-                  time,
-                  ambient: Number.isFinite(ambientValue) ? ambientValue : NaN,
-                  coil: Number.isFinite(coilValue) ? coilValue : NaN,
-                };
-              })
-              .filter((entry) => entry !== null)
-          : [];
-
-        renderLineChart(
-          canvas,
-          [
-            {
-              label: 'Ambient',
-              color: '#ef6f6c',
-              data: prepared.map((entry) => ({ x: entry.time, y: entry.ambient })),
-            },
-            {
-              label: 'Coil',
-              color: '#3f8efc',
-              data: prepared.map((entry) => ({ x: entry.time, y: entry.coil })),
-            },
-          ],
-          { yUnit: '°C' },
-        );
-      }
-
-      function renderCurrentPowerChart(canvas, entries) {
-        const summary = {
-          type: 'current',
-          sampleCount: 0,
-          hasData: false,
-          windowStartEpoch: null,
-          windowEndEpoch: null,
-        };
-        if (!canvas) {
-          return summary;
-        }
-        const context = canvas.getContext('2d');
-        if (!context) {
-          return summary;
-        }
-
-        const drawEmptyState = (message) => {
-          context.clearRect(0, 0, canvas.width, canvas.height);
-          context.fillStyle = '#ffffff';
-          context.fillRect(0, 0, canvas.width, canvas.height);
-          context.fillStyle = '#6b7280';
-          context.font = '14px sans-serif';
-          context.textAlign = 'center';
-          context.textBaseline = 'middle';
-          context.fillText(message, canvas.width / 2, canvas.height / 2);
-        };
-
-        const prepared = Array.isArray(entries)
-          ? entries
-              .map((entry) => {
-                const uptime = Number(entry?.t);
-                if (!Number.isFinite(uptime)) {
-                  return null;
-                }
-                const wattsValue =
-                  entry.watts === null || typeof entry.watts === 'undefined'
-                    ? NaN
-                    : Number(entry.watts);
-                if (!Number.isFinite(wattsValue)) {
-                  return null;
-                }
-                const epochValue = uptimeToEpochMs(uptime);
-                const axisTime = Number.isFinite(epochValue) ? epochValue : uptime;
-                return {
-                  axisTime,
-                  watts: wattsValue,
-                };
-              })
-              .filter((entry) => entry !== null)
-          : [];
-
-        if (prepared.length === 0) {
-          drawEmptyState('No power samples yet.');
-          return summary;
-        }
-
-        const sorted = [...prepared].sort((a, b) => a.axisTime - b.axisTime);
-        const latestEntry = sorted[sorted.length - 1];
-        const latestTime = latestEntry?.axisTime;
-        if (!Number.isFinite(latestTime)) {
-          drawEmptyState('No recent power samples.');
-          return summary;
-        }
-
-        const earliestTime = sorted[0]?.axisTime ?? latestTime;
-        const windowStart = Math.max(latestTime - currentPowerWindowMs, earliestTime);
-        const recent = sorted.filter((entry) => entry.axisTime >= windowStart);
-        if (recent.length === 0) {
-          drawEmptyState('No power samples in the last 30 minutes.');
-          return summary;
-        }
-
-        summary.sampleCount = recent.length;
-        summary.hasData = true;
-        summary.windowStartEpoch = windowStart;
-        summary.windowEndEpoch = latestTime;
-
-        const chartData = [...recent];
-        if (chartData.length > 0 && chartData[0].axisTime > windowStart) {
-          chartData.unshift({ axisTime: windowStart, watts: chartData[0].watts });
-        }
-        if (chartData.length > 0 && chartData[chartData.length - 1].axisTime < latestTime) {
-          chartData.push({ axisTime: latestTime, watts: chartData[chartData.length - 1].watts });
-        }
-
-        const xFormatter = ({ ratio, range }) => {
-          if (!Number.isFinite(range) || range <= 0) {
-            return '';
-          }
-          const minutes = (ratio * range) / 60000;
-          const decimals = range >= 20 * 60000 ? 0 : range >= 5 * 60000 ? 1 : 2;
-          return `${minutes.toFixed(decimals)} min`;
-        };
-
-        renderLineChart(
-          canvas,
-          [
-            {
-              label: 'Watts',
-              color: '#2ca02c',
-              data: chartData.map((entry) => ({ x: entry.axisTime, y: entry.watts })),
-            },
-          ],
-          {
-            yUnit: 'W',
-            xFormatter,
-            margin: { left: 60, right: 18, top: 48, bottom: 48 },
-          },
-        );
-
-        return summary;
-      }
-
-      function renderPowerChart(canvas, entries, meta = {}) {
-        if (selectedPowerRange === 'current') {
-          return renderCurrentPowerChart(canvas, entries);
-        }
-        if (selectedPowerRange === 'day') {
-          return renderDayPowerBarChart(canvas, entries);
-        }
-        if (selectedPowerRange === 'week') {
-          return renderRecentDailyUsageChart(canvas, entries, meta, {
-            days: 7,
-            title: 'Daily Energy (Last 7 Days)',
-          });
-        }
-        if (selectedPowerRange === 'month') {
-          return renderRecentDailyUsageChart(canvas, entries, meta, {
-            days: 30,
-            title: 'Daily Energy (Last 30 Days)',
-          });
-        }
-        if (selectedPowerRange === 'year') {
-          return renderRecentMonthlyUsageChart(canvas, entries, meta, {
-            months: 12,
-            title: 'Monthly Energy (Last 12 Months)',
-          });
-        }
-
-        const prepared = Array.isArray(entries)
-          ? entries
-              .map((entry) => {
-                const time = Number(entry.t);
-                if (!Number.isFinite(time)) {
-                  return null;
-                }
-                const wattsValue =
-                  entry.watts === null || typeof entry.watts === 'undefined'
-                    ? NaN
-                    : Number(entry.watts);
-                return {
-                  time,
-                  watts: Number.isFinite(wattsValue) ? wattsValue : NaN,
-                };
-              })
-              .filter((entry) => entry !== null)
-          : [];
-
-        const xFormatter = ({ ratio, range }) => {
-          if (!Number.isFinite(range) || range <= 0) {
-            return '';
-          }
-          const totalHours = range / 3600000;
-          if (totalHours >= 24 * 30) {
-            const totalDays = range / 86400000;
-            const days = ratio * totalDays;
-            const decimals = totalDays >= 60 ? 0 : totalDays >= 14 ? 1 : 2;
-            return `${days.toFixed(decimals)} d`;
-          }
-          if (totalHours >= 24) {
-            const totalDays = range / 86400000;
-            const days = ratio * totalDays;
-            const decimals = totalDays >= 10 ? 1 : 2;
-            return `${days.toFixed(decimals)} d`;
-          }
-          if (totalHours >= 6) {
-            const hours = ratio * totalHours;
-            return `${hours.toFixed(0)} h`;
-          }
-          const minutes = (ratio * range) / 60000;
-          const decimals = minutes >= 10 ? 0 : 1;
-          return `${minutes.toFixed(decimals)} min`;
-        };
-
-        renderLineChart(
-          canvas,
-          [
-            {
-              label: 'Watts',
-              color: '#2ca02c',
-              data: prepared.map((entry) => ({ x: entry.time, y: entry.watts })),
-            },
-          ],
-          { yUnit: 'W', xFormatter },
-        );
-
-        return {
-          type: 'line',
-          hasData: prepared.length > 0,
-          sampleCount: prepared.length,
-        };
-      }
-
-      function renderDayPowerBarChart(canvas, entries) {
-        const summary = {
-          type: 'day',
-          sampleCount: Array.isArray(entries) ? entries.length : 0,
-          hasData: false,
-          buckets: [],
-          coveredBuckets: 0,
-          dayStartEpoch: null,
-        };
-        if (!canvas) {
-          return summary;
-        }
-        const context = canvas.getContext('2d');
-        if (!context) {
-          return summary;
-        }
-
-        const width = canvas.width;
-        const height = canvas.height;
-        context.clearRect(0, 0, width, height);
-        context.fillStyle = '#ffffff';
-        context.fillRect(0, 0, width, height);
-
-        const drawEmptyState = (message) => {
-          context.fillStyle = '#6b7280';
-          context.font = '14px sans-serif';
-          context.textAlign = 'center';
-          context.textBaseline = 'middle';
-          context.fillText(message, width / 2, height / 2);
-        };
-
-        let latestSampleUptime = null;
-        if (Array.isArray(entries)) {
-          entries.forEach((entry) => {
-            const time = Number(entry.t);
-            if (!Number.isFinite(time)) {
-              return;
-            }
-            if (!Number.isFinite(latestSampleUptime) || time > latestSampleUptime) {
-              latestSampleUptime = time;
-            }
-          });
-        }
-
-        const referenceEpochMs = estimateReferenceEpochMs(latestSampleUptime);
-        const referenceDate = new Date(referenceEpochMs);
-        referenceDate.setHours(0, 0, 0, 0);
-        const dayStartEpoch = referenceDate.getTime();
-        const dayEndEpoch = dayStartEpoch + 24 * 60 * 60 * 1000;
-        summary.dayStartEpoch = dayStartEpoch;
-
-        const buckets = Array.from({ length: 24 }, () => ({ sum: 0, count: 0 }));
-        if (Array.isArray(entries)) {
-          entries.forEach((entry) => {
-            const time = Number(entry.t);
-            const wattsValue =
-              entry.watts === null || typeof entry.watts === 'undefined'
-                ? NaN
-                : Number(entry.watts);
-            if (!Number.isFinite(time) || !Number.isFinite(wattsValue)) {
-              return;
-            }
-            const epochMs = uptimeToEpochMs(time);
-            if (!Number.isFinite(epochMs)) {
-              return;
-            }
-            if (epochMs < dayStartEpoch || epochMs >= dayEndEpoch) {
-              return;
-            }
-            const hourIndex = Math.floor((epochMs - dayStartEpoch) / 3600000);
-            if (hourIndex < 0 || hourIndex >= buckets.length) {
-              return;
-            }
-            buckets[hourIndex].sum += wattsValue;
-            buckets[hourIndex].count += 1;
-          });
-        }
-
-        const hasSamples = buckets.some((bucket) => bucket.count > 0);
-        summary.hasData = hasSamples;
-        summary.coveredBuckets = buckets.filter((bucket) => bucket.count > 0).length;
-        summary.buckets = buckets.map((bucket, index) => ({
-          start: dayStartEpoch + index * 3600000,
-          end: dayStartEpoch + (index + 1) * 3600000,
-          averageWatts: bucket.count > 0 ? bucket.sum / bucket.count : 0,
-          count: bucket.count,
-        }));
-        if (!hasSamples) {
-          drawEmptyState('No power samples for this day yet');
-          return summary;
-        }
-
-        const averages = buckets.map((bucket) =>
-          bucket.count > 0 ? bucket.sum / bucket.count : 0,
-        );
-        const maxAverage = Math.max(...averages);
-        const yMax = maxAverage > 0 ? Math.max(maxAverage * 1.1, maxAverage + 5) : 10;
-        const yTicks = 5;
-        const margin = { left: 60, right: 18, top: 48, bottom: 56 };
-        const chartWidth = Math.max(1, width - margin.left - margin.right);
-        const chartHeight = Math.max(1, height - margin.top - margin.bottom);
-
-        const toY = (value) =>
-          margin.top + chartHeight - Math.min(1, Math.max(0, value / yMax)) * chartHeight;
-
-        context.strokeStyle = '#e2e8f0';
-        context.lineWidth = 1;
-        for (let i = 0; i <= yTicks; ++i) {
-          const ratio = i / yTicks;
-          const y = margin.top + chartHeight - ratio * chartHeight;
-          context.beginPath();
-          context.moveTo(margin.left, y);
-          context.lineTo(margin.left + chartWidth, y);
-          context.stroke();
-        }
-
-        context.strokeStyle = '#94a3b8';
-        context.beginPath();
-        context.moveTo(margin.left, margin.top);
-        context.lineTo(margin.left, margin.top + chartHeight);
-        context.lineTo(margin.left + chartWidth, margin.top + chartHeight);
-        context.stroke();
-
-        const slotWidth = chartWidth / buckets.length;
-        const barWidth = Math.max(6, slotWidth * 0.6);
-        const barColor = '#2ca02c';
-        const labelDates = Array.from({ length: buckets.length }, (_, index) =>
-          new Date(dayStartEpoch + index * 3600000),
-        );
-
-        context.fillStyle = barColor;
-        buckets.forEach((bucket, index) => {
-          const average = averages[index];
-          const barHeight = chartHeight * (Math.min(average, yMax) / yMax);
-          const x = margin.left + index * slotWidth + (slotWidth - barWidth) / 2;
-          const y = margin.top + chartHeight - barHeight;
-          context.fillRect(x, y, barWidth, barHeight);
-        });
-
-        context.fillStyle = '#475569';
-        context.font = '12px sans-serif';
-        context.textAlign = 'right';
-        context.textBaseline = 'middle';
-        for (let i = 0; i <= yTicks; ++i) {
-          const ratio = i / yTicks;
-          const value = yMax * ratio;
-          const y = toY(value);
-          const label = value.toFixed(value >= 50 ? 0 : value >= 10 ? 1 : 2);
-          context.fillText(`${label} W`, margin.left - 8, y);
-        }
-
-        context.textAlign = 'center';
-        context.textBaseline = 'top';
-        labelDates.forEach((date, index) => {
-          const label = date.toLocaleTimeString([], { hour: '2-digit' });
-          const x = margin.left + index * slotWidth + slotWidth / 2;
-          const y = margin.top + chartHeight + 8;
-          if (index % 2 === 0) {
-            context.fillText(label, x, y);
-          }
-        });
-
-        context.textAlign = 'left';
-        context.textBaseline = 'middle';
-        context.fillStyle = barColor;
-        context.fillRect(margin.left, Math.max(18, margin.top - 26), 12, 12);
-        context.fillStyle = '#1f2937';
-        context.fillText(
-          'Average Watts per Hour',
-          margin.left + 16,
-          Math.max(18, margin.top - 20),
-        );
-
-        return summary;
-      }
-
-      function renderRecentDailyUsageChart(canvas, entries, meta, options = {}) {
-        const dayMs = 24 * 60 * 60 * 1000;
-        const days = Number(options.days) > 0 ? Math.floor(Number(options.days)) : 7;
-        const summary = {
-          type: 'daily-usage',
-          sampleCount: Array.isArray(entries) ? entries.length : 0,
-          bucketCount: days,
-          buckets: [],
-          coveredBuckets: 0,
-          totalWh: 0,
-          windowStartEpoch: null,
-          windowEndEpoch: null,
-          hasData: false,
-        };
-        if (!canvas) {
-          return summary;
-        }
-        const context = canvas.getContext('2d');
-        if (!context || days <= 0) {
-          return summary;
-        }
-
-        const latestEntry = Array.isArray(entries) && entries.length > 0 ? entries[entries.length - 1] : null;
-        let latestEpoch = latestEntry ? uptimeToEpochMs(latestEntry.t) : null;
-        if (!Number.isFinite(latestEpoch)) {
-          latestEpoch = estimateReferenceEpochMs();
-        }
-        const anchorDate = new Date(Number.isFinite(latestEpoch) ? latestEpoch : Date.now());
-        anchorDate.setHours(0, 0, 0, 0);
-        const windowEnd = anchorDate.getTime() + dayMs;
-        const windowStart = windowEnd - days * dayMs;
-        summary.windowStartEpoch = windowStart;
-        summary.windowEndEpoch = windowEnd;
-
-        const buckets = Array.from({ length: days }, (_, index) => {
-          const start = windowStart + index * dayMs;
-          return { start, end: start + dayMs, totalWh: 0, samples: 0 };
-        });
-
-        let previousWh = Number(meta?.rangeStartEnergyWh);
-        if (!Number.isFinite(previousWh)) {
-          previousWh = null;
-        }
-
-        if (Array.isArray(entries)) {
-          entries.forEach((entry) => {
-            const whValue = Number(entry?.wh);
-            const epoch = uptimeToEpochMs(entry?.t);
-            if (!Number.isFinite(whValue)) {
-              return;
-            }
-            if (!Number.isFinite(epoch)) {
-              previousWh = whValue;
-              return;
-            }
-            const sampleBucketIndex = Math.floor((epoch - windowStart) / dayMs);
-            if (sampleBucketIndex >= 0 && sampleBucketIndex < buckets.length) {
-              buckets[sampleBucketIndex].samples =
-                (buckets[sampleBucketIndex].samples || 0) + 1;
-            }
-            if (!Number.isFinite(previousWh)) {
-              previousWh = whValue;
-              return;
-            }
-            const delta = whValue - previousWh;
-            previousWh = whValue;
-            if (!Number.isFinite(delta) || delta <= 0) {
-              return;
-            }
-            if (sampleBucketIndex < 0 || sampleBucketIndex >= buckets.length) {
-              return;
-            }
-            buckets[sampleBucketIndex].totalWh += delta;
-          });
-        }
-
-        const values = buckets.map((bucket) => (Number.isFinite(bucket.totalWh) ? Math.max(0, bucket.totalWh) : 0));
-        summary.buckets = buckets;
-        summary.coveredBuckets = buckets.filter((bucket) => (bucket.samples || 0) > 0).length;
-        summary.totalWh = values.reduce((sum, value) => sum + value, 0);
-        summary.hasData = summary.coveredBuckets > 0;
-
-        renderUsageBarChart(context, buckets, {
-          title: options.title,
-          emptyMessage: 'No power samples for this period yet',
-          hasSamples: summary.coveredBuckets > 0,
-          labelFormatter: (bucket, index, count) => {
-            const date = new Date(bucket.start);
-            if (!summary.hasData) {
-              return date.toLocaleDateString(undefined, { month: 'short', day: '2-digit' });
-            }
-            if (count > 14) {
-              const interval = Math.max(1, Math.ceil(count / 10));
-              if (index % interval !== 0 && index !== count - 1) {
-                return '';
-              }
-            }
-            return date.toLocaleDateString(undefined, { month: 'short', day: '2-digit' });
-          },
-        });
-
-        return summary;
-      }
-
-      function renderRecentMonthlyUsageChart(canvas, entries, meta, options = {}) {
-        const months = Number(options.months) > 0 ? Math.floor(Number(options.months)) : 12;
-        const summary = {
-          type: 'monthly-usage',
-          sampleCount: Array.isArray(entries) ? entries.length : 0,
-          bucketCount: months,
-          buckets: [],
-          coveredBuckets: 0,
-          totalWh: 0,
-          windowStartEpoch: null,
-          windowEndEpoch: null,
-          hasData: false,
-        };
-        if (!canvas) {
-          return summary;
-        }
-        const context = canvas.getContext('2d');
-        if (!context || months <= 0) {
-          return summary;
-        }
-
-        const latestEntry = Array.isArray(entries) && entries.length > 0 ? entries[entries.length - 1] : null;
-        let latestEpoch = latestEntry ? uptimeToEpochMs(latestEntry.t) : null;
-        if (!Number.isFinite(latestEpoch)) {
-          latestEpoch = estimateReferenceEpochMs();
-        }
-        const anchorDate = new Date(Number.isFinite(latestEpoch) ? latestEpoch : Date.now());
-        const endMonth = new Date(anchorDate.getFullYear(), anchorDate.getMonth() + 1, 1);
-        const startMonth = new Date(endMonth.getFullYear(), endMonth.getMonth() - months, 1);
-        summary.windowStartEpoch = startMonth.getTime();
-        summary.windowEndEpoch = endMonth.getTime();
-
-        const buckets = Array.from({ length: months }, (_, index) => {
-          const startDate = new Date(startMonth.getFullYear(), startMonth.getMonth() + index, 1);
-          const endDate = new Date(startMonth.getFullYear(), startMonth.getMonth() + index + 1, 1);
-          return { start: startDate.getTime(), end: endDate.getTime(), totalWh: 0, samples: 0 };
-        });
-
-        let previousWh = Number(meta?.rangeStartEnergyWh);
-        if (!Number.isFinite(previousWh)) {
-          previousWh = null;
-        }
-
-        if (Array.isArray(entries)) {
-          entries.forEach((entry) => {
-            const whValue = Number(entry?.wh);
-            const epoch = uptimeToEpochMs(entry?.t);
-            if (!Number.isFinite(whValue)) {
-              return;
-            }
-            if (!Number.isFinite(epoch)) {
-              previousWh = whValue;
-              return;
-            }
-            const bucketIndex = buckets.findIndex(
-              (bucket) => epoch >= bucket.start && epoch < bucket.end,
-            );
-            if (bucketIndex === -1) {
-              previousWh = whValue;
-              return;
-            }
-            buckets[bucketIndex].samples = (buckets[bucketIndex].samples || 0) + 1;
-            if (!Number.isFinite(previousWh)) {
-              previousWh = whValue;
-              return;
-            }
-            const delta = whValue - previousWh;
-            previousWh = whValue;
-            if (!Number.isFinite(delta) || delta <= 0) {
-              return;
-            }
-            buckets[bucketIndex].totalWh += delta;
-          });
-        }
-
-        const values = buckets.map((bucket) => (Number.isFinite(bucket.totalWh) ? Math.max(0, bucket.totalWh) : 0));
-        summary.buckets = buckets;
-        summary.coveredBuckets = buckets.filter((bucket) => (bucket.samples || 0) > 0).length;
-        summary.totalWh = values.reduce((sum, value) => sum + value, 0);
-        summary.hasData = summary.coveredBuckets > 0;
-
-        renderUsageBarChart(context, buckets, {
-          title: options.title,
-          emptyMessage: 'No power samples for this period yet',
-          hasSamples: summary.coveredBuckets > 0,
-          labelFormatter: (bucket, index) => {
-            const date = new Date(bucket.start);
-            const formatOptions =
-              index === 0 || date.getMonth() === 0
-                ? { month: 'short', year: 'numeric' }
-                : { month: 'short' };
-            return date.toLocaleDateString(undefined, formatOptions);
-          },
-        });
-
-        return summary;
-      }
-
-      function renderUsageBarChart(context, buckets, options = {}) {
-        const canvas = context.canvas;
-        const width = canvas.width;
-        const height = canvas.height;
-        context.clearRect(0, 0, width, height);
-        context.fillStyle = '#ffffff';
-        context.fillRect(0, 0, width, height);
-
-        const drawEmptyState = (message) => {
-          context.fillStyle = '#6b7280';
-          context.font = '14px sans-serif';
-          context.textAlign = 'center';
-          context.textBaseline = 'middle';
-          context.fillText(message, width / 2, height / 2);
-        };
-
-        if (!Array.isArray(buckets) || buckets.length === 0) {
-          drawEmptyState(options.emptyMessage || 'No data available');
-          return;
-        }
-
-        const values = buckets.map((bucket) => (Number.isFinite(bucket.totalWh) ? Math.max(0, bucket.totalWh) : 0));
-        const hasUsage = values.some((value) => value > 0);
-        const hasSamples = Boolean(options.hasSamples);
-        if (!hasUsage && !hasSamples) {
-          drawEmptyState(options.emptyMessage || 'No data available');
-          return;
-        }
-
-        const maxValue = Math.max(...values);
-        const yMax = maxValue > 0 ? maxValue * 1.1 : 10;
-        const margin = { left: 72, right: 18, top: 48, bottom: 64 };
-        const chartWidth = Math.max(1, width - margin.left - margin.right);
-        const chartHeight = Math.max(1, height - margin.top - margin.bottom);
-        const slotWidth = chartWidth / buckets.length;
-        const barWidth = Math.max(6, slotWidth * 0.6);
-        const useKilowattHours = yMax >= 1000;
-        const scale = useKilowattHours ? 1 / 1000 : 1;
-        const unitLabel = useKilowattHours ? 'kWh' : 'Wh';
-        const yTicks = 5;
-
-        const toY = (value) =>
-          margin.top + chartHeight - Math.min(1, Math.max(0, value / yMax)) * chartHeight;
-
-        context.strokeStyle = '#e2e8f0';
-        context.lineWidth = 1;
-        for (let i = 0; i <= yTicks; ++i) {
-          const ratio = i / yTicks;
-          const y = margin.top + chartHeight - ratio * chartHeight;
-          context.beginPath();
-          context.moveTo(margin.left, y);
-          context.lineTo(margin.left + chartWidth, y);
-          context.stroke();
-        }
-
-        context.strokeStyle = '#94a3b8';
-        context.beginPath();
-        context.moveTo(margin.left, margin.top);
-        context.lineTo(margin.left, margin.top + chartHeight);
-        context.lineTo(margin.left + chartWidth, margin.top + chartHeight);
-        context.stroke();
-
-        context.fillStyle = '#2563eb';
-        buckets.forEach((bucket, index) => {
-          const value = values[index];
-          const barHeight = chartHeight * (Math.min(value, yMax) / yMax);
-          const x = margin.left + index * slotWidth + (slotWidth - barWidth) / 2;
-          const y = margin.top + chartHeight - barHeight;
-          context.fillRect(x, y, barWidth, barHeight);
-        });
-
-        context.fillStyle = '#475569';
-        context.font = '12px sans-serif';
-        context.textAlign = 'right';
-        context.textBaseline = 'middle';
-        for (let i = 0; i <= yTicks; ++i) {
-          const ratio = i / yTicks;
-          const value = yMax * ratio;
-          const y = toY(value);
-          const labelValue = value * scale;
-          const label = labelValue >= 10 ? labelValue.toFixed(0) : labelValue.toFixed(1);
-          context.fillText(`${label} ${unitLabel}`, margin.left - 8, y);
-        }
-
-        const labelFormatter = typeof options.labelFormatter === 'function'
-          ? options.labelFormatter
-          : () => '';
-        const labelInterval = Math.max(1, Math.ceil(buckets.length / 10));
-        context.textAlign = 'center';
-        context.textBaseline = 'top';
-        buckets.forEach((bucket, index) => {
-          const label = labelFormatter(bucket, index, buckets.length);
-          if (!label) {
-            return;
-          }
-          if (buckets.length > 12 && index % labelInterval !== 0 && index !== buckets.length - 1) {
-            return;
-          }
-          const x = margin.left + index * slotWidth + slotWidth / 2;
-          const y = margin.top + chartHeight + 8;
-          context.fillText(label, x, y);
-        });
-
-        if (options.title) {
-          context.textAlign = 'left';
-          context.textBaseline = 'middle';
-          context.fillStyle = '#2563eb';
-          context.fillRect(margin.left, Math.max(18, margin.top - 26), 12, 12);
-          context.fillStyle = '#1f2937';
-          context.fillText(options.title, margin.left + 16, Math.max(18, margin.top - 20));
-        }
-      }
-
-      function setActivePowerRange(range) {
-        powerRangeButtons.forEach((button) => {
-          if (button.dataset.powerRange === range) {
-            button.classList.add('active');
-          } else {
-            button.classList.remove('active');
-          }
-        });
-      }
-
-      function formatEnergyWh(value) {
-        const numeric = Number(value);
-        if (!Number.isFinite(numeric)) {
-          return '-';
-        }
-        const absolute = Math.abs(numeric);
-        if (absolute >= 1000) {
-          const kilo = numeric / 1000;
-          const decimals = Math.abs(kilo) >= 10 ? 1 : 2;
-          return `${kilo.toFixed(decimals)} kWh`;
-        }
-        if (absolute >= 100) {
-          return `${numeric.toFixed(0)} Wh`;
-        }
-        return `${numeric.toFixed(1)} Wh`;
-      }
-
-      function formatShortDate(timestampMs) {
-        const numeric = Number(timestampMs);
-        if (!Number.isFinite(numeric)) {
-          return '';
-        }
-        const epochValue = uptimeToEpochMs(numeric);
-        const date = new Date(Number.isFinite(epochValue) ? epochValue : numeric);
-        const month = date.toLocaleDateString(undefined, { month: 'short' });
-        const day = String(date.getDate()).padStart(2, '0');
-        const hours = String(date.getHours()).padStart(2, '0');
-        const minutes = String(date.getMinutes()).padStart(2, '0');
-        return `${month} ${day} ${hours}:${minutes}`;
-      }
-
-      function describeDuration(ms) {
-        const numeric = Number(ms);
-        if (!Number.isFinite(numeric) || numeric <= 0) {
-          return '0 minutes';
-        }
-        const days = numeric / 86400000;
-        if (days >= 1) {
-          const decimals = days >= 10 ? 0 : 1;
-          const value = days.toFixed(decimals);
-          return `${value} day${Number(value) === 1 ? '' : 's'}`;
-        }
-        const hours = numeric / 3600000;
-        if (hours >= 1) {
-          const decimals = hours >= 10 ? 0 : 1;
-          const value = hours.toFixed(decimals);
-          return `${value} hour${Number(value) === 1 ? '' : 's'}`;
-        }
-        const minutes = numeric / 60000;
-        const decimals = minutes >= 10 ? 0 : 1;
-        const value = minutes.toFixed(decimals);
-        return `${value} minute${Number(value) === 1 ? '' : 's'}`;
-      }
-
-      function estimateCurrentUptimeMs() {
-        if (!Number.isFinite(currentTimeState.uptimeMs)) {
-          return null;
-        }
-        if (!Number.isFinite(currentTimeState.uptimeReceivedAtMs)) {
-          return currentTimeState.uptimeMs;
-        }
-        const elapsed = Date.now() - currentTimeState.uptimeReceivedAtMs;
-        if (!Number.isFinite(elapsed) || elapsed < 0) {
-          return currentTimeState.uptimeMs;
-        }
-        return currentTimeState.uptimeMs + elapsed;
-      }
-
-      function uptimeToEpochMs(uptimeMs) {
-        const numeric = Number(uptimeMs);
-        if (!Number.isFinite(numeric)) {
-          return null;
-        }
-        if (Number.isFinite(currentTimeState.clockOffsetMs)) {
-          return numeric + currentTimeState.clockOffsetMs;
-        }
-        if (Number.isFinite(currentTimeState.epochSeconds)) {
-          const baseEpoch = currentTimeState.epochSeconds * 1000;
-          const receivedAt = Number.isFinite(currentTimeState.receivedAtMs)
-            ? currentTimeState.receivedAtMs
-            : null;
-          const elapsedSince = receivedAt !== null ? Date.now() - receivedAt : 0;
-          const estimatedCurrentEpoch = baseEpoch + (Number.isFinite(elapsedSince) ? elapsedSince : 0);
-          const estimatedUptime = estimateCurrentUptimeMs();
-          if (Number.isFinite(estimatedUptime)) {
-            const delta = numeric - estimatedUptime;
-            return estimatedCurrentEpoch + delta;
-          }
-          return numeric;
-        }
-        return numeric;
-      }
-
-      function estimateReferenceEpochMs(latestUptimeMs = null) {
-        const latestNumeric = Number(latestUptimeMs);
-        const hasLatest = Number.isFinite(latestNumeric);
-        if (Number.isFinite(currentTimeState.clockOffsetMs)) {
-          if (hasLatest) {
-            return latestNumeric + currentTimeState.clockOffsetMs;
-          }
-          const estimatedUptime = estimateCurrentUptimeMs();
-          if (Number.isFinite(estimatedUptime)) {
-            return estimatedUptime + currentTimeState.clockOffsetMs;
-          }
-        }
-        if (Number.isFinite(currentTimeState.epochSeconds)) {
-          const baseEpoch = currentTimeState.epochSeconds * 1000;
-          const receivedAt = Number.isFinite(currentTimeState.receivedAtMs)
-            ? currentTimeState.receivedAtMs
-            : null;
-          const elapsedSince = receivedAt !== null ? Date.now() - receivedAt : 0;
-          return baseEpoch + (Number.isFinite(elapsedSince) ? elapsedSince : 0);
-        }
-        if (hasLatest) {
-          return latestNumeric;
-        }
-        const estimatedUptimeFallback = estimateCurrentUptimeMs();
-        if (Number.isFinite(estimatedUptimeFallback)) {
-          return estimatedUptimeFallback;
-        }
-        return Date.now();
-      }
-
-      function epochToUptimeMs(epochMs) {
-        const numeric = Number(epochMs);
-        if (!Number.isFinite(numeric)) {
-          return null;
-        }
-        if (Number.isFinite(currentTimeState.clockOffsetMs)) {
-          return numeric - currentTimeState.clockOffsetMs;
-        }
-        const estimatedEpoch = estimateReferenceEpochMs();
-        const estimatedUptime = estimateCurrentUptimeMs();
-        if (Number.isFinite(estimatedEpoch) && Number.isFinite(estimatedUptime)) {
-          const delta = numeric - estimatedEpoch;
-          return estimatedUptime + delta;
-        }
-        return numeric;
-      }
-
-      function updatePowerRangeAvailability(meta) {
-        const availableCount = Number(meta?.availableCount) || 0;
-        let fallbackRange = null;
-        powerRangeButtons.forEach((button) => {
-          const range = button.dataset.powerRange;
-          const enabled = availableCount >= 1 || range === 'current';
-          button.disabled = !enabled;
-          if (enabled && fallbackRange === null) {
-            fallbackRange = range;
-          }
-        });
-        const selectedButton = powerRangeButtons.find(
-          (button) => button.dataset.powerRange === selectedPowerRange,
-        );
-        if (selectedButton && selectedButton.disabled && fallbackRange && fallbackRange !== selectedPowerRange) {
-          selectedPowerRange = fallbackRange;
-          setActivePowerRange(selectedPowerRange);
-          return true;
-        }
-        return false;
-      }
-
-      function applyPowerHistoryResponse(data) {
-        const entries = Array.isArray(data?.entries) ? data.entries : [];
-
-        const chartSummary = renderPowerChart(
-          document.getElementById('powerChart'),
-          entries,
-          data,
-        );
-
-        const baselineWh = Number(data?.rangeStartEnergyWh);
-        const endWh = Number(data?.rangeEndEnergyWh);
-        let totalWh =
-          Number.isFinite(baselineWh) && Number.isFinite(endWh) ? endWh - baselineWh : NaN;
-        if (Number.isFinite(totalWh) && totalWh < 0) {
-          totalWh = 0;
-        }
-        const filteredSpanMs = Number(data?.filteredSpanMs);
-        const filteredCount = Number(data?.filteredCount) || entries.length;
-
-        if (!Number.isFinite(totalWh) || filteredCount < 2) {
-          powerSummaryTotal.textContent = '-';
-          powerSummaryAverage.textContent = '-';
-        } else {
-          powerSummaryTotal.textContent = formatEnergyWh(totalWh);
-          const days = filteredSpanMs > 0 ? filteredSpanMs / (24 * 60 * 60 * 1000) : 0;
-          if (days > 0.05) {
-            powerSummaryAverage.textContent = `${formatEnergyWh(totalWh / days)} / day`;
-          } else {
-            powerSummaryAverage.textContent = `${formatEnergyWh(totalWh)} / day`;
-          }
-        }
-
-        if (!powerRangeMessage) {
-          return;
-        }
-
-        if (filteredCount === 0 || entries.length === 0 || (chartSummary && chartSummary.hasData === false)) {
-          powerRangeMessage.textContent =
-            selectedPowerRange === 'current'
-              ? 'No recent power samples.'
-              : 'No power history available yet.';
-          return;
-        }
-
-        if (selectedPowerRange === 'day') {
-          let earliestUptime = null;
-          entries.forEach((entry) => {
-            const value = Number(entry?.t);
-            if (!Number.isFinite(value)) {
-              return;
-            }
-            if (earliestUptime === null || value < earliestUptime) {
-              earliestUptime = value;
-            }
-          });
-          const sampleLabel = filteredCount === 1 ? 'sample' : 'samples';
-          const hasRealtimeClock =
-            Number.isFinite(currentTimeState.clockOffsetMs) ||
-            (Number.isFinite(currentTimeState.epochSeconds) &&
-              Number.isFinite(currentTimeState.uptimeMs));
-          if (earliestUptime !== null) {
-            const epochValue = uptimeToEpochMs(earliestUptime);
-            if (hasRealtimeClock && Number.isFinite(epochValue)) {
-              const formattedDate = new Date(epochValue).toLocaleDateString(undefined, {
-                month: 'short',
-                day: '2-digit',
-                year: 'numeric',
-              });
-              powerRangeMessage.textContent = `Showing hourly averages for ${formattedDate} (${filteredCount} ${sampleLabel}).`;
-              return;
-            }
-          }
-          if (hasRealtimeClock) {
-            const fallbackEpoch = estimateReferenceEpochMs(earliestUptime);
-            if (Number.isFinite(fallbackEpoch)) {
-              const formattedDate = new Date(fallbackEpoch).toLocaleDateString(undefined, {
-                month: 'short',
-                day: '2-digit',
-                year: 'numeric',
-              });
-              powerRangeMessage.textContent = `Showing hourly averages for ${formattedDate} (${filteredCount} ${sampleLabel}).`;
-              return;
-            }
-          }
-          powerRangeMessage.textContent = `Showing hourly averages from the latest 24 hours (${filteredCount} ${sampleLabel}).`;
-          return;
-        }
-
-        if (selectedPowerRange === 'current') {
-          const windowStart = Number(chartSummary.windowStartEpoch);
-          const windowEnd = Number(chartSummary.windowEndEpoch);
-          const durationMs =
-            Number.isFinite(windowStart) && Number.isFinite(windowEnd) && windowEnd >= windowStart
-              ? windowEnd - windowStart
-              : currentPowerWindowMs;
-          const durationText = describeDuration(durationMs);
-          powerRangeMessage.textContent = `Showing ${chartSummary.sampleCount} sample${
-            chartSummary.sampleCount === 1 ? '' : 's'
-          } from the last ${durationText}.`;
-          return;
-        }
-
-        if (selectedPowerRange === 'week' || selectedPowerRange === 'month') {
-          const totalDays = selectedPowerRange === 'week' ? 7 : 30;
-          const covered = chartSummary?.coveredBuckets ?? 0;
-          const windowStart = chartSummary?.windowStartEpoch;
-          const windowEnd = chartSummary?.windowEndEpoch;
-          const totalEnergyText = Number.isFinite(chartSummary?.totalWh)
-            ? formatEnergyWh(chartSummary.totalWh)
-            : null;
-          let detail = '';
-          if (Number.isFinite(windowStart) && Number.isFinite(windowEnd)) {
-            const startLabel = new Date(windowStart).toLocaleDateString(undefined, {
-              month: 'short',
-              day: '2-digit',
-            });
-            const endLabel = new Date(windowEnd - 1).toLocaleDateString(undefined, {
-              month: 'short',
-              day: '2-digit',
-            });
-            detail = `${startLabel} – ${endLabel}`;
-          }
-          let message = `Showing daily energy totals for the last ${totalDays} days`;
-          if (detail) {
-            message += ` (${detail})`;
-          }
-          message += '.';
-          message += ` ${covered} of ${totalDays} day${totalDays === 1 ? '' : 's'} include samples.`;
-          if (totalEnergyText) {
-            message += ` Total: ${totalEnergyText}.`;
-          }
-          powerRangeMessage.textContent = message;
-          return;
-        }
-
-        if (selectedPowerRange === 'year') {
-          const covered = chartSummary?.coveredBuckets ?? 0;
-          const windowStart = chartSummary?.windowStartEpoch;
-          const windowEnd = chartSummary?.windowEndEpoch;
-          const totalEnergyText = Number.isFinite(chartSummary?.totalWh)
-            ? formatEnergyWh(chartSummary.totalWh)
-            : null;
-          let detail = '';
-          if (Number.isFinite(windowStart) && Number.isFinite(windowEnd)) {
-            const startLabel = new Date(windowStart).toLocaleDateString(undefined, {
-              month: 'short',
-              year: 'numeric',
-            });
-            const endLabel = new Date(windowEnd - 1).toLocaleDateString(undefined, {
-              month: 'short',
-              year: 'numeric',
-            });
-            detail = `${startLabel} – ${endLabel}`;
-          }
-          let message = 'Showing monthly energy totals for the last 12 months';
-          if (detail) {
-            message += ` (${detail})`;
-          }
-          message += '.';
-          message += ` ${covered} of 12 months include samples.`;
-          if (totalEnergyText) {
-            message += ` Total: ${totalEnergyText}.`;
-          }
-          powerRangeMessage.textContent = message;
-          return;
-        }
-
-        const coverageMs = Number.isFinite(filteredSpanMs) ? filteredSpanMs : 0;
-
-        const startText = formatShortDate(entries[0].t);
-        const endText = formatShortDate(entries[entries.length - 1].t);
-        if (startText && endText) {
-          powerRangeMessage.textContent = `Showing ${filteredCount} samples from ${startText} to ${endText}.`;
-        } else {
-          powerRangeMessage.textContent = `Showing ${filteredCount} samples spanning ${describeDuration(
-            coverageMs,
-          )}.`;
-        }
-      }
-
-      async function refreshPowerHistory(force = false) {
-        if (powerRangeButtons.length === 0) {
-          return;
-        }
-        if (powerHistoryRequest) {
-          if (!force) {
-            return powerHistoryRequest;
-          }
-          try {
-            await powerHistoryRequest;
-          } catch (err) {
-            console.error(err);
-          }
-        }
-
-        const now = Date.now();
-        if (!force && now - lastPowerHistoryRefresh < powerHistoryRefreshIntervalMs) {
-          return;
-        }
-        lastPowerHistoryRefresh = now;
-
-        const requestPromise = (async () => {
-          const duration = powerRangeDurations[selectedPowerRange] || powerRangeDurations.week;
-          const params = new URLSearchParams();
-          const estimatedUptime = estimateCurrentUptimeMs();
-          const canMapEpochToUptime =
-            Number.isFinite(currentTimeState.clockOffsetMs) ||
-            (Number.isFinite(currentTimeState.epochSeconds) &&
-              Number.isFinite(currentTimeState.uptimeMs));
-
-          if (selectedPowerRange === 'day') {
-            let dayStartUptime = null;
-            let dayEndUptime = null;
-            if (canMapEpochToUptime) {
-              const referenceEpoch = estimateReferenceEpochMs(estimatedUptime);
-              if (Number.isFinite(referenceEpoch)) {
-                const dayStart = new Date(referenceEpoch);
-                dayStart.setHours(0, 0, 0, 0);
-                const dayStartEpoch = dayStart.getTime();
-                const dayEndEpoch = dayStartEpoch + 24 * 60 * 60 * 1000 - 1;
-                dayStartUptime = epochToUptimeMs(dayStartEpoch);
-                dayEndUptime = epochToUptimeMs(dayEndEpoch);
-              }
-            }
-            if (!Number.isFinite(dayStartUptime) && Number.isFinite(estimatedUptime)) {
-              dayStartUptime = Math.max(0, estimatedUptime - 24 * 60 * 60 * 1000);
-            }
-            if (Number.isFinite(dayStartUptime)) {
-              params.set('start', String(Math.max(0, Math.floor(dayStartUptime))));
-            }
-            if (
-              Number.isFinite(dayEndUptime) &&
-              Number.isFinite(dayStartUptime) &&
-              dayEndUptime >= dayStartUptime
-            ) {
-              params.set('end', String(Math.floor(dayEndUptime)));
-            }
-          } else if (Number.isFinite(estimatedUptime) && Number.isFinite(duration)) {
-            const startCandidate = Math.max(0, estimatedUptime - duration);
-            params.set('start', String(Math.floor(startCandidate)));
-          }
-          const url = params.toString().length > 0 ? `/api/power-log?${params}` : '/api/power-log';
-          if (powerRangeMessage) {
-            powerRangeMessage.textContent = 'Loading power history…';
-          }
-          const response = await fetch(url);
-          if (!response.ok) {
-            throw new Error('Failed to load power history');
-          }
-          const data = await response.json();
-          const switched = updatePowerRangeAvailability(data);
-          if (switched) {
-            lastPowerHistoryRefresh = 0;
-            setTimeout(() => {
-              refreshPowerHistory(true).catch((err) => console.error(err));
-            }, 0);
-            return;
-          }
-          applyPowerHistoryResponse(data);
-        })();
-
-        powerHistoryRequest = requestPromise;
-        try {
-          await requestPromise;
-        } catch (error) {
-          console.error(error);
-          if (powerRangeMessage) {
-            powerRangeMessage.textContent = error.message || 'Power history unavailable.';
-          }
-          powerSummaryTotal.textContent = '-';
-          powerSummaryAverage.textContent = '-';
-          renderPowerChart(document.getElementById('powerChart'), []);
-        } finally {
-          powerHistoryRequest = null;
-        }
-      }
-
-      function formatTimestamp(epochSeconds) {
-        const numeric = Number(epochSeconds);
-        if (!Number.isFinite(numeric)) {
-          return '-';
-        }
-        const date = new Date(numeric * 1000);
-        const pad = (value) => String(value).padStart(2, '0');
-        const year = date.getFullYear();
-        const month = pad(date.getMonth() + 1);
-        const day = pad(date.getDate());
-        const hours = pad(date.getHours());
-        const minutes = pad(date.getMinutes());
-        const seconds = pad(date.getSeconds());
-        return `${year}-${month}-${day} ${hours}:${minutes}:${seconds}`;
-      }
-
-      function toFixedOrDash(value, digits = 1) {
-        const numeric = Number(value);
-        return Number.isFinite(numeric) ? numeric.toFixed(digits) : '-';
-      }
-
-      function formatOffsetHours(value) {
-        const numeric = Number(value);
-        if (!Number.isFinite(numeric)) {
-          return '';
-        }
-        const rounded = Math.round(numeric * 100) / 100;
-        if (Number.isInteger(rounded)) {
-          return String(rounded);
-        }
-        return rounded.toFixed(2).replace(/0+$/, '').replace(/\.$/, '');
-      }
-
-      if (timezoneOffsetInput) {
-        const detectedFormatted = formatOffsetHours(detectedTimezoneOffsetHours);
-        if (detectedFormatted !== '') {
-          timezoneOffsetInput.placeholder = detectedFormatted;
-          timezoneOffsetInput.title = `Detected from browser: ${detectedFormatted} hours from UTC`;
-          timezoneOffsetInput.value = detectedFormatted;
-        }
-      }
-
-      function formatCompressorTimeout(value) {
-        const numeric = Number(value);
-        if (!Number.isFinite(numeric)) {
-          return '-';
-        }
-        if (numeric <= 0) {
-          return 'Ready';
-        }
-        if (numeric < 60) {
-          return `${numeric.toFixed(1)} s`;
-        }
-        const minutes = Math.floor(numeric / 60);
-        const seconds = Math.round(numeric % 60);
-        const minuteLabel = minutes === 1 ? 'min' : 'mins';
-        const secondLabel = seconds === 1 ? 'sec' : 'secs';
-        if (seconds === 0) {
-          return `${minutes} ${minuteLabel}`;
-        }
-        return `${minutes} ${minuteLabel} ${seconds} ${secondLabel}`;
-      }
-
-      function formatUptimeSeconds(value) {
-        const numeric = Number(value);
-        if (!Number.isFinite(numeric) || numeric < 0) {
-          return '-';
-        }
-        const totalSeconds = Math.floor(numeric);
-        const days = Math.floor(totalSeconds / 86400);
-        const hours = Math.floor((totalSeconds % 86400) / 3600);
-        const minutes = Math.floor((totalSeconds % 3600) / 60);
-        const seconds = totalSeconds % 60;
-        const parts = [];
-        if (days > 0) {
-          parts.push(`${days}d`);
-        }
-        if (hours > 0 || parts.length > 0) {
-          parts.push(`${hours}h`);
-        }
-        if (minutes > 0 || parts.length > 0) {
-          parts.push(`${minutes}m`);
-        }
-        if (parts.length === 0 || seconds > 0) {
-          parts.push(`${seconds}s`);
-        }
-        return parts.join(' ');
-      }
-
-      function renderCurrentTime() {
-        const currentTimeElement = document.getElementById('currentTime');
-        if (!currentTimeElement) {
-          return;
-        }
-        let display = '-';
-        if (Number.isFinite(currentTimeState.epochSeconds)) {
-          const elapsedMs = Date.now() - (currentTimeState.receivedAtMs ?? 0);
-          const computedEpoch = currentTimeState.epochSeconds + elapsedMs / 1000;
-          display = formatTimestamp(computedEpoch);
-        } else if (currentTimeState.formatted) {
-          display = currentTimeState.formatted;
-        }
-        currentTimeElement.textContent = display;
-      }
-
-      function updateStatusBar(data) {
-        const wifiInfo = document.getElementById('wifiInfo');
-        wifiInfo.textContent = data.ssid && data.ip ? `${data.ssid} @ ${data.ip}` : '-';
-
-        const epochValue = Number(data.currentTimeEpoch);
-        const timeString =
-          typeof data.currentTime === 'string' ? data.currentTime.trim() : '';
-        const uptimeSecondsValue = Number(data.uptimeSeconds);
-        const uptimeMs =
-          Number.isFinite(uptimeSecondsValue) && uptimeSecondsValue >= 0
-            ? uptimeSecondsValue * 1000
-            : null;
-        const now = Date.now();
-        const epochSeconds = Number.isFinite(epochValue) && epochValue > 0 ? epochValue : null;
-        const clockOffsetCandidate =
-          epochSeconds !== null && Number.isFinite(uptimeMs)
-            ? epochSeconds * 1000 - uptimeMs
-            : null;
-        currentTimeState = {
-          epochSeconds,
-          receivedAtMs: epochSeconds !== null ? now : null,
-          formatted: timeString !== '' ? timeString : null,
-          uptimeMs: Number.isFinite(uptimeMs) ? uptimeMs : null,
-          uptimeReceivedAtMs: Number.isFinite(uptimeMs) ? now : null,
-          clockOffsetMs: Number.isFinite(clockOffsetCandidate) ? clockOffsetCandidate : null,
-        };
-        if (currentTimeState.formatted === null && currentTimeState.epochSeconds === null) {
-          currentTimeState.receivedAtMs = null;
-        }
-        if (!Number.isFinite(currentTimeState.uptimeMs)) {
-          currentTimeState.uptimeMs = null;
-          currentTimeState.uptimeReceivedAtMs = null;
-        }
-        renderCurrentTime();
-
-        document.getElementById('systemMode').textContent =
-          systemModeLabels[data.systemMode] || data.systemMode || '-';
-        document.getElementById('fanMode').textContent =
-          fanModeLabels[data.fanMode] || data.fanMode || '-';
-        document.getElementById('fanSpeed').textContent =
-          fanSpeedLabels[data.fanSpeed] || data.fanSpeed || '-';
-        document.getElementById('compressor').textContent = data.compressor ? 'Running' : 'Idle';
-        document.getElementById('compressorTimeout').textContent =
-          formatCompressorTimeout(data.compressorTimeout);
-        document.getElementById('compressorOffTimeout').textContent =
-          formatCompressorTimeout(data.compressorOffTimeout);
-        document.getElementById('compressorCooldown').textContent =
-          data.compressorCooldown ? 'Active' : 'Idle';
-        document.getElementById('compressorCooldownRemaining').textContent =
-          formatCompressorTimeout(data.compressorCooldownRemaining);
-        if (schedulingStateElement) {
-          schedulingStateElement.textContent = data.scheduling ? 'Enabled' : 'Disabled';
-        }
-        if (scheduleHoldStateElement) {
-          const remainingSeconds = Number(data.scheduleIgnoreRemainingSeconds);
-          const remainingMs = Number.isFinite(remainingSeconds) ? remainingSeconds * 1000 : 0;
-          if (data.scheduleIgnoreActive && remainingMs > 0) {
-            scheduleHoldStateElement.textContent = `${describeDuration(remainingMs)} remaining`;
-          } else {
-            scheduleHoldStateElement.textContent = 'Inactive';
-          }
-        }
-        updateScheduleIgnoreInteractivity(Boolean(data.scheduling));
-        document.getElementById('target').textContent = toFixedOrDash(data.target);
-        document.getElementById('hysteresis').textContent = toFixedOrDash(data.hysteresis);
-        document.getElementById('compressorTempLimit').textContent = toFixedOrDash(
-          data.compressorTempLimit,
-        );
-        document.getElementById('compressorMinAmbient').textContent = toFixedOrDash(
-          data.compressorMinAmbient,
-        );
-        document.getElementById('compressorCooldownTemp').textContent = toFixedOrDash(
-          data.compressorCooldownTemp,
-        );
-        document.getElementById('compressorCooldownMinutes').textContent = toFixedOrDash(
-          data.compressorCooldownMinutes,
-          2,
-        );
-        document.getElementById('ambient').textContent = toFixedOrDash(data.ambient);
-        document.getElementById('coil').textContent = toFixedOrDash(data.coil);
-        document.getElementById('energy').textContent = toFixedOrDash(data.energyWh);
-        const uptimeElement = document.getElementById('uptime');
-        if (uptimeElement) {
-          uptimeElement.textContent = formatUptimeSeconds(data.uptimeSeconds);
-        }
-      }
-
-      function updateConfigForm(data) {
-        document.getElementById('targetInput').value = Number(data.target).toFixed(1);
-        document.getElementById('hysteresisInput').value = Number(data.hysteresis).toFixed(1);
-        const compressorLimitValue = Number(data.compressorTempLimit);
-        document.getElementById('compressorTempLimitInput').value = Number.isFinite(
-          compressorLimitValue,
-        )
-          ? compressorLimitValue.toFixed(1)
-          : '';
-        const compressorMinAmbientValue = Number(data.compressorMinAmbient);
-        document.getElementById('compressorMinAmbientInput').value = Number.isFinite(
-          compressorMinAmbientValue,
-        )
-          ? compressorMinAmbientValue.toFixed(1)
-          : '';
-        const compressorCooldownTempValue = Number(data.compressorCooldownTemp);
-        document.getElementById('compressorCooldownTempInput').value = Number.isFinite(
-          compressorCooldownTempValue,
-        )
-          ? compressorCooldownTempValue.toFixed(1)
-          : '';
-        const compressorCooldownMinutesValue = Number(data.compressorCooldownMinutes);
-        document.getElementById('compressorCooldownMinutesInput').value = Number.isFinite(
-          compressorCooldownMinutesValue,
-        )
-          ? compressorCooldownMinutesValue.toFixed(2)
-          : '';
-        document.getElementById('fanModeInput').value = data.fanMode;
-        document.getElementById('systemModeInput').value = data.systemMode;
-        document.getElementById('schedulingInput').checked = Boolean(data.scheduling);
-        if (timezoneOffsetInput) {
-          const timezoneOffsetValue = Number(data.timezoneOffset);
-          const detectedFormatted = formatOffsetHours(detectedTimezoneOffsetHours);
-          let displayValue = '';
-          if (Number.isFinite(timezoneOffsetValue)) {
-            displayValue = formatOffsetHours(timezoneOffsetValue);
-          }
-          if (!timezoneOffsetAutoApplied) {
-            const shouldUseDetected =
-              !Number.isFinite(timezoneOffsetValue) || Math.abs(timezoneOffsetValue) < 0.01;
-            if (shouldUseDetected && detectedFormatted !== '') {
-              displayValue = detectedFormatted;
-            }
-            timezoneOffsetAutoApplied = true;
-          }
-          if (displayValue === '' && detectedFormatted !== '') {
-            displayValue = detectedFormatted;
-          }
-          timezoneOffsetInput.value = displayValue;
-        }
-        document.getElementById('weekdayInput').value = scheduleToText(data.weekday || []);
-        document.getElementById('weekendInput').value = scheduleToText(data.weekend || []);
-      }
-
-      function updateLogs(data) {
-        renderTemperatureChart(
-          document.getElementById('temperatureChart'),
-          data && Array.isArray(data.temperatureLog) ? data.temperatureLog : [],
-        );
-      }
-
-      async function refreshState(options = {}) {
-        const { updateForm = false } = options;
-        const data = await fetchState();
-        updateStatusBar(data);
-        updateLogs(data);
-        if (updateForm) {
-          updateConfigForm(data);
-        }
-        refreshPowerHistory().catch((err) => console.error(err));
-      }
-
-      function handleRefreshError(error, showToUser) {
-        console.error(error);
-        if (showToUser) {
-          configStatus.textContent = error.message;
-          configStatus.style.color = '#b00020';
-        }
-      }
-
-      function setScheduleIgnoreBusy(isBusy) {
-        if (!scheduleIgnoreButton) {
-          return;
-        }
-        scheduleIgnoreButton.dataset.busy = isBusy ? 'true' : 'false';
-        updateScheduleIgnoreInteractivity();
-      }
-
-      function updateScheduleIgnoreInteractivity(schedulingEnabledValue) {
-        if (typeof schedulingEnabledValue === 'boolean') {
-          latestSchedulingEnabled = schedulingEnabledValue;
-        }
-        if (!scheduleIgnoreButton) {
-          return;
-        }
-        const busy = scheduleIgnoreButton.dataset.busy === 'true';
-        const disableControls = busy || !latestSchedulingEnabled;
-        scheduleIgnoreButton.disabled = disableControls;
-        if (scheduleIgnoreSelect) {
-          scheduleIgnoreSelect.disabled = disableControls;
-        }
-      }
-
-      function buildConfigPayload(extraParams = null) {
-        const formData = new FormData(configForm);
-        if (!configForm.scheduling.checked) {
-          formData.set('scheduling', 'false');
-        }
-        const payload = new URLSearchParams(formData);
-        if (extraParams && typeof extraParams === 'object') {
-          Object.entries(extraParams).forEach(([key, value]) => {
-            if (typeof value !== 'undefined' && value !== null) {
-              payload.set(key, String(value));
-            }
-          });
-        }
-        return payload;
-      }
-
-      async function sendScheduleIgnoreRequest(minutes) {
-        const payload = buildConfigPayload({ scheduleIgnoreMinutes: minutes });
-        const response = await fetch('/api/config', {
-          method: 'POST',
-          body: payload,
-        });
-        if (!response.ok) {
-          throw new Error('Failed to update schedule hold');
-        }
-      }
-
-      if (scheduleIgnoreButton && scheduleIgnoreSelect) {
-        scheduleIgnoreButton.addEventListener('click', async () => {
-          const minutes = Number(scheduleIgnoreSelect.value);
-          if (!Number.isFinite(minutes) || minutes <= 0) {
-            if (scheduleIgnoreMessage) {
-              scheduleIgnoreMessage.textContent = 'Select a duration to ignore the schedule.';
-              scheduleIgnoreMessage.style.color = '#b00020';
-            }
-            return;
-          }
-          setScheduleIgnoreBusy(true);
-          if (scheduleIgnoreMessage) {
-            scheduleIgnoreMessage.textContent = 'Applying hold…';
-            scheduleIgnoreMessage.style.color = '#333';
-          }
-          try {
-            await sendScheduleIgnoreRequest(minutes);
-            if (scheduleIgnoreMessage) {
-              scheduleIgnoreMessage.textContent = `Ignoring schedule for ${minutes} minutes.`;
-              scheduleIgnoreMessage.style.color = '#006400';
-            }
-            await refreshState();
-          } catch (err) {
-            if (scheduleIgnoreMessage) {
-              scheduleIgnoreMessage.textContent =
-                err?.message || 'Failed to update schedule hold.';
-              scheduleIgnoreMessage.style.color = '#b00020';
-            }
-          } finally {
-            setScheduleIgnoreBusy(false);
-          }
-        });
-      }
-      updateScheduleIgnoreInteractivity(false);
-
-      configForm.addEventListener('submit', async (event) => {
-        event.preventDefault();
-        const payload = buildConfigPayload();
-        configStatus.textContent = 'Saving…';
-        configStatus.style.color = '#333';
-        try {
-          const response = await fetch('/api/config', {
-            method: 'POST',
-            body: payload,
-          });
-          if (!response.ok) {
-            throw new Error('Failed to save configuration');
-          }
-          await refreshState({ updateForm: true });
-          configStatus.textContent = 'Configuration saved.';
-          configStatus.style.color = '#006400';
-        } catch (err) {
-          configStatus.textContent = err.message;
-          configStatus.style.color = '#b00020';
-        }
-      });
-
-      setActivePowerRange(selectedPowerRange);
-      powerRangeButtons.forEach((button) => {
-        button.addEventListener('click', () => {
-          if (button.disabled) {
-            return;
-          }
-          const range = button.dataset.powerRange;
-          if (range && range !== selectedPowerRange) {
-            selectedPowerRange = range;
-            setActivePowerRange(selectedPowerRange);
-            refreshPowerHistory(true).catch((err) => console.error(err));
-          }
-        });
-      });
-
-      if (powerResetButton) {
-        powerResetButton.addEventListener('click', async () => {
-          const confirmed = window.confirm(
-            'Reset power history? This will remove all recorded power log entries.',
-          );
-          if (!confirmed) {
-            return;
-          }
-
-          const originalLabel = powerResetButton.textContent.trim() || 'Reset power log';
-          powerResetButton.disabled = true;
-          powerResetButton.textContent = 'Resetting…';
-
-          try {
-            const response = await fetch('/api/power-log', { method: 'DELETE' });
-            if (!response.ok) {
-              throw new Error('Failed to reset power log');
-            }
-
-            if (powerRangeMessage) {
-              powerRangeMessage.textContent = 'Power history cleared.';
-            }
-            powerSummaryTotal.textContent = '-';
-            powerSummaryAverage.textContent = '-';
-            renderPowerChart(document.getElementById('powerChart'), []);
-            lastPowerHistoryRefresh = 0;
-            await refreshPowerHistory(true);
-          } catch (err) {
-            console.error(err);
-            const message = err && err.message ? err.message : 'Failed to reset power log.';
-            if (powerRangeMessage) {
-              powerRangeMessage.textContent = message;
-            }
-            window.alert(message);
-          } finally {
-            powerResetButton.disabled = false;
-            powerResetButton.textContent = originalLabel;
-          }
-        });
-      }
-
-      (async () => {
-        try {
-          await refreshState({ updateForm: true });
-          await refreshPowerHistory(true);
-        } catch (err) {
-          handleRefreshError(err, true);
-        }
-      })();
-
-      renderCurrentTime();
-      setInterval(renderCurrentTime, 1000);
-      setInterval(() => {
-        refreshState().catch((err) => handleRefreshError(err, false));
-      }, 5000);
-    </script>
-  </body>
-</html>)rawliteral";
+static constexpr const char *kWebInterfaceHtmlEtag = "\"3578337589364067\"";
+
+static constexpr size_t kWebInterfaceHtmlGzipLength = 15657;
+
+static const uint8_t kWebInterfaceHtmlGzip[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xed, 0x7d, 0xed, 0x72, 0x1b, 0xb9,
+    0xb1, 0xe8, 0x7f, 0x3e, 0x05, 0xac, 0x38, 0x21, 0x19, 0x93, 0x14, 0x49, 0x59, 0xb2, 0x4c, 0xea,
+    0xe3, 0xfa, 0x6b, 0x6b, 0x7d, 0xaf, 0x9d, 0x75, 0x59, 0xde, 0xf8, 0xa4, 0x7c, 0x5d, 0xd7, 0x43,
+    0x72, 0x28, 0x4e, 0x3c, 0xe4, 0x30, 0x33, 0x43, 0x4b, 0x8c, 0xc2, 0xaa, 0xbc, 0xc3, 0x79, 0x87,
+    0xf3, 0xfb, 0x3c, 0xc3, 0x79, 0x94, 0x3c, 0xc9, 0xed, 0x6e, 0x7c, 0x63, 0x30, 0x43, 0x4a, 0xf6,
+    0x66, 0x37, 0xa9, 0xdd, 0x4a, 0x2c, 0x0e, 0xd0, 0x68, 0x34, 0x80, 0x46, 0xa3, 0xd1, 0xe8, 0x06,
+    0x4e, 0xee, 0x3d, 0xff, 0xe1, 0xd9, 0xbb, 0x3f, 0xbd, 0x79, 0xc1, 0x66, 0xf9, 0x3c, 0x3e, 0xab,
+    0x9d, 0xc8, 0x3f, 0x61, 0x30, 0x81, 0x3f, 0xf3, 0x30, 0x0f, 0xd8, 0x78, 0x16, 0xa4, 0x59, 0x98,
+    0x9f, 0xee, 0xad, 0xf2, 0x69, 0xfb, 0x78, 0x8f, 0xed, 0x43, 0x46, 0x1e, 0xe5, 0x71, 0x78, 0xf6,
+    0xfd, 0x1f, 0x9f, 0x3c, 0x63, 0xcf, 0x92, 0x45, 0x9e, 0x26, 0x71, 0x1c, 0xa6, 0x27, 0xfb, 0x3c,
+    0x59, 0x94, 0x5b, 0x04, 0xf3, 0xf0, 0x74, 0xef, 0x4b, 0x14, 0x5e, 0x2d, 0x93, 0x34, 0xdf, 0x63,
+    0x63, 0x00, 0x0c, 0x17, 0x80, 0xe7, 0x2a, 0x9a, 0xe4, 0xb3, 0xd3, 0x49, 0xf8, 0x25, 0x1a, 0x87,
+    0x6d, 0xfa, 0x68, 0xb1, 0x68, 0x11, 0xe5, 0x51, 0x10, 0xb7, 0xb3, 0x71, 0x10, 0x87, 0xa7, 0x3d,
+    0x5e, 0x4b, 0x96, 0xaf, 0x11, 0xdd, 0x28, 0x99, 0xac, 0xd9, 0x4d, 0x6d, 0x0a, 0xe5, 0xdb, 0xd3,
+    0x60, 0x1e, 0xc5, 0xeb, 0x01, 0x7b, 0x92, 0x02, 0x74, 0x8b, 0x65, 0xc1, 0x22, 0x6b, 0x67, 0x61,
+    0x1a, 0x4d, 0x87, 0xb5, 0x79, 0x90, 0x5e, 0x46, 0x8b, 0x01, 0xeb, 0xb2, 0x60, 0x95, 0x27, 0xc3,
+    0xda, 0x32, 0x98, 0x4c, 0xa2, 0xc5, 0xe5, 0x80, 0xf5, 0xd2, 0x70, 0x8e, 0xd9, 0xd7, 0xbc, 0xb2,
+    0x01, 0x7b, 0x7c, 0xd4, 0x5d, 0x5e, 0x0f, 0x6b, 0xa3, 0x60, 0xfc, 0xf9, 0x32, 0x4d, 0x56, 0x8b,
+    0xc9, 0x80, 0xfd, 0x66, 0xfa, 0x70, 0xfa, 0x68, 0xfa, 0x78, 0x58, 0x1b, 0x27, 0x71, 0x92, 0xc2,
+    0x77, 0xbf, 0xdf, 0x1f, 0xd6, 0x36, 0x35, 0xec, 0x88, 0x30, 0x85, 0xda, 0x27, 0x51, 0xb6, 0x8c,
+    0x03, 0xa8, 0x79, 0x1a, 0x87, 0x50, 0xf6, 0xcf, 0xab, 0x2c, 0x8f, 0xa6, 0xeb, 0xb6, 0x68, 0xd4,
+    0x80, 0x65, 0xcb, 0x00, 0x5a, 0x33, 0x0a, 0xf3, 0xab, 0x30, 0x5c, 0x0c, 0x6b, 0x41, 0x1c, 0x5d,
+    0x2e, 0xda, 0x51, 0x1e, 0xce, 0xb3, 0x01, 0x1b, 0x03, 0x44, 0x98, 0x4a, 0x0a, 0xdb, 0xa3, 0x24,
+    0xcf, 0x93, 0x39, 0xd0, 0xd5, 0x39, 0x24, 0xca, 0xa0, 0x96, 0x1e, 0xd4, 0xa0, 0xe8, 0xc7, 0x94,
+    0x2c, 0x1c, 0xe7, 0x51, 0xb2, 0x80, 0x64, 0x9b, 0xca, 0x29, 0x34, 0x74, 0x94, 0xa4, 0x40, 0x53,
+    0x3b, 0x0d, 0x26, 0xd1, 0x0a, 0xb0, 0x1f, 0x63, 0x5b, 0x0a, 0x8d, 0xb5, 0x6b, 0xa2, 0xc4, 0x51,
+    0x72, 0xdd, 0xce, 0x66, 0xc1, 0x24, 0xb9, 0xc2, 0x4e, 0xea, 0x2d, 0xaf, 0xd9, 0x01, 0xfc, 0x3f,
+    0xbd, 0x1c, 0x05, 0x8d, 0x6e, 0x8b, 0x89, 0xff, 0x75, 0x7a, 0x4d, 0xac, 0x3f, 0x0e, 0x46, 0x61,
+    0x6c, 0x36, 0x7b, 0x14, 0x27, 0xe3, 0xcf, 0x43, 0x3e, 0x08, 0x57, 0x61, 0x74, 0x39, 0x83, 0x36,
+    0x8f, 0x92, 0x78, 0xa2, 0xea, 0xca, 0x93, 0x25, 0xa0, 0x55, 0x4d, 0x8a, 0x16, 0xcb, 0x55, 0xde,
+    0x82, 0x76, 0xc4, 0xd0, 0x92, 0x56, 0x2d, 0x0f, 0xaf, 0xf3, 0x20, 0x0d, 0x83, 0x56, 0x6d, 0xb4,
+    0x02, 0x9a, 0xb0, 0x61, 0x62, 0x30, 0x7a, 0xdd, 0xee, 0x6f, 0x0d, 0xfa, 0x25, 0x06, 0x1b, 0x6b,
+    0xff, 0x50, 0xb7, 0x20, 0xfa, 0x2b, 0x01, 0x8a, 0x5e, 0x80, 0x24, 0xd9, 0x23, 0x03, 0x6a, 0x53,
+    0x96, 0xc4, 0xd1, 0x84, 0xfd, 0x66, 0x3c, 0x9e, 0x1c, 0x4d, 0x26, 0x85, 0xce, 0x7a, 0x88, 0x9d,
+    0xb5, 0xd1, 0x44, 0x58, 0xbd, 0xdb, 0xed, 0x3e, 0x3a, 0x9e, 0x3c, 0xd4, 0x3c, 0x60, 0xf4, 0xf6,
+    0x80, 0x2d, 0x92, 0x45, 0x08, 0x59, 0xab, 0x34, 0xc3, 0xbc, 0x65, 0x12, 0xf1, 0x31, 0x95, 0xb8,
+    0x06, 0xd0, 0x53, 0xc1, 0x28, 0x0e, 0x27, 0x2e, 0xd2, 0x20, 0x18, 0x1f, 0x85, 0x23, 0x5d, 0x72,
+    0x91, 0xe4, 0xed, 0x20, 0x8e, 0x93, 0xab, 0x70, 0x82, 0xa5, 0x3b, 0x38, 0xbd, 0xf2, 0xf6, 0x38,
+    0x48, 0x27, 0xed, 0x32, 0x66, 0xc3, 0x7f, 0xdb, 0x57, 0x69, 0x00, 0x5d, 0x81, 0xff, 0xde, 0x91,
+    0xfb, 0x2e, 0x03, 0xea, 0xca, 0x47, 0x72, 0x84, 0x3a, 0x4b, 0xa0, 0x21, 0x25, 0x1c, 0x30, 0x7f,
+    0xb3, 0x1d, 0xaa, 0xad, 0x42, 0x5b, 0x82, 0xb5, 0x2d, 0x19, 0xc9, 0x62, 0x9c, 0xa3, 0x6e, 0x57,
+    0xf7, 0x72, 0x6f, 0xda, 0x7f, 0x7c, 0xf0, 0xc8, 0x28, 0x9b, 0x06, 0x8b, 0x4b, 0x68, 0x0c, 0x75,
+    0xab, 0x45, 0x56, 0xb4, 0x88, 0xa3, 0x45, 0xd8, 0x2e, 0xa1, 0xce, 0x25, 0xc4, 0x44, 0xa3, 0xd9,
+    0xcd, 0x91, 0x0d, 0xdd, 0xce, 0x01, 0x16, 0x80, 0xbf, 0x8f, 0x05, 0x87, 0x59, 0xec, 0xf2, 0xf8,
+    0xf1, 0xe3, 0xa5, 0x9f, 0xbf, 0x24, 0xaf, 0x98, 0x63, 0x2d, 0xa7, 0x52, 0xaf, 0x0f, 0xff, 0xf4,
+    0x7b, 0x7d, 0x9c, 0x4e, 0xdd, 0xe3, 0xa6, 0x6e, 0x6a, 0x77, 0x7a, 0x70, 0x78, 0x78, 0x3c, 0xf4,
+    0x74, 0x46, 0x0e, 0xd4, 0x66, 0x11, 0x4e, 0x79, 0xe0, 0x6c, 0x85, 0x12, 0x39, 0x3f, 0x63, 0x61,
+    0x90, 0x85, 0x2d, 0x46, 0x38, 0xcc, 0x04, 0x41, 0xaa, 0x93, 0x5e, 0x68, 0xfa, 0x60, 0x96, 0x7c,
+    0x01, 0xda, 0x81, 0xed, 0x1a, 0x8a, 0x47, 0x9b, 0x0e, 0x93, 0xfa, 0x08, 0xef, 0x37, 0x0b, 0xa8,
+    0x3a, 0x01, 0x08, 0xa5, 0x2f, 0x61, 0xd9, 0xb4, 0x31, 0x09, 0xa2, 0xe4, 0xa3, 0x7e, 0x10, 0x38,
+    0xb3, 0xc9, 0x25, 0xae, 0x6c, 0xd6, 0x84, 0xfd, 0xf0, 0x78, 0xda, 0x2d, 0xe0, 0x1c, 0x8f, 0x26,
+    0x87, 0x61, 0x4f, 0xe3, 0x7c, 0xfc, 0x30, 0x38, 0x18, 0x1d, 0x13, 0xda, 0x09, 0xa2, 0x4d, 0x7f,
+    0xb2, 0xf1, 0x9e, 0x8c, 0xfb, 0x47, 0xfd, 0x23, 0x67, 0xd1, 0x90, 0x89, 0x56, 0x13, 0xef, 0x32,
+    0xb8, 0x15, 0x63, 0x69, 0xb5, 0x6b, 0x97, 0xc1, 0xfc, 0xcd, 0xe8, 0x71, 0x6f, 0xdc, 0x1b, 0x17,
+    0xfa, 0xee, 0xf1, 0xe3, 0xde, 0xa8, 0x37, 0xf2, 0xe0, 0x2c, 0x1b, 0x83, 0xe9, 0x38, 0x38, 0x0c,
+    0x0e, 0x0b, 0x78, 0xa6, 0xc7, 0x8f, 0x7a, 0x8f, 0x8c, 0x31, 0x78, 0x34, 0xed, 0x4d, 0x7a, 0x93,
+    0x72, 0x01, 0xc7, 0x27, 0x75, 0xb6, 0x9a, 0x83, 0x48, 0x5f, 0x9b, 0xd3, 0xf9, 0x32, 0x8d, 0x00,
+    0x02, 0xff, 0x6d, 0x83, 0x48, 0x81, 0xb4, 0x3c, 0xc4, 0x4a, 0x56, 0xf3, 0x05, 0x8c, 0x44, 0x1a,
+    0x2e, 0xc3, 0x20, 0x6f, 0xe0, 0xf0, 0xb5, 0xa7, 0x51, 0xde, 0x62, 0xf3, 0x68, 0x01, 0x4b, 0x78,
+    0xa3, 0x77, 0x0c, 0x6b, 0x37, 0x70, 0xea, 0x34, 0x6d, 0x36, 0x3d, 0x32, 0x4d, 0x54, 0x43, 0xf2,
+    0xb4, 0xd0, 0x9e, 0xe3, 0x69, 0x30, 0x1d, 0xfb, 0x47, 0xf7, 0x38, 0xec, 0x86, 0x8f, 0xb6, 0x2c,
+    0xad, 0xaa, 0x1e, 0x9f, 0x9c, 0x9c, 0x44, 0x29, 0x5f, 0xb2, 0x07, 0x8c, 0xb7, 0x41, 0x11, 0xd7,
+    0x2f, 0x10, 0x67, 0xc9, 0x44, 0x58, 0xcf, 0x42, 0x03, 0x77, 0x1c, 0xe6, 0x39, 0x76, 0x17, 0x08,
+    0x74, 0x51, 0x69, 0xf7, 0x08, 0xd3, 0x71, 0x01, 0x6d, 0x13, 0x23, 0x4d, 0x93, 0x14, 0x96, 0xf4,
+    0xd5, 0x72, 0x19, 0xa6, 0x63, 0x62, 0x12, 0x39, 0x10, 0x47, 0x0f, 0x1f, 0x3d, 0x3c, 0x1e, 0x59,
+    0x35, 0x7d, 0x09, 0xe2, 0x55, 0x68, 0xd7, 0xd4, 0xe3, 0x33, 0x60, 0x58, 0x21, 0x91, 0xbb, 0xd3,
+    0xde, 0xa3, 0x7e, 0x40, 0x88, 0xe6, 0xab, 0x9c, 0x18, 0xc3, 0xad, 0xc3, 0x22, 0xfd, 0xb1, 0x2d,
+    0xfb, 0x81, 0x01, 0x40, 0xb3, 0x33, 0x35, 0x1a, 0x39, 0xe9, 0xb8, 0x6e, 0xd3, 0xc1, 0x21, 0xff,
+    0x6a, 0x46, 0xe8, 0xf7, 0x0b, 0x8c, 0xd0, 0x13, 0x74, 0xe4, 0xc8, 0xce, 0xae, 0x86, 0xa1, 0xb9,
+    0x38, 0x0e, 0x96, 0x59, 0x48, 0xc3, 0x44, 0xbf, 0xa8, 0xc4, 0x0c, 0x54, 0x14, 0x62, 0x18, 0xa9,
+    0x55, 0x08, 0xc5, 0x49, 0xb3, 0x48, 0x78, 0x18, 0x1e, 0xe3, 0x3a, 0x6e, 0xb0, 0xc3, 0x43, 0x2e,
+    0x49, 0x8e, 0x52, 0x35, 0x40, 0xb4, 0x42, 0x0e, 0x58, 0x1c, 0x4e, 0xf3, 0x92, 0x3e, 0xca, 0x67,
+    0x05, 0xb6, 0x84, 0x55, 0x61, 0x7a, 0xc8, 0x87, 0x2d, 0x0f, 0xf2, 0xd5, 0x2e, 0x2b, 0xb1, 0xd5,
+    0x5c, 0x59, 0x6c, 0x12, 0x7d, 0xc1, 0x4e, 0x07, 0xad, 0x49, 0x36, 0xfc, 0x61, 0x97, 0xab, 0x3b,
+    0x86, 0x92, 0x51, 0x82, 0xbc, 0x9c, 0x7d, 0xf5, 0xdc, 0x32, 0x90, 0x8c, 0x83, 0xc5, 0x97, 0x20,
+    0x73, 0xbb, 0xd8, 0x50, 0xb1, 0x79, 0xc2, 0xa6, 0xc6, 0x01, 0x79, 0x51, 0x8f, 0x3a, 0x69, 0x77,
+    0x44, 0x30, 0x1d, 0x4d, 0x27, 0xb7, 0x99, 0x9f, 0x47, 0xa2, 0x79, 0x5c, 0x31, 0x28, 0x55, 0x15,
+    0x76, 0xd2, 0x5b, 0xb2, 0xf1, 0x2c, 0x9c, 0xac, 0xe2, 0xb0, 0x0d, 0xb0, 0x49, 0x1a, 0x7e, 0x5b,
+    0xbd, 0x48, 0xcf, 0x04, 0x3e, 0x11, 0xaa, 0x6b, 0x94, 0xf2, 0xc1, 0xd8, 0x11, 0x14, 0x27, 0x6b,
+    0x15, 0x02, 0xa9, 0x75, 0x97, 0x43, 0xf8, 0x97, 0x49, 0x0f, 0x4e, 0xc5, 0x92, 0x1e, 0x6e, 0x96,
+    0x42, 0xe1, 0xe0, 0xd1, 0xc3, 0xde, 0x21, 0xac, 0x08, 0xc8, 0x7a, 0x33, 0x41, 0x63, 0x4f, 0xca,
+    0x3d, 0xdd, 0xf4, 0xbe, 0x25, 0x04, 0xb8, 0xb2, 0xdb, 0xa6, 0xad, 0xe2, 0xce, 0x3c, 0x69, 0xf5,
+    0x34, 0x01, 0x85, 0x8b, 0x89, 0x2b, 0x69, 0xcd, 0x99, 0x98, 0x22, 0x35, 0x85, 0xfa, 0xf8, 0x4c,
+    0xf1, 0xce, 0xcf, 0x93, 0x7d, 0xb1, 0xeb, 0x3c, 0xd9, 0x17, 0x9b, 0x60, 0xdc, 0x7e, 0x8a, 0x2d,
+    0x71, 0x98, 0xe2, 0x8f, 0x5e, 0x71, 0xe3, 0x0b, 0x69, 0xb5, 0x13, 0xc4, 0x3a, 0x8e, 0x83, 0x2c,
+    0x3b, 0xdd, 0x33, 0x2a, 0xdb, 0x13, 0x39, 0xd1, 0x04, 0x77, 0xbe, 0xd3, 0xe8, 0xe5, 0x62, 0x9a,
+    0xec, 0x9d, 0x9d, 0xec, 0x43, 0x1a, 0xcf, 0x39, 0xfb, 0x71, 0x99, 0x47, 0x73, 0x20, 0xe2, 0x04,
+    0x84, 0xfe, 0x82, 0xe0, 0x56, 0x94, 0xb2, 0x77, 0xd6, 0x06, 0x6a, 0x20, 0xcd, 0x84, 0xa6, 0x7c,
+    0x58, 0x6a, 0x53, 0x60, 0xb3, 0x77, 0x12, 0x88, 0xe7, 0xca, 0x3f, 0x8a, 0x52, 0xb9, 0x89, 0xc4,
+    0x22, 0x7c, 0x1c, 0x2f, 0x78, 0x0a, 0xd2, 0x34, 0xeb, 0x9f, 0x3d, 0xe3, 0x68, 0xd8, 0x05, 0xe5,
+    0x41, 0xc1, 0xbe, 0xdd, 0x0a, 0x5e, 0x46, 0x34, 0xe0, 0xec, 0x75, 0x32, 0xb1, 0x88, 0xcc, 0xd6,
+    0x19, 0x8c, 0x03, 0xa6, 0x7a, 0x09, 0x3d, 0xfb, 0x2e, 0x58, 0x98, 0xe0, 0xd3, 0x60, 0x61, 0xc3,
+    0xb2, 0x86, 0x95, 0x79, 0xb1, 0x0c, 0xc3, 0x89, 0xce, 0x6d, 0x9a, 0xa8, 0x9e, 0x25, 0xf3, 0x65,
+    0x1a, 0x66, 0xa4, 0x5e, 0xe8, 0x42, 0x63, 0x95, 0xea, 0x27, 0x40, 0x97, 0x62, 0xd8, 0x53, 0xc9,
+    0x2a, 0xf7, 0x97, 0x16, 0x99, 0x5b, 0x91, 0xfc, 0x30, 0x9d, 0x56, 0x23, 0x02, 0x80, 0x2d, 0xb8,
+    0x60, 0xc3, 0x9c, 0x5c, 0x2d, 0xd8, 0x13, 0xd2, 0xa3, 0xfd, 0x48, 0x24, 0xd0, 0x16, 0x14, 0x6f,
+    0xc3, 0x79, 0x10, 0x2d, 0x68, 0x21, 0xaa, 0xc2, 0xa2, 0xc0, 0xfc, 0xe8, 0x2e, 0xf8, 0x6c, 0x77,
+    0xd0, 0x64, 0x2a, 0x15, 0x39, 0x23, 0xac, 0x2c, 0x1a, 0xb2, 0xef, 0xa1, 0x26, 0x4f, 0xe9, 0x10,
+    0xd3, 0x2b, 0xca, 0xbf, 0x03, 0xb9, 0x10, 0x5a, 0x1d, 0x99, 0x53, 0x8a, 0x86, 0xfe, 0x9f, 0xff,
+    0x7e, 0x66, 0x16, 0xf8, 0x1e, 0xf9, 0x0d, 0x5a, 0x17, 0x65, 0x66, 0xa1, 0x99, 0x4a, 0x2d, 0x2d,
+    0x68, 0xf2, 0x01, 0xa8, 0x17, 0xec, 0x55, 0x34, 0x8f, 0xca, 0x58, 0x01, 0xf2, 0x29, 0x7b, 0x17,
+    0x64, 0xaf, 0x23, 0x18, 0xc9, 0xf9, 0x28, 0xa2, 0x1d, 0xb8, 0x0f, 0x1b, 0x00, 0x88, 0xfc, 0x0a,
+    0x74, 0x62, 0x3c, 0xb1, 0xe6, 0xea, 0xa1, 0x44, 0x88, 0xed, 0x78, 0x9e, 0xaf, 0xd2, 0x80, 0xcb,
+    0xcc, 0x2a, 0x5c, 0x40, 0x19, 0x28, 0x76, 0x46, 0x97, 0xa1, 0x56, 0x65, 0xe2, 0xf3, 0xb4, 0x2b,
+    0xd8, 0xda, 0x94, 0x28, 0xb6, 0x6b, 0x8d, 0xe2, 0x52, 0xe0, 0x17, 0x8b, 0x30, 0xbd, 0x5c, 0x9b,
+    0xe0, 0x21, 0xa5, 0x18, 0x14, 0xbd, 0x9f, 0xb9, 0x82, 0x4d, 0xc8, 0x33, 0x2d, 0xd9, 0x84, 0x18,
+    0x4b, 0x16, 0xd3, 0xe8, 0x52, 0xb4, 0x5b, 0x48, 0x31, 0x54, 0x92, 0x05, 0x15, 0x98, 0xf9, 0x1d,
+    0x7c, 0xee, 0xd9, 0xc2, 0x0d, 0xd5, 0x4d, 0x29, 0xda, 0x6a, 0x27, 0x7c, 0xc9, 0x85, 0x52, 0x92,
+    0x0d, 0x5f, 0xa2, 0xfd, 0x6a, 0x4f, 0x70, 0x29, 0x8d, 0x4e, 0x08, 0x15, 0xac, 0xd2, 0x90, 0x35,
+    0xa0, 0x29, 0x20, 0x9d, 0xa8, 0x04, 0x94, 0x24, 0x43, 0x97, 0xc1, 0xbf, 0xbc, 0xa0, 0xb0, 0x7e,
+    0x0a, 0x96, 0x66, 0xf9, 0x7a, 0x09, 0x5f, 0x8b, 0xd5, 0x7c, 0x14, 0xa6, 0x7b, 0x0c, 0x38, 0x76,
+    0x79, 0xba, 0xd7, 0xed, 0x08, 0x33, 0xa7, 0xd1, 0x2d, 0x16, 0x21, 0x9a, 0xb5, 0x05, 0x31, 0x7a,
+    0x06, 0x94, 0x13, 0xe1, 0x16, 0x12, 0x84, 0x18, 0xd3, 0xe4, 0x6e, 0xc4, 0x78, 0xe6, 0x88, 0xa0,
+    0xca, 0x3b, 0xbd, 0xbc, 0x04, 0xd6, 0x4a, 0x26, 0x1b, 0x47, 0x54, 0xe3, 0x94, 0xfa, 0x26, 0x63,
+    0xcd, 0x22, 0xb9, 0xa6, 0x49, 0x46, 0x95, 0x03, 0x7e, 0xed, 0xd5, 0x76, 0x23, 0x5d, 0x4f, 0xc8,
+    0x22, 0xed, 0xc6, 0x6c, 0xde, 0x85, 0x78, 0x17, 0x55, 0x81, 0x7a, 0x63, 0xf2, 0x97, 0x93, 0xbf,
+    0x1b, 0xd9, 0xa6, 0x04, 0x28, 0x12, 0x6e, 0x89, 0x90, 0x5d, 0x48, 0x2f, 0xa2, 0x2b, 0x10, 0x6f,
+    0xc9, 0x9c, 0x6f, 0xd5, 0xfb, 0x8e, 0xf0, 0xa9, 0x68, 0x89, 0x14, 0x62, 0xac, 0x31, 0xe7, 0xb0,
+    0x3b, 0xb6, 0xc8, 0xc2, 0x5c, 0xda, 0x28, 0x29, 0xfc, 0xbe, 0xae, 0x5d, 0x42, 0x9f, 0x11, 0xad,
+    0x00, 0x65, 0x87, 0xe1, 0xa7, 0xa6, 0x93, 0xeb, 0xe0, 0xa6, 0xea, 0x63, 0x4d, 0x48, 0xa5, 0x0e,
+    0xd5, 0x4e, 0x92, 0x25, 0xb5, 0x95, 0xf6, 0xea, 0x20, 0x66, 0x41, 0x13, 0xdf, 0x3b, 0x7b, 0x02,
+    0xff, 0xce, 0xa1, 0x0f, 0xc6, 0x27, 0xfb, 0x3c, 0xbb, 0x00, 0x97, 0x4c, 0xa7, 0x7b, 0x67, 0xa0,
+    0x71, 0x94, 0x02, 0xc4, 0xc9, 0xd5, 0xde, 0xd9, 0xab, 0xe4, 0xaa, 0x14, 0x60, 0x1e, 0xc2, 0x2e,
+    0x0a, 0xc4, 0xe2, 0x6b, 0xfa, 0x5b, 0x0a, 0x36, 0x03, 0x15, 0x1a, 0x64, 0x0f, 0xfc, 0x6b, 0x80,
+    0xec, 0xf3, 0xe6, 0x55, 0xf4, 0x8f, 0x56, 0x0f, 0x45, 0x17, 0x5d, 0x50, 0x42, 0x79, 0x2f, 0xb9,
+    0x05, 0x44, 0x47, 0x99, 0x6a, 0xa6, 0x4b, 0xda, 0x18, 0x46, 0x94, 0x74, 0x9b, 0x67, 0xfc, 0x47,
+    0x79, 0x1b, 0x42, 0xe8, 0x4b, 0x04, 0xfc, 0x9e, 0xff, 0x28, 0x05, 0x84, 0x61, 0xe1, 0x83, 0xf9,
+    0xc3, 0x22, 0x5e, 0x97, 0x42, 0x45, 0x93, 0x18, 0xa8, 0x79, 0x09, 0xff, 0xde, 0xaa, 0x4b, 0x50,
+    0xa9, 0xff, 0x6b, 0xb2, 0x08, 0x61, 0xd4, 0x32, 0xbd, 0xc2, 0x88, 0x44, 0xc6, 0x53, 0x59, 0x63,
+    0x96, 0xac, 0xd2, 0x8c, 0x4d, 0xd3, 0x64, 0xce, 0x7e, 0x7c, 0xe7, 0x9f, 0xcb, 0x3e, 0x44, 0x82,
+    0xdd, 0xed, 0xac, 0x32, 0x1e, 0xef, 0x1f, 0x0a, 0x26, 0x6f, 0xf7, 0xfa, 0x7b, 0xb8, 0x6f, 0x3f,
+    0xdd, 0xeb, 0x3d, 0xb4, 0xf8, 0x7d, 0xdf, 0xa4, 0x5e, 0x2c, 0x99, 0x7c, 0x53, 0xbd, 0x67, 0xad,
+    0x37, 0x5a, 0x57, 0xb4, 0x47, 0x4d, 0x25, 0xcb, 0xf5, 0x06, 0x12, 0xc6, 0x9f, 0x47, 0xc9, 0xf5,
+    0x9e, 0xec, 0xc4, 0x3c, 0x5d, 0x85, 0xb4, 0xe6, 0xbc, 0x58, 0x90, 0xbd, 0x46, 0x17, 0xa9, 0xe9,
+    0x36, 0x9b, 0xbb, 0x91, 0x92, 0xbd, 0xec, 0x9e, 0xa5, 0x75, 0xbe, 0xa4, 0xcc, 0x67, 0x32, 0xcf,
+    0xe1, 0x49, 0x0b, 0xe8, 0x82, 0xc6, 0x0b, 0xc6, 0x91, 0xbe, 0x64, 0xfd, 0x21, 0x82, 0xfa, 0x19,
+    0xd4, 0x5b, 0xda, 0xe5, 0x8d, 0x5e, 0x77, 0xef, 0xac, 0xd7, 0x65, 0x42, 0x70, 0x95, 0xb2, 0x50,
+    0x1f, 0xc0, 0xfa, 0xdb, 0xc1, 0x0e, 0x00, 0xec, 0x60, 0x3b, 0xd8, 0x43, 0x00, 0x7b, 0xb8, 0x1d,
+    0xec, 0x10, 0xc0, 0x0e, 0xb7, 0x83, 0x1d, 0x01, 0xd8, 0xd1, 0x76, 0xb0, 0x47, 0x00, 0xf6, 0x68,
+    0x3b, 0xd8, 0x31, 0x80, 0x1d, 0x6f, 0x07, 0x7b, 0x0c, 0x60, 0x8f, 0xb7, 0x83, 0xf5, 0xba, 0xd4,
+    0xbf, 0x3b, 0x00, 0xd2, 0x40, 0xec, 0x30, 0x12, 0x3d, 0x18, 0x0a, 0x61, 0x31, 0x09, 0x27, 0x67,
+    0x3d, 0xef, 0xa0, 0xe8, 0xb9, 0x2d, 0x0c, 0x27, 0x9c, 0xa7, 0xf9, 0x87, 0x8f, 0x01, 0x9f, 0xf2,
+    0x9c, 0xb3, 0x27, 0xcb, 0x65, 0xbc, 0x66, 0x33, 0x58, 0x78, 0x4e, 0xf6, 0x39, 0xb4, 0x9e, 0x5b,
+    0x4b, 0xc9, 0xd9, 0x64, 0x64, 0x05, 0x4e, 0xc2, 0xd5, 0x36, 0x49, 0x83, 0x34, 0x12, 0x45, 0x58,
+    0x3e, 0x0b, 0xc9, 0x32, 0x43, 0x2b, 0x81, 0x66, 0xd0, 0x3c, 0x61, 0x9f, 0xc3, 0x70, 0xc9, 0xe6,
+    0xc1, 0x62, 0x15, 0xc4, 0x2c, 0x98, 0xe0, 0x79, 0xe0, 0x1c, 0x34, 0x8d, 0x0c, 0x79, 0x97, 0x05,
+    0x2c, 0x9b, 0x25, 0x69, 0xce, 0x50, 0x14, 0x74, 0xa0, 0xb6, 0x25, 0xd5, 0x55, 0xa4, 0xf1, 0x35,
+    0xac, 0x8a, 0xc1, 0x25, 0xcc, 0xc1, 0x92, 0x09, 0x26, 0xb7, 0xff, 0x12, 0x83, 0x43, 0xad, 0xdc,
+    0x00, 0x66, 0x0c, 0x54, 0x63, 0x36, 0x09, 0xd6, 0x2c, 0xc8, 0xd8, 0xf7, 0xdf, 0x0f, 0x5e, 0xbf,
+    0x3e, 0x7d, 0xf7, 0xe2, 0xf5, 0x9b, 0xbf, 0xcd, 0x41, 0x64, 0x0f, 0xff, 0xf1, 0xf7, 0xff, 0x82,
+    0x45, 0x1c, 0x7e, 0x31, 0xde, 0x97, 0x78, 0x68, 0x1f, 0x76, 0x2e, 0x3b, 0x4c, 0x88, 0xee, 0x7d,
+    0x14, 0xa5, 0xcd, 0x0e, 0x7b, 0xb2, 0x60, 0xd0, 0xf8, 0x7c, 0x8d, 0x78, 0x6a, 0xd8, 0xf6, 0x8c,
+    0x1a, 0x3f, 0x09, 0xa7, 0xc1, 0x2a, 0x86, 0xa6, 0x90, 0x1e, 0x2d, 0x1b, 0xb3, 0x8b, 0x16, 0xaf,
+    0x1a, 0x93, 0xad, 0x60, 0x18, 0x2e, 0x56, 0x0b, 0x40, 0xac, 0x67, 0xb5, 0x3c, 0x8e, 0xae, 0x99,
+    0xbd, 0x42, 0xa0, 0x42, 0x8c, 0xd2, 0xcf, 0x49, 0x90, 0x07, 0x6d, 0x95, 0xbb, 0x4c, 0x93, 0x69,
+    0x14, 0xcb, 0xbc, 0x34, 0xb9, 0x82, 0xea, 0x0f, 0xf6, 0x6a, 0xcb, 0x38, 0x18, 0x87, 0x48, 0x71,
+    0x08, 0xb5, 0x76, 0x8f, 0x07, 0xdd, 0xee, 0x69, 0xff, 0xa0, 0x73, 0xf8, 0x37, 0xd1, 0xc0, 0x61,
+    0xaf, 0x4f, 0x49, 0x87, 0x9d, 0xae, 0x4e, 0x92, 0x50, 0x3a, 0xa9, 0x7f, 0x20, 0xa0, 0x0e, 0xff,
+    0x46, 0x8b, 0x4b, 0x0d, 0x7a, 0x5d, 0x12, 0x59, 0xb5, 0xc8, 0x4a, 0xe2, 0xe6, 0xc8, 0x6c, 0xaf,
+    0x93, 0x5d, 0x5a, 0x89, 0xa0, 0xa2, 0x95, 0xf4, 0xb3, 0xa4, 0x95, 0x94, 0x57, 0xd2, 0xca, 0xa3,
+    0x02, 0xfd, 0xdd, 0xc7, 0x94, 0x74, 0x64, 0xb6, 0xf2, 0xd1, 0xe0, 0xc0, 0xe9, 0x8b, 0xbe, 0xee,
+    0x8b, 0x3b, 0xb5, 0x32, 0x87, 0x15, 0xe3, 0xec, 0xdd, 0x2a, 0xcc, 0x76, 0x68, 0x26, 0xc2, 0xca,
+    0x35, 0x11, 0x7f, 0x96, 0x34, 0x93, 0xf2, 0x7e, 0x61, 0xcd, 0xbc, 0xc2, 0xf9, 0xf5, 0x3e, 0x9c,
+    0x2c, 0x76, 0x6a, 0x28, 0x42, 0x8b, 0x86, 0xd2, 0xcf, 0x92, 0x86, 0x52, 0xde, 0x2f, 0x6d, 0x3c,
+    0x67, 0x2b, 0x18, 0xcf, 0x19, 0xe8, 0x3b, 0xbb, 0x0c, 0x28, 0x00, 0xcb, 0x01, 0xc5, 0x9f, 0x65,
+    0x03, 0x8a, 0x79, 0xbf, 0xb0, 0x76, 0x4e, 0xd3, 0x08, 0xb4, 0x4a, 0x10, 0x55, 0xdb, 0x5b, 0x89,
+    0xa0, 0xa2, 0x95, 0xf4, 0xb3, 0xa4, 0x95, 0x94, 0xf7, 0x0b, 0x6b, 0x65, 0x16, 0xa0, 0x96, 0x8f,
+    0x46, 0x92, 0x5d, 0x64, 0x6d, 0xa0, 0x54, 0x56, 0xfa, 0x59, 0x26, 0x6b, 0x31, 0xef, 0x17, 0x26,
+    0x6b, 0x67, 0x78, 0x26, 0x15, 0xac, 0x61, 0x33, 0xc1, 0x7f, 0x6c, 0x6b, 0xaa, 0x84, 0x17, 0xcd,
+    0x55, 0x9f, 0x25, 0x4d, 0x56, 0xf9, 0x3f, 0x4b, 0xb3, 0xf7, 0x0b, 0xed, 0x46, 0x8f, 0x03, 0x60,
+    0x5d, 0xb5, 0x61, 0xaf, 0x89, 0x66, 0xb3, 0x7d, 0x26, 0xb3, 0x70, 0xd5, 0xce, 0x58, 0xe3, 0x4f,
+    0xf0, 0x5f, 0xfb, 0xf5, 0xeb, 0xf6, 0xf3, 0xe7, 0xa7, 0xa2, 0x35, 0xb4, 0xfe, 0xff, 0xe3, 0xef,
+    0xff, 0xc9, 0xc4, 0x37, 0x8b, 0x32, 0x06, 0xcb, 0x27, 0xa4, 0xc2, 0xc0, 0x32, 0xd0, 0x55, 0x44,
+    0x63, 0x9b, 0xb5, 0x92, 0x4e, 0x74, 0x2a, 0x17, 0x5d, 0xa8, 0x52, 0x65, 0x27, 0xf5, 0x9d, 0x4e,
+    0xea, 0x77, 0xfb, 0x0f, 0x61, 0x6b, 0xd3, 0xee, 0x1f, 0x9e, 0x8a, 0x1a, 0x86, 0x2a, 0xe9, 0xe8,
+    0x94, 0x16, 0x70, 0xbb, 0xf5, 0x96, 0x5a, 0x97, 0xad, 0x46, 0x64, 0x02, 0xbe, 0x08, 0xbe, 0x84,
+    0xcc, 0xb1, 0x2e, 0x2a, 0x25, 0x6e, 0x69, 0x98, 0x17, 0x2f, 0x2c, 0x4d, 0x69, 0x1f, 0x8d, 0x8f,
+    0x15, 0xf6, 0xca, 0x57, 0xc9, 0xa5, 0xe7, 0xb0, 0xc5, 0xd0, 0x64, 0x64, 0x92, 0x3e, 0x70, 0xa5,
+    0x03, 0x9b, 0x83, 0x33, 0x8f, 0x19, 0x12, 0x52, 0x6b, 0x27, 0xe2, 0x38, 0x96, 0xb6, 0x86, 0x1a,
+    0xe4, 0x19, 0x16, 0xdf, 0xb3, 0x90, 0xed, 0x31, 0xee, 0x7c, 0xb9, 0xf7, 0x08, 0x95, 0x5e, 0x7e,
+    0x56, 0x07, 0x2c, 0x86, 0x9b, 0x91, 0x93, 0x7d, 0x8e, 0xc5, 0x9a, 0x01, 0x7e, 0x4a, 0xbc, 0x19,
+    0xc2, 0x7b, 0x4d, 0x50, 0xfa, 0x06, 0x3d, 0x01, 0x58, 0xe3, 0xbd, 0xa4, 0xd0, 0x28, 0x62, 0x3b,
+    0x88, 0x21, 0x3c, 0xd9, 0x80, 0xbd, 0xb9, 0xdc, 0x55, 0x62, 0xef, 0xec, 0x2d, 0x3a, 0xac, 0x08,
+    0xc3, 0xb0, 0x07, 0x99, 0xe5, 0x31, 0xb6, 0x57, 0xa6, 0xa5, 0x8b, 0x22, 0x96, 0x5f, 0x18, 0xf7,
+    0x68, 0xda, 0x63, 0x34, 0x17, 0x0d, 0x64, 0xea, 0x8c, 0x0d, 0xb0, 0x89, 0x63, 0xb2, 0x9a, 0x31,
+    0xf8, 0xbb, 0xe2, 0xf7, 0x21, 0x26, 0xd1, 0x51, 0x7b, 0x13, 0x64, 0x39, 0x29, 0xbb, 0xdf, 0x08,
+    0xeb, 0x55, 0x18, 0x7e, 0x96, 0x68, 0xf1, 0xf7, 0xb7, 0xc2, 0x0b, 0x6a, 0x60, 0x3e, 0x93, 0x88,
+    0xe9, 0xe3, 0x5b, 0x61, 0x5e, 0x87, 0x41, 0x2a, 0x11, 0xe3, 0xef, 0x5a, 0x71, 0x87, 0x54, 0xba,
+    0xd9, 0x4a, 0xc3, 0x2c, 0xcc, 0x89, 0xc7, 0x60, 0x32, 0x3d, 0xb5, 0xeb, 0xb5, 0x9c, 0x9b, 0x80,
+    0x75, 0x10, 0x94, 0x51, 0xcd, 0x2c, 0x4e, 0x2e, 0x8b, 0x95, 0x14, 0xb9, 0xdd, 0xf2, 0x58, 0x72,
+    0x18, 0xde, 0x74, 0x30, 0x2a, 0xc9, 0x12, 0x3c, 0xfb, 0x2e, 0xc9, 0x61, 0x73, 0xb6, 0xc2, 0x2d,
+    0x96, 0xa7, 0x0e, 0xcb, 0x43, 0x87, 0x37, 0x8a, 0xaa, 0xbd, 0xe0, 0xe9, 0x54, 0xb8, 0x78, 0xb6,
+    0x7b, 0x27, 0x42, 0x9e, 0x80, 0xb4, 0x04, 0x22, 0xe4, 0x36, 0xed, 0xf6, 0xc4, 0x08, 0x04, 0x9e,
+    0xa3, 0x66, 0xb9, 0x91, 0x55, 0x25, 0x68, 0xa2, 0xba, 0x1b, 0x4b, 0xee, 0x44, 0x64, 0x3a, 0x07,
+    0xa1, 0x61, 0x32, 0x40, 0x37, 0x1a, 0x31, 0x30, 0xb3, 0x28, 0xcb, 0x93, 0x74, 0x0d, 0xeb, 0x02,
+    0x17, 0xa1, 0x86, 0x40, 0x23, 0x80, 0xaf, 0x15, 0x65, 0x9e, 0x13, 0xa4, 0x71, 0x1a, 0x2d, 0x61,
+    0x43, 0x0f, 0x92, 0x06, 0xf8, 0x4f, 0x9f, 0x12, 0xb1, 0x53, 0x36, 0x49, 0xc6, 0x2b, 0xdc, 0x4d,
+    0x77, 0x60, 0xcb, 0xf9, 0x22, 0x0e, 0xf1, 0xe7, 0xd3, 0xf5, 0xcb, 0x49, 0xa3, 0xae, 0xa1, 0xea,
+    0xe4, 0xd4, 0xa9, 0x4b, 0xf2, 0x05, 0x60, 0x7b, 0x59, 0x0e, 0xa7, 0x4b, 0x7b, 0x0c, 0x79, 0x55,
+    0x48, 0x3c, 0xe0, 0x1a, 0xd7, 0x24, 0xcc, 0xc9, 0x84, 0xf1, 0xce, 0x02, 0xfa, 0x9e, 0xac, 0x89,
+    0xa7, 0xac, 0xbd, 0x08, 0xaf, 0xd8, 0xf3, 0x20, 0x0f, 0x1b, 0x4d, 0x44, 0x6b, 0x03, 0x35, 0x9a,
+    0xb0, 0x98, 0x1f, 0x75, 0xc9, 0xfb, 0xcc, 0xa1, 0x09, 0x0d, 0xd1, 0x68, 0xc4, 0x88, 0x60, 0x04,
+    0x4f, 0xd9, 0x34, 0x88, 0xb9, 0xc7, 0x19, 0x56, 0xa8, 0x2d, 0xb3, 0xaf, 0x90, 0xd1, 0xb0, 0x16,
+    0x74, 0x14, 0x4b, 0xf8, 0x71, 0x72, 0x5d, 0xd8, 0x64, 0xeb, 0xad, 0x9a, 0xb0, 0xbe, 0x42, 0x9a,
+    0x30, 0xbf, 0x42, 0xda, 0x14, 0xbd, 0x03, 0xea, 0xd2, 0xd2, 0x0a, 0x09, 0xa8, 0x93, 0x40, 0x0a,
+    0x1a, 0x55, 0xe1, 0x6b, 0x23, 0x2b, 0x11, 0x76, 0x72, 0xa3, 0x06, 0x34, 0x88, 0x00, 0x20, 0x12,
+    0x06, 0x80, 0xc9, 0x74, 0x0a, 0x1f, 0x40, 0x2b, 0xfc, 0x8e, 0xd1, 0xb3, 0xbd, 0xfe, 0x2a, 0xb9,
+    0x82, 0xdf, 0xdc, 0xb8, 0x0d, 0x9f, 0xdc, 0xba, 0x8d, 0x54, 0x00, 0x87, 0x20, 0x09, 0xf0, 0xc7,
+    0xa9, 0x80, 0x5c, 0x0f, 0x8c, 0x1a, 0xbe, 0x02, 0x27, 0x76, 0xa0, 0xe1, 0x9d, 0x41, 0xe7, 0xdf,
+    0x84, 0x33, 0x5c, 0x26, 0xe3, 0xd9, 0x45, 0x08, 0x75, 0x4e, 0xb2, 0x01, 0x5b, 0xac, 0xe2, 0xb8,
+    0x55, 0x4b, 0xc3, 0x71, 0x08, 0xab, 0xcf, 0xe4, 0x49, 0xfe, 0x5a, 0xa5, 0xa1, 0xee, 0x10, 0xe4,
+    0x30, 0x8c, 0x32, 0x41, 0x11, 0xaa, 0xe7, 0xd7, 0x53, 0xe1, 0x1a, 0x7d, 0xca, 0x9e, 0xa4, 0x69,
+    0xb0, 0xee, 0xa0, 0xad, 0xb8, 0x51, 0x53, 0x5c, 0xf3, 0x97, 0x55, 0x98, 0xae, 0xb9, 0x79, 0x32,
+    0x49, 0x9f, 0xc4, 0x71, 0xa3, 0x6e, 0xf9, 0xdc, 0x7e, 0x70, 0x45, 0xf1, 0xc7, 0x7a, 0xb3, 0x55,
+    0x6b, 0xda, 0xd5, 0xa0, 0xd0, 0xe4, 0xd5, 0x54, 0xf1, 0xa3, 0x47, 0x0c, 0xd7, 0x6d, 0x44, 0xa6,
+    0x38, 0xab, 0xc2, 0x54, 0x00, 0xf6, 0xe3, 0x91, 0xa2, 0x6c, 0x47, 0x4c, 0x02, 0xdc, 0xc1, 0x65,
+    0xca, 0xa8, 0xad, 0x98, 0x4c, 0x60, 0x8d, 0xa7, 0xe0, 0xe3, 0x20, 0x0a, 0x56, 0xa1, 0x2b, 0x94,
+    0x29, 0xa0, 0x93, 0x0e, 0x17, 0xbb, 0x23, 0x93, 0x25, 0x8a, 0x94, 0x99, 0x46, 0xea, 0x5d, 0xa8,
+    0x32, 0xe1, 0xcb, 0xb0, 0x6d, 0x67, 0x08, 0x1f, 0x7c, 0x19, 0xb6, 0x1d, 0x46, 0xc0, 0x5b, 0x00,
+    0xf1, 0x45, 0x53, 0xd6, 0xf0, 0xd5, 0x85, 0xbe, 0xd0, 0xbe, 0xf4, 0x0e, 0xf2, 0x3c, 0xf0, 0x6a,
+    0x67, 0xb4, 0xca, 0xd6, 0x50, 0x63, 0x9d, 0x04, 0x59, 0x9d, 0x22, 0x5d, 0x60, 0xc6, 0xa2, 0xc7,
+    0x69, 0x96, 0x6b, 0x67, 0x18, 0x7e, 0x22, 0x51, 0x10, 0x78, 0x62, 0x62, 0x13, 0xc3, 0xbf, 0x8f,
+    0x16, 0x93, 0xe4, 0xea, 0x35, 0x4e, 0xc2, 0x83, 0x2e, 0xfb, 0x3d, 0x48, 0x4f, 0xf8, 0xa7, 0xd7,
+    0xe5, 0x6e, 0xb4, 0x36, 0xab, 0xc9, 0xd3, 0x4c, 0x21, 0x20, 0x39, 0x92, 0x81, 0x17, 0x5b, 0x0b,
+    0x36, 0x85, 0xeb, 0x01, 0xeb, 0x3f, 0x94, 0x18, 0x15, 0xda, 0x56, 0x0d, 0xb5, 0xba, 0x01, 0x7b,
+    0x04, 0xdf, 0xde, 0x6c, 0xd2, 0xcd, 0x06, 0x9c, 0x18, 0x2f, 0x00, 0xea, 0x58, 0x90, 0x7f, 0x74,
+    0x58, 0x06, 0x00, 0x92, 0x66, 0x7f, 0x9f, 0x3d, 0x5d, 0x8d, 0x3f, 0x43, 0x97, 0xa0, 0x5f, 0x1c,
+    0x4b, 0x43, 0x90, 0x25, 0x19, 0x2d, 0xde, 0xb0, 0x48, 0x93, 0xb0, 0x18, 0x0a, 0xbb, 0x2c, 0x06,
+    0x6f, 0xb1, 0x60, 0x91, 0x01, 0xf1, 0xe2, 0xb0, 0x2a, 0xca, 0x33, 0x86, 0x67, 0x57, 0xf1, 0xba,
+    0x85, 0x78, 0x26, 0x01, 0x9a, 0xb1, 0x61, 0x8b, 0x47, 0x84, 0xc1, 0x4f, 0xf4, 0x95, 0x5b, 0x2d,
+    0x61, 0x51, 0x87, 0xde, 0x81, 0xad, 0x02, 0x4b, 0xa6, 0x84, 0x2a, 0x8b, 0xae, 0xdb, 0x58, 0x4c,
+    0x58, 0xdd, 0x51, 0x47, 0xeb, 0x14, 0xba, 0x10, 0xe4, 0x51, 0x12, 0xaf, 0x74, 0x27, 0x52, 0x2f,
+    0xf9, 0x3b, 0xa8, 0xa4, 0x5f, 0xaa, 0xba, 0xa4, 0x5b, 0xd1, 0x23, 0xc8, 0x1e, 0xf2, 0x70, 0xe0,
+    0x8d, 0xa2, 0x07, 0x59, 0x48, 0x8c, 0x5f, 0x7d, 0x28, 0x58, 0x28, 0xe3, 0x43, 0xf9, 0x3d, 0x57,
+    0x65, 0xde, 0x86, 0x53, 0x90, 0x8e, 0x33, 0x00, 0xb4, 0x39, 0xc2, 0xce, 0x7e, 0x89, 0xbe, 0xa2,
+    0xa0, 0x75, 0x11, 0x1f, 0x19, 0x2c, 0x14, 0x87, 0x2e, 0x38, 0x0d, 0x04, 0x00, 0xe1, 0xa2, 0xa0,
+    0xe6, 0x13, 0x4e, 0x7d, 0x90, 0xbc, 0xdc, 0xe3, 0x02, 0x19, 0x51, 0xd0, 0x8b, 0xe9, 0xcf, 0xc8,
+    0x1d, 0x5f, 0x95, 0xa0, 0x85, 0x29, 0x40, 0x0e, 0x97, 0x6b, 0x12, 0x4f, 0x9f, 0xae, 0x16, 0xdc,
+    0x49, 0x70, 0x1e, 0xa6, 0x97, 0x88, 0xec, 0x2d, 0x6c, 0xa8, 0x1b, 0xe1, 0x35, 0xd4, 0x0b, 0x13,
+    0xa1, 0xc5, 0x70, 0x7f, 0xdd, 0x42, 0x27, 0x6c, 0xdc, 0x5e, 0xe3, 0xf4, 0xc2, 0xa9, 0x27, 0x3e,
+    0xd9, 0xdf, 0xfe, 0xc6, 0xee, 0xf1, 0x25, 0x28, 0xca, 0xe8, 0xaf, 0x2a, 0xd8, 0x44, 0xd0, 0x34,
+    0x84, 0x6d, 0xe8, 0x82, 0x50, 0x74, 0xb2, 0x18, 0x18, 0xa6, 0xd1, 0xb6, 0x48, 0xa6, 0x08, 0x13,
+    0xde, 0x14, 0xaa, 0x1d, 0x27, 0x9c, 0x44, 0x20, 0x0a, 0x00, 0x08, 0x15, 0x87, 0x65, 0xf1, 0x05,
+    0x50, 0xdf, 0x68, 0xc0, 0x57, 0x93, 0x9d, 0x9e, 0x91, 0xa6, 0x81, 0x05, 0x61, 0xe2, 0x84, 0xd7,
+    0x50, 0x8e, 0x23, 0xe8, 0x4c, 0xe1, 0xfb, 0x25, 0x26, 0x35, 0x1a, 0xe8, 0x25, 0x4a, 0xa0, 0xf8,
+    0xa3, 0x03, 0xfd, 0x73, 0x7a, 0x8a, 0xa4, 0x74, 0x72, 0x21, 0x3f, 0x78, 0xc9, 0x33, 0x18, 0x20,
+    0xa4, 0x95, 0x97, 0xff, 0x40, 0x89, 0x1f, 0x19, 0x41, 0x02, 0x75, 0x0c, 0x54, 0x82, 0x50, 0xe5,
+    0x76, 0x96, 0xab, 0x6c, 0x46, 0x14, 0x20, 0xe1, 0x1b, 0xf8, 0x57, 0xa4, 0x43, 0x47, 0xe7, 0x8d,
+    0x46, 0xd0, 0x62, 0x23, 0xaa, 0x30, 0x80, 0xda, 0xda, 0x6c, 0x44, 0x35, 0x89, 0x3e, 0x90, 0x80,
+    0x65, 0xbd, 0x00, 0x13, 0xe6, 0x2d, 0x41, 0xf2, 0x73, 0x0f, 0xd1, 0x1d, 0x04, 0xd7, 0xc2, 0x49,
+    0x84, 0x83, 0xc5, 0xae, 0x66, 0xe1, 0x02, 0xc3, 0x2b, 0x66, 0xa8, 0x38, 0x83, 0x12, 0xbc, 0x20,
+    0x98, 0x68, 0x01, 0x23, 0x81, 0x85, 0x90, 0x05, 0x61, 0x8c, 0xe3, 0xb8, 0x53, 0x0b, 0xb2, 0xf5,
+    0x62, 0xcc, 0xd4, 0xd8, 0x4e, 0xc3, 0x1c, 0x94, 0x0f, 0x44, 0xd6, 0xe0, 0xc7, 0x30, 0x34, 0x8b,
+    0x36, 0x4d, 0xd5, 0x8b, 0x37, 0x00, 0x1b, 0xc7, 0x52, 0xde, 0xb1, 0x0d, 0xfc, 0x12, 0x80, 0x92,
+    0xd7, 0x56, 0x59, 0xf8, 0x3c, 0x8c, 0xf3, 0x00, 0x72, 0xee, 0x11, 0xec, 0xef, 0x7e, 0x67, 0xf1,
+    0xd3, 0xbd, 0x53, 0xce, 0x51, 0x98, 0x6e, 0xf2, 0x9f, 0x4c, 0x57, 0x78, 0x52, 0xac, 0x46, 0x62,
+    0xab, 0x9d, 0xb3, 0x4f, 0xfb, 0xc1, 0x32, 0xda, 0xa7, 0x22, 0xe7, 0xa3, 0x24, 0xc9, 0x4f, 0xef,
+    0xdf, 0x18, 0xe5, 0x3b, 0x98, 0xb4, 0xf9, 0x1d, 0x35, 0xd2, 0xc9, 0xc9, 0xc2, 0xbf, 0x6c, 0x3e,
+    0xd5, 0x40, 0xfb, 0xd2, 0x08, 0xea, 0xb2, 0x16, 0x98, 0x5b, 0x4b, 0xf8, 0x81, 0x6c, 0x1e, 0x5c,
+    0x05, 0x30, 0x39, 0xa8, 0x07, 0x1a, 0x50, 0x79, 0x0b, 0xda, 0x4a, 0x74, 0x43, 0xc1, 0x45, 0xd2,
+    0xc6, 0xd9, 0x15, 0xd6, 0xd9, 0x46, 0xf0, 0x84, 0x2c, 0x27, 0x5d, 0xea, 0x91, 0x67, 0x0e, 0xba,
+    0x0f, 0x0d, 0x66, 0xe6, 0x6d, 0xd9, 0x10, 0xf4, 0x3d, 0x05, 0x9e, 0x7c, 0x46, 0x90, 0x7c, 0x06,
+    0xbc, 0xc1, 0x50, 0xd1, 0x7e, 0x91, 0xa6, 0x49, 0xda, 0x00, 0xf5, 0x36, 0xc2, 0x65, 0x24, 0x4f,
+    0x40, 0xaa, 0x05, 0x62, 0x38, 0xeb, 0x06, 0xd7, 0xe3, 0xaa, 0xa4, 0x48, 0x54, 0xc8, 0xfe, 0x9c,
+    0x25, 0x0b, 0x64, 0x7c, 0x7b, 0x1a, 0xdf, 0x30, 0xec, 0x8a, 0x01, 0x95, 0xa1, 0x5e, 0x69, 0x81,
+    0x5c, 0xfa, 0x8b, 0xf8, 0x86, 0x5f, 0x6c, 0xc3, 0x9b, 0x70, 0x8f, 0x12, 0x26, 0x34, 0x56, 0x30,
+    0x3f, 0xad, 0x39, 0x2f, 0xc6, 0x82, 0xc6, 0xdd, 0x92, 0x05, 0x58, 0x46, 0xf1, 0xaa, 0x91, 0xa5,
+    0x49, 0x85, 0xd6, 0x69, 0xcb, 0x12, 0xb0, 0x6e, 0xcb, 0xf9, 0x26, 0x8d, 0xb1, 0x55, 0x5b, 0x0a,
+    0x65, 0x50, 0xff, 0x12, 0x19, 0x9d, 0x0e, 0xcc, 0xcd, 0x30, 0x9e, 0x64, 0xb5, 0x8d, 0xaa, 0xef,
+    0x87, 0xd1, 0x9f, 0x41, 0xae, 0x76, 0x40, 0x88, 0xa6, 0x51, 0x98, 0x35, 0x78, 0x7e, 0x53, 0xcf,
+    0xf5, 0x0f, 0x9f, 0xc3, 0x75, 0x8b, 0x1f, 0xd3, 0x7e, 0x14, 0x93, 0x1e, 0x5b, 0xc8, 0x83, 0x5a,
+    0xcc, 0xc6, 0x40, 0x6b, 0x61, 0xf3, 0x63, 0x12, 0x8e, 0x45, 0x3f, 0x1a, 0x13, 0xd8, 0xcd, 0x02,
+    0x1a, 0x08, 0x8d, 0x9c, 0xc8, 0x88, 0xd7, 0x96, 0x64, 0x76, 0xf3, 0x9a, 0x4e, 0x9f, 0x75, 0xec,
+    0x6c, 0x29, 0x80, 0xa4, 0xfc, 0xac, 0x00, 0x6d, 0xed, 0xd6, 0x91, 0x4d, 0xc9, 0x64, 0x36, 0x55,
+    0xb2, 0x57, 0x0b, 0xf4, 0xc8, 0x0c, 0x97, 0x12, 0x1f, 0x4c, 0x8b, 0x15, 0x7f, 0x51, 0xb5, 0x54,
+    0xa9, 0x9f, 0x0b, 0x94, 0x2c, 0x91, 0xea, 0xd5, 0xbb, 0xe4, 0x5d, 0x78, 0x9d, 0x37, 0xc4, 0xe0,
+    0x19, 0x33, 0x44, 0xa4, 0xd4, 0x3a, 0xf3, 0x60, 0xd9, 0xa0, 0xfc, 0xb5, 0x25, 0xb1, 0x71, 0x7f,
+    0x89, 0x82, 0x1e, 0x33, 0x3a, 0xf8, 0xa1, 0x36, 0xc3, 0xe8, 0xbf, 0x76, 0xca, 0xfe, 0x40, 0xbe,
+    0x2a, 0x0d, 0x91, 0x0f, 0x69, 0xcd, 0x4e, 0x9e, 0x7c, 0x17, 0x5d, 0x87, 0x93, 0x46, 0x4f, 0xa9,
+    0x92, 0x74, 0xa4, 0x7c, 0x4a, 0x96, 0x21, 0xd0, 0x23, 0x38, 0x2c, 0x4f, 0x03, 0xb6, 0xa8, 0x67,
+    0x40, 0x01, 0xec, 0x32, 0x51, 0x16, 0xe9, 0xac, 0x4e, 0x1c, 0x2e, 0x2e, 0xf3, 0x19, 0x3b, 0x63,
+    0x5d, 0x06, 0x62, 0xe7, 0x6f, 0xf7, 0x6f, 0x74, 0xde, 0xe6, 0x13, 0x03, 0x79, 0x50, 0x57, 0x53,
+    0xe0, 0xd3, 0xfd, 0x1b, 0xa4, 0x6c, 0x03, 0x22, 0x07, 0x29, 0xd8, 0xdc, 0xbf, 0xe1, 0x50, 0xd0,
+    0x13, 0xcd, 0x5a, 0xe7, 0xcf, 0x49, 0xb4, 0x68, 0xd4, 0x87, 0x7c, 0x26, 0xab, 0x8e, 0x01, 0x65,
+    0x60, 0x02, 0x5d, 0x19, 0x2d, 0xb8, 0xe1, 0xb5, 0xc1, 0x6d, 0x10, 0x38, 0x4b, 0xb1, 0x3b, 0x5a,
+    0xcc, 0x95, 0xbc, 0x34, 0x59, 0x39, 0x90, 0xee, 0x3d, 0x3d, 0xe1, 0x28, 0xb6, 0xf7, 0x1a, 0x97,
+    0x75, 0x11, 0x43, 0x03, 0xca, 0xf1, 0x33, 0x9e, 0xd6, 0xa8, 0xf7, 0x27, 0x52, 0x0b, 0xbe, 0x27,
+    0xe0, 0x7c, 0x28, 0xc8, 0x40, 0xa2, 0x11, 0xd0, 0xa7, 0xec, 0x40, 0x6e, 0x30, 0xd1, 0x99, 0xfc,
+    0x9b, 0x72, 0x11, 0x5d, 0x67, 0x1c, 0x83, 0x6e, 0xf4, 0x16, 0xa6, 0xa7, 0x88, 0x0d, 0x17, 0x71,
+    0xfa, 0x1c, 0xac, 0xa9, 0xe1, 0xa6, 0x51, 0x1c, 0x5f, 0x60, 0xc4, 0x04, 0xaa, 0x44, 0x18, 0x00,
+    0x09, 0xff, 0xd5, 0xed, 0xec, 0x6a, 0x2c, 0xa8, 0x18, 0xa5, 0xc9, 0x18, 0x74, 0x7b, 0xe0, 0x36,
+    0xea, 0x2a, 0xc0, 0xc4, 0xfb, 0x4c, 0xb0, 0x90, 0x5a, 0xc8, 0x1b, 0x37, 0x3c, 0x2e, 0x7d, 0xc0,
+    0x97, 0x74, 0xfa, 0xdd, 0x92, 0x51, 0x28, 0x94, 0x44, 0xbf, 0x5b, 0x74, 0xb2, 0x22, 0x52, 0xf0,
+    0xa7, 0xc0, 0x43, 0x31, 0xdb, 0x16, 0x2b, 0x5e, 0x6b, 0x76, 0xa3, 0xcc, 0xce, 0xb5, 0xa2, 0x69,
+    0xfd, 0x47, 0x2e, 0x65, 0x6a, 0x3c, 0x63, 0xad, 0xe4, 0x0d, 0x0a, 0x55, 0xc1, 0x76, 0x66, 0x56,
+    0x7d, 0x05, 0xa3, 0x0f, 0xda, 0x47, 0x38, 0xa9, 0xc3, 0xa2, 0xf6, 0x87, 0xe0, 0x0f, 0xb0, 0x32,
+    0x59, 0xa8, 0xd7, 0x5a, 0x19, 0xb8, 0xa9, 0x5d, 0x83, 0xee, 0x29, 0xf3, 0x61, 0x6e, 0x7f, 0x87,
+    0xd7, 0x1f, 0x84, 0x0d, 0x5e, 0x67, 0x13, 0xb8, 0x53, 0xd4, 0x3e, 0x40, 0x44, 0xa4, 0x86, 0x22,
+    0xdb, 0x41, 0x5f, 0x82, 0xb6, 0x68, 0xb6, 0xc3, 0x45, 0x20, 0x1b, 0x01, 0xfb, 0xf9, 0x4d, 0xd3,
+    0x28, 0x61, 0xab, 0x42, 0xb4, 0x40, 0xe8, 0xc9, 0xa0, 0x0d, 0x48, 0x69, 0x70, 0xf5, 0x02, 0x9d,
+    0x30, 0xe4, 0xaa, 0xd0, 0x98, 0xf3, 0x1d, 0x97, 0xee, 0x33, 0xcf, 0x90, 0x1f, 0x8d, 0x1e, 0xf5,
+    0x8f, 0xbb, 0xe6, 0x90, 0x27, 0xb4, 0x75, 0xad, 0xf7, 0x1e, 0x62, 0xfc, 0x96, 0xba, 0xa0, 0xc1,
+    0x80, 0xc0, 0x7f, 0x9e, 0x60, 0x7c, 0x0e, 0xa9, 0xd1, 0x14, 0x2f, 0xe5, 0xe4, 0x3e, 0x85, 0xcd,
+    0x1a, 0x85, 0x74, 0x01, 0xc0, 0x3c, 0x9a, 0xa0, 0x4d, 0xc8, 0xe6, 0x29, 0x92, 0x3d, 0x82, 0x3c,
+    0xc1, 0x56, 0x6c, 0x9f, 0xf5, 0x25, 0x6b, 0xe1, 0x6f, 0x9c, 0x9d, 0x7c, 0x8e, 0x38, 0xfc, 0x25,
+    0xdb, 0x8e, 0xc3, 0x46, 0xba, 0x9f, 0xdd, 0xf0, 0x46, 0xfd, 0x0f, 0x09, 0x5f, 0x99, 0x83, 0x2f,
+    0xb0, 0x7e, 0xe3, 0x4e, 0xb0, 0xae, 0xc6, 0x4e, 0x4f, 0xae, 0x6b, 0x1a, 0x22, 0x64, 0x56, 0x17,
+    0xfd, 0x14, 0xb6, 0x93, 0xaf, 0x2d, 0xc6, 0xd5, 0xdd, 0xee, 0x30, 0xa2, 0x1a, 0x30, 0x4e, 0xa8,
+    0xc0, 0xf9, 0xb5, 0x04, 0xa2, 0xae, 0x7f, 0x8d, 0xfe, 0xcc, 0xa7, 0xec, 0x75, 0x90, 0xcf, 0x3a,
+    0xb0, 0xb3, 0x6a, 0xc0, 0xfa, 0x2b, 0xb0, 0x37, 0x87, 0x02, 0x20, 0xb8, 0x56, 0x00, 0xc1, 0xb5,
+    0x0d, 0x40, 0x92, 0xc5, 0xe5, 0x2e, 0x44, 0xd9, 0x24, 0x9d, 0xbf, 0x98, 0x13, 0x5c, 0x37, 0xef,
+    0x40, 0x28, 0xb5, 0x99, 0xe8, 0x80, 0x96, 0x72, 0xf4, 0x30, 0x37, 0x90, 0xf2, 0x36, 0xea, 0x5d,
+    0xb4, 0x15, 0xa2, 0xfc, 0x07, 0xea, 0x73, 0x63, 0xcd, 0xcf, 0x9d, 0xba, 0xbf, 0xa6, 0xbb, 0x7f,
+    0xd7, 0x29, 0xb4, 0x6e, 0x36, 0xfd, 0x43, 0xb5, 0xe6, 0xa6, 0x32, 0x24, 0x7c, 0xfd, 0xed, 0x06,
+    0x6b, 0x5d, 0x1c, 0xac, 0xb5, 0x35, 0x58, 0xeb, 0xe2, 0x60, 0xad, 0xad, 0xc1, 0x5a, 0xcb, 0x5e,
+    0x5c, 0x8b, 0x5e, 0x14, 0x92, 0x95, 0x07, 0xab, 0xb2, 0x53, 0x51, 0x05, 0xd2, 0x08, 0xe2, 0xa5,
+    0x07, 0x92, 0x85, 0x70, 0x05, 0xa3, 0xac, 0xc1, 0x4b, 0xfc, 0x1e, 0xaf, 0xfe, 0x18, 0xd6, 0xd6,
+    0xa2, 0xf3, 0x45, 0x41, 0x4c, 0xe0, 0xdd, 0xaf, 0x12, 0xd4, 0x00, 0xbc, 0x51, 0xb8, 0x79, 0xed,
+    0x6d, 0x66, 0x61, 0x22, 0xaa, 0x24, 0xcc, 0x19, 0xef, 0x1a, 0x89, 0x5d, 0xa6, 0x6b, 0xf4, 0x3a,
+    0x45, 0xed, 0x08, 0x29, 0x6e, 0x50, 0x6f, 0x44, 0x3a, 0x22, 0x01, 0xf8, 0xef, 0x86, 0x02, 0x6c,
+    0x71, 0xab, 0xdf, 0xe2, 0x01, 0x7e, 0x03, 0xd6, 0x3b, 0x6e, 0x31, 0xba, 0x2b, 0xe4, 0xb0, 0x8f,
+    0xd1, 0xf4, 0x3c, 0x7a, 0xf7, 0x61, 0x9f, 0x29, 0xeb, 0x29, 0x9d, 0x19, 0xbc, 0x17, 0x0b, 0xa2,
+    0xea, 0xc7, 0x9e, 0x94, 0x1d, 0x6d, 0x51, 0x5f, 0x07, 0x31, 0xeb, 0xaf, 0xd4, 0x5a, 0xa7, 0x08,
+    0xc7, 0xf7, 0x72, 0xe1, 0x34, 0x91, 0x08, 0xa9, 0xa3, 0xca, 0x01, 0x29, 0xfa, 0x83, 0x93, 0xa3,
+    0xb0, 0x5c, 0x4b, 0x0b, 0xc2, 0x35, 0xef, 0x35, 0xe4, 0x77, 0xb5, 0xea, 0xc8, 0x3c, 0xa3, 0x47,
+    0x85, 0x68, 0xe0, 0x39, 0x27, 0x38, 0x80, 0xd0, 0x05, 0x6b, 0xfd, 0xe9, 0xe3, 0xb9, 0xf7, 0xb0,
+    0xa1, 0xc0, 0x7e, 0x9f, 0x92, 0xfd, 0x25, 0x0d, 0x89, 0x03, 0x7d, 0x52, 0x2c, 0x4f, 0xfe, 0x03,
+    0x07, 0xf0, 0x0b, 0x5f, 0x78, 0x80, 0xcd, 0xcd, 0x6e, 0x78, 0xc0, 0x1a, 0x42, 0xd9, 0x6e, 0x8b,
+    0xd9, 0xb9, 0x2f, 0xa8, 0xc7, 0x51, 0xd6, 0x3d, 0xaa, 0x14, 0xb8, 0xe4, 0x4f, 0x5e, 0x64, 0xd8,
+    0x1b, 0x0f, 0xac, 0xde, 0x6b, 0x1b, 0x98, 0xd7, 0x02, 0xf3, 0xda, 0xc6, 0xfc, 0xbd, 0x56, 0x48,
+    0xb0, 0xd3, 0xbe, 0x13, 0x76, 0xf1, 0x54, 0x6b, 0x7d, 0x92, 0x31, 0xcc, 0x3c, 0x5c, 0x89, 0xa5,
+    0x46, 0x56, 0x07, 0x4e, 0xf7, 0xc0, 0x0c, 0xf4, 0x7e, 0x94, 0x96, 0x13, 0x50, 0x16, 0x93, 0xcf,
+    0xa1, 0x5e, 0xd0, 0xf8, 0xd5, 0x13, 0xc6, 0x7a, 0x83, 0x0b, 0x91, 0xe4, 0x9c, 0x9e, 0x22, 0xe8,
+    0x5d, 0x34, 0xfe, 0x9c, 0x19, 0xec, 0x29, 0x12, 0xce, 0xcf, 0xd9, 0x21, 0x86, 0xeb, 0xa6, 0xac,
+    0x81, 0x13, 0x37, 0x22, 0x03, 0x10, 0xfc, 0x81, 0x91, 0xe2, 0x10, 0x43, 0xf6, 0xe0, 0x41, 0xa4,
+    0x67, 0x28, 0x99, 0x06, 0x01, 0x28, 0xc2, 0xbe, 0xe5, 0x00, 0x86, 0x72, 0x62, 0x8f, 0x06, 0x87,
+    0x2d, 0xf4, 0x3c, 0x11, 0x39, 0x0a, 0x01, 0xf0, 0x0d, 0xb0, 0x64, 0xc3, 0x50, 0xce, 0xe6, 0xc9,
+    0x17, 0xd0, 0xd3, 0x1b, 0xd7, 0x2d, 0x63, 0x24, 0x9a, 0x76, 0xc3, 0xdc, 0x6c, 0x7b, 0xa0, 0x9a,
+    0x6e, 0x37, 0x35, 0x8c, 0xdd, 0xeb, 0xda, 0xed, 0x82, 0xf5, 0xd6, 0x2e, 0x58, 0x6f, 0xeb, 0x82,
+    0xb5, 0xd5, 0x05, 0x6b, 0xdd, 0x05, 0x3e, 0x1e, 0xb2, 0xfa, 0xe3, 0x7b, 0x47, 0x81, 0xad, 0xea,
+    0x10, 0xa3, 0x5b, 0x5b, 0x6c, 0x5d, 0xec, 0x11, 0xbb, 0xdb, 0x75, 0x77, 0xdb, 0xc0, 0x4e, 0x8f,
+    0x78, 0x99, 0x89, 0x5f, 0x50, 0x52, 0xbf, 0x03, 0x59, 0x55, 0x23, 0x56, 0x02, 0x58, 0x3a, 0x76,
+    0x5b, 0x9b, 0x75, 0xab, 0xf1, 0xf7, 0xeb, 0x81, 0x0f, 0x1f, 0x1d, 0x1e, 0x1e, 0x3d, 0xf6, 0xe9,
+    0x81, 0xfd, 0x2a, 0x3d, 0xd0, 0xd4, 0xf4, 0xa0, 0xfa, 0xad, 0x5a, 0xe2, 0x3f, 0x6f, 0x66, 0x71,
+    0xab, 0x2e, 0xba, 0x41, 0x9d, 0xd2, 0xd6, 0x90, 0xa4, 0xb0, 0x12, 0x23, 0x58, 0x8f, 0xcc, 0xd5,
+    0xa9, 0x8d, 0x1b, 0x8e, 0xaa, 0xc5, 0x8d, 0xe5, 0x03, 0x21, 0x2e, 0xe9, 0xd2, 0x8a, 0x01, 0xc9,
+    0x50, 0xec, 0xeb, 0xeb, 0x01, 0x97, 0xfd, 0x68, 0x78, 0xd0, 0x16, 0x0a, 0x21, 0x42, 0xf3, 0x20,
+    0x16, 0x01, 0x4a, 0x88, 0x99, 0x8b, 0x79, 0x3c, 0x9c, 0x35, 0x8e, 0x16, 0xb8, 0xa5, 0xfc, 0x79,
+    0x38, 0x8e, 0xe6, 0x01, 0x1e, 0x59, 0xd6, 0xac, 0x52, 0x67, 0x64, 0x49, 0x3e, 0x87, 0x75, 0x62,
+    0xc0, 0xdc, 0x8c, 0x5e, 0x59, 0xc6, 0x81, 0xd0, 0x0a, 0xfa, 0x76, 0x1d, 0x48, 0x43, 0x43, 0x76,
+    0x8e, 0x14, 0xfd, 0x8a, 0x1a, 0xd9, 0x7e, 0xd8, 0x2d, 0x0b, 0x70, 0xb5, 0x53, 0xb7, 0x49, 0x6c,
+    0x6e, 0x10, 0xdf, 0x27, 0xa9, 0xf2, 0x09, 0xf9, 0x2d, 0x8a, 0x3b, 0x1b, 0x76, 0x4a, 0x35, 0xb7,
+    0x27, 0xce, 0xce, 0x83, 0x34, 0x7f, 0xbe, 0xf5, 0x63, 0x15, 0x92, 0x0b, 0xbe, 0x8e, 0xb9, 0x99,
+    0xd6, 0xcf, 0x50, 0xb4, 0xb2, 0xef, 0xb8, 0xeb, 0x40, 0x49, 0xa4, 0x7b, 0x5b, 0xae, 0xbd, 0xd0,
+    0x6b, 0x87, 0xb2, 0x3b, 0x75, 0x52, 0xaf, 0xab, 0x7b, 0xf2, 0x67, 0x14, 0x81, 0x50, 0x52, 0x98,
+    0xc9, 0xb8, 0xe6, 0xa7, 0x59, 0x9c, 0x93, 0x2a, 0x81, 0xe4, 0x10, 0x12, 0xb0, 0x1a, 0x3d, 0xd5,
+    0x5a, 0xa1, 0x5d, 0x2a, 0x01, 0xff, 0x23, 0xe8, 0xc8, 0xde, 0x01, 0x01, 0x16, 0x20, 0x54, 0x1b,
+    0x76, 0xff, 0xc6, 0x82, 0xde, 0x7c, 0x6a, 0x39, 0xaa, 0xd5, 0x31, 0x97, 0xa2, 0x26, 0xe3, 0x7b,
+    0x07, 0xd7, 0x5f, 0xaa, 0x6c, 0x3c, 0x11, 0x6c, 0xf7, 0xe1, 0x8c, 0xc3, 0xcb, 0x70, 0x31, 0xf9,
+    0x93, 0xa5, 0xc5, 0x1d, 0xb7, 0x6c, 0xed, 0xad, 0x7f, 0xd4, 0xb4, 0xc1, 0x2f, 0xf8, 0x9d, 0x3c,
+    0xa8, 0x05, 0x1c, 0xc0, 0xe8, 0x16, 0xf6, 0x1d, 0xd2, 0x6c, 0x89, 0xdb, 0x8d, 0x16, 0x3f, 0x98,
+    0x28, 0x58, 0x1b, 0x6c, 0xb1, 0xc3, 0x8f, 0x20, 0x7e, 0x6f, 0xe3, 0xf7, 0x0b, 0x58, 0x6d, 0xde,
+    0xf0, 0x18, 0x57, 0x60, 0x1e, 0x88, 0x16, 0xe1, 0x1d, 0x5e, 0xf8, 0xff, 0x52, 0x31, 0xcd, 0x6f,
+    0x5b, 0xf3, 0xed, 0xa6, 0x0d, 0x9b, 0x0a, 0x90, 0xfa, 0x80, 0xf5, 0x8e, 0x14, 0x56, 0xf8, 0xc2,
+    0xce, 0x40, 0x79, 0x55, 0xd9, 0x6a, 0xc7, 0x50, 0xe0, 0x5d, 0xeb, 0xec, 0x15, 0xd2, 0xd7, 0x2c,
+    0x53, 0xdf, 0xea, 0xab, 0x13, 0xad, 0x34, 0xf7, 0x78, 0xa0, 0x24, 0x22, 0xf5, 0x03, 0x6c, 0x88,
+    0xd4, 0x2e, 0xef, 0x63, 0xf1, 0x3c, 0xe6, 0x9a, 0xce, 0x63, 0xd0, 0xba, 0xc3, 0x8b, 0x68, 0xb2,
+    0x4d, 0xa3, 0x90, 0x77, 0xd7, 0xab, 0x36, 0x84, 0x78, 0xb4, 0xec, 0x92, 0x51, 0x30, 0x0a, 0xa0,
+    0x76, 0x9a, 0xfc, 0x47, 0xd1, 0x9a, 0x44, 0xe9, 0x7f, 0x32, 0x4c, 0x41, 0x54, 0x97, 0xc0, 0x67,
+    0xce, 0x28, 0xad, 0xb2, 0xad, 0xf9, 0x11, 0x80, 0xa8, 0x10, 0xa3, 0xe5, 0x3c, 0x93, 0x46, 0xab,
+    0x70, 0x6b, 0x75, 0x28, 0xe5, 0xd1, 0x4f, 0x7c, 0x96, 0xca, 0x77, 0x8e, 0xa7, 0xa8, 0x32, 0x58,
+    0x1a, 0x26, 0x5d, 0x69, 0x9f, 0x0b, 0x97, 0x41, 0x4a, 0x64, 0x38, 0xa7, 0x7d, 0x02, 0xb2, 0x76,
+    0xbe, 0xab, 0xd5, 0x37, 0x4e, 0x2e, 0xd1, 0x2f, 0xe6, 0x5d, 0xf2, 0x02, 0xfd, 0x61, 0x5e, 0x67,
+    0xd2, 0xcc, 0x5b, 0x66, 0x73, 0xc0, 0x62, 0x4d, 0xcf, 0xf1, 0x0b, 0x47, 0x2a, 0xae, 0x24, 0x90,
+    0xa6, 0x3a, 0x8e, 0x4b, 0x24, 0xfa, 0x0c, 0x76, 0x45, 0x80, 0x0a, 0xb3, 0x9d, 0x05, 0x6c, 0xf8,
+    0x7b, 0x45, 0xb1, 0x5d, 0x1f, 0xa6, 0x94, 0x57, 0xa6, 0x72, 0xb7, 0xd6, 0x84, 0x90, 0xa6, 0x8d,
+    0x10, 0x9b, 0xde, 0xaa, 0x05, 0xf2, 0x22, 0x06, 0xb7, 0x67, 0xcc, 0xb6, 0xa3, 0xc9, 0xd0, 0xea,
+    0x0b, 0x61, 0x38, 0x1c, 0xd3, 0x95, 0x0c, 0x6e, 0x49, 0xd5, 0x04, 0x2c, 0xa6, 0xdb, 0xe3, 0x37,
+    0x36, 0xea, 0x91, 0xa4, 0x5f, 0xea, 0x3c, 0xaf, 0x09, 0xe4, 0x7f, 0xf8, 0x88, 0xe4, 0xda, 0x56,
+    0x6f, 0x71, 0xe3, 0x53, 0xab, 0xf6, 0xa1, 0xa6, 0xac, 0xb5, 0x75, 0x11, 0x08, 0x5f, 0x57, 0xc6,
+    0x5a, 0xd8, 0x65, 0x4d, 0x8f, 0xa6, 0x47, 0xe3, 0xba, 0xb4, 0xd5, 0x4a, 0x16, 0x73, 0xd9, 0x07,
+    0x14, 0x2a, 0xd0, 0x96, 0xf4, 0x59, 0x01, 0xf0, 0xf9, 0xc0, 0x19, 0xc6, 0x0d, 0x99, 0x3b, 0x5b,
+    0x46, 0x75, 0x78, 0x13, 0x85, 0x59, 0xd7, 0xc1, 0xf4, 0x38, 0x9c, 0x7e, 0x55, 0x5d, 0x34, 0x8a,
+    0xb2, 0xa2, 0x8f, 0x50, 0x17, 0xa3, 0xc5, 0x0d, 0x90, 0xff, 0xcf, 0x7f, 0x3f, 0xab, 0xb3, 0x8d,
+    0x38, 0xaf, 0x71, 0x66, 0xd8, 0x33, 0xc3, 0xc3, 0x63, 0xcb, 0x14, 0x93, 0xd7, 0xe3, 0xa1, 0x73,
+    0x03, 0xf2, 0xcf, 0x40, 0xfb, 0x17, 0xb4, 0x6a, 0x59, 0x30, 0x5f, 0xc6, 0xe1, 0xb3, 0x64, 0x85,
+    0x7c, 0xd0, 0x6d, 0xd5, 0x66, 0x41, 0xf6, 0x9c, 0x5a, 0x42, 0x52, 0xa8, 0x55, 0xbb, 0x22, 0xef,
+    0x91, 0x0b, 0x94, 0x15, 0x34, 0xad, 0xa4, 0xeb, 0x18, 0x4f, 0x7f, 0xb1, 0x98, 0x58, 0xa9, 0xf2,
+    0x9c, 0xd0, 0x3d, 0x7a, 0x90, 0x34, 0x7c, 0x83, 0x23, 0x88, 0x22, 0xaa, 0x5d, 0x6d, 0xcb, 0xee,
+    0xb1, 0x83, 0x79, 0x74, 0xd1, 0xb2, 0xcf, 0x2a, 0xee, 0x7c, 0x08, 0x71, 0x17, 0x9c, 0xbf, 0x04,
+    0x2b, 0xb7, 0x49, 0x37, 0x37, 0x76, 0x5b, 0xb4, 0x6b, 0x9b, 0xf7, 0xb7, 0x93, 0xda, 0xc1, 0x75,
+    0x94, 0xbd, 0xab, 0x92, 0xdc, 0xe7, 0xe5, 0xa2, 0x5b, 0x96, 0x2d, 0x17, 0xdf, 0x57, 0xb0, 0x67,
+    0xca, 0x6c, 0x61, 0x4a, 0x49, 0xe5, 0xd2, 0x54, 0x67, 0x6f, 0x15, 0xa7, 0x04, 0x5a, 0x46, 0x9b,
+    0xae, 0xd9, 0x47, 0x9d, 0x12, 0xc1, 0xb2, 0x09, 0x30, 0x95, 0xb0, 0xc0, 0xc0, 0xa0, 0xf8, 0xd6,
+    0x82, 0x92, 0x1f, 0x44, 0x08, 0xc9, 0xb3, 0x83, 0xcd, 0x98, 0x3b, 0x46, 0xf3, 0xa9, 0x9f, 0xb1,
+    0x75, 0x98, 0x77, 0xb4, 0xfd, 0xae, 0x38, 0xbf, 0x2c, 0x4d, 0x48, 0x56, 0xe3, 0x51, 0x84, 0xd4,
+    0x80, 0xa2, 0x3e, 0xa4, 0x46, 0x48, 0xef, 0x06, 0xd0, 0x0f, 0xee, 0x05, 0xd1, 0x7f, 0x2a, 0x70,
+    0x7e, 0x10, 0x1a, 0x93, 0x20, 0xb9, 0xcd, 0x7a, 0x1f, 0x6d, 0x70, 0xc9, 0x1f, 0xba, 0xec, 0xb9,
+    0xc2, 0x5c, 0xd2, 0xfd, 0xba, 0x60, 0xd9, 0xa9, 0x01, 0xba, 0xc6, 0x2e, 0x72, 0xbb, 0x13, 0x2a,
+    0x3b, 0x00, 0xc4, 0x46, 0x1c, 0x69, 0x6a, 0x04, 0xed, 0xdd, 0x8f, 0x9a, 0x16, 0xb4, 0x4b, 0xe9,
+    0x8a, 0x87, 0xea, 0x8c, 0x54, 0xc9, 0x4e, 0x73, 0x37, 0x60, 0x34, 0xad, 0xed, 0xf7, 0xd4, 0xb3,
+    0x6a, 0x6c, 0x6a, 0xc7, 0x93, 0x31, 0xf7, 0xdc, 0x94, 0x7a, 0xa6, 0x9f, 0x3b, 0x34, 0x51, 0xb0,
+    0x65, 0x34, 0x48, 0x50, 0x6e, 0x28, 0x88, 0xe5, 0xf6, 0x5c, 0x02, 0x1b, 0x3d, 0xe5, 0x08, 0xa4,
+    0x6f, 0x0d, 0x28, 0xe9, 0x37, 0xf1, 0xb3, 0x63, 0xac, 0x2e, 0xe8, 0xf7, 0x64, 0x56, 0x3d, 0x54,
+    0x40, 0x62, 0xc9, 0x51, 0x8a, 0xa8, 0x4c, 0x77, 0x97, 0x1e, 0x66, 0x35, 0xc7, 0x85, 0x93, 0x4b,
+    0x91, 0x62, 0x17, 0x73, 0x24, 0x68, 0x0b, 0x2b, 0x2a, 0x41, 0x2e, 0xe6, 0x94, 0x88, 0x99, 0xa3,
+    0x32, 0xcd, 0x53, 0x7c, 0x74, 0x41, 0x92, 0xe9, 0x30, 0xd4, 0x46, 0xa7, 0x5a, 0x7d, 0x8a, 0xd2,
+    0x4c, 0x15, 0x5f, 0x2d, 0xb2, 0x59, 0x34, 0xcd, 0x61, 0xad, 0x97, 0xd0, 0x03, 0x13, 0xb8, 0xc5,
+    0xc4, 0x4c, 0xb7, 0x10, 0x73, 0xb1, 0xb3, 0x51, 0x3e, 0x19, 0xdb, 0xa9, 0x29, 0x40, 0xe0, 0xbc,
+    0xd1, 0x04, 0x9e, 0x18, 0xed, 0xb7, 0xe9, 0x23, 0x17, 0x33, 0x93, 0x38, 0x0d, 0xe8, 0xa1, 0xcd,
+    0x5f, 0x8d, 0x49, 0xae, 0xc7, 0x7c, 0xee, 0x18, 0xa9, 0x00, 0xb0, 0x62, 0xfb, 0x93, 0x72, 0x9b,
+    0x0f, 0x08, 0xe2, 0xd4, 0x3a, 0x71, 0x10, 0xfc, 0x54, 0xaf, 0x1b, 0x27, 0x36, 0x45, 0x93, 0x51,
+    0xea, 0x58, 0x8c, 0x64, 0xa4, 0x82, 0xb2, 0xa5, 0xa4, 0xd2, 0x6e, 0xd2, 0xe7, 0xae, 0x97, 0xf0,
+    0x9f, 0x30, 0xa9, 0xa8, 0x9c, 0x43, 0x23, 0x43, 0x18, 0x56, 0xb4, 0x97, 0x86, 0x6b, 0x77, 0x9a,
+    0x14, 0x2c, 0x4e, 0x3b, 0xaa, 0xa8, 0xef, 0xb1, 0xcf, 0x4c, 0xa5, 0xb1, 0x3f, 0x0e, 0xba, 0x7d,
+    0xad, 0x34, 0xea, 0x9e, 0xae, 0xd0, 0x1a, 0xd5, 0x7a, 0xa1, 0x35, 0x47, 0x39, 0x16, 0x5a, 0x75,
+    0xac, 0x49, 0xd5, 0xf1, 0x3d, 0x20, 0xd7, 0x03, 0xd3, 0x52, 0x37, 0x65, 0x56, 0x1d, 0x6f, 0x3d,
+    0x3c, 0x36, 0x8e, 0xb7, 0x8e, 0x51, 0xf1, 0xe4, 0xba, 0x67, 0x71, 0x7a, 0x3b, 0xba, 0x68, 0xb9,
+    0x12, 0xda, 0x62, 0x74, 0x27, 0xa6, 0xe9, 0x96, 0xe2, 0x73, 0x78, 0x3d, 0x35, 0x5c, 0x5e, 0x4d,
+    0xe7, 0xce, 0x1d, 0x35, 0x5d, 0x39, 0x75, 0xca, 0x50, 0x4f, 0x82, 0x75, 0x11, 0xed, 0xf3, 0x60,
+    0x4d, 0x70, 0x4f, 0x83, 0x3b, 0x62, 0x45, 0x97, 0xe0, 0x22, 0xda, 0xb7, 0x24, 0x59, 0x9e, 0xa3,
+    0x83, 0xf2, 0x8f, 0xa8, 0x5a, 0x55, 0x74, 0x4b, 0x8b, 0x3b, 0x1b, 0xc3, 0xa4, 0x7b, 0xd4, 0xaa,
+    0xd1, 0xf3, 0x16, 0x30, 0x70, 0x54, 0x92, 0xf1, 0x2b, 0xec, 0x58, 0xe3, 0x15, 0x4a, 0xdb, 0x47,
+    0x0c, 0x68, 0xcd, 0x9a, 0x18, 0x04, 0xb2, 0x95, 0x28, 0xf2, 0x48, 0xfe, 0x46, 0x54, 0x1d, 0x74,
+    0x2b, 0xc9, 0x82, 0x45, 0x60, 0x77, 0xba, 0xd0, 0x1b, 0xba, 0x8c, 0xac, 0xd7, 0xdc, 0x89, 0x7b,
+    0x17, 0xc2, 0xa8, 0x79, 0x40, 0x5a, 0xaf, 0xaf, 0x49, 0x13, 0xc5, 0x6d, 0xe2, 0x7a, 0x7d, 0x46,
+    0xe9, 0x06, 0x79, 0xbf, 0x70, 0x7b, 0xc3, 0x3f, 0x45, 0x61, 0x75, 0x0c, 0x00, 0x42, 0xe6, 0x57,
+    0x68, 0xb0, 0x20, 0x17, 0x0d, 0xc2, 0xee, 0xb6, 0x8d, 0xff, 0x27, 0x2e, 0x13, 0x74, 0xf4, 0x20,
+    0xc3, 0xd2, 0x52, 0x71, 0xbe, 0x71, 0x40, 0x12, 0xbe, 0xcb, 0x47, 0xc5, 0x80, 0xc0, 0x95, 0x01,
+    0x3d, 0xf3, 0x0f, 0xba, 0x4d, 0xfb, 0x8c, 0x04, 0xd9, 0xda, 0x28, 0x7f, 0x7c, 0xf4, 0xb0, 0x6b,
+    0x2d, 0x31, 0x32, 0x9b, 0xaf, 0x43, 0xaa, 0x88, 0x67, 0x09, 0xd2, 0xe8, 0x0a, 0x27, 0x27, 0x32,
+    0xb5, 0xf7, 0xd0, 0xb7, 0xf6, 0x60, 0x1d, 0xbe, 0x85, 0x67, 0xa2, 0x0f, 0x3a, 0x9c, 0x86, 0xfc,
+    0x73, 0xda, 0xd0, 0xeb, 0x7e, 0x0b, 0x6a, 0x8f, 0x34, 0xb1, 0x33, 0x35, 0x58, 0x06, 0x25, 0x04,
+    0x68, 0x56, 0x40, 0x50, 0xaa, 0x86, 0x2e, 0xa0, 0x9e, 0x7d, 0xfa, 0x3a, 0xe5, 0x60, 0xee, 0x39,
+    0xb8, 0xea, 0xfd, 0x2c, 0xab, 0xff, 0x1d, 0x4c, 0x46, 0xc5, 0x85, 0x9f, 0x19, 0x0b, 0xbf, 0x39,
+    0xd5, 0xac, 0x15, 0x5c, 0x99, 0x7f, 0xd0, 0x30, 0x50, 0x37, 0x6c, 0x3d, 0xee, 0xde, 0xf1, 0x0c,
+    0x2d, 0x41, 0x96, 0x65, 0xc8, 0x81, 0xe0, 0x32, 0xc0, 0xd5, 0x03, 0xb6, 0x2e, 0xa9, 0x55, 0x26,
+    0x29, 0x5c, 0xa4, 0x9d, 0x4a, 0xfd, 0x02, 0x9a, 0x29, 0x01, 0x2d, 0xc9, 0xf5, 0x1a, 0xae, 0x46,
+    0x14, 0x6b, 0x94, 0xa1, 0x08, 0xc2, 0xbe, 0xff, 0x12, 0x02, 0xf5, 0x4f, 0x65, 0x5a, 0x97, 0x82,
+    0xa1, 0x8a, 0x56, 0xad, 0x9f, 0xc5, 0x7e, 0xf5, 0xaf, 0xe2, 0x4a, 0xfb, 0x6f, 0xe9, 0xc3, 0x69,
+    0x84, 0xe8, 0x11, 0xeb, 0x89, 0xb5, 0x5c, 0xc5, 0x30, 0x15, 0xdd, 0xe4, 0x25, 0x1f, 0xe2, 0x90,
+    0x4a, 0x46, 0x54, 0x47, 0x3e, 0x77, 0x55, 0x16, 0xbc, 0xba, 0x02, 0x6e, 0xfb, 0x1a, 0x5e, 0xe2,
+    0x4c, 0x95, 0x80, 0x6f, 0x4a, 0x3d, 0x60, 0x4d, 0xee, 0x47, 0xe0, 0x6b, 0x1b, 0x77, 0x8d, 0xdf,
+    0x58, 0x9a, 0x51, 0x1a, 0x4e, 0x61, 0x8e, 0x2c, 0xc6, 0xe1, 0x73, 0x11, 0xc3, 0x25, 0x83, 0xba,
+    0x7d, 0x28, 0xce, 0x61, 0x12, 0x66, 0x80, 0x25, 0xc0, 0x83, 0x78, 0x8c, 0xd7, 0x93, 0xcd, 0x6a,
+    0x92, 0xb8, 0x31, 0x30, 0x75, 0x64, 0xa0, 0xb8, 0xf1, 0x10, 0x58, 0xd3, 0x58, 0x86, 0xac, 0xfd,
+    0xbd, 0x5d, 0x52, 0xc4, 0x92, 0x37, 0x4c, 0x70, 0x63, 0x9b, 0x6f, 0x17, 0x7e, 0xe0, 0x0b, 0xb3,
+    0xd3, 0x46, 0x02, 0xb7, 0x26, 0xeb, 0x5b, 0xe2, 0x17, 0x32, 0xc3, 0x0e, 0x7e, 0xc6, 0x2d, 0x13,
+    0x8a, 0x19, 0x8a, 0xf3, 0xdb, 0xb4, 0x58, 0x43, 0x4a, 0xe7, 0x0c, 0xe3, 0xb5, 0xd1, 0xe6, 0x2b,
+    0x8c, 0xe7, 0x28, 0x90, 0xbf, 0x01, 0xc3, 0x84, 0x6a, 0x94, 0x2a, 0x78, 0xe6, 0xe7, 0x36, 0x72,
+    0x0a, 0x22, 0xfd, 0x2e, 0xbb, 0x5e, 0x0b, 0xa8, 0xd4, 0x04, 0x64, 0xf3, 0x4e, 0x9c, 0xf1, 0x03,
+    0x44, 0x32, 0xeb, 0xec, 0xd4, 0x1c, 0x69, 0x5f, 0xf4, 0x01, 0xea, 0x03, 0x2f, 0x45, 0x74, 0x1e,
+    0xd9, 0xd5, 0xa6, 0x71, 0x92, 0xa0, 0x2a, 0x2a, 0x30, 0xb4, 0x6d, 0xe4, 0x4d, 0xad, 0x05, 0x8a,
+    0x06, 0x69, 0x04, 0x27, 0xdc, 0xe9, 0x51, 0x27, 0x40, 0xed, 0x82, 0x0f, 0xc4, 0xfa, 0x62, 0x13,
+    0x20, 0xf2, 0x3e, 0xa8, 0x02, 0x1f, 0xf1, 0x45, 0x1c, 0xf4, 0x33, 0xd5, 0xcd, 0x1e, 0xfa, 0xa0,
+    0x88, 0x4d, 0x10, 0xae, 0x37, 0xb4, 0xe6, 0x1d, 0x2c, 0x5c, 0x17, 0xc2, 0xc6, 0xa6, 0x6b, 0xce,
+    0x12, 0xe0, 0xfb, 0x06, 0xff, 0x22, 0xee, 0xe0, 0x3f, 0x05, 0x12, 0xee, 0x59, 0x5f, 0xb4, 0x9f,
+    0x69, 0x54, 0x3a, 0xd7, 0x5e, 0xfa, 0x8c, 0x2a, 0xa4, 0xfa, 0x5e, 0x55, 0x49, 0xc1, 0x56, 0x37,
+    0x2a, 0xa0, 0x21, 0xad, 0x85, 0x7f, 0x98, 0x8e, 0x09, 0x0d, 0x71, 0xa2, 0x3d, 0x28, 0x4c, 0x53,
+    0xe9, 0x98, 0x20, 0x06, 0xa4, 0x05, 0x8c, 0x3b, 0x29, 0x42, 0x89, 0x10, 0xca, 0x07, 0xac, 0xd7,
+    0x34, 0x61, 0x03, 0x1e, 0x75, 0xff, 0x9e, 0x6f, 0x5c, 0x5c, 0x7a, 0x41, 0x35, 0x10, 0x49, 0x38,
+    0x24, 0xfb, 0x76, 0x3e, 0xad, 0xfa, 0x62, 0xae, 0x9a, 0x19, 0x14, 0xcf, 0x20, 0xd8, 0x5c, 0x77,
+    0xe0, 0x4e, 0x36, 0x51, 0x74, 0xc2, 0xc9, 0x67, 0x51, 0x46, 0x37, 0x54, 0xae, 0xc3, 0xbc, 0xca,
+    0x88, 0x2c, 0x28, 0x2f, 0xe9, 0x3a, 0xf2, 0x25, 0xbf, 0x7d, 0x73, 0x74, 0xcc, 0x52, 0x70, 0xad,
+    0xef, 0x2f, 0x30, 0x5d, 0xb9, 0x65, 0xb5, 0xda, 0x5d, 0x80, 0xbb, 0x7b, 0x1b, 0x05, 0x78, 0x4d,
+    0xaa, 0x90, 0x91, 0x03, 0x42, 0xb4, 0xd3, 0x6b, 0x99, 0xb0, 0x0f, 0xd8, 0x61, 0x13, 0x35, 0x65,
+    0xa5, 0x52, 0x2b, 0x47, 0xcd, 0xc3, 0xa1, 0xeb, 0x5c, 0xbd, 0xab, 0xad, 0xe9, 0xf0, 0xe8, 0x97,
+    0xe8, 0x4a, 0xed, 0x3a, 0x1c, 0xd7, 0x2a, 0x3c, 0xa5, 0x94, 0x73, 0x3d, 0xd4, 0xa1, 0xea, 0xeb,
+    0x8a, 0xf0, 0x42, 0x74, 0xbb, 0xe2, 0x31, 0x0c, 0x25, 0xde, 0xa4, 0xb7, 0x75, 0x12, 0xfe, 0xd5,
+    0xfb, 0xf5, 0xdf, 0xd8, 0xfb, 0x15, 0x37, 0x47, 0x71, 0xa2, 0xa6, 0x80, 0x31, 0x1f, 0xf6, 0x9d,
+    0x65, 0x49, 0x29, 0x2d, 0x41, 0x5a, 0x98, 0x30, 0x47, 0x2d, 0x03, 0x0b, 0x06, 0x4d, 0x68, 0x7f,
+    0x33, 0x00, 0x7f, 0x46, 0x4f, 0x01, 0x9e, 0xea, 0xad, 0xa8, 0xe5, 0xb1, 0x87, 0xaa, 0x57, 0xa9,
+    0x0a, 0x64, 0x93, 0x40, 0xea, 0xd0, 0xff, 0x33, 0xc4, 0x7e, 0x4d, 0x29, 0x8d, 0x5b, 0xa4, 0xbe,
+    0xba, 0x15, 0xa6, 0xb0, 0x63, 0x90, 0xf4, 0xa9, 0x35, 0x54, 0xeb, 0x4a, 0xc5, 0x55, 0xe6, 0xc6,
+    0x16, 0xae, 0x18, 0xef, 0x2c, 0xe4, 0x9d, 0x88, 0xb6, 0x37, 0x5a, 0xad, 0x24, 0x82, 0xc9, 0xea,
+    0xbf, 0x67, 0x0d, 0x35, 0x79, 0x45, 0xd1, 0x16, 0x9f, 0xae, 0x72, 0xda, 0x0e, 0xb7, 0x7a, 0xd8,
+    0xe9, 0x9e, 0x86, 0x65, 0x4b, 0x7f, 0xb4, 0xd5, 0xc8, 0x20, 0xae, 0xfe, 0x8e, 0x33, 0x4f, 0x11,
+    0xea, 0x77, 0xc5, 0x5b, 0xb7, 0x14, 0xd6, 0x96, 0x86, 0x15, 0x6e, 0x58, 0xdf, 0xd4, 0x79, 0xfa,
+    0xf6, 0xde, 0xac, 0xdf, 0x42, 0x2e, 0x69, 0xc7, 0xd2, 0xe0, 0x9a, 0xcc, 0x38, 0x00, 0xe8, 0x3a,
+    0xba, 0x71, 0x91, 0x5c, 0xed, 0x65, 0xca, 0xf1, 0x98, 0x6e, 0xb4, 0x2a, 0x45, 0x9b, 0xb0, 0x9a,
+    0xc3, 0x2a, 0x67, 0xd3, 0xf7, 0xa5, 0xde, 0xa5, 0x77, 0xdc, 0xa8, 0x72, 0x17, 0x74, 0x3d, 0xc7,
+    0x34, 0x63, 0x4f, 0xe8, 0x2a, 0x86, 0x22, 0x5b, 0xcb, 0xb6, 0x4d, 0x28, 0xd4, 0x3b, 0x79, 0x95,
+    0xe0, 0x0b, 0xd6, 0xfc, 0xee, 0x27, 0xf4, 0x69, 0x6e, 0x7c, 0xf8, 0x88, 0x57, 0x0e, 0xa0, 0x8e,
+    0x39, 0x60, 0xf5, 0x7e, 0x7b, 0x12, 0x5d, 0x46, 0x39, 0xbf, 0x70, 0xe0, 0x36, 0x3c, 0xab, 0x7f,
+    0xef, 0xca, 0xa6, 0x0f, 0xd8, 0xb1, 0x79, 0xcf, 0xc5, 0x6f, 0x59, 0x5f, 0x1f, 0x24, 0x57, 0xf8,
+    0x53, 0x17, 0xdd, 0x08, 0xef, 0xea, 0x66, 0x5b, 0x21, 0x35, 0x0a, 0xb3, 0xc6, 0x12, 0xe9, 0x95,
+    0x2e, 0xb9, 0x5f, 0xe1, 0xe0, 0x5a, 0xab, 0x4b, 0x0d, 0x89, 0x54, 0x53, 0xba, 0xd3, 0x06, 0x77,
+    0xbd, 0x75, 0x79, 0xf4, 0x26, 0x07, 0xa0, 0x77, 0xd4, 0xaa, 0x55, 0x10, 0x21, 0x04, 0xe3, 0xd6,
+    0x23, 0xb7, 0x5b, 0x1d, 0xe8, 0xf8, 0xef, 0xe5, 0x00, 0x09, 0x4d, 0xbb, 0x4c, 0xef, 0xb6, 0xd9,
+    0xb2, 0x12, 0x8b, 0x6d, 0xa1, 0xf4, 0xbd, 0xc6, 0xd4, 0xa6, 0xa9, 0x35, 0xf2, 0xcd, 0x97, 0x0f,
+    0x0a, 0x75, 0xc5, 0x47, 0xc3, 0x2a, 0xa3, 0x1f, 0x34, 0xa0, 0x4d, 0xf7, 0x18, 0x7e, 0x95, 0xf1,
+    0x8f, 0xaf, 0x0c, 0xa2, 0x24, 0xd6, 0xbc, 0xdd, 0xfe, 0x47, 0x86, 0xe6, 0xf7, 0x33, 0xfa, 0x7d,
+    0x3b, 0x27, 0x37, 0xd7, 0xd2, 0xf8, 0x93, 0x19, 0x0d, 0x71, 0x5f, 0x4a, 0x43, 0xe0, 0x9c, 0x78,
+    0x14, 0xf0, 0xda, 0xbe, 0x35, 0x25, 0x3d, 0x27, 0x2e, 0x2c, 0x30, 0xba, 0x8e, 0x0f, 0xa1, 0x48,
+    0xfc, 0xe0, 0x64, 0xe2, 0x69, 0xbf, 0x19, 0xcf, 0xa6, 0xab, 0xb1, 0xbc, 0x2c, 0x78, 0xa5, 0xe7,
+    0x45, 0x5b, 0x85, 0x91, 0xdd, 0xc9, 0x9b, 0x0e, 0xa6, 0x60, 0x31, 0x9e, 0x25, 0xa9, 0xdf, 0xd0,
+    0xc4, 0xf1, 0x57, 0x1a, 0x98, 0x74, 0xf1, 0x4a, 0xeb, 0x92, 0x1a, 0x3e, 0xd4, 0x0b, 0x74, 0x11,
+    0x65, 0x56, 0x82, 0xe9, 0x48, 0x93, 0xc0, 0xef, 0xaf, 0xa3, 0x4b, 0xb7, 0xf9, 0x28, 0xfc, 0x5e,
+    0x42, 0x7f, 0xb5, 0x83, 0x8a, 0x4a, 0xd8, 0xd1, 0xf0, 0x44, 0xd5, 0xbb, 0xba, 0x96, 0x36, 0xa6,
+    0x5b, 0x04, 0x73, 0xf2, 0xb5, 0xa4, 0x17, 0x34, 0xcb, 0x23, 0x00, 0x0e, 0x8d, 0x22, 0x02, 0x36,
+    0xdd, 0x99, 0x80, 0x25, 0x98, 0x16, 0x33, 0xa6, 0x84, 0xdc, 0xe2, 0x92, 0x59, 0x8b, 0x6b, 0x17,
+    0x74, 0x6f, 0x54, 0x0a, 0x63, 0x91, 0xac, 0xb2, 0xf7, 0x33, 0x2d, 0x16, 0x50, 0xc6, 0x9c, 0xf3,
+    0x5b, 0x00, 0x79, 0x57, 0xd0, 0x39, 0xec, 0xfb, 0x59, 0x99, 0xe9, 0x48, 0xe3, 0x20, 0xeb, 0x90,
+    0x85, 0xd2, 0xbc, 0x01, 0xe7, 0xab, 0x8c, 0x68, 0x57, 0x33, 0x61, 0x16, 0xb3, 0x6c, 0x5a, 0xe7,
+    0x9d, 0xab, 0x99, 0xe2, 0x8e, 0x50, 0xf2, 0xf1, 0x6d, 0x9d, 0x0f, 0x05, 0x6e, 0x8f, 0x6d, 0xcb,
+    0x6f, 0x26, 0x2b, 0x36, 0x53, 0x60, 0x28, 0xfa, 0xf8, 0xf3, 0x5e, 0xe7, 0x62, 0xaa, 0xd4, 0xbe,
+    0x05, 0xfc, 0x68, 0xb9, 0x20, 0xed, 0xf3, 0xf1, 0x93, 0x57, 0xd7, 0x15, 0x50, 0xe0, 0x35, 0x54,
+    0x74, 0x75, 0x52, 0x21, 0xe7, 0xc4, 0x63, 0xe9, 0x92, 0x96, 0xab, 0x02, 0xf4, 0xc7, 0x8e, 0x34,
+    0x7b, 0x9c, 0xd6, 0x1a, 0x3b, 0x40, 0x81, 0xf0, 0xea, 0xe2, 0x14, 0xeb, 0x95, 0xf6, 0x4e, 0x15,
+    0x27, 0x94, 0x76, 0xd1, 0x44, 0xdc, 0x14, 0x25, 0x47, 0xb8, 0x6d, 0x30, 0xe5, 0xb0, 0x04, 0x87,
+    0xb7, 0x76, 0x42, 0x44, 0x06, 0x4c, 0x8e, 0xd2, 0x16, 0xb2, 0xca, 0xa1, 0xc1, 0xd3, 0x69, 0x64,
+    0x30, 0xf4, 0xf6, 0xf3, 0x2e, 0x86, 0x43, 0x4f, 0x97, 0x89, 0x89, 0x87, 0xc6, 0x41, 0xa2, 0xc5,
+    0x36, 0x10, 0x7e, 0x91, 0xb7, 0x11, 0x94, 0xd8, 0x8d, 0x8a, 0xa7, 0x07, 0xc2, 0x50, 0x24, 0xd0,
+    0x36, 0x4d, 0xeb, 0x0e, 0x4c, 0x6d, 0x37, 0x17, 0xe6, 0x78, 0xb3, 0x59, 0x61, 0xe2, 0xbb, 0x9b,
+    0x2d, 0x51, 0x12, 0x61, 0xb3, 0x83, 0xd7, 0xa8, 0x28, 0x9b, 0x2f, 0x94, 0xf8, 0xac, 0x03, 0x75,
+    0xac, 0xc6, 0x61, 0xa3, 0x01, 0x00, 0xc2, 0x88, 0x42, 0x28, 0xc9, 0xce, 0xca, 0xbf, 0x5b, 0x25,
+    0x16, 0xd0, 0x12, 0x4a, 0xcf, 0xf0, 0xa6, 0x3c, 0xae, 0x39, 0x91, 0xba, 0xa4, 0x4f, 0x28, 0xf9,
+    0x4a, 0x2b, 0x3b, 0x25, 0x6b, 0x91, 0x6f, 0x04, 0x39, 0x96, 0x48, 0x45, 0x86, 0x3e, 0x5b, 0x35,
+    0x7a, 0x42, 0x46, 0x5c, 0x13, 0x09, 0x9a, 0x4b, 0xb9, 0x2d, 0x10, 0x54, 0xbf, 0x28, 0x99, 0x90,
+    0x39, 0x90, 0x74, 0x85, 0x0b, 0x29, 0x49, 0xcb, 0x69, 0x6b, 0xf1, 0x5d, 0x81, 0x3a, 0xb6, 0x1d,
+    0x30, 0x7b, 0xaf, 0x2b, 0xce, 0x18, 0x2c, 0x09, 0x37, 0x71, 0x16, 0x4f, 0xd9, 0xdd, 0x86, 0xab,
+    0xe7, 0x3d, 0xa7, 0x7f, 0x0c, 0x15, 0xc2, 0xda, 0x51, 0x60, 0x79, 0xb1, 0xa3, 0x50, 0x87, 0x02,
+    0xb8, 0xb1, 0x10, 0xd7, 0x1b, 0xd6, 0xe9, 0xc9, 0x9f, 0x7a, 0x8b, 0xd1, 0xcd, 0x88, 0xf6, 0x3e,
+    0x43, 0xf8, 0x2c, 0x0a, 0x8b, 0x65, 0xcf, 0xf0, 0x42, 0x88, 0xc4, 0xf5, 0x83, 0x8e, 0x09, 0x8e,
+    0x7e, 0x8f, 0xc3, 0x28, 0x16, 0x85, 0xf6, 0x41, 0xe1, 0x6c, 0x36, 0xed, 0xdd, 0x84, 0x2a, 0x7a,
+    0xef, 0x54, 0x88, 0x2e, 0x9e, 0x83, 0x9f, 0xbc, 0x54, 0x1b, 0xcd, 0xc2, 0x8e, 0x07, 0xc8, 0xe6,
+    0x9b, 0xb7, 0x8d, 0x7b, 0x0e, 0xed, 0xa8, 0x8b, 0xef, 0xec, 0xc5, 0xe4, 0xd7, 0xc6, 0xb9, 0x67,
+    0x53, 0x51, 0xd9, 0xe6, 0xe9, 0xdb, 0xd5, 0x6d, 0x01, 0x47, 0xc6, 0xd9, 0x7e, 0x85, 0xc6, 0x2d,
+    0x6e, 0xcc, 0xfc, 0xd6, 0x3a, 0x37, 0xaf, 0xfe, 0xdf, 0x46, 0xeb, 0x16, 0xa3, 0xf1, 0xab, 0xde,
+    0x6d, 0xeb, 0xdd, 0x42, 0x71, 0x5a, 0x4c, 0x88, 0xd9, 0x4d, 0x14, 0xb6, 0x7a, 0xfd, 0x1d, 0x54,
+    0xf9, 0xa7, 0x30, 0x48, 0x1b, 0xb0, 0xa5, 0xb6, 0x73, 0xa8, 0x20, 0x69, 0xde, 0x20, 0x0b, 0xf4,
+    0x95, 0x6b, 0x24, 0xb5, 0x0a, 0x48, 0x65, 0x45, 0x2e, 0x4a, 0x33, 0x5d, 0x22, 0x6c, 0x4b, 0x16,
+    0x24, 0xac, 0x15, 0x1a, 0xba, 0xae, 0xca, 0x3c, 0x5f, 0x2e, 0x55, 0xd5, 0xcd, 0xba, 0xec, 0xc3,
+    0xe8, 0x2d, 0x3a, 0xbb, 0x60, 0xa1, 0x6a, 0xad, 0xdd, 0x1d, 0x09, 0x9b, 0x38, 0xb3, 0xcd, 0x76,
+    0x8e, 0xee, 0x46, 0xb1, 0x3e, 0xf4, 0xcc, 0xd1, 0xf9, 0x46, 0x58, 0xf5, 0x20, 0xd9, 0x9b, 0x87,
+    0x81, 0xa6, 0x5d, 0xf7, 0x8a, 0xd8, 0x51, 0x88, 0xda, 0xcd, 0xf4, 0x5f, 0x77, 0x15, 0x3f, 0xf7,
+    0xae, 0x62, 0x64, 0xed, 0x27, 0xb4, 0xce, 0x26, 0xaf, 0xb3, 0xad, 0x99, 0x7a, 0x1b, 0x6f, 0x80,
+    0xd2, 0x65, 0xb9, 0x42, 0x41, 0x42, 0x8c, 0x32, 0xe4, 0x96, 0xa1, 0x03, 0x23, 0xad, 0xae, 0xab,
+    0xb2, 0x2a, 0x80, 0x45, 0xba, 0xdd, 0xdb, 0x85, 0x38, 0xa9, 0x10, 0x8f, 0xbc, 0x7b, 0x0c, 0xd6,
+    0xa8, 0xcc, 0x37, 0x76, 0x17, 0xff, 0x92, 0x7b, 0x0b, 0x6f, 0xe3, 0x7e, 0xdd, 0x07, 0xfc, 0xba,
+    0x0f, 0xa8, 0xda, 0x07, 0xdc, 0x66, 0x03, 0x20, 0x5e, 0xa0, 0x20, 0x54, 0x3f, 0x48, 0x95, 0xb3,
+    0x16, 0xa9, 0x39, 0xda, 0xe5, 0xd6, 0x45, 0x7b, 0x59, 0xa6, 0x8c, 0xda, 0xb9, 0x47, 0x3f, 0xe6,
+    0xd7, 0x99, 0xd7, 0x17, 0xab, 0x39, 0x34, 0x6b, 0x0c, 0x0a, 0x72, 0x6d, 0x50, 0x80, 0x62, 0x9b,
+    0xe1, 0x2d, 0x74, 0x70, 0x8b, 0xb4, 0x5b, 0xa8, 0xdb, 0xdb, 0x06, 0xce, 0xaf, 0x5f, 0x8b, 0x57,
+    0x5f, 0x4e, 0x99, 0xf2, 0x9c, 0xa4, 0x84, 0xe1, 0xaf, 0x3e, 0x98, 0xbf, 0x8c, 0x7b, 0x34, 0x9d,
+    0xbb, 0xde, 0xc5, 0x68, 0x92, 0x08, 0x75, 0xce, 0x9c, 0xcb, 0x42, 0x16, 0xe5, 0x3c, 0x35, 0x27,
+    0x28, 0x16, 0xdf, 0xed, 0xca, 0xcd, 0x7f, 0x92, 0x70, 0x55, 0x2e, 0x5f, 0x3f, 0x8a, 0xf7, 0x29,
+    0x84, 0xa4, 0xe3, 0xfe, 0x5e, 0x5a, 0xc4, 0x89, 0xd3, 0x4a, 0xc3, 0x98, 0x6d, 0xb9, 0x89, 0x3d,
+    0x4d, 0x12, 0x60, 0xba, 0x85, 0x6a, 0xb3, 0xe1, 0xb7, 0xa4, 0x3d, 0x99, 0x78, 0x15, 0xb0, 0x72,
+    0x57, 0xbb, 0x35, 0x7d, 0x5d, 0xbf, 0x41, 0x73, 0xa5, 0x4e, 0x64, 0xba, 0x1d, 0x7d, 0x91, 0x17,
+    0x48, 0xba, 0x4e, 0x47, 0x7f, 0x94, 0x0d, 0x83, 0xfe, 0x52, 0x9f, 0xe4, 0x67, 0x64, 0xb9, 0x15,
+    0x15, 0x9c, 0x88, 0x1e, 0xf5, 0xab, 0x9d, 0x88, 0x8e, 0x1e, 0xfe, 0x12, 0x9d, 0x88, 0x7e, 0x5a,
+    0x57, 0x8e, 0x55, 0x16, 0xfe, 0x9f, 0x28, 0x4e, 0xd0, 0xef, 0x50, 0xc6, 0xbc, 0x50, 0x47, 0xd3,
+    0x21, 0xb7, 0x3e, 0xc5, 0xcb, 0x50, 0x06, 0xf3, 0x8b, 0xf1, 0x6d, 0x70, 0x3c, 0x06, 0xdf, 0x27,
+    0x50, 0x1e, 0xfc, 0x20, 0xb0, 0x02, 0x77, 0xbf, 0x12, 0x07, 0xcf, 0x9e, 0x22, 0xf5, 0xcf, 0xef,
+    0x67, 0x75, 0xbc, 0xd1, 0x1a, 0xfe, 0x94, 0x3b, 0x81, 0xfd, 0xea, 0x3d, 0xf5, 0xab, 0xf7, 0xd4,
+    0x2f, 0xe3, 0xee, 0xc0, 0xfe, 0xe1, 0xd1, 0x41, 0x38, 0xaa, 0xdf, 0xca, 0x9d, 0x48, 0x7a, 0xa1,
+    0x70, 0x29, 0x76, 0x07, 0x57, 0x22, 0xa1, 0x9b, 0xfe, 0xea, 0x48, 0xf4, 0xaf, 0xe6, 0x48, 0xf4,
+    0x47, 0x73, 0xe4, 0x71, 0x48, 0x50, 0x76, 0xba, 0xae, 0x46, 0x06, 0xa4, 0xf4, 0x27, 0xd2, 0x49,
+    0x46, 0x94, 0x1a, 0x1b, 0xf8, 0xd2, 0x7b, 0xd5, 0x6e, 0x47, 0xf7, 0x6f, 0x94, 0x00, 0xde, 0x54,
+    0x7a, 0x20, 0x49, 0x82, 0x2a, 0x6e, 0xaf, 0x75, 0xf3, 0xad, 0x1b, 0x6c, 0x6b, 0xe7, 0x25, 0x70,
+    0xa0, 0xd9, 0xf3, 0x18, 0x87, 0xba, 0xed, 0x18, 0xf8, 0x72, 0x9b, 0x45, 0xdf, 0x51, 0xd4, 0xa4,
+    0x69, 0xff, 0x6b, 0xbc, 0xa5, 0x6e, 0x31, 0x69, 0xad, 0xd1, 0xd1, 0xb7, 0x66, 0x3a, 0x07, 0x29,
+    0xce, 0x09, 0x9d, 0xd0, 0x96, 0xa8, 0x4c, 0xd1, 0xf2, 0xe2, 0x34, 0xe8, 0x0c, 0xc3, 0x8a, 0xd5,
+    0x69, 0xc4, 0x6f, 0x9d, 0x5e, 0xf1, 0x1c, 0x56, 0x38, 0xe5, 0xad, 0x53, 0x0b, 0xfb, 0x62, 0xb7,
+    0x9f, 0xcc, 0x4b, 0x6b, 0x9b, 0x3b, 0x96, 0x73, 0x0b, 0x23, 0x6d, 0x72, 0x4d, 0x37, 0xae, 0x6f,
+    0xe6, 0xa1, 0x65, 0x48, 0xe2, 0x9f, 0xc7, 0x45, 0xcb, 0xde, 0xc7, 0xb3, 0x82, 0x5b, 0x16, 0xab,
+    0x74, 0xcb, 0x12, 0xf7, 0x43, 0xea, 0xa7, 0x4a, 0xc2, 0xfc, 0x09, 0xbd, 0xef, 0xab, 0x23, 0xdd,
+    0x65, 0xa0, 0xf2, 0x4d, 0xad, 0xf0, 0x9c, 0xa2, 0xc9, 0xbf, 0xfc, 0x2d, 0x39, 0x15, 0xee, 0x3c,
+    0xb2, 0x1f, 0x91, 0x5b, 0xda, 0x81, 0xf3, 0x0a, 0xa5, 0x00, 0xa3, 0x57, 0x4a, 0x5f, 0x45, 0x59,
+    0xde, 0x09, 0x26, 0x93, 0x46, 0x9d, 0x3f, 0x31, 0x5c, 0x37, 0xaf, 0xbc, 0x2c, 0x00, 0xa6, 0x21,
+    0x2e, 0xe3, 0x16, 0xac, 0x7b, 0x69, 0x1f, 0xdf, 0x8a, 0x4b, 0x13, 0xab, 0xd4, 0xda, 0xe4, 0xc4,
+    0x12, 0x7b, 0x7e, 0x6d, 0xf5, 0x94, 0x72, 0xd3, 0x6b, 0xfa, 0x12, 0xd0, 0x66, 0xa0, 0x7b, 0xbd,
+    0x6d, 0x84, 0x68, 0x07, 0x23, 0x7a, 0x6e, 0x4d, 0x6d, 0x18, 0xf0, 0x9a, 0x78, 0x59, 0x86, 0xa3,
+    0x54, 0x10, 0x42, 0x8f, 0xd5, 0x94, 0x7c, 0x06, 0x5d, 0x94, 0xec, 0xb9, 0x9c, 0xa0, 0x7d, 0xdb,
+    0x59, 0x4d, 0x07, 0xf7, 0x2a, 0xc4, 0x58, 0xa0, 0x59, 0x1e, 0xb7, 0x8c, 0xd9, 0xbe, 0x00, 0x5f,
+    0x50, 0x71, 0x55, 0xe4, 0xb2, 0x43, 0x8d, 0xd1, 0x2c, 0x40, 0x20, 0x28, 0xb1, 0x22, 0x93, 0x45,
+    0xd9, 0x72, 0xa0, 0x9e, 0x06, 0x72, 0x46, 0xe0, 0x02, 0xcd, 0x28, 0xfc, 0xe8, 0x43, 0xc6, 0x57,
+    0x95, 0x0e, 0x82, 0x84, 0xb8, 0xc5, 0x30, 0xd4, 0xad, 0xd7, 0xa1, 0x2c, 0xe3, 0x91, 0x1e, 0x01,
+    0xe3, 0x38, 0xd2, 0xf5, 0x3c, 0xdd, 0xed, 0x2c, 0xd5, 0xf0, 0x3f, 0xc5, 0xb0, 0x98, 0x53, 0x26,
+    0x8a, 0x48, 0x5b, 0x13, 0x7f, 0x28, 0xb6, 0xd9, 0x59, 0x06, 0x13, 0xb2, 0xec, 0x37, 0x60, 0x42,
+    0xd7, 0xbb, 0xfa, 0x25, 0x47, 0x19, 0x11, 0xee, 0x14, 0xe3, 0x5e, 0x5e, 0x15, 0xe5, 0x74, 0x14,
+    0xb8, 0x53, 0x52, 0x5c, 0x45, 0xec, 0x2f, 0x6b, 0x04, 0x7c, 0x63, 0x2b, 0x70, 0xfd, 0x05, 0xaa,
+    0xf1, 0x0f, 0xd1, 0xb1, 0x19, 0xa8, 0x48, 0xf0, 0x8d, 0x3d, 0x62, 0x93, 0x10, 0x9f, 0xf9, 0x1d,
+    0xa9, 0x17, 0x18, 0x1b, 0xf3, 0xaa, 0xd1, 0x9a, 0x6f, 0x1d, 0x28, 0xdc, 0x72, 0xcb, 0x62, 0xee,
+    0x0d, 0x07, 0xea, 0xba, 0x25, 0x6b, 0x04, 0xd7, 0x99, 0x35, 0x17, 0x74, 0x88, 0x3f, 0xd6, 0x33,
+    0x91, 0x01, 0xfb, 0x86, 0xc3, 0xa7, 0x9e, 0x20, 0x13, 0x33, 0x9c, 0xdf, 0xda, 0xfd, 0x49, 0xbd,
+    0xc9, 0x1f, 0xd2, 0x6f, 0xf6, 0x17, 0x41, 0x6e, 0x10, 0xf0, 0xfe, 0x8d, 0x25, 0x18, 0x48, 0x70,
+    0xf5, 0x70, 0xab, 0x48, 0xfb, 0xc4, 0xac, 0xbe, 0xf9, 0x64, 0x47, 0xee, 0xd9, 0x74, 0x5b, 0xd7,
+    0x33, 0xcc, 0xe4, 0x15, 0x01, 0x7e, 0xba, 0x75, 0x76, 0x29, 0xe1, 0xf6, 0x55, 0x01, 0x55, 0x94,
+    0x23, 0xe4, 0x6d, 0x48, 0xd7, 0x0c, 0xa6, 0x89, 0xbf, 0xe5, 0xf5, 0x02, 0x36, 0xa9, 0xa5, 0x57,
+    0x0c, 0x78, 0x88, 0xe5, 0xb0, 0xbb, 0x91, 0xbb, 0xbf, 0xcf, 0xf0, 0xb5, 0x2e, 0x7c, 0xdc, 0x90,
+    0x8d, 0x83, 0x34, 0x5d, 0x8b, 0xb3, 0x9b, 0x8c, 0x3f, 0x11, 0xdc, 0x61, 0x4f, 0xc3, 0x29, 0x3e,
+    0xdc, 0x60, 0xbc, 0xb6, 0x39, 0x0b, 0x32, 0x86, 0xef, 0xfa, 0xcd, 0xd2, 0x64, 0x11, 0xfd, 0x35,
+    0x9c, 0xe0, 0x8b, 0x9b, 0x88, 0x67, 0x1c, 0x27, 0xe3, 0xcf, 0x08, 0xb8, 0x66, 0x01, 0x94, 0x58,
+    0xa6, 0xc9, 0x97, 0x28, 0x03, 0x6e, 0x0f, 0x62, 0x3c, 0xd9, 0x45, 0x30, 0x86, 0xab, 0x0b, 0xbd,
+    0x2c, 0x38, 0x67, 0x09, 0x3e, 0x17, 0x18, 0x91, 0xad, 0xaa, 0xa3, 0x67, 0x4a, 0xe1, 0x28, 0x4c,
+    0xd0, 0xa1, 0x6f, 0x04, 0xa2, 0x4f, 0x5f, 0xd0, 0xaa, 0x99, 0x65, 0x04, 0xac, 0x96, 0x5e, 0xa2,
+    0x52, 0x98, 0x77, 0xb2, 0x2a, 0xd5, 0xa3, 0xa5, 0xd3, 0xef, 0x5c, 0x15, 0xfe, 0xbd, 0x34, 0x89,
+    0x48, 0xdc, 0xaa, 0x25, 0x25, 0x27, 0xe3, 0x65, 0x17, 0x97, 0xb8, 0x8f, 0x35, 0x77, 0xcc, 0x87,
+    0x9a, 0x4d, 0xc9, 0x4c, 0x47, 0xa6, 0x8b, 0xe4, 0xca, 0x7c, 0x01, 0x21, 0x8c, 0x83, 0x65, 0x46,
+    0xf7, 0xd4, 0xe8, 0x5c, 0x7c, 0xdb, 0xa2, 0x80, 0xd4, 0x7c, 0xe9, 0x19, 0x8f, 0xef, 0x35, 0xb8,
+    0x6e, 0x75, 0x25, 0x25, 0xb2, 0xc1, 0x0f, 0x2c, 0xeb, 0x8b, 0xa8, 0xdf, 0xa0, 0x68, 0x14, 0x2d,
+    0x82, 0x94, 0xdf, 0xf0, 0x60, 0xbf, 0x99, 0xfa, 0xa1, 0xce, 0xb9, 0xb3, 0x0e, 0x42, 0x75, 0x46,
+    0x4e, 0xef, 0xe2, 0x3a, 0x07, 0x79, 0x1f, 0x91, 0xde, 0x3b, 0x13, 0x0a, 0xe3, 0x76, 0xe0, 0x72,
+    0x44, 0x7f, 0x59, 0xe1, 0xf5, 0xc4, 0x69, 0x5b, 0x22, 0x34, 0x11, 0x7f, 0x74, 0x1f, 0xd8, 0xfe,
+    0x43, 0x30, 0x0f, 0x39, 0x82, 0x04, 0x5f, 0xd6, 0x06, 0x4d, 0x15, 0x1f, 0xd5, 0x86, 0xea, 0xc5,
+    0x63, 0xda, 0x50, 0x1c, 0x9f, 0xd1, 0xfe, 0x48, 0xaf, 0xd0, 0xbe, 0xa3, 0xa7, 0x30, 0x03, 0xb1,
+    0xe6, 0x9e, 0x02, 0x4d, 0xf2, 0x8d, 0x78, 0xfd, 0xb6, 0x63, 0x23, 0x8e, 0x72, 0x50, 0x13, 0xdb,
+    0xe1, 0x62, 0x12, 0x05, 0x8b, 0x16, 0xa8, 0xfa, 0xeb, 0x64, 0x95, 0x2b, 0xa1, 0x3f, 0x41, 0x3c,
+    0x50, 0xee, 0x7d, 0x38, 0x22, 0xfd, 0x7f, 0x1a, 0x8c, 0xc3, 0xce, 0x78, 0xb9, 0x6c, 0xa2, 0xef,
+    0x52, 0xc2, 0xdf, 0x9e, 0x05, 0x92, 0x58, 0x42, 0xaf, 0x10, 0xd2, 0xf7, 0xff, 0xbe, 0xf8, 0xe1,
+    0x0f, 0x78, 0x3c, 0x4e, 0xd7, 0x34, 0x67, 0x8c, 0x0f, 0x4c, 0xc7, 0x5c, 0x4f, 0xc6, 0xc9, 0x24,
+    0x14, 0x6f, 0xb2, 0x3e, 0xa5, 0x7e, 0x02, 0xdd, 0x70, 0x3a, 0xe5, 0xcf, 0x01, 0x08, 0xc1, 0x11,
+    0xc1, 0x7a, 0xad, 0x56, 0xed, 0xe0, 0x8f, 0xf0, 0x29, 0x61, 0xb8, 0xf8, 0x44, 0x80, 0xce, 0x68,
+    0x9d, 0x87, 0xaf, 0xf8, 0x8e, 0xe3, 0x04, 0x77, 0x2c, 0x30, 0x9d, 0x28, 0x1d, 0x96, 0xc2, 0x1f,
+    0xa1, 0xee, 0x63, 0xdc, 0x99, 0xe2, 0xee, 0xa4, 0xe7, 0x7d, 0x57, 0xf2, 0xc7, 0x45, 0xb6, 0x5a,
+    0x2e, 0xf9, 0x95, 0x8f, 0xb2, 0x5b, 0x78, 0x4f, 0x99, 0xaf, 0x4b, 0x7e, 0x8e, 0xc8, 0xab, 0xda,
+    0xc6, 0xab, 0x9d, 0x10, 0x66, 0x61, 0x30, 0x09, 0xd3, 0x0b, 0x7c, 0xe7, 0xd7, 0x06, 0xea, 0x1d,
+    0xe1, 0xd2, 0x8b, 0xf7, 0xfc, 0x99, 0xd7, 0x1a, 0x26, 0xe9, 0xc4, 0x0f, 0xfb, 0xb0, 0x00, 0x2b,
+    0xd9, 0x45, 0x9e, 0x66, 0xdb, 0x14, 0x68, 0xdb, 0x28, 0x3f, 0x7d, 0x93, 0x1c, 0x6e, 0xc3, 0x1d,
+    0xf4, 0x1b, 0xc7, 0x0e, 0x62, 0x71, 0xf8, 0x8f, 0x2c, 0xa4, 0x98, 0x6b, 0x0c, 0x1a, 0x75, 0xb4,
+    0xa2, 0xa3, 0xe8, 0x84, 0xde, 0xab, 0xf7, 0xdb, 0x88, 0x04, 0xe2, 0x97, 0x44, 0x30, 0x07, 0x54,
+    0xc8, 0xc5, 0xf4, 0xd3, 0xaf, 0x4a, 0xb6, 0x0f, 0xfa, 0x8f, 0x8e, 0x8e, 0x49, 0xd8, 0x80, 0xa0,
+    0x1b, 0x28, 0x1b, 0x67, 0x8f, 0xde, 0x9f, 0x32, 0x4c, 0x1f, 0x1c, 0x11, 0xae, 0x67, 0xaa, 0x2b,
+    0x87, 0x32, 0xf1, 0x81, 0xd9, 0x67, 0x27, 0x82, 0x04, 0x3d, 0xea, 0x1a, 0xee, 0xd4, 0x00, 0x34,
+    0xee, 0x07, 0x2a, 0x76, 0x87, 0x43, 0x36, 0xb2, 0x12, 0x1f, 0xe1, 0x53, 0x6b, 0x25, 0xce, 0xc4,
+    0xa1, 0x93, 0xdd, 0xe9, 0x8a, 0xaa, 0x1e, 0x9e, 0x56, 0x48, 0x37, 0x0a, 0x7e, 0xd9, 0x60, 0x2d,
+    0x6f, 0xd5, 0xae, 0x40, 0x37, 0x94, 0x25, 0xbe, 0x8b, 0x93, 0x40, 0x57, 0x08, 0x65, 0xe4, 0x08,
+    0xab, 0xcb, 0xa8, 0x1c, 0x0e, 0x50, 0x80, 0x72, 0xc4, 0xa8, 0xb3, 0x5a, 0x35, 0x98, 0xf9, 0x03,
+    0x7b, 0xfa, 0x7f, 0xe0, 0xd4, 0xfd, 0x8e, 0x75, 0xaf, 0xbb, 0x07, 0xe4, 0x7d, 0x36, 0x5f, 0x02,
+    0xbf, 0x64, 0x78, 0xe9, 0x4e, 0xc3, 0xc8, 0x7b, 0xc8, 0xb9, 0xbf, 0x2b, 0xee, 0x05, 0xe3, 0xfb,
+    0x26, 0xab, 0xc5, 0x7d, 0xe3, 0xd8, 0x90, 0x9f, 0xd1, 0x96, 0xf5, 0x98, 0xd1, 0x00, 0xcb, 0x95,
+    0x89, 0x1f, 0x62, 0x97, 0xb5, 0xb9, 0xc8, 0x7c, 0x93, 0xea, 0x02, 0x3d, 0x3d, 0x67, 0xfc, 0xdd,
+    0x4b, 0x18, 0x54, 0x17, 0x4a, 0xa2, 0xf9, 0x29, 0x0b, 0x3a, 0xb2, 0x20, 0xfe, 0xb6, 0x24, 0x4d,
+    0x06, 0xd4, 0x63, 0x57, 0x4a, 0x50, 0xee, 0x90, 0x87, 0xc5, 0x5f, 0xe3, 0x35, 0x81, 0x65, 0x83,
+    0x80, 0xdb, 0x64, 0x73, 0x14, 0x78, 0x09, 0x7c, 0x74, 0xa4, 0xb4, 0x84, 0x33, 0x6e, 0x65, 0x7d,
+    0x7e, 0x60, 0xba, 0xe0, 0xe8, 0xc6, 0x89, 0x8b, 0xb8, 0x89, 0x28, 0x31, 0x1f, 0x8d, 0xae, 0x6f,
+    0x6a, 0x00, 0xa4, 0xa1, 0x00, 0x70, 0xd4, 0x34, 0x2e, 0x39, 0x2f, 0xe4, 0x1e, 0x37, 0xf9, 0x2d,
+    0xe6, 0x7e, 0xe4, 0xbd, 0xae, 0xcc, 0xf6, 0xa2, 0xee, 0xf5, 0x9b, 0xf2, 0x0e, 0xf4, 0x62, 0xde,
+    0xc3, 0xa6, 0xbc, 0x74, 0x4e, 0xca, 0xcb, 0x69, 0x94, 0xd2, 0x13, 0xdb, 0x95, 0x9e, 0x80, 0xdd,
+    0x8f, 0x9d, 0xbc, 0xe0, 0xfa, 0xb7, 0xbd, 0x98, 0xc7, 0x81, 0xd0, 0xc0, 0x53, 0xec, 0x65, 0x75,
+    0x1b, 0x94, 0x96, 0xa6, 0x83, 0xca, 0x95, 0xf9, 0x83, 0x23, 0x76, 0x3f, 0xd2, 0xf1, 0xa0, 0x5c,
+    0xaa, 0x6b, 0x96, 0xa8, 0x6d, 0xd5, 0xd4, 0xc3, 0xee, 0x17, 0xdc, 0x59, 0xcc, 0x99, 0x38, 0x8a,
+    0x97, 0x0d, 0xc8, 0x17, 0xe8, 0x3a, 0xe6, 0xc2, 0x1d, 0x29, 0x38, 0xe9, 0x40, 0xcb, 0x2f, 0x9d,
+    0x12, 0x9a, 0x5e, 0x42, 0x36, 0xa7, 0xee, 0xf5, 0x54, 0xfc, 0x37, 0x74, 0x2e, 0xeb, 0x2d, 0x4e,
+    0x59, 0x85, 0xd1, 0xf6, 0xab, 0x2c, 0x02, 0xf6, 0xbb, 0x0e, 0xa0, 0x3a, 0x01, 0x95, 0x37, 0xd9,
+    0x96, 0xb5, 0x49, 0xad, 0x53, 0xca, 0x6f, 0xcd, 0x3b, 0xb1, 0xfb, 0xc7, 0x3e, 0xf8, 0x17, 0x25,
+    0x62, 0xe0, 0xc0, 0xc5, 0x0e, 0xea, 0xb5, 0x7c, 0xcb, 0xcd, 0x7b, 0x57, 0xde, 0x85, 0x9c, 0xe7,
+    0xbf, 0xfb, 0x9d, 0x1f, 0x80, 0x6a, 0x32, 0xef, 0x05, 0x2b, 0x72, 0x82, 0xab, 0xe6, 0xdd, 0x8e,
+    0x07, 0xd4, 0x88, 0xd9, 0x3d, 0x07, 0x62, 0x9b, 0x1c, 0x84, 0xc2, 0x89, 0x70, 0x1b, 0xb6, 0x59,
+    0x17, 0xca, 0x89, 0xc1, 0x1b, 0x18, 0xc3, 0x88, 0xbb, 0x02, 0x1c, 0x6c, 0xb5, 0x66, 0xca, 0xac,
+    0x96, 0xb8, 0xdc, 0x68, 0xa0, 0x06, 0xb2, 0x00, 0xca, 0x33, 0x0c, 0x32, 0x2e, 0x96, 0xb0, 0x64,
+    0x70, 0x2a, 0x07, 0xaa, 0x36, 0x7e, 0x63, 0x21, 0x16, 0x84, 0x0e, 0x73, 0xc6, 0xfa, 0x0c, 0xf6,
+    0x57, 0xf4, 0x72, 0x10, 0xd5, 0x00, 0xdb, 0x39, 0x55, 0x48, 0xde, 0xf8, 0x0c, 0x13, 0x4e, 0xa5,
+    0x91, 0x18, 0x95, 0x6d, 0x34, 0xeb, 0x2a, 0xce, 0xe0, 0x1e, 0x21, 0xa0, 0xe2, 0x5c, 0x38, 0x70,
+    0xa7, 0x6a, 0x61, 0x4e, 0x45, 0x7f, 0x49, 0x35, 0xcc, 0xe7, 0x36, 0x3f, 0x49, 0x8f, 0xe8, 0xa2,
+    0x73, 0xe4, 0x8e, 0x65, 0xd0, 0xbd, 0xb5, 0xb4, 0x04, 0xe7, 0x42, 0x07, 0xbe, 0x1a, 0xb8, 0xed,
+    0xaf, 0x8b, 0x7c, 0x1f, 0x74, 0xd9, 0xc2, 0x24, 0xd0, 0x4b, 0xbf, 0x7d, 0x99, 0xdc, 0x6a, 0x89,
+    0x96, 0x1b, 0x6d, 0x57, 0x7d, 0xc2, 0x47, 0x24, 0x02, 0x95, 0x7c, 0x4d, 0x7e, 0xa1, 0x4d, 0x23,
+    0xee, 0xdf, 0x99, 0x98, 0x96, 0xf7, 0xa8, 0x9d, 0x4b, 0x16, 0x96, 0x2e, 0xf7, 0x38, 0x9d, 0x06,
+    0x71, 0x3c, 0x0a, 0xc6, 0x9f, 0xe5, 0x34, 0xe2, 0xa2, 0x72, 0x57, 0xb3, 0xad, 0x31, 0x67, 0xc9,
+    0x61, 0xa4, 0xc4, 0x80, 0xab, 0x97, 0x77, 0xa4, 0x81, 0x82, 0x10, 0x1d, 0xde, 0xc2, 0xcd, 0xbb,
+    0xba, 0xd6, 0xd2, 0xba, 0x05, 0x77, 0x28, 0xed, 0xb8, 0x93, 0x28, 0x93, 0xa5, 0xef, 0x09, 0x44,
+    0x5c, 0xa6, 0x4b, 0xac, 0xc0, 0x9c, 0x4e, 0x6b, 0x8c, 0xc7, 0xcb, 0xdd, 0x76, 0xa6, 0x9c, 0x2e,
+    0x15, 0x84, 0x8d, 0xfa, 0x8a, 0xb8, 0xb1, 0x95, 0x37, 0x19, 0xdf, 0x3c, 0x2d, 0xf6, 0x02, 0x2c,
+    0x1f, 0xe4, 0x24, 0xaa, 0xfa, 0xa0, 0xda, 0x68, 0x5d, 0xbc, 0x04, 0x56, 0x79, 0x8a, 0x3a, 0xb5,
+    0x61, 0x54, 0x9a, 0x95, 0xa2, 0xdb, 0x5b, 0x68, 0x57, 0x21, 0xe1, 0x9e, 0xb7, 0x2a, 0x7a, 0x4b,
+    0xc7, 0x73, 0x0b, 0xad, 0x5d, 0x78, 0x58, 0xf3, 0x19, 0xf0, 0x3d, 0xd8, 0x94, 0x90, 0x14, 0x8f,
+    0xe4, 0xc8, 0x4f, 0xf1, 0x48, 0x8f, 0xc1, 0xb6, 0xc1, 0x72, 0x19, 0x73, 0xb1, 0x29, 0x36, 0x71,
+    0x6f, 0xc5, 0x66, 0x12, 0x0d, 0x91, 0x06, 0xcf, 0xea, 0xad, 0x86, 0xed, 0xf2, 0x84, 0x50, 0xe7,
+    0x1d, 0x23, 0xe8, 0x82, 0x5e, 0x95, 0x95, 0xd0, 0xe6, 0x55, 0xaa, 0x74, 0xc8, 0x73, 0xa1, 0x62,
+    0x3b, 0x0a, 0x97, 0x30, 0xd7, 0x26, 0xc9, 0x78, 0x35, 0xc7, 0xab, 0xd6, 0x61, 0xba, 0xbd, 0x88,
+    0x43, 0xfc, 0xf9, 0x74, 0xfd, 0x72, 0xd2, 0xa8, 0x2f, 0x15, 0x50, 0xdd, 0x5c, 0x57, 0xb1, 0x26,
+    0xe3, 0x32, 0x21, 0x2d, 0x84, 0xf4, 0x8c, 0xe2, 0xd4, 0x79, 0xfd, 0xb1, 0x6d, 0x25, 0xb6, 0x08,
+    0x6f, 0x88, 0x1b, 0xe1, 0xf0, 0xad, 0x1c, 0x3d, 0x6b, 0x05, 0xa7, 0x2a, 0x55, 0xb5, 0x77, 0xf5,
+    0xa2, 0x4a, 0x78, 0x40, 0x0a, 0x17, 0x3c, 0x06, 0xa9, 0x74, 0x39, 0x6d, 0xc9, 0x6d, 0x7a, 0xd2,
+    0x0b, 0x0b, 0x50, 0xca, 0xba, 0x4f, 0xb8, 0x89, 0x55, 0xfb, 0x9c, 0x1a, 0x0f, 0x00, 0x9b, 0x12,
+    0xfc, 0x75, 0xe6, 0x36, 0xca, 0x23, 0xdf, 0x9b, 0x4e, 0xe0, 0xbc, 0xb5, 0xcc, 0x95, 0x95, 0xd7,
+    0x52, 0xc9, 0x5e, 0x1c, 0xca, 0xae, 0x0f, 0x96, 0x8d, 0x80, 0x02, 0x36, 0xfe, 0x13, 0xbe, 0x63,
+    0xa1, 0xc1, 0x15, 0x6c, 0xf1, 0x0e, 0x81, 0xe9, 0x80, 0x8e, 0x22, 0x5d, 0xf8, 0x39, 0x3d, 0x1e,
+    0xc3, 0x98, 0x40, 0xe2, 0xca, 0x02, 0x1f, 0x98, 0x3a, 0x4e, 0xda, 0x86, 0xd4, 0x39, 0x3a, 0x92,
+    0x44, 0x3a, 0x37, 0x08, 0x38, 0x1d, 0xca, 0xf5, 0x57, 0x27, 0x71, 0x9f, 0x35, 0x3c, 0x57, 0x11,
+    0x90, 0xe7, 0x9c, 0x69, 0xd2, 0x66, 0xdd, 0x4e, 0xf7, 0xd0, 0x6d, 0xae, 0xbf, 0x25, 0x9f, 0xee,
+    0xdf, 0xf8, 0xc9, 0xe3, 0x21, 0xb3, 0x78, 0xd2, 0x43, 0x3f, 0x3e, 0x95, 0xb4, 0xf7, 0x96, 0x58,
+    0x4d, 0x74, 0xd2, 0x75, 0x5f, 0x4b, 0xc6, 0xd7, 0xd2, 0x4f, 0xd3, 0x3d, 0x64, 0x76, 0x78, 0x45,
+    0xba, 0xe6, 0x3a, 0x0a, 0x83, 0x4a, 0x6f, 0x58, 0xb3, 0x5f, 0x3e, 0x0c, 0x70, 0xe1, 0x7a, 0x40,
+    0x9f, 0x8a, 0x77, 0xc4, 0x9a, 0xf6, 0x79, 0xa4, 0xa0, 0xc2, 0x6e, 0x52, 0x6d, 0xdb, 0x9d, 0xec,
+    0xb5, 0x73, 0x56, 0xfe, 0x70, 0x46, 0xcd, 0xf4, 0x82, 0x96, 0x16, 0x23, 0xb5, 0xd2, 0xf1, 0xd7,
+    0x45, 0xdc, 0x87, 0xb9, 0xb7, 0xdd, 0xd4, 0x6e, 0x46, 0x43, 0x4b, 0x5f, 0xb4, 0x62, 0x3f, 0x91,
+    0xe5, 0x9b, 0x03, 0x71, 0xfb, 0x37, 0x27, 0xa9, 0xee, 0xde, 0x2e, 0x29, 0x1d, 0x75, 0x44, 0x27,
+    0x9d, 0x77, 0x9c, 0xcb, 0x1f, 0x7d, 0x22, 0x43, 0x82, 0x34, 0x35, 0x39, 0x53, 0xe1, 0x53, 0x50,
+    0x88, 0xaf, 0x51, 0xb0, 0xdb, 0x4e, 0xca, 0x6a, 0x8e, 0x57, 0x75, 0xcd, 0x8e, 0x3a, 0x6c, 0xd5,
+    0x1c, 0x2f, 0x6b, 0xbe, 0x8b, 0xdc, 0x32, 0x7a, 0xec, 0xd3, 0xc5, 0x2c, 0xb9, 0xc2, 0xc7, 0x03,
+    0xd1, 0x44, 0x1a, 0xaf, 0xf5, 0x4d, 0x73, 0x68, 0x4c, 0x92, 0xcc, 0x2a, 0xc8, 0xde, 0xb0, 0x06,
+    0xa4, 0x98, 0x3d, 0x89, 0x47, 0x5d, 0x46, 0x47, 0x6f, 0x9a, 0x9d, 0x4f, 0xe6, 0x68, 0xdd, 0xbd,
+    0xf2, 0x34, 0x99, 0x8b, 0x17, 0x43, 0x48, 0x4b, 0x86, 0xb9, 0xcd, 0x4f, 0x6f, 0x6e, 0x49, 0xc0,
+    0xae, 0x6f, 0x06, 0xf8, 0xae, 0x70, 0x10, 0x62, 0xd7, 0x9a, 0x21, 0x6e, 0x48, 0x98, 0xf7, 0xb6,
+    0x88, 0xf2, 0x82, 0xea, 0x56, 0x4a, 0xc5, 0x64, 0xe2, 0xfc, 0x0f, 0xd7, 0x89, 0xc2, 0x72, 0x66,
+    0xc5, 0xe9, 0x7b, 0xd6, 0x33, 0x85, 0x93, 0x72, 0x35, 0x05, 0xf6, 0xcb, 0x2d, 0x30, 0xfd, 0xcc,
+    0xcb, 0x28, 0xcc, 0x9c, 0x81, 0xf7, 0x01, 0x19, 0x97, 0xb6, 0x77, 0x3c, 0xfc, 0xb1, 0x70, 0x64,
+    0xa9, 0x69, 0xbf, 0x0d, 0x9b, 0xdd, 0xbf, 0xb1, 0xfa, 0xc5, 0x88, 0x20, 0xdd, 0x88, 0x29, 0x7b,
+    0x5f, 0xbc, 0x3a, 0x72, 0xe1, 0x7b, 0x06, 0xc6, 0x39, 0xb2, 0x02, 0xd1, 0x6b, 0xb0, 0x0a, 0x10,
+    0x7d, 0xff, 0xc6, 0x24, 0x7b, 0xb3, 0x3b, 0x37, 0xd0, 0x83, 0x0c, 0x14, 0x9a, 0xbf, 0xf5, 0x71,
+    0x84, 0xe2, 0x45, 0xe9, 0xd5, 0x48, 0xcf, 0xd9, 0x23, 0x86, 0x0f, 0x22, 0x0c, 0x0b, 0x66, 0x41,
+    0x5b, 0xb0, 0x38, 0x21, 0x1d, 0xe7, 0xe7, 0xac, 0xeb, 0xbf, 0x5c, 0xc4, 0x2e, 0xe6, 0xf2, 0xa4,
+    0x8f, 0x25, 0x7d, 0x25, 0x24, 0x33, 0x0e, 0xcd, 0x06, 0xf1, 0x65, 0x49, 0x0c, 0x79, 0xe1, 0x48,
+    0xca, 0xc2, 0x22, 0x17, 0x2e, 0x60, 0x30, 0x67, 0x49, 0xb3, 0x86, 0x4f, 0x81, 0x49, 0x9b, 0x12,
+    0xea, 0x70, 0x13, 0xd8, 0x62, 0x45, 0xe6, 0xfb, 0xc5, 0x77, 0xe7, 0xfd, 0xa6, 0x1d, 0x14, 0x29,
+    0x05, 0xbe, 0x92, 0xaf, 0x26, 0xa6, 0xaf, 0x16, 0xb1, 0x1b, 0x53, 0x63, 0x2d, 0xa9, 0x8a, 0xcf,
+    0xb3, 0xde, 0xb7, 0xa9, 0x4c, 0x75, 0x14, 0x28, 0x0e, 0xba, 0x7d, 0x1b, 0xf6, 0x8f, 0xbf, 0xff,
+    0x27, 0xf0, 0xba, 0x24, 0x82, 0x9f, 0xdc, 0x62, 0xc7, 0x8a, 0x88, 0x09, 0x73, 0xc6, 0xd1, 0x35,
+    0x49, 0x40, 0x2f, 0x3d, 0x70, 0x41, 0xa3, 0x21, 0xe3, 0x8c, 0xd4, 0x9c, 0x51, 0xbc, 0x4c, 0x27,
+    0xf2, 0xd9, 0x27, 0xa1, 0x32, 0x51, 0xdd, 0xd8, 0xbf, 0x12, 0xeb, 0x03, 0x40, 0x8b, 0x22, 0x98,
+    0xe7, 0x6c, 0x9a, 0x54, 0xad, 0x91, 0x59, 0xc7, 0xc5, 0xda, 0x02, 0x86, 0xe9, 0xce, 0xb9, 0x7a,
+    0xc3, 0x92, 0x69, 0xa1, 0x26, 0xe3, 0xbb, 0x78, 0x1a, 0xcd, 0xa2, 0xc5, 0x38, 0x5e, 0x4d, 0x42,
+    0xa5, 0x2c, 0x7c, 0x32, 0x1e, 0x61, 0xd0, 0x7c, 0x5a, 0xa0, 0x8f, 0x14, 0xcd, 0x81, 0xac, 0x4b,
+    0x03, 0x92, 0x30, 0xd8, 0xbe, 0x26, 0x09, 0x5c, 0xbb, 0xca, 0x0d, 0xf5, 0x36, 0xc9, 0xaf, 0x73,
+    0xfb, 0x5f, 0x6c, 0x6e, 0x7b, 0xd5, 0xa5, 0x9f, 0x6c, 0x72, 0x7b, 0x6b, 0xbb, 0xfb, 0xec, 0xae,
+    0xcb, 0xd9, 0x2d, 0xae, 0x64, 0xa8, 0x9a, 0xdf, 0xbd, 0xbe, 0x88, 0x27, 0xaf, 0xff, 0x54, 0xf3,
+    0x5a, 0xd5, 0xf0, 0xcb, 0x99, 0xb3, 0xc6, 0x74, 0x84, 0x1c, 0x63, 0x1f, 0xae, 0xf9, 0xcc, 0xde,
+    0x42, 0x36, 0x8b, 0x9b, 0xca, 0x81, 0x9e, 0xa4, 0x34, 0x3a, 0x62, 0xea, 0xb8, 0xee, 0x76, 0xde,
+    0x68, 0x6d, 0x79, 0x24, 0x63, 0xdd, 0x7c, 0x70, 0x5b, 0x04, 0xde, 0xc3, 0x19, 0x79, 0xe1, 0x89,
+    0x26, 0x89, 0x2e, 0x89, 0x98, 0xc8, 0x8e, 0xbd, 0x85, 0x2a, 0xe6, 0xa8, 0xd2, 0x2a, 0x0a, 0x15,
+    0x55, 0x2a, 0xc1, 0x91, 0x34, 0x0a, 0xc0, 0x56, 0x9c, 0x1f, 0xf5, 0x98, 0x58, 0x5b, 0xde, 0xaf,
+    0xaa, 0x2d, 0x83, 0xce, 0x5e, 0x70, 0x88, 0x82, 0x8e, 0x59, 0xd3, 0x03, 0xd8, 0xaa, 0x35, 0x05,
+    0x37, 0x6c, 0x6a, 0x01, 0x7a, 0x1b, 0x31, 0x23, 0xb4, 0x73, 0x9a, 0x86, 0xd9, 0xcc, 0x34, 0x9f,
+    0x35, 0xa0, 0x8f, 0xc7, 0xa1, 0x7c, 0x0f, 0x5b, 0x3a, 0xd9, 0x14, 0xad, 0x93, 0x6e, 0x58, 0xa0,
+    0x2d, 0xf4, 0x97, 0x96, 0x41, 0x8e, 0xce, 0x9b, 0x94, 0xbf, 0x0e, 0x55, 0x60, 0x9c, 0x88, 0x79,
+    0x60, 0x11, 0x0d, 0x5e, 0xb4, 0x71, 0x53, 0x0b, 0xae, 0x82, 0x28, 0x2f, 0x01, 0x61, 0xe3, 0x20,
+    0x1f, 0xcf, 0x58, 0x23, 0x4c, 0x95, 0xb3, 0x46, 0x12, 0x87, 0x9d, 0x90, 0x3c, 0x2a, 0x30, 0xd1,
+    0x3c, 0x0a, 0x5c, 0x24, 0x57, 0x96, 0x53, 0xcf, 0xd0, 0x20, 0x06, 0xf9, 0x00, 0xf3, 0xdb, 0x34,
+    0xed, 0x6d, 0x63, 0x22, 0x75, 0x10, 0x3b, 0x71, 0x48, 0xa0, 0x54, 0xe9, 0x83, 0xfe, 0x3a, 0xb3,
+    0x3b, 0xa0, 0x0c, 0x09, 0x9e, 0x76, 0x5c, 0x69, 0x9f, 0x0a, 0x6a, 0xc6, 0x1b, 0xe0, 0x98, 0x28,
+    0xa3, 0x90, 0x52, 0x3e, 0x36, 0x0d, 0x3b, 0xda, 0x58, 0x8c, 0xa7, 0x65, 0x20, 0x96, 0x83, 0x9c,
+    0x7d, 0x28, 0xae, 0xad, 0x74, 0x40, 0xe4, 0x01, 0xed, 0xa0, 0x46, 0xad, 0xbc, 0x34, 0x82, 0x34,
+    0x98, 0x67, 0x42, 0x46, 0xff, 0xf8, 0xf6, 0xd5, 0x05, 0x88, 0xd8, 0xf1, 0xec, 0x0d, 0xa5, 0xea,
+    0x9b, 0x36, 0x16, 0xb8, 0xa7, 0xc1, 0x53, 0x50, 0xbf, 0xfb, 0x15, 0x77, 0xea, 0xd1, 0xbe, 0x6c,
+    0x79, 0xf0, 0x19, 0x78, 0xd2, 0x76, 0x79, 0xbb, 0x85, 0xd5, 0xc1, 0xb0, 0x1a, 0x68, 0xf7, 0x58,
+    0xa4, 0x00, 0xa5, 0xbd, 0xc8, 0xdb, 0xe9, 0x51, 0x8b, 0xd7, 0x99, 0xf1, 0xce, 0x84, 0x79, 0x7f,
+    0x08, 0x6f, 0x35, 0xe2, 0x68, 0xd4, 0x69, 0x86, 0xd6, 0x5b, 0xd2, 0x67, 0xd5, 0xb8, 0xe0, 0xc7,
+    0x40, 0xc3, 0x1d, 0x9d, 0x9b, 0x4d, 0xa7, 0x2c, 0xcc, 0x66, 0x6f, 0x49, 0xb3, 0xa8, 0xf7, 0x59,
+    0x8c, 0xa6, 0xc4, 0x48, 0x0b, 0xa1, 0x7d, 0x22, 0x5f, 0x30, 0x84, 0x88, 0x81, 0xe3, 0x86, 0xa4,
+    0x2d, 0x94, 0x0b, 0xdf, 0x31, 0x93, 0x16, 0x3e, 0x78, 0x6d, 0xc5, 0x40, 0x4d, 0xdd, 0x9a, 0xa6,
+    0x35, 0x49, 0x69, 0x40, 0xcc, 0x13, 0x47, 0x0f, 0x4f, 0xb9, 0x34, 0xe8, 0x43, 0x49, 0x4d, 0xc8,
+    0xce, 0xc8, 0x14, 0x21, 0x86, 0x2c, 0x14, 0x9c, 0x44, 0x11, 0x0d, 0xa4, 0x27, 0x61, 0xd0, 0xf7,
+    0x22, 0x81, 0xd5, 0x03, 0x64, 0x20, 0xac, 0x90, 0xe4, 0x35, 0x19, 0x2c, 0x58, 0xc0, 0xc8, 0x8f,
+    0x8b, 0xee, 0x79, 0x5d, 0x46, 0xd7, 0x61, 0x3c, 0xc4, 0xc5, 0x1a, 0x8b, 0x0b, 0x26, 0x04, 0x1d,
+    0x01, 0xad, 0x20, 0xe4, 0x83, 0x39, 0x0a, 0xd7, 0xc0, 0x84, 0x58, 0x30, 0xef, 0xb0, 0xa7, 0x41,
+    0xca, 0x31, 0x67, 0xc0, 0x5e, 0xa0, 0x66, 0x5e, 0xcd, 0x40, 0x54, 0xa8, 0x48, 0x11, 0x39, 0x2f,
+    0xc8, 0x4e, 0x2f, 0x43, 0xd6, 0x77, 0x32, 0xe7, 0x0f, 0x75, 0x4f, 0x8a, 0x82, 0x20, 0x4b, 0x8c,
+    0x4f, 0xf1, 0xb6, 0xf3, 0x19, 0x17, 0x92, 0x66, 0x27, 0x72, 0x8f, 0x34, 0xa7, 0x03, 0xcd, 0x42,
+    0x32, 0xf8, 0x01, 0x5a, 0xf7, 0x26, 0x00, 0x3a, 0x27, 0xc2, 0xad, 0x28, 0x23, 0x9f, 0xd0, 0x00,
+    0x16, 0x9b, 0x80, 0x4b, 0x71, 0xd0, 0x23, 0x94, 0xab, 0x5b, 0x86, 0xce, 0x49, 0xe8, 0x22, 0x9a,
+    0x7d, 0x8e, 0x96, 0x6c, 0x8a, 0x87, 0x7e, 0xd2, 0x82, 0x86, 0x2b, 0x45, 0xb2, 0x30, 0xdc, 0x4f,
+    0x3b, 0x16, 0x3d, 0xc2, 0xdb, 0xac, 0xc5, 0xea, 0xa3, 0x68, 0xa1, 0xfd, 0xbb, 0x57, 0x29, 0xa9,
+    0x59, 0xfb, 0xc1, 0x32, 0xda, 0x27, 0x12, 0xdb, 0xb0, 0xe8, 0x9e, 0xdf, 0xbf, 0xe1, 0x45, 0x37,
+    0x9f, 0x86, 0x0e, 0x2b, 0x19, 0x06, 0xd7, 0x6d, 0x2b, 0x5c, 0xfd, 0x55, 0x12, 0x4c, 0x90, 0x2a,
+    0xcb, 0x88, 0xf9, 0x8f, 0xbf, 0xff, 0x57, 0xdd, 0x7c, 0x1e, 0x47, 0xb8, 0x06, 0x9e, 0x32, 0xbe,
+    0x14, 0x4c, 0x43, 0x90, 0xf9, 0x0d, 0xa0, 0x4a, 0x4a, 0x70, 0x09, 0xd1, 0x49, 0x3e, 0x7b, 0x3d,
+    0xeb, 0xbe, 0x03, 0xc5, 0x0c, 0xfa, 0x0e, 0x16, 0x62, 0xe8, 0x8c, 0x89, 0x5d, 0x97, 0xe9, 0x5b,
+    0x37, 0xe1, 0x57, 0x58, 0xf8, 0x1c, 0x02, 0x79, 0xcd, 0xaa, 0xa2, 0x00, 0x0f, 0x8e, 0x9e, 0x92,
+    0x03, 0xa0, 0x71, 0x3f, 0x53, 0x76, 0x15, 0x01, 0x65, 0xb4, 0x83, 0xa9, 0x3c, 0x4a, 0xa5, 0x63,
+    0x29, 0xa1, 0x88, 0x88, 0x22, 0xfc, 0xc5, 0xa0, 0xb2, 0x45, 0xa3, 0x4b, 0xa7, 0x66, 0x28, 0xc5,
+    0x92, 0x55, 0xde, 0x90, 0xeb, 0x83, 0x6f, 0xe9, 0xa6, 0x73, 0xdd, 0x0e, 0xad, 0x8a, 0x0d, 0xbe,
+    0x2a, 0x02, 0x68, 0x71, 0x59, 0xa4, 0x5b, 0x1f, 0x48, 0x72, 0xea, 0x35, 0x6b, 0xcb, 0x31, 0x1a,
+    0x86, 0x2c, 0x35, 0xa4, 0xb5, 0xca, 0x5e, 0x88, 0xe9, 0x28, 0xcc, 0x5c, 0xcb, 0x86, 0xd6, 0xd2,
+    0xed, 0xe6, 0x99, 0xab, 0x76, 0xe2, 0x5f, 0xb7, 0x93, 0xb4, 0xf9, 0x15, 0x5c, 0x45, 0x08, 0x3a,
+    0x73, 0x23, 0xa2, 0xfe, 0x8d, 0x65, 0x23, 0x5f, 0x2d, 0x94, 0x95, 0xbc, 0x53, 0x57, 0x3a, 0xf2,
+    0x37, 0x3a, 0xc0, 0x29, 0x1c, 0x0a, 0xee, 0x76, 0x26, 0xc8, 0x3e, 0x7c, 0x24, 0x71, 0x08, 0x9b,
+    0xa0, 0x20, 0x8e, 0xd7, 0xb2, 0x95, 0x85, 0x8e, 0x96, 0xae, 0xd1, 0x85, 0x10, 0x16, 0xe4, 0x0e,
+    0x58, 0x19, 0xe6, 0xcb, 0x86, 0xe5, 0xec, 0xbc, 0x25, 0x8e, 0xe5, 0x42, 0xb9, 0x69, 0xdf, 0x29,
+    0xa6, 0xa8, 0x24, 0x9a, 0x45, 0xae, 0x76, 0x5a, 0xdb, 0x98, 0x58, 0x41, 0xe9, 0x52, 0xe0, 0xf1,
+    0x84, 0xd2, 0xc0, 0x12, 0xdc, 0xf7, 0xc9, 0x50, 0x18, 0xeb, 0xfe, 0x2c, 0x37, 0x58, 0x06, 0x10,
+    0x34, 0x26, 0xc5, 0x8b, 0xce, 0x9c, 0x70, 0x18, 0x13, 0x4a, 0xc4, 0xc2, 0xb8, 0xa1, 0x2f, 0x26,
+    0x88, 0x8c, 0x7b, 0x29, 0x86, 0xb9, 0x58, 0xd5, 0xa9, 0x18, 0x17, 0x7d, 0xae, 0x2f, 0x5d, 0x5f,
+    0x4d, 0x38, 0xd1, 0xd1, 0xa6, 0x6f, 0x38, 0x6c, 0x5c, 0xb1, 0x85, 0x9b, 0xb6, 0x0c, 0x81, 0x69,
+    0x97, 0x87, 0xc0, 0xc0, 0x4f, 0x81, 0xd7, 0x89, 0x86, 0x11, 0x21, 0x0c, 0x3f, 0xa4, 0xcf, 0x83,
+    0x6c, 0x26, 0xc3, 0x9f, 0xc9, 0x0a, 0x86, 0x14, 0xf4, 0x76, 0x08, 0x26, 0xdb, 0xd9, 0x3f, 0x5f,
+    0x87, 0x4b, 0x10, 0x7a, 0x3c, 0x20, 0x14, 0xcc, 0xe0, 0xb0, 0xe2, 0x0f, 0xe4, 0x8f, 0xc7, 0xfb,
+    0xef, 0x9b, 0x87, 0xb4, 0x99, 0x2b, 0x43, 0x82, 0x66, 0x83, 0x89, 0x8c, 0x3b, 0xa3, 0x4f, 0x9b,
+    0x05, 0x9b, 0xd2, 0xc3, 0xd7, 0x52, 0xb0, 0x50, 0x6b, 0xbf, 0x84, 0xba, 0x45, 0x79, 0x13, 0xbd,
+    0x60, 0x4c, 0x99, 0x63, 0xf8, 0x1d, 0x88, 0x24, 0xd5, 0x09, 0xfd, 0x66, 0x27, 0x0d, 0x97, 0x71,
+    0x30, 0x0e, 0x1b, 0xfb, 0xdd, 0x07, 0xf7, 0xf7, 0x81, 0x75, 0xeb, 0x46, 0xd2, 0xff, 0xed, 0x88,
+    0x24, 0xf5, 0x10, 0x27, 0xcc, 0xcf, 0xbf, 0x26, 0x8b, 0x90, 0x77, 0xce, 0xcb, 0xc5, 0x72, 0x95,
+    0x9b, 0x91, 0x36, 0x39, 0x29, 0x49, 0x32, 0x7a, 0x76, 0xa2, 0x76, 0xba, 0x66, 0x5f, 0x4a, 0xa8,
+    0x77, 0x16, 0x2a, 0xca, 0x6b, 0x2a, 0xf3, 0x84, 0x83, 0x07, 0x7d, 0x35, 0xea, 0xa4, 0x64, 0x7b,
+    0x08, 0xe8, 0x10, 0xb1, 0xa0, 0x07, 0x4d, 0x28, 0x88, 0xb9, 0x50, 0x7a, 0xe8, 0x2d, 0x44, 0x71,
+    0x9c, 0xa8, 0x11, 0x3c, 0x17, 0xf0, 0x7c, 0xd3, 0x3b, 0x42, 0x95, 0x0b, 0xaf, 0x4e, 0x22, 0x5b,
+    0x88, 0x8d, 0x68, 0x23, 0x66, 0x18, 0x01, 0xfe, 0xf8, 0xee, 0xd9, 0x27, 0x3f, 0x66, 0x15, 0x03,
+    0x55, 0x24, 0xc4, 0x23, 0xf1, 0x9e, 0x29, 0x3f, 0x63, 0xb9, 0x32, 0xfe, 0x44, 0xf1, 0x93, 0x08,
+    0x5e, 0x16, 0x21, 0xf6, 0x36, 0x0c, 0x26, 0xeb, 0x22, 0x14, 0xa8, 0xfc, 0xd5, 0x01, 0x8b, 0x18,
+    0x8b, 0x98, 0x79, 0x63, 0x9c, 0x0c, 0x1d, 0xde, 0x0c, 0x77, 0xf2, 0xc8, 0x17, 0x0f, 0xd7, 0xff,
+    0xd6, 0x84, 0xe4, 0x38, 0xa5, 0x35, 0x4e, 0xd5, 0x20, 0x8d, 0xc5, 0x90, 0x40, 0xf6, 0x62, 0xf8,
+    0xab, 0x8f, 0x6e, 0x39, 0x76, 0x59, 0xc6, 0x0c, 0x03, 0xe2, 0x87, 0xbe, 0xe1, 0x98, 0xdb, 0x98,
+    0xc3, 0xb1, 0x34, 0x89, 0x99, 0x30, 0x4e, 0xa3, 0xa5, 0xf4, 0x62, 0xf2, 0xa7, 0x61, 0x93, 0xdb,
+    0x0a, 0xc5, 0xb4, 0xc8, 0x53, 0x3f, 0x8d, 0xf2, 0x0e, 0x33, 0xfc, 0xb8, 0x44, 0x86, 0x92, 0x52,
+    0xf6, 0x9b, 0x30, 0x82, 0x15, 0x18, 0x68, 0x8f, 0x7a, 0xdb, 0x7d, 0xfa, 0xf8, 0xc2, 0x1e, 0x14,
+    0x6b, 0xf8, 0x5c, 0x9f, 0x0c, 0x03, 0xc2, 0x2a, 0x2b, 0x22, 0x09, 0x0b, 0x8b, 0x92, 0xb9, 0xa9,
+    0xb3, 0x0a, 0xfc, 0x56, 0x14, 0x10, 0xb1, 0x7c, 0x9e, 0x95, 0xaa, 0xa2, 0xa8, 0x74, 0x44, 0xf7,
+    0x72, 0x96, 0x03, 0x7b, 0xd4, 0x35, 0xec, 0x06, 0xb9, 0x0c, 0xd6, 0x30, 0x5d, 0x43, 0xc4, 0xd6,
+    0x26, 0x17, 0x2e, 0xe4, 0xe2, 0x69, 0xe2, 0xcd, 0xe4, 0x93, 0x92, 0x7f, 0x22, 0x82, 0x90, 0xfb,
+    0x52, 0x70, 0x50, 0xed, 0x54, 0x5d, 0x2c, 0xce, 0x57, 0xc0, 0x99, 0x2e, 0xaf, 0x02, 0xfb, 0x76,
+    0xc5, 0x20, 0xd9, 0x6a, 0xae, 0x71, 0x58, 0x85, 0x94, 0x63, 0x87, 0x6c, 0xb6, 0x17, 0x8b, 0x64,
+    0xc1, 0xec, 0x93, 0xb9, 0x18, 0x70, 0x98, 0x3f, 0xc3, 0xfe, 0xad, 0x51, 0x67, 0xf5, 0xa6, 0xe7,
+    0xb2, 0xb4, 0x67, 0x3a, 0xf0, 0xab, 0x61, 0x1c, 0x71, 0xe8, 0x54, 0xa1, 0x0a, 0x56, 0xed, 0x32,
+    0x0d, 0x68, 0x7d, 0x57, 0x6e, 0x01, 0x83, 0x63, 0x79, 0xc2, 0x53, 0x84, 0x28, 0x03, 0xc1, 0xbe,
+    0x96, 0x1a, 0xa9, 0xcf, 0xb8, 0xb0, 0x3d, 0x42, 0xce, 0x0a, 0x86, 0x23, 0x8b, 0xca, 0x2d, 0xc3,
+    0xe1, 0x34, 0x5f, 0x61, 0x40, 0xc8, 0x0a, 0xbd, 0xcd, 0xc5, 0x15, 0x9d, 0xd5, 0x41, 0x71, 0x0f,
+    0x8c, 0x4a, 0x65, 0xa0, 0xb9, 0x6e, 0x91, 0xab, 0xec, 0x5a, 0xb8, 0x6d, 0x83, 0x4a, 0xa1, 0x1a,
+    0xe5, 0x90, 0x41, 0x97, 0x71, 0x29, 0x94, 0xe5, 0x70, 0x34, 0xc9, 0x0b, 0x1d, 0xee, 0x68, 0xfd,
+    0x02, 0x91, 0x88, 0xff, 0x7c, 0x03, 0x7c, 0x03, 0x2b, 0x62, 0xf8, 0x25, 0xc4, 0x60, 0x33, 0x1e,
+    0x04, 0xba, 0x48, 0x78, 0x38, 0x67, 0x8b, 0x65, 0x09, 0x0f, 0xe9, 0x8c, 0xc3, 0xe0, 0x0b, 0x0f,
+    0x03, 0xa5, 0x57, 0x64, 0x25, 0x2d, 0x41, 0x0c, 0x0b, 0x62, 0xc7, 0x75, 0xc8, 0x45, 0xa2, 0x56,
+    0xd9, 0xd3, 0x80, 0xbb, 0xb1, 0x95, 0xdd, 0xb3, 0x77, 0x23, 0xa0, 0x9f, 0x51, 0xe0, 0xe8, 0x29,
+    0xb9, 0x4d, 0xb2, 0x0d, 0xfc, 0x10, 0xe0, 0xfa, 0xf8, 0x6b, 0x1a, 0xbd, 0x5c, 0x4c, 0x93, 0x2a,
+    0xc6, 0x93, 0x30, 0xc8, 0x75, 0xf2, 0xb7, 0xdb, 0x6a, 0xf4, 0x91, 0xcc, 0xb2, 0x88, 0xfc, 0x45,
+    0xe9, 0x23, 0x5a, 0xc2, 0x02, 0x41, 0x13, 0x5f, 0xe4, 0x6c, 0xd8, 0xff, 0x62, 0xe2, 0x33, 0x5a,
+    0x6e, 0x3e, 0x49, 0x75, 0x11, 0x87, 0xc6, 0x20, 0xb5, 0x69, 0xbf, 0xbf, 0xea, 0xdc, 0xf3, 0x4a,
+    0xa5, 0xcd, 0x21, 0xb0, 0x5c, 0x40, 0x72, 0xf5, 0x22, 0x13, 0x3b, 0xad, 0x89, 0xc8, 0x55, 0xb7,
+    0x04, 0xb7, 0x34, 0x66, 0x04, 0x55, 0x97, 0xce, 0x9d, 0x46, 0x7e, 0x07, 0x72, 0xe6, 0x0d, 0x52,
+    0x66, 0xeb, 0xc3, 0x52, 0x4b, 0xb1, 0x41, 0xa1, 0x16, 0xf5, 0xde, 0xeb, 0x61, 0xf9, 0x65, 0xb2,
+    0xea, 0xde, 0x56, 0xf3, 0xda, 0x35, 0x23, 0x41, 0x05, 0x9b, 0x38, 0xbc, 0x47, 0x37, 0x86, 0x9b,
+    0xd5, 0x60, 0xb0, 0x86, 0x9e, 0x57, 0x03, 0x9b, 0x84, 0x7b, 0x32, 0x70, 0xf7, 0x9c, 0x48, 0x96,
+    0xfe, 0xdf, 0x8a, 0x7f, 0x07, 0x66, 0x0f, 0x71, 0x4d, 0x10, 0x40, 0x8d, 0x34, 0xe3, 0xf9, 0x6d,
+    0x8f, 0xd8, 0x42, 0x96, 0x2e, 0xe5, 0x91, 0x6c, 0x9d, 0xe5, 0xe1, 0xfc, 0x75, 0x32, 0x01, 0xd9,
+    0xe4, 0x7a, 0xb5, 0xa9, 0x2c, 0x5a, 0xaf, 0xb3, 0x0f, 0x9c, 0x25, 0x54, 0xea, 0x47, 0x71, 0x03,
+    0xa6, 0x99, 0x46, 0xdb, 0x74, 0x64, 0x8f, 0xd2, 0x0a, 0xa7, 0xc1, 0xc2, 0x5b, 0x9b, 0x48, 0x37,
+    0xab, 0x12, 0x49, 0xba, 0x1e, 0x91, 0xb0, 0x53, 0x25, 0x14, 0xd8, 0xe6, 0xab, 0x85, 0x32, 0x9c,
+    0x6a, 0x28, 0xcd, 0xaa, 0x87, 0x52, 0xb6, 0x57, 0xa4, 0x83, 0xe4, 0xdc, 0xaa, 0x04, 0x87, 0xaa,
+    0x7c, 0x54, 0xbb, 0xde, 0xae, 0xe8, 0x98, 0x87, 0x54, 0xaf, 0x97, 0xfc, 0xaa, 0x97, 0x1d, 0x30,
+    0x0b, 0xb5, 0xb8, 0xd8, 0x96, 0x12, 0xf5, 0xd9, 0xa9, 0x58, 0x24, 0x37, 0x77, 0xaa, 0x0b, 0xd4,
+    0xf8, 0xaf, 0xac, 0x4e, 0x63, 0xd8, 0xad, 0xc6, 0x67, 0x09, 0xec, 0x5b, 0x92, 0xab, 0x45, 0xa1,
+    0x3e, 0x07, 0xaf, 0x84, 0xc3, 0x7e, 0xe4, 0x8e, 0xe7, 0xb7, 0xec, 0x46, 0x89, 0xe0, 0x6d, 0x38,
+    0x0f, 0x22, 0x1a, 0x86, 0x3b, 0xb6, 0xb0, 0x80, 0x48, 0x1a, 0x01, 0xd1, 0x02, 0xb8, 0x8a, 0x21,
+    0x81, 0x64, 0x80, 0xb1, 0xae, 0xfb, 0x73, 0xbc, 0xa2, 0x58, 0x41, 0x62, 0x3b, 0x5f, 0xf0, 0x18,
+    0x05, 0x6a, 0xe8, 0x73, 0xe1, 0xd8, 0xaf, 0x36, 0x29, 0x02, 0x34, 0xfc, 0x1e, 0xa8, 0x71, 0x2b,
+    0x94, 0x26, 0x57, 0x41, 0xa0, 0x2b, 0xeb, 0x1a, 0x66, 0x5d, 0xe1, 0xcb, 0xcb, 0x45, 0x82, 0xf1,
+    0x6a, 0x36, 0xb0, 0x11, 0x33, 0x2c, 0x32, 0xbc, 0x27, 0xc8, 0x6e, 0x1d, 0x68, 0x68, 0x28, 0xd4,
+    0xab, 0x6e, 0x04, 0x50, 0x9e, 0xc8, 0x85, 0xea, 0xf9, 0x90, 0xa2, 0xbc, 0x35, 0xeb, 0x13, 0xba,
+    0x5c, 0x59, 0x53, 0x8b, 0x9e, 0xc5, 0x85, 0xe3, 0x53, 0x03, 0x1b, 0x6c, 0xd5, 0xd4, 0x97, 0x79,
+    0x7e, 0xbb, 0x23, 0xf6, 0xfa, 0xcb, 0x85, 0xb8, 0x02, 0x88, 0x6f, 0x63, 0xc5, 0xaa, 0x6e, 0xb5,
+    0x82, 0x0e, 0x12, 0x09, 0x0a, 0x0d, 0xc4, 0xf2, 0x96, 0x51, 0x67, 0x64, 0x9b, 0x55, 0x13, 0x23,
+    0x0f, 0xd2, 0xcb, 0xb0, 0x30, 0xf9, 0x1c, 0xfb, 0x10, 0x21, 0xe4, 0x90, 0x55, 0xb8, 0x66, 0x28,
+    0x96, 0x81, 0x67, 0xa3, 0x6c, 0x17, 0x7c, 0x1a, 0x7a, 0xb7, 0x89, 0x8b, 0xb1, 0x8e, 0xaf, 0xa2,
+    0x79, 0xb4, 0x8d, 0x58, 0x77, 0x22, 0xab, 0x72, 0x14, 0x31, 0xb1, 0x43, 0x45, 0xaf, 0xa3, 0xc5,
+    0x13, 0x1e, 0x84, 0x7a, 0xcb, 0x9a, 0x74, 0xc1, 0x5d, 0xab, 0x92, 0x53, 0x1b, 0x69, 0xbc, 0x65,
+    0x65, 0x66, 0xd1, 0xdb, 0x56, 0x27, 0xac, 0x8f, 0x77, 0xac, 0x51, 0x94, 0x6e, 0xd5, 0xfa, 0xd5,
+    0xf5, 0x06, 0x3b, 0x75, 0x22, 0x55, 0x22, 0x40, 0xab, 0x5b, 0x11, 0xc5, 0xbb, 0xa0, 0x42, 0xb8,
+    0x2a, 0x3c, 0xdc, 0x6b, 0x67, 0x17, 0x4c, 0xa1, 0x1b, 0x32, 0xb3, 0x22, 0x63, 0xc1, 0x0e, 0x3b,
+    0x30, 0x0e, 0x28, 0x37, 0x5f, 0x76, 0x31, 0x90, 0x38, 0x8e, 0x1a, 0x6b, 0xe5, 0x7b, 0xc3, 0x35,
+    0x6c, 0x2b, 0x05, 0x11, 0xb7, 0x32, 0x93, 0xdc, 0xcb, 0xce, 0x44, 0x05, 0xc9, 0x62, 0x1a, 0x5d,
+    0xa2, 0x31, 0x4c, 0x45, 0x34, 0x6d, 0x11, 0x03, 0x64, 0x4e, 0x83, 0xae, 0xf9, 0xe2, 0xd1, 0xa6,
+    0xc5, 0xf4, 0xb7, 0xae, 0x45, 0xdc, 0x41, 0x12, 0x54, 0xa1, 0x34, 0x24, 0x80, 0x7b, 0xdb, 0xa2,
+    0xd8, 0xfe, 0x71, 0xc6, 0xa3, 0xd9, 0xeb, 0xd5, 0xf0, 0x8b, 0x93, 0xfc, 0x96, 0xb2, 0xc4, 0x4f,
+    0x9e, 0x5e, 0x6e, 0x6a, 0x3e, 0x2a, 0x80, 0xed, 0x6b, 0xe7, 0x5e, 0xfa, 0x8c, 0x66, 0xd4, 0xcc,
+    0x9d, 0x81, 0x4f, 0x46, 0x54, 0x37, 0x48, 0xc3, 0xdd, 0x56, 0x68, 0xdd, 0xa2, 0x49, 0x0e, 0x31,
+    0x6e, 0xbb, 0x9c, 0xec, 0xed, 0x8d, 0x33, 0x65, 0x52, 0x75, 0xf3, 0x4c, 0xc8, 0xdb, 0x8b, 0xca,
+    0x5b, 0x34, 0xb1, 0x40, 0x92, 0xdb, 0xc8, 0x02, 0xc0, 0xee, 0xcd, 0x14, 0x82, 0x70, 0xb7, 0x96,
+    0x0a, 0xe0, 0x3b, 0x09, 0xea, 0x3b, 0xb4, 0xd7, 0xa4, 0xad, 0xac, 0xc9, 0x26, 0x8c, 0x71, 0x40,
+    0x21, 0x5a, 0xbd, 0x6d, 0x47, 0xe5, 0x12, 0x65, 0xee, 0x98, 0x86, 0xbb, 0x6c, 0x00, 0xbd, 0x08,
+    0x74, 0x76, 0x15, 0x0e, 0xa5, 0xdb, 0x48, 0x1c, 0x90, 0x40, 0x8e, 0x0e, 0xfa, 0xaa, 0x75, 0x57,
+    0x09, 0x1a, 0x6e, 0x3f, 0x4e, 0xb1, 0x33, 0x7d, 0xc3, 0x6a, 0x43, 0x68, 0x0b, 0xed, 0x37, 0x38,
+    0x87, 0x31, 0x2c, 0x70, 0xb2, 0xe6, 0x32, 0x6f, 0x5e, 0x0f, 0x9d, 0x4d, 0xc3, 0x36, 0x25, 0x8b,
+    0x17, 0x29, 0xf0, 0x15, 0x54, 0xaf, 0xd6, 0xd8, 0x99, 0x4f, 0x56, 0x79, 0xf2, 0x64, 0xb9, 0x8c,
+    0x23, 0x6e, 0xf6, 0x12, 0x96, 0xde, 0x59, 0xb2, 0x8a, 0x27, 0x3f, 0x66, 0xa1, 0x3a, 0xc2, 0x39,
+    0xad, 0xdd, 0xdb, 0x85, 0x3a, 0xdc, 0xd8, 0xaa, 0x4b, 0x1e, 0xbd, 0x00, 0x27, 0x18, 0x27, 0x28,
+    0x1e, 0x87, 0x29, 0x56, 0x83, 0xc6, 0xa2, 0x8a, 0x33, 0x2a, 0xa7, 0xe1, 0xde, 0x73, 0xa0, 0xd2,
+    0xe6, 0x09, 0xa3, 0x97, 0xec, 0x07, 0x1b, 0x17, 0x37, 0x7e, 0x7c, 0xf3, 0xea, 0x9d, 0x73, 0x2b,
+    0xa3, 0xbc, 0xf1, 0xb6, 0xa8, 0xd0, 0xf4, 0x33, 0x67, 0xaf, 0xc6, 0xdf, 0x64, 0xb9, 0xd9, 0x18,
+    0xf3, 0xe3, 0x2f, 0xab, 0x30, 0x5d, 0x5f, 0x90, 0xc7, 0x54, 0x92, 0x3e, 0x89, 0xe3, 0x46, 0x9d,
+    0x2c, 0x0d, 0x6d, 0x59, 0xa2, 0xbd, 0x4c, 0x93, 0x69, 0x14, 0x87, 0x1f, 0x61, 0xa6, 0xa8, 0x10,
+    0xf9, 0x88, 0x33, 0x3f, 0xbf, 0xd8, 0xd4, 0xa2, 0x47, 0x16, 0x7b, 0x97, 0xd0, 0x45, 0xac, 0xaa,
+    0xde, 0x0f, 0x1c, 0x4c, 0x46, 0x91, 0xcb, 0xf4, 0x37, 0x02, 0x39, 0x92, 0xc5, 0xdd, 0x11, 0xaa,
+    0x84, 0x1c, 0x7a, 0x97, 0xa6, 0xd1, 0xa4, 0x28, 0xd4, 0xf8, 0x0c, 0x53, 0xd9, 0x02, 0x5b, 0x8d,
+    0x3f, 0xec, 0xa0, 0xdf, 0x76, 0xfa, 0x84, 0x5e, 0xb1, 0xf8, 0x58, 0x1a, 0xaa, 0x38, 0x9b, 0x53,
+    0xf9, 0x25, 0x5a, 0xb8, 0xf9, 0x04, 0x25, 0xb8, 0x81, 0x7d, 0xe8, 0x18, 0xd8, 0xb9, 0x52, 0xf4,
+    0x2a, 0xb9, 0xcc, 0x94, 0x3a, 0xc4, 0x8d, 0x57, 0xc6, 0x25, 0x2a, 0xdb, 0xe2, 0xb1, 0x73, 0x07,
+    0x14, 0xa3, 0xb2, 0xc9, 0xfd, 0x07, 0x38, 0xa4, 0x18, 0x1d, 0xde, 0x31, 0xc0, 0xa1, 0x5e, 0x15,
+    0x23, 0x6e, 0x27, 0x33, 0xfe, 0xf8, 0x1e, 0x11, 0xeb, 0xf7, 0xb2, 0xb5, 0xde, 0x7d, 0x28, 0xb1,
+    0xdf, 0x22, 0xb3, 0x49, 0xdf, 0x5b, 0x9f, 0xfd, 0x56, 0x38, 0x29, 0x19, 0xae, 0x50, 0x1c, 0xeb,
+    0x0d, 0xd4, 0x16, 0xc7, 0x03, 0x13, 0x8b, 0xbc, 0x63, 0x98, 0x8a, 0xdc, 0x33, 0x6e, 0x27, 0xf0,
+    0xd9, 0x95, 0x01, 0xd6, 0xed, 0x58, 0xd3, 0x56, 0x8b, 0x08, 0x75, 0x51, 0x57, 0x23, 0x95, 0xcf,
+    0x40, 0x16, 0x1d, 0x92, 0x76, 0x74, 0x46, 0x32, 0xef, 0xb9, 0x7a, 0x93, 0xc4, 0xb1, 0x76, 0xac,
+    0xc5, 0xc7, 0x0d, 0x8c, 0x00, 0xef, 0x25, 0xd9, 0xd7, 0x2f, 0xbc, 0x70, 0x07, 0xfc, 0x4e, 0x48,
+    0x14, 0xc0, 0xe8, 0x4b, 0xa5, 0x80, 0xb8, 0x07, 0x15, 0x26, 0x73, 0xb3, 0x3c, 0x50, 0xbf, 0x10,
+    0x52, 0x4f, 0x5e, 0x27, 0xe0, 0x5c, 0x26, 0x40, 0x95, 0x7c, 0x17, 0x85, 0x31, 0x68, 0xe9, 0x53,
+    0xfa, 0x23, 0x7d, 0x97, 0xc7, 0xc1, 0x58, 0xd6, 0x6f, 0x5d, 0xf8, 0xa0, 0x4f, 0x60, 0x7e, 0xa0,
+    0xab, 0xe7, 0xe4, 0xfd, 0x01, 0xb2, 0xb8, 0x9e, 0xae, 0x1f, 0x3e, 0x87, 0x6b, 0xf1, 0xc6, 0xc2,
+    0x47, 0xe3, 0x3a, 0x62, 0x48, 0xe5, 0x92, 0x28, 0x0b, 0xff, 0xc2, 0x9d, 0x62, 0x75, 0x4d, 0x58,
+    0xe4, 0xa3, 0xbc, 0x1c, 0xdd, 0x73, 0x8d, 0xf0, 0x98, 0x37, 0xe8, 0x05, 0xb5, 0x4e, 0x5d, 0x8b,
+    0x28, 0x0c, 0xe2, 0x94, 0x7a, 0x01, 0xcb, 0xc6, 0x38, 0x2c, 0xbf, 0xce, 0xd1, 0x18, 0x02, 0x01,
+    0xc9, 0x1d, 0xe8, 0x74, 0xd9, 0x46, 0x9d, 0x1c, 0x00, 0x79, 0x0f, 0xe2, 0x8c, 0xe4, 0x80, 0x78,
+    0x1d, 0x32, 0x41, 0xe1, 0x95, 0xc7, 0xb8, 0xd1, 0x02, 0xc1, 0xb0, 0x0c, 0xd1, 0x2b, 0x54, 0xba,
+    0xa9, 0x15, 0xfb, 0x9c, 0x4b, 0xe9, 0xfd, 0x7d, 0xf6, 0x8c, 0xfc, 0xc0, 0x56, 0x4b, 0x74, 0x4a,
+    0x0c, 0x16, 0xeb, 0x7c, 0x46, 0x51, 0x19, 0x51, 0x96, 0x91, 0x7b, 0x26, 0x48, 0x01, 0x94, 0xa8,
+    0x63, 0x59, 0xb2, 0x53, 0xb3, 0xa6, 0x51, 0x81, 0xb3, 0x66, 0xc1, 0x62, 0x12, 0x87, 0xc2, 0x6b,
+    0xee, 0x85, 0x64, 0xaf, 0x96, 0x0c, 0xc7, 0xe6, 0xe2, 0xac, 0x94, 0x6a, 0xe2, 0xc7, 0x4a, 0xb2,
+    0xe5, 0xcd, 0x13, 0x55, 0x58, 0x32, 0x9a, 0x53, 0x88, 0x86, 0xca, 0x0b, 0x5c, 0x45, 0xa6, 0x42,
+    0x4f, 0xcd, 0xce, 0x32, 0x48, 0xb3, 0x90, 0x03, 0x92, 0x2c, 0x96, 0xd1, 0x09, 0x26, 0x8f, 0x55,
+    0x4d, 0x5b, 0x03, 0xae, 0x65, 0x9f, 0xff, 0x0c, 0xa4, 0xfc, 0x50, 0x97, 0x4e, 0x97, 0x52, 0x1c,
+    0x27, 0x97, 0x2e, 0xb9, 0x96, 0xa0, 0xf1, 0x53, 0x3a, 0xdc, 0x71, 0x32, 0x28, 0xa3, 0x9d, 0x21,
+    0x2a, 0x1d, 0xe6, 0x76, 0xa5, 0xe8, 0x29, 0x77, 0xe1, 0x85, 0x9f, 0x6f, 0x93, 0xab, 0xac, 0x51,
+    0x0e, 0xd9, 0x62, 0x1f, 0x6a, 0x2e, 0xee, 0x56, 0xed, 0x63, 0xd3, 0xaa, 0x97, 0xbc, 0xe8, 0xdc,
+    0x1a, 0x29, 0x71, 0x4b, 0x5d, 0x12, 0x06, 0x6a, 0xd1, 0x88, 0x38, 0xf2, 0xe2, 0x70, 0xde, 0xb0,
+    0x50, 0x5d, 0xb7, 0x63, 0x99, 0x1c, 0x68, 0x04, 0xee, 0x36, 0x6e, 0x86, 0x34, 0x36, 0x0a, 0x6c,
+    0x63, 0xe3, 0x31, 0x49, 0x66, 0x83, 0x8f, 0xbf, 0xc1, 0x9c, 0x31, 0x24, 0x8d, 0x1f, 0x3e, 0x81,
+    0x12, 0xe8, 0xa7, 0xfd, 0x2e, 0x01, 0x5d, 0x6f, 0x8b, 0x47, 0x67, 0x01, 0x0e, 0xc8, 0xe5, 0x5d,
+    0x53, 0xe5, 0xc5, 0x39, 0xb4, 0x21, 0x33, 0xbc, 0x76, 0x1e, 0xf6, 0x66, 0x71, 0x92, 0xd2, 0xe5,
+    0xf3, 0x23, 0x10, 0xfc, 0xfd, 0x6e, 0xbd, 0x78, 0x55, 0xbc, 0x6d, 0x65, 0x7d, 0xba, 0xca, 0xd6,
+    0x8d, 0x28, 0xc3, 0x3f, 0x2a, 0x16, 0x25, 0x73, 0x20, 0xf8, 0x55, 0x3b, 0x26, 0x0f, 0xfb, 0x20,
+    0x94, 0xee, 0x34, 0x02, 0x5c, 0xf8, 0x0e, 0x06, 0x21, 0x45, 0xd3, 0x3b, 0x0a, 0x37, 0xb2, 0xbb,
+    0x53, 0x17, 0xd6, 0x87, 0x3b, 0x98, 0x7b, 0x7d, 0xea, 0x4d, 0x15, 0xbc, 0xde, 0x0c, 0x09, 0x3b,
+    0xff, 0x1f, 0xa5, 0xbb, 0x8b, 0x21, 0xf6, 0xfd, 0x40, 0x7c, 0x05, 0x18, 0xf1, 0xad, 0x55, 0x9d,
+    0x7b, 0x1d, 0xe3, 0x2d, 0x01, 0x17, 0x2e, 0xb4, 0xd6, 0x1e, 0x1d, 0x0c, 0x6a, 0x9b, 0xb1, 0xbd,
+    0xe3, 0xe4, 0x23, 0x98, 0xd4, 0x43, 0x3b, 0xf4, 0x22, 0x92, 0x46, 0xdd, 0xa7, 0x74, 0x1d, 0x7e,
+    0x74, 0x81, 0x3c, 0x91, 0x26, 0x31, 0x7f, 0x24, 0x0c, 0x00, 0x41, 0xa1, 0xbc, 0x57, 0x42, 0xf6,
+    0xb0, 0x64, 0xb4, 0xf4, 0x65, 0x4e, 0x0e, 0x4e, 0xeb, 0x04, 0x46, 0x14, 0xe2, 0x0a, 0xb8, 0x79,
+    0x7e, 0x60, 0xa6, 0x57, 0x22, 0xb3, 0xf8, 0x6f, 0xb4, 0x8a, 0xe2, 0x09, 0x57, 0x95, 0xde, 0x04,
+    0x6b, 0xf4, 0x3d, 0x6f, 0x00, 0x87, 0xa7, 0xc1, 0x1b, 0x15, 0x7c, 0x23, 0xe4, 0xa5, 0xbe, 0xe6,
+    0x42, 0xbc, 0xa2, 0x88, 0x6b, 0xef, 0x77, 0xe2, 0xb3, 0x31, 0x56, 0xca, 0x96, 0xf1, 0x60, 0xb2,
+    0x48, 0x31, 0x36, 0xc6, 0x72, 0xeb, 0x4c, 0xd7, 0x4f, 0x89, 0xb2, 0x22, 0x60, 0x44, 0xc1, 0xa0,
+    0x6f, 0x3f, 0xe7, 0x4b, 0x43, 0xe9, 0x5a, 0x72, 0xda, 0x4a, 0x82, 0x81, 0x24, 0x2a, 0x51, 0xb7,
+    0xd9, 0x00, 0xbc, 0xd4, 0x87, 0x33, 0x9b, 0xd5, 0x2c, 0x1c, 0x46, 0x7e, 0xff, 0x2e, 0x31, 0x98,
+    0xa3, 0x0f, 0x19, 0xa0, 0xdb, 0x95, 0x22, 0x81, 0x9e, 0xef, 0x2c, 0xee, 0xd9, 0xca, 0x0b, 0x56,
+    0xaf, 0x33, 0x64, 0x57, 0x8a, 0xc6, 0x50, 0xc3, 0x09, 0xa7, 0xe5, 0x6a, 0x6c, 0xbc, 0xc1, 0xa0,
+    0x3c, 0x79, 0x08, 0xde, 0xa3, 0xb3, 0x67, 0xb0, 0xa7, 0xb8, 0x70, 0x4e, 0xba, 0xc8, 0x0b, 0x5b,
+    0xba, 0x22, 0xe9, 0x91, 0xd3, 0x3d, 0xe8, 0x19, 0xf2, 0x1b, 0x87, 0xf5, 0x85, 0xb1, 0x66, 0xa0,
+    0xdc, 0xb4, 0x36, 0xe6, 0x2d, 0xbb, 0xbe, 0x50, 0x07, 0xae, 0x79, 0x29, 0xc9, 0x8e, 0xf1, 0x9f,
+    0xf9, 0x2c, 0x99, 0x80, 0x8c, 0x79, 0xf3, 0xc3, 0xc5, 0xbb, 0x7a, 0xab, 0x36, 0x4a, 0x26, 0xeb,
+    0x81, 0xa4, 0xa2, 0xa5, 0xde, 0x16, 0xb9, 0x45, 0x60, 0x04, 0x17, 0x3a, 0x8a, 0x52, 0x86, 0x3e,
+    0xa1, 0xe2, 0xc5, 0x0a, 0xcf, 0x04, 0x31, 0x2e, 0x11, 0xdb, 0x69, 0xe2, 0x88, 0x59, 0xe8, 0x59,
+    0xad, 0xe2, 0x68, 0xfc, 0x19, 0x9a, 0xe4, 0x0b, 0x7c, 0xd3, 0x5e, 0x6c, 0xf2, 0x4a, 0x71, 0xdf,
+    0x64, 0xac, 0xf4, 0xe4, 0x53, 0x03, 0x85, 0x2f, 0x8b, 0x0b, 0x74, 0xd2, 0x81, 0xb3, 0xd8, 0x2a,
+    0x23, 0xc2, 0xc0, 0x9b, 0xe1, 0x1e, 0xeb, 0x71, 0x0a, 0x58, 0xa0, 0x43, 0xf4, 0xa0, 0x23, 0x23,
+    0x2a, 0xc1, 0x2f, 0xa2, 0x16, 0x48, 0x30, 0xc6, 0xc0, 0x8f, 0xb0, 0x62, 0x19, 0x33, 0x96, 0x1f,
+    0xef, 0x2a, 0x66, 0x5c, 0x18, 0xfc, 0x75, 0xad, 0x40, 0xe3, 0xc9, 0x9a, 0xdf, 0x23, 0x13, 0x4f,
+    0x78, 0xe4, 0xcd, 0x6e, 0xc4, 0x1e, 0x1c, 0x1c, 0xd4, 0xdd, 0x28, 0xcd, 0xed, 0x73, 0xe6, 0x1b,
+    0x90, 0xfc, 0x89, 0x32, 0x91, 0x64, 0xc5, 0xae, 0xfc, 0xc2, 0x1d, 0xe5, 0x48, 0x2a, 0xef, 0xf7,
+    0xff, 0xb4, 0x6b, 0x5b, 0xba, 0x5d, 0x74, 0xa4, 0xa4, 0xe6, 0xc8, 0x98, 0x15, 0x53, 0x6b, 0x2a,
+    0x46, 0x9a, 0x7e, 0x6d, 0x23, 0x6a, 0x80, 0xe7, 0xdc, 0x0a, 0x51, 0xa9, 0x9e, 0x8b, 0x77, 0xe2,
+    0x21, 0x33, 0x9a, 0xc4, 0xcf, 0x45, 0x5c, 0xcd, 0xd3, 0x42, 0x71, 0xbb, 0xee, 0x21, 0x4b, 0x18,
+    0x4b, 0x90, 0x67, 0x17, 0xb4, 0x1a, 0xe1, 0xf1, 0xae, 0x9a, 0xd7, 0xe6, 0xe6, 0x82, 0x6f, 0x22,
+    0xf0, 0x49, 0x67, 0xf8, 0xfb, 0x3c, 0x9c, 0x06, 0xab, 0x38, 0x6f, 0x18, 0x91, 0x22, 0x15, 0x92,
+    0xb4, 0x39, 0xac, 0xd2, 0x17, 0xeb, 0x17, 0xc1, 0x17, 0x60, 0x0a, 0xce, 0xc2, 0x95, 0xda, 0x22,
+    0xe7, 0x5c, 0xce, 0xb7, 0xff, 0x14, 0xc1, 0xab, 0x8c, 0xcb, 0xfc, 0xc6, 0x02, 0x27, 0x98, 0xec,
+    0xcf, 0x59, 0xb2, 0xd0, 0x9a, 0x39, 0x75, 0x13, 0xad, 0x66, 0xc3, 0x82, 0xc0, 0x96, 0x97, 0x1e,
+    0x70, 0x33, 0x26, 0xfc, 0xe2, 0xfa, 0x75, 0xed, 0x9c, 0x7d, 0xd2, 0xec, 0x93, 0xa1, 0x6b, 0x21,
+    0xa7, 0x59, 0xc8, 0x25, 0xe1, 0x92, 0xaf, 0xe0, 0x37, 0x9f, 0xf0, 0x64, 0xa0, 0xaa, 0x44, 0x5d,
+    0x9a, 0xb1, 0x8a, 0x93, 0xc1, 0xb4, 0x53, 0x0d, 0x84, 0x97, 0xe1, 0x96, 0x81, 0x79, 0x66, 0xa2,
+    0xa6, 0xda, 0x88, 0x9f, 0x2b, 0xc7, 0x48, 0xcf, 0xc8, 0x62, 0x8c, 0x77, 0xc5, 0x8e, 0xe1, 0x0e,
+    0xfb, 0x85, 0xe6, 0x2d, 0xae, 0xa4, 0xdc, 0xf5, 0xa2, 0xd2, 0xd1, 0xb6, 0x05, 0xaf, 0xe1, 0x79,
+    0x88, 0x4a, 0xa8, 0x95, 0x3e, 0x1d, 0x7a, 0x87, 0x2b, 0x4f, 0x11, 0x53, 0x2a, 0xef, 0xeb, 0x4c,
+    0xef, 0x72, 0x4f, 0x67, 0x7a, 0xeb, 0xfb, 0x39, 0xbf, 0x2a, 0xfe, 0x90, 0x8b, 0x1c, 0x2b, 0xce,
+    0x2f, 0x84, 0xba, 0xf5, 0x46, 0xc2, 0x4d, 0xbb, 0xa5, 0xfe, 0x40, 0x0c, 0x90, 0xce, 0x49, 0x4f,
+    0xe7, 0x17, 0x90, 0x74, 0x44, 0x52, 0xa3, 0x56, 0x27, 0xb4, 0x76, 0x24, 0xe8, 0x39, 0x7b, 0x87,
+    0xaf, 0x87, 0x5f, 0x45, 0x71, 0xcc, 0xf8, 0xd3, 0x5d, 0x2c, 0xa0, 0x9f, 0x18, 0x71, 0x1b, 0xca,
+    0xb0, 0xd1, 0x38, 0xb9, 0x54, 0x37, 0x04, 0xd6, 0xd5, 0xed, 0xaa, 0xf7, 0x54, 0x65, 0xbe, 0xd1,
+    0x83, 0xc5, 0xea, 0x12, 0x05, 0xb1, 0x8c, 0xaa, 0x28, 0x34, 0xcc, 0x60, 0x63, 0xe9, 0x8e, 0x8a,
+    0x4b, 0x82, 0x49, 0x24, 0x9a, 0x69, 0x86, 0xc5, 0x2e, 0x31, 0xf6, 0x22, 0xdc, 0xaa, 0x56, 0x85,
+    0x1b, 0x59, 0x9f, 0xb2, 0x72, 0x25, 0x27, 0x77, 0x16, 0x82, 0x2a, 0xf0, 0xb7, 0x4e, 0x0f, 0x4f,
+    0x49, 0x39, 0xf8, 0xfc, 0xc5, 0xab, 0x17, 0xef, 0x5e, 0xd4, 0xd9, 0x1d, 0x54, 0xce, 0xd4, 0x69,
+    0x9d, 0x27, 0x28, 0xfd, 0x36, 0x91, 0xc4, 0x76, 0x88, 0x27, 0x3d, 0x0d, 0xce, 0xc5, 0xcc, 0x2f,
+    0x28, 0xbc, 0xb3, 0x32, 0xc2, 0xd7, 0x92, 0xb5, 0xc5, 0x49, 0xb5, 0xdb, 0x6d, 0x17, 0x42, 0x75,
+    0x56, 0x77, 0xdd, 0x40, 0x2a, 0xb9, 0x22, 0x6b, 0xc9, 0x88, 0x7e, 0xc8, 0xc6, 0x97, 0xb5, 0x10,
+    0x38, 0x43, 0xd2, 0xa9, 0x7f, 0x45, 0x10, 0xae, 0x12, 0xc4, 0x9b, 0x9a, 0x98, 0x7d, 0x41, 0x1c,
+    0xa6, 0xea, 0x5d, 0x72, 0x5f, 0xb0, 0x6b, 0x09, 0x63, 0x0b, 0xbb, 0xeb, 0x16, 0xce, 0xb6, 0x26,
+    0x99, 0xd6, 0x68, 0x9c, 0x3b, 0x35, 0xec, 0xb8, 0xe4, 0xed, 0xcb, 0xda, 0xad, 0x07, 0xa5, 0xcc,
+    0xa0, 0x26, 0xc1, 0x45, 0x14, 0xb5, 0xd7, 0xdb, 0x9a, 0xce, 0x13, 0xf9, 0x79, 0x46, 0xa3, 0x00,
+    0xd0, 0x32, 0x42, 0x6a, 0x4d, 0x63, 0x3f, 0x19, 0xd2, 0x5f, 0xa1, 0x0b, 0xe4, 0x78, 0x86, 0xa3,
+    0x81, 0x77, 0x03, 0xa4, 0xf8, 0x89, 0x07, 0x70, 0xcc, 0xb0, 0xd9, 0x0f, 0x61, 0x60, 0xe3, 0x98,
+    0x5f, 0x01, 0x10, 0xaf, 0x65, 0x9b, 0xf0, 0x05, 0x29, 0xc0, 0x9e, 0x66, 0x78, 0x65, 0x00, 0xa2,
+    0xc2, 0x9d, 0x8b, 0x88, 0x56, 0xc0, 0x4b, 0x04, 0xf8, 0x9d, 0x1e, 0x84, 0x0b, 0xfd, 0x0e, 0xe2,
+    0x30, 0x0f, 0xa1, 0x30, 0x37, 0xce, 0xd3, 0x26, 0x27, 0x4f, 0xc3, 0x60, 0xce, 0x40, 0x70, 0xa2,
+    0x23, 0x42, 0xc7, 0x6a, 0x83, 0x2d, 0x8f, 0x23, 0xfd, 0x8a, 0xa9, 0x6b, 0x5b, 0x3f, 0xaf, 0x38,
+    0xd6, 0x19, 0xf8, 0x0e, 0x85, 0x38, 0x5f, 0x5a, 0x01, 0x29, 0xf6, 0x89, 0xcf, 0x89, 0xaa, 0xae,
+    0x78, 0x31, 0x8b, 0x79, 0x2e, 0x64, 0xfa, 0xf8, 0x7f, 0xad, 0xa5, 0x54, 0x8d, 0xd0, 0xc9, 0x3e,
+    0xfa, 0x92, 0x2e, 0xf3, 0x33, 0xf8, 0x85, 0x1a, 0x22, 0xfe, 0x9d, 0xe5, 0xf3, 0xf8, 0xec, 0xff,
+    0x03, 0x88, 0x1e, 0x65, 0xee, 0x9a, 0x15, 0x01, 0x00,
+};
 
 }  // namespace interface
-
@@ -3,16 +3,19 @@
 #include <ArduinoOTA.h>
 #include <OneWire.h>
 #include <DallasTemperature.h>
-#include <time.h>
 
+#include "ConnectivityManager.h"
 #include "HVACController.h"
+#include "LoopMetrics.h"
 #include "SensorManager.h"
 #include "WebInterface.h"
 #include "PowerLog.h"
 #include "PowerLogStorage.h"
 #include "TemperatureLog.h"
+#include "TemperatureProbes.h"
 #include "ScheduleManager.h"
 #include "SettingsStorage.h"
+#include "Temperature.h"
 
 #include "WiFiConfig.h"
 
@@ -23,8 +26,11 @@ using controller::FanSpeed;
 using controller::HVACController;
 using controller::SensorManager;
 using controller::SystemMode;
+using controller::TemperatureProbes;
+using diagnostics::LoopMetrics;
 using interface::WebInterface;
 using logging::PowerLog;
+using network::ConnectivityManager;
 using logging::TemperatureLog;
 using scheduler::ScheduleEntry;
 using scheduler::ScheduledMode;
@@ -37,64 +43,54 @@ constexpr uint8_t kCompressorRelayPin = 16;   // GPIO5 (D0)
 constexpr FanController::Pins kFanPins = {5, 14, 12};  // GPIO5/14/12 (D1/D5/D6)
 constexpr uint8_t kOneWireBusPin = 4;        // GPIO4 (D2)
 
-OneWire oneWire(kOneWireBusPin);
-DallasTemperature dallasSensors(&oneWire);
+constexpr uint8_t kSensorResolutionBits = 12;
 
-DeviceAddress ambientAddress;
-DeviceAddress coilAddress;
-bool hasAmbientSensor = false;
-bool hasCoilSensor = false;
+/** The two probes on the OneWire bus: ambient at index 0, coil at the next one found. */
+class DallasProbeBus : public TemperatureProbes::Bus {
+ public:
+  static_assert(kDisconnected == DEVICE_DISCONNECTED_RAW, "raw sentinel must match the library");
 
-float cachedAmbientC = NAN;
-float cachedCoilC = NAN;
-bool dallasCacheValid = false;
+  explicit DallasProbeBus(uint8_t pin) : oneWire_(pin), dallas_(&oneWire_) {}
 
-void refreshDallasTemperatures() {
-  dallasSensors.requestTemperatures();
-  if (hasAmbientSensor) {
-    float reading = dallasSensors.getTempC(ambientAddress);
-    cachedAmbientC = (reading == DEVICE_DISCONNECTED_C) ? NAN : reading;
-  } else {
-    cachedAmbientC = NAN;
-  }
-  if (hasCoilSensor) {
-    float reading = dallasSensors.getTempC(coilAddress);
-    cachedCoilC = (reading == DEVICE_DISCONNECTED_C) ? NAN : reading;
-  } else {
-    cachedCoilC = NAN;
+  void begin() {
+    dallas_.begin();
+    dallas_.setResolution(kSensorResolutionBits);
+    dallas_.setWaitForConversion(false);
+    hasAmbient_ = dallas_.getAddress(ambientAddress_, 0);
+    hasCoil_ = dallas_.getAddress(coilAddress_, hasAmbient_ ? 1 : 0);
+    conversionMs_ = dallas_.millisToWaitForConversion(kSensorResolutionBits);
   }
-  dallasCacheValid = true;
-}
 
-float readAmbientTemperature() {
-  if (!hasAmbientSensor) {
-    if (!hasCoilSensor) {
-      dallasCacheValid = false;
-    }
-    return NAN;
-  }
-  if (!dallasCacheValid) {
-    refreshDallasTemperatures();
-  }
-  float value = cachedAmbientC;
-  if (!hasCoilSensor) {
-    dallasCacheValid = false;
-  }
-  return value;
-}
+  uint8_t deviceCount() { return dallas_.getDeviceCount(); }
 
-float readCoilTemperature() {
-  if (!hasCoilSensor) {
-    dallasCacheValid = false;
-    return NAN;
+  bool present(TemperatureProbes::Probe probe) const override {
+    return probe == TemperatureProbes::Probe::kAmbient ? hasAmbient_ : hasCoil_;
   }
-  if (!dallasCacheValid) {
-    refreshDallasTemperatures();
+
+  void requestConversion() override { dallas_.requestTemperatures(); }
+
+  unsigned long conversionTimeMs() const override { return conversionMs_; }
+
+  int32_t readRaw(TemperatureProbes::Probe probe) override {
+    return dallas_.getTemp(probe == TemperatureProbes::Probe::kAmbient ? ambientAddress_
+                                                                       : coilAddress_);
   }
-  float value = cachedCoilC;
-  dallasCacheValid = false;
-  return value;
-}
+
+ private:
+  OneWire oneWire_;
+  DallasTemperature dallas_;
+  DeviceAddress ambientAddress_;
+  DeviceAddress coilAddress_;
+  bool hasAmbient_ = false;
+  bool hasCoil_ = false;
+  unsigned long conversionMs_ = 0;
+};
+
+DallasProbeBus probeBus(kOneWireBusPin);
+TemperatureProbes probes(probeBus);
+
+units::CentiCelsius readAmbientTemperature() { return probes.takeAmbient(); }
+units::CentiCelsius readCoilTemperature() { return probes.takeCoil(); }
 
 Compressor compressor(kCompressorRelayPin);
 FanController fan(kFanPins);
@@ -105,7 +101,10 @@ PowerLog powerLog;
 storage::PowerLogStorage powerLogStorage(powerLog);
 SettingsStorage settingsStorage;
 HVACController hvac(compressor, fan, sensors, scheduleManager, temperatureLog, powerLog);
+ConnectivityManager connectivity(WiFiConfig::kSsid, WiFiConfig::kPassword);
+bool otaStarted = false;
 WebInterface webInterface(hvac, scheduleManager, temperatureLog, powerLog, &settingsStorage, 80);
+LoopMetrics loopMetrics;
 
 const PowerLog::ConsumptionRate kConsumptionTable[] = {
     {FanSpeed::kOff, false, 5.0f},   {FanSpeed::kLow, false, 110.0f},
@@ -115,62 +114,36 @@ const PowerLog::ConsumptionRate kConsumptionTable[] = {
 };
 
 const ScheduleEntry kDefaultWeekday[] = {
-    ScheduleEntry(6, 0, 23.0f, ScheduledMode::kCooling),
-    ScheduleEntry(9, 0, 26.0f, ScheduledMode::kCooling),
-    ScheduleEntry(17, 30, 23.5f, ScheduledMode::kCooling),
-    ScheduleEntry(22, 0, 25.0f, ScheduledMode::kIdle),
+    ScheduleEntry(6, 0, units::fromCelsius(23.0f), ScheduledMode::kCooling),
+    ScheduleEntry(9, 0, units::fromCelsius(26.0f), ScheduledMode::kCooling),
+    ScheduleEntry(17, 30, units::fromCelsius(23.5f), ScheduledMode::kCooling),
+    ScheduleEntry(22, 0, units::fromCelsius(25.0f), ScheduledMode::kIdle),
 };
 
 const ScheduleEntry kDefaultWeekend[] = {
-    ScheduleEntry(8, 0, 23.5f, ScheduledMode::kCooling),
-    ScheduleEntry(12, 0, 25.0f, ScheduledMode::kCooling),
-    ScheduleEntry(18, 0, 23.0f, ScheduledMode::kCooling),
-    ScheduleEntry(23, 0, 25.5f, ScheduledMode::kIdle),
+    ScheduleEntry(8, 0, units::fromCelsius(23.5f), ScheduledMode::kCooling),
+    ScheduleEntry(12, 0, units::fromCelsius(25.0f), ScheduledMode::kCooling),
+    ScheduleEntry(18, 0, units::fromCelsius(23.0f), ScheduledMode::kCooling),
+    ScheduleEntry(23, 0, units::fromCelsius(25.5f), ScheduledMode::kIdle),
 };
 
-void connectWiFi() {
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(WiFiConfig::kSsid, WiFiConfig::kPassword);
-  Serial.print(F("Connecting to Wi-Fi"));
-  while (WiFi.status() != WL_CONNECTED) {
-    delay(500);
-    Serial.print('.');
-  }
-  Serial.println();
-  Serial.print(F("Connected: "));
-  Serial.println(WiFi.localIP());
-}
-
-void configureTime() {
-  configTime(0, 0, "pool.ntp.org", "time.nist.gov", "time.google.com");
-  Serial.print(F("Synchronizing time"));
-  time_t now = time(nullptr);
-  while (now < 100000) {
-    delay(500);
-    Serial.print('.');
-    now = time(nullptr);
-  }
-  Serial.println();
-}
-
 void initializeSensors() {
-  dallasSensors.begin();
-  dallasSensors.setResolution(12);
-  hasAmbientSensor = dallasSensors.getAddress(ambientAddress, 0);
-  hasCoilSensor = dallasSensors.getAddress(coilAddress, hasAmbientSensor ? 1 : 0);
+  probeBus.begin();
+  bool hasAmbient = probeBus.present(TemperatureProbes::Probe::kAmbient);
+  bool hasCoil = probeBus.present(TemperatureProbes::Probe::kCoil);
 
-  if (!hasAmbientSensor && !hasCoilSensor) {
+  if (!hasAmbient && !hasCoil) {
     Serial.println(F("No DS18B20 sensors detected on the OneWire bus."));
   } else {
     Serial.print(F("DS18B20 sensors detected: "));
-    Serial.println(dallasSensors.getDeviceCount());
-    if (hasAmbientSensor) {
+    Serial.println(probeBus.deviceCount());
+    if (hasAmbient) {
       Serial.print(F("  Ambient sensor assigned to index 0"));
       Serial.println();
     }
-    if (hasCoilSensor) {
+    if (hasCoil) {
       Serial.print(F("  Coil sensor assigned to index "));
-      Serial.println(hasAmbientSensor ? 1 : 0);
+      Serial.println(hasAmbient ? 1 : 0);
     }
   }
 
@@ -179,38 +152,43 @@ void initializeSensors() {
 }
 
 void logInitialTemperatureReadings() {
-  if (!hasAmbientSensor && !hasCoilSensor) {
+  bool hasAmbient = probeBus.present(TemperatureProbes::Probe::kAmbient);
+  bool hasCoil = probeBus.present(TemperatureProbes::Probe::kCoil);
+  if (!hasAmbient && !hasCoil) {
     Serial.println(F("Initial temperature readings unavailable (no sensors detected)."));
     return;
   }
 
-  refreshDallasTemperatures();
+  // Boot is the one place where waiting for a conversion is acceptable.
+  probes.readNow();
 
-  if (hasAmbientSensor) {
+  if (hasAmbient) {
     Serial.print(F("Initial ambient temperature: "));
-    if (!isnan(cachedAmbientC)) {
-      Serial.print(cachedAmbientC, 2);
+    if (units::isValid(probes.ambient())) {
+      char text[12];
+      units::formatCelsius(probes.ambient(), 2, text, sizeof(text));
+      Serial.print(text);
       Serial.println(F(" °C"));
     } else {
       Serial.println(F("unavailable"));
     }
   }
 
-  if (hasCoilSensor) {
+  if (hasCoil) {
     Serial.print(F("Initial coil temperature: "));
-    if (!isnan(cachedCoilC)) {
-      Serial.print(cachedCoilC, 2);
+    if (units::isValid(probes.coil())) {
+      char text[12];
+      units::formatCelsius(probes.coil(), 2, text, sizeof(text));
+      Serial.print(text);
       Serial.println(F(" °C"));
     } else {
       Serial.println(F("unavailable"));
     }
   }
-
-  dallasCacheValid = false;
 }
 
 void configureSchedule() {
-  scheduleManager.setDefaultTemperature(23.5f);
+  scheduleManager.setDefaultTemperature(units::fromCelsius(23.5f));
   scheduleManager.setWeekdaySchedule(kDefaultWeekday, sizeof(kDefaultWeekday) / sizeof(ScheduleEntry));
   scheduleManager.setWeekendSchedule(kDefaultWeekend, sizeof(kDefaultWeekend) / sizeof(ScheduleEntry));
 }
@@ -218,7 +196,11 @@ void configureSchedule() {
 void configureOta() {
   ArduinoOTA.setHostname("thn-hvac");
 
-  ArduinoOTA.onStart([]() { Serial.println(F("OTA update starting")); });
+  ArduinoOTA.onStart([]() {
+    Serial.println(F("OTA update starting"));
+    // The update ends in a restart; don't lose an edit that is still settling.
+    settingsStorage.flush(hvac, scheduleManager);
+  });
 
   ArduinoOTA.onEnd([]() {
     Serial.println();
@@ -265,9 +247,8 @@ void setup() {
   Serial.println();
   Serial.println(F("HVAC controller booting"));
 
-  connectWiFi();
-  configureOta();
-  configureTime();
+  // Wi-Fi and NTP come up from loop(); the unit is controlled from boot either way.
+  connectivity.begin();
 
   initializeSensors();
   logInitialTemperatureReadings();
@@ -290,27 +271,12 @@ void setup() {
   hvac.setSystemMode(SystemMode::kCooling);
   hvac.setFanMode(FanMode::kAuto);
   hvac.enableScheduling(true);
-  scheduler::ScheduleTarget initialTarget = scheduleManager.targetFor(time(nullptr));
-  hvac.setTargetTemperature(initialTarget.temperature);
-  switch (initialTarget.mode) {
-    case scheduler::ScheduledMode::kCooling:
-      hvac.setSystemMode(SystemMode::kCooling);
-      break;
-    case scheduler::ScheduledMode::kHeating:
-      hvac.setSystemMode(SystemMode::kHeating);
-      break;
-    case scheduler::ScheduledMode::kFanOnly:
-      hvac.setSystemMode(SystemMode::kFanOnly);
-      break;
-    case scheduler::ScheduledMode::kIdle:
-      hvac.setSystemMode(SystemMode::kIdle);
-      break;
-    case scheduler::ScheduledMode::kUnspecified:
-      break;
-  }
-  hvac.setHysteresis(1.0f);
+  // Until NTP sets the clock the unit holds the default target; the schedule
+  // takes over from loop() once the time is known.
+  hvac.setTargetTemperature(scheduleManager.defaultTemperature());
+  hvac.setHysteresis(units::fromCelsius(1.0f));
 
-  if (storageReady) {
+  if (storageReady && settingsStorage.begin()) {
     if (settingsStorage.load(hvac, scheduleManager)) {
       Serial.println(F("Settings restored from storage."));
     } else {
@@ -319,15 +285,39 @@ void setup() {
   }
 
   scheduleManager.update(hvac);
+  hvac.setEventListener([](controller::ControllerEvent event) {
+    webInterface.publishControllerEvent(event);
+  });
   hvac.begin();
 
+  webInterface.setLoopMetrics(&loopMetrics);
   webInterface.begin();
 }
 
 void loop() {
-  ArduinoOTA.handle();
+  const uint32_t loopStart = LoopMetrics::mark();
+  uint32_t mark = loopStart;
+  connectivity.update();
+  if (!otaStarted && connectivity.connected()) {
+    configureOta();
+    otaStarted = true;
+  }
+  mark = loopMetrics.record(LoopMetrics::Stage::kNetwork, mark);
+  if (otaStarted) {
+    ArduinoOTA.handle();
+  }
+  mark = loopMetrics.record(LoopMetrics::Stage::kOta, mark);
+  probes.poll();
+  mark = loopMetrics.record(LoopMetrics::Stage::kSensors, mark);
   scheduleManager.update(hvac);
+  mark = loopMetrics.record(LoopMetrics::Stage::kSchedule, mark);
   hvac.update();
+  mark = loopMetrics.record(LoopMetrics::Stage::kController, mark);
   powerLogStorage.update();
+  mark = loopMetrics.record(LoopMetrics::Stage::kPowerLogStorage, mark);
+  settingsStorage.update(hvac, scheduleManager);
+  mark = loopMetrics.record(LoopMetrics::Stage::kSettingsStorage, mark);
   webInterface.handleClient();
+  loopMetrics.record(LoopMetrics::Stage::kWeb, mark);
+  loopMetrics.finishLoop(loopStart);
 }
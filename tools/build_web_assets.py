@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""Embed the dashboard into the firmware as a gzip-compressed PROGMEM array.
+
+Reads web/index.html, strips indentation and blank lines, gzips the result and
+writes main/WebInterfaceHtml.h together with a strong ETag derived from the
+compressed bytes. Run it after every change to web/index.html:
+
+    python3 tools/build_web_assets.py
+
+Pass --check to verify that the committed header is up to date and that its
+payload decompresses to exactly the minified source.
+"""
+
+import argparse
+import gzip
+import hashlib
+import io
+import pathlib
+import re
+import sys
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+SOURCE = ROOT / "web" / "index.html"
+OUTPUT = ROOT / "main" / "WebInterfaceHtml.h"
+BYTES_PER_LINE = 16
+
+
+def minify(html: str) -> bytes:
+    """Drops leading indentation and blank lines.
+
+    Line breaks are kept so inline JavaScript never depends on automatic
+    semicolon insertion across joined lines.
+    """
+    lines = (line.strip() for line in html.splitlines())
+    return "\n".join(line for line in lines if line).encode("utf-8")
+
+
+def compress(payload: bytes) -> bytes:
+    buffer = io.BytesIO()
+    # mtime=0 keeps the output (and therefore the ETag) reproducible.
+    with gzip.GzipFile(fileobj=buffer, mode="wb", compresslevel=9, mtime=0) as stream:
+        stream.write(payload)
+    return buffer.getvalue()
+
+
+def render_header(compressed: bytes, source_size: int, minified_size: int) -> str:
+    etag = hashlib.sha256(compressed).hexdigest()[:16]
+    rows = []
+    for offset in range(0, len(compressed), BYTES_PER_LINE):
+        chunk = compressed[offset:offset + BYTES_PER_LINE]
+        rows.append("    " + ", ".join(f"0x{byte:02x}" for byte in chunk) + ",")
+    body = "\n".join(rows)
+    return f"""#pragma once
+
+// Generated by tools/build_web_assets.py from web/index.html -- do not edit.
+// Source {source_size} bytes, minified {minified_size} bytes, gzip {len(compressed)} bytes.
+
+#include <pgmspace.h>
+
+namespace interface {{
+
+static constexpr const char *kWebInterfaceHtmlEtag = "\\"{etag}\\"";
+
+static constexpr size_t kWebInterfaceHtmlGzipLength = {len(compressed)};
+
+static const uint8_t kWebInterfaceHtmlGzip[] PROGMEM = {{
+{body}
+}};
+
+}}  // namespace interface
+"""
+
+
+def embedded_payload(header: str) -> bytes:
+    match = re.search(r"kWebInterfaceHtmlGzip\[\] PROGMEM = \{(.*?)\};", header, re.S)
+    if match is None:
+        raise ValueError("gzip array not found in header")
+    return bytes(int(token, 16) for token in re.findall(r"0x([0-9a-f]{2})", match.group(1)))
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--check", action="store_true",
+                        help="verify the generated header instead of writing it")
+    args = parser.parse_args()
+
+    source = SOURCE.read_text(encoding="utf-8")
+    source_size = len(source.encode("utf-8"))
+    minified = minify(source)
+    compressed = compress(minified)
+    header = render_header(compressed, source_size, len(minified))
+
+    if args.check:
+        current = OUTPUT.read_text(encoding="utf-8")
+        if gzip.decompress(embedded_payload(current)) != minified:
+            print(f"{OUTPUT.name}: embedded asset does not match {SOURCE.name}", file=sys.stderr)
+            return 1
+        if current != header:
+            print(f"{OUTPUT.name}: out of date, rerun {pathlib.Path(__file__).name}",
+                  file=sys.stderr)
+            return 1
+        print(f"{OUTPUT.name}: up to date ({len(compressed)} bytes gzip)")
+        return 0
+
+    OUTPUT.write_text(header, encoding="utf-8")
+    print(f"Wrote {OUTPUT.relative_to(ROOT)}: {source_size} -> {len(minified)} -> "
+          f"{len(compressed)} bytes")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())